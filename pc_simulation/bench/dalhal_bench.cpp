@@ -0,0 +1,479 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/*
+ * dalhal_bench - optimized (no sanitizer) benchmark suite for the pc simulation
+ *
+ * runs from the pc_simulation directory (same as the test executable) against
+ * hal/cfg.json, scripts/list.txt, scripts/<name>.txt and bench/scripts/calc.txt
+ *
+ * usage: dalhal_bench [--filter <substr>] [--min-time-ms <ms>] [--label <text>]
+ *                     [--json <results.json>] [--baseline <results.json>] [--max-regression <percent>]
+ *
+ * --json writes machine readable results, store one per commit and give it as --baseline
+ * to a later run to get the relative change per case, the exit code is 2 when any case
+ * got slower than --max-regression percent (default 10)
+ */
+
+#include <DALHAL/Core/Manager/DALHAL_DeviceManager.h>
+#include <DALHAL/Core/Manager/DALHAL_GPIO_Manager.h>
+#include <DALHAL/Core/Types/DALHAL_UID_Path.h>
+#include <DALHAL/Core/Types/DALHAL_CachedDeviceRead.h>
+#include <DALHAL/Core/Types/DALHAL_ZeroCopyString.h>
+#include <DALHAL/Core/JsonConfig/Types/Structures/DALHAL_JSON_Schema_ArrayOfRegistryItems.h>
+#include <DALHAL/Devices/_Registry/DALHAL_DevicesRegistry.h>
+#include <DALHAL/API/DALHAL_CommandExecutor.h>
+#include <DALHAL/API/DALHAL_StringBuilderStreamer.h>
+#include <DALHAL/ScriptEngine/DALHAL_SCRIPT_ENGINE.h>
+#include <DALHAL/ScriptEngine/Parser/DALHAL_SCRIPT_ENGINE_Parser.h>
+#include <DALHAL/ScriptEngine/Parser/DALHAL_SCRIPT_ENGINE_Parser_Expressions.h>
+#include <DALHAL/ScriptEngine/Parser/DALHAL_SCRIPT_ENGINE_Tokenizer.h>
+#include <DALHAL/ScriptEngine/Parser/DALHAL_SCRIPT_ENGINE_TokenArena.h>
+#include <LittleFS_ext.h>
+#include <ArduinoJson.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <io.h>
+#define BENCH_DUP _dup
+#define BENCH_DUP2 _dup2
+#define BENCH_CLOSE _close
+#define BENCH_NULL_DEVICE "NUL"
+#else
+#include <unistd.h>
+#define BENCH_DUP dup
+#define BENCH_DUP2 dup2
+#define BENCH_CLOSE close
+#define BENCH_NULL_DEVICE "/dev/null"
+#endif
+#include <fcntl.h>
+
+using namespace DALHAL;
+
+namespace {
+
+    const char* const BENCH_CFG_FILE = "hal/cfg.json";
+    /** relative to DALHAL_SCRIPT_ENGINE_SCRIPTS_DIRECTORY as that is prepended by the loader */
+    const char* const BENCH_CALC_SCRIPT = "../bench/scripts/calc.txt";
+
+    /** the firmware code logs a lot to stdout on pc, this mutes it while a case runs */
+    class Quiet {
+    public:
+        Quiet() {
+            fflush(stdout);
+            std::cout.flush();
+            savedFd = BENCH_DUP(1);
+            int nullFd = open(BENCH_NULL_DEVICE, O_WRONLY);
+            if (nullFd >= 0) { BENCH_DUP2(nullFd, 1); BENCH_CLOSE(nullFd); }
+        }
+        ~Quiet() {
+            fflush(stdout);
+            std::cout.flush();
+            if (savedFd >= 0) { BENCH_DUP2(savedFd, 1); BENCH_CLOSE(savedFd); }
+        }
+    private:
+        int savedFd;
+    };
+
+    struct BenchResult {
+        std::string name;
+        uint64_t iterations;
+        double nsPerOp;     // median of the samples
+        double nsPerOpMin;
+        bool ok;
+    };
+
+    struct BenchOptions {
+        std::string filter;
+        std::string label;
+        std::string jsonPath;
+        std::string baselinePath;
+        double minTimeMs = 300.0;
+        double maxRegressionPercent = 10.0;
+    };
+
+    class BenchRunner {
+    public:
+        explicit BenchRunner(const BenchOptions& options) : options(options) { }
+
+        /** fn is one operation, returns false on failure (the case is then reported as failed, not timed) */
+        void Run(const std::string& name, const std::function<bool()>& fn) {
+            if (!options.filter.empty() && name.find(options.filter) == std::string::npos) return;
+
+            BenchResult r{name, 0, 0.0, 0.0, true};
+            std::vector<double> samples;
+            {
+                Quiet quiet;
+                r.ok = fn(); // warmup, also catches broken setups before timing them
+                if (r.ok) {
+                    // calibrate a batch size that takes at least ~1 ms
+                    uint64_t batch = 1;
+                    for (;;) {
+                        double ns = TimeBatch(fn, batch, r.ok);
+                        if (!r.ok || ns >= 1e6 || batch >= (1ull << 30)) break;
+                        batch *= (ns < 1e4) ? 16 : 2;
+                    }
+                    const auto deadline = std::chrono::steady_clock::now() + std::chrono::duration<double, std::milli>(options.minTimeMs);
+                    while (r.ok && (samples.size() < 5 || std::chrono::steady_clock::now() < deadline)) {
+                        samples.push_back(TimeBatch(fn, batch, r.ok) / (double)batch);
+                        r.iterations += batch;
+                    }
+                }
+            }
+            if (r.ok && !samples.empty()) {
+                std::sort(samples.begin(), samples.end());
+                r.nsPerOp = samples[samples.size() / 2];
+                r.nsPerOpMin = samples.front();
+            }
+            printf("%-48s %14.1f %14.1f %12llu %s\n", r.name.c_str(), r.nsPerOp, r.nsPerOpMin, (unsigned long long)r.iterations, r.ok ? "" : "FAILED");
+            fflush(stdout);
+            results.push_back(r);
+        }
+
+        void PrintHeader() const {
+            printf("%-48s %14s %14s %12s\n", "case", "ns/op(median)", "ns/op(min)", "iterations");
+        }
+
+        bool WriteJson() const {
+            if (options.jsonPath.empty()) return true;
+            DynamicJsonDocument doc(4096 + results.size() * 256);
+            doc["suite"] = "dalhal_bench";
+            doc["label"] = options.label.c_str();
+#if defined(__clang__)
+            doc["compiler"] = "clang " __clang_version__;
+#elif defined(__GNUC__)
+            doc["compiler"] = "gcc " __VERSION__;
+#endif
+            doc["minTimeMs"] = options.minTimeMs;
+            JsonArray arr = doc.createNestedArray("results");
+            for (const auto& r : results) {
+                JsonObject o = arr.createNestedObject();
+                o["name"] = r.name.c_str();
+                o["ok"] = r.ok;
+                o["iterations"] = r.iterations;
+                o["nsPerOp"] = r.nsPerOp;
+                o["nsPerOpMin"] = r.nsPerOpMin;
+            }
+            std::string out;
+            serializeJsonPretty(doc, out);
+            FILE* f = fopen(options.jsonPath.c_str(), "wb");
+            if (f == nullptr) { printf("could not write %s\n", options.jsonPath.c_str()); return false; }
+            fwrite(out.data(), 1, out.size(), f);
+            fclose(f);
+            printf("\nresults written to %s\n", options.jsonPath.c_str());
+            return true;
+        }
+
+        /** returns false if any case regressed more than allowed compared to the baseline */
+        bool CompareBaseline() const {
+            if (options.baselinePath.empty()) return true;
+            char* contents = nullptr;
+            size_t size = 0;
+            if (LittleFS_ext::load_text_file(options.baselinePath.c_str(), &contents, &size) != LittleFS_ext::FileResult::Success) {
+                printf("could not read baseline %s\n", options.baselinePath.c_str());
+                return false;
+            }
+            DynamicJsonDocument doc(size * 4 + 1024);
+            DeserializationError err = deserializeJson(doc, contents);
+            delete[] contents;
+            if (err) { printf("baseline parse error: %s\n", err.c_str()); return false; }
+
+            bool pass = true;
+            printf("\ncompared to baseline %s (%s)\n", options.baselinePath.c_str(), doc["label"] | "");
+            printf("%-48s %14s %14s %9s\n", "case", "baseline", "current", "change");
+            for (const auto& r : results) {
+                double base = 0.0;
+                for (JsonObject o : doc["results"].as<JsonArray>()) {
+                    if (r.name == (o["name"] | "")) { base = o["nsPerOp"] | 0.0; break; }
+                }
+                if (base <= 0.0 || !r.ok) {
+                    printf("%-48s %14s %14.1f %9s\n", r.name.c_str(), "-", r.nsPerOp, r.ok ? "new" : "FAILED");
+                    if (!r.ok) pass = false;
+                    continue;
+                }
+                double change = (r.nsPerOp - base) * 100.0 / base;
+                bool regressed = change > options.maxRegressionPercent;
+                if (regressed) pass = false;
+                printf("%-48s %14.1f %14.1f %+8.1f%%%s\n", r.name.c_str(), base, r.nsPerOp, change, regressed ? " REGRESSION" : "");
+            }
+            return pass;
+        }
+
+        bool AllOk() const {
+            for (const auto& r : results) if (!r.ok) return false;
+            return true;
+        }
+
+    private:
+        const BenchOptions& options;
+        std::vector<BenchResult> results;
+
+        static double TimeBatch(const std::function<bool()>& fn, uint64_t batch, bool& ok) {
+            auto t0 = std::chrono::steady_clock::now();
+            for (uint64_t i = 0; i < batch; i++) {
+                if (fn() == false) { ok = false; break; }
+            }
+            auto t1 = std::chrono::steady_clock::now();
+            return std::chrono::duration<double, std::nano>(t1 - t0).count();
+        }
+    };
+
+    std::vector<std::string> ScriptFiles() {
+        std::vector<std::string> files;
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(DALHAL_SCRIPT_ENGINE_SCRIPTS_DIRECTORY, ec)) {
+            if (!entry.is_regular_file()) continue;
+            std::string name = entry.path().filename().string();
+            if (name.size() > 4 && name.compare(name.size() - 4, 4, ".txt") == 0 && name != "list.txt") files.push_back(name);
+        }
+        std::sort(files.begin(), files.end());
+        return files;
+    }
+
+    /** fills the list with the given script files (relative to the scripts directory) */
+    void SetScripts(ScriptEngine::ScriptsToLoad& stl, const std::vector<std::string>& files) {
+        stl.InitScriptList((int)files.size());
+        for (size_t i = 0; i < files.size(); i++) stl.scriptFileList[i].Set(files[i].c_str());
+    }
+
+    bool LoadScripts(const std::vector<std::string>& files) {
+        ScriptEngine::ScriptsToLoad stl;
+        SetScripts(stl, files);
+        ScriptEngine::ScriptBlocks::running = false;
+        ScriptEngine::Expressions::CalcStackSizesInit();
+        if (ScriptEngine::ValidateAllActiveScripts(stl) == false) return false;
+        ScriptEngine::Expressions::InitStacks();
+        if (ScriptEngine::ScriptBlocks::LoadAllActiveScripts(stl) == false) return false;
+        ScriptEngine::ScriptBlocks::running = true;
+        return true;
+    }
+
+    bool NoopCommandCallback(const ZeroCopyString&, CmdCbType) { return true; }
+
+}
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        bool hasValue = (i + 1) < argc;
+        if (a == "--filter" && hasValue) options.filter = argv[++i];
+        else if (a == "--label" && hasValue) options.label = argv[++i];
+        else if (a == "--json" && hasValue) options.jsonPath = argv[++i];
+        else if (a == "--baseline" && hasValue) options.baselinePath = argv[++i];
+        else if (a == "--min-time-ms" && hasValue) options.minTimeMs = atof(argv[++i]);
+        else if (a == "--max-regression" && hasValue) options.maxRegressionPercent = atof(argv[++i]);
+        else {
+            printf("usage: dalhal_bench [--filter <substr>] [--min-time-ms <ms>] [--label <text>] [--json <file>] [--baseline <file>] [--max-regression <percent>]\n");
+            return 1;
+        }
+    }
+
+    BenchRunner bench(options);
+
+    // --- cfg: deserialized once, then validated/loaded from the same document ---
+    char* cfgContents = nullptr;
+    size_t cfgSize = 0;
+    if (LittleFS_ext::load_text_file(BENCH_CFG_FILE, &cfgContents, &cfgSize) != LittleFS_ext::FileResult::Success) {
+        printf("could not read %s, dalhal_bench need to run from the pc_simulation directory\n", BENCH_CFG_FILE);
+        return 1;
+    }
+    DynamicJsonDocument cfgDoc(cfgSize * 10);
+    if (deserializeJson(cfgDoc, cfgContents)) {
+        printf("could not parse %s\n", BENCH_CFG_FILE);
+        delete[] cfgContents;
+        return 1;
+    }
+
+    bench.PrintHeader();
+
+    bench.Run("cfg/schema_validate", [&]() {
+        GPIO_manager::ClearAllReservations();
+        bool anyError = false;
+        JsonSchema::SchemaArrayOfRegistryItems::ValidateArrayOfRegistryItems(RootDevicesRegistry, cfgDoc.as<JsonArray>(), "root", anyError);
+        return anyError == false;
+    });
+    bench.Run("cfg/load (validate + create devices)", [&]() {
+        return DeviceManager::ParseJSON(cfgDoc);
+    });
+    // make sure a loaded cfg exists for the rest even if the cases above were filtered out
+    {
+        Quiet quiet;
+        if (DeviceManager::DeviceCount() == 0 && DeviceManager::ParseJSON(cfgDoc) == false) {
+            printf("could not load %s\n", BENCH_CFG_FILE);
+            return 1;
+        }
+    }
+
+    // --- script text ---
+    const std::vector<std::string> allScripts = ScriptFiles();
+    for (const auto& file : allScripts) {
+        std::string path = DALHAL_SCRIPT_ENGINE_SCRIPTS_DIRECTORY + file;
+        bench.Run("script/tokenize/" + file, [path]() {
+            ScriptEngine::TokenArena arena;
+            return ScriptEngine::TokenizeFile(path.c_str(), arena) == LittleFS_ext::FileResult::Success;
+        });
+    }
+    std::vector<std::string> activeScripts;
+    {
+        ScriptEngine::ScriptsToLoad stl; // from scripts/list.txt
+        for (int i = 0; i < stl.scriptFileCount; i++) activeScripts.push_back(stl.scriptFileList[i].ToString());
+    }
+    {
+        Quiet quiet;
+        ScriptEngine::Expressions::CalcStackSizesInit();
+    }
+    for (const auto& file : activeScripts) {
+        std::string path = DALHAL_SCRIPT_ENGINE_SCRIPTS_DIRECTORY + file;
+        bench.Run("script/parse/" + file, [path]() {
+            return ScriptEngine::Parser::ReadAndParseScriptFile(path.c_str(), nullptr);
+        });
+    }
+
+    // --- script runtime ---
+    bool calcLoaded = false;
+    {
+        Quiet quiet;
+        calcLoaded = LoadScripts({BENCH_CALC_SCRIPT});
+    }
+    bench.Run("script/exec/calc (CalcRPN::DoCalc + LogicExecNode)", [calcLoaded]() {
+        if (!calcLoaded) return false;
+        ScriptEngine::ScriptBlocks::Exec();
+        return true;
+    });
+    bench.Run("script/load/list.txt", [&]() {
+        return LoadScripts(activeScripts);
+    });
+    {
+        Quiet quiet;
+        LoadScripts(activeScripts);
+    }
+    bench.Run("script/exec/list.txt", []() {
+        ScriptEngine::ScriptBlocks::Exec();
+        return true;
+    });
+
+    // --- device lookup and reads ---
+    const char* const uids[] = { "var1", "var9", "rgb16", "wr_var", "temps:a:b", "temps:b:c", "hum", "servo", nullptr };
+    std::vector<UIDPath*> paths;
+    for (int i = 0; uids[i] != nullptr; i++) paths.push_back(new UIDPath(uids[i]));
+    bench.Run("device/findDevice (8 paths)", [&]() {
+        for (UIDPath* p : paths) {
+            Device* device = nullptr;
+            if (DeviceManager::findDevice(*p, device) != DeviceFindResult::Success) return false;
+        }
+        return true;
+    });
+    const char* const reads[] = { "var1", "rgb16", "temps:a:b", "hum#humidity", nullptr };
+    for (int i = 0; reads[i] != nullptr; i++) {
+        auto* cdr = new CachedDeviceRead();
+        bool setOk;
+        {
+            Quiet quiet;
+            setOk = cdr->Set(ZeroCopyString(reads[i]));
+        }
+        bench.Run(std::string("device/CachedDeviceRead::ReadSimple/") + reads[i], [cdr, setOk]() {
+            if (!setOk) return false;
+            HALValue val;
+            return cdr->ReadSimple(val) == HALOperationResult::Success;
+        });
+        // intentionally not deleted, the devices it points to live until the end
+    }
+
+    // --- api ---
+    size_t emitted = 0;
+    bench.Run("api/StringBuilderStreamer/DeviceManager::PrintTo", [&]() {
+        StringBuilderStreamer sbs(NoopCommandCallback, [&](const char*, size_t len) { emitted += len; return true; });
+        DeviceManager::PrintTo(sbs);
+        sbs.flush();
+        return true;
+    });
+
+    // --- numbers, formatting and parsing of typical state values ---
+    const float floatValues[] = { 0.0f, 1.0f, 21.5f, -3.25f, 1013.25f, 0.001f, 65.3f, 1234567.0f, 3.14159265f, 100.0f / 3.0f };
+    const uint32_t uintValues[] = { 0, 7, 42, 255, 1023, 65535, 100000, 4294967295UL };
+    bench.Run("number/StringBuilderStreamer::write(uint32_t) x8", [&]() {
+        StringBuilderStreamer sbs(NoopCommandCallback, [&](const char*, size_t len) { emitted += len; return true; });
+        for (uint32_t v : uintValues) sbs.write(v);
+        sbs.flush();
+        return true;
+    });
+    bench.Run("number/StringBuilderStreamer::write_json(float) x10", [&]() {
+        StringBuilderStreamer sbs(NoopCommandCallback, [&](const char*, size_t len) { emitted += len; return true; });
+        for (float v : floatValues) sbs.write_json(v);
+        sbs.flush();
+        return true;
+    });
+    const char* const numberStrings[] = { "0", "42", "-17", "21.5", "1013.25", "0.001", "65535", "3.14159", nullptr };
+    bench.Run("number/HALValue(cstring)::toFloat x8", [&]() {
+        float acc = 0.0f;
+        for (int i = 0; numberStrings[i] != nullptr; i++) acc += HALValue(numberStrings[i]).toFloat();
+        return acc != 0.0f;
+    });
+    bench.Run("number/ZeroCopyString::ConvertStringToNumber x8", [&]() {
+        for (int i = 0; numberStrings[i] != nullptr; i++) {
+            if (ZeroCopyString(numberStrings[i]).ConvertStringToNumber().type == NumberType::INVALID) return false;
+        }
+        return true;
+    });
+
+    const char* const commands[] = {
+        "hal/read/value/var1",
+        "hal/write/value/var2/42",
+        "hal/read/value/temps:a:b",
+        "hal/config/list",
+        nullptr
+    };
+    for (int i = 0; commands[i] != nullptr; i++) {
+        std::string cmd = commands[i];
+        bench.Run("api/CommandExecutor::execute/" + cmd, [cmd]() {
+            ZeroCopyString zcCmd(cmd.c_str()); // execute consumes the view
+            return CommandExecutor::execute(zcCmd, NoopCommandCallback);
+        });
+    }
+
+    bool ok = bench.AllOk();
+    if (bench.WriteJson() == false) ok = false;
+    bool noRegression = bench.CompareBaseline();
+
+    {
+        Quiet quiet;
+        for (UIDPath* p : paths) delete p;
+        DeviceManager::CleanUp();
+    }
+    delete[] cfgContents;
+
+    if (!ok) return 1;
+    return noRegression ? 0 : 2;
+}
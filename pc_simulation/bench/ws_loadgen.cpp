@@ -0,0 +1,843 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/*
+ * ws_loadgen - WebSocket command load generator and latency benchmark
+ *
+ * opens N WebSocket connections to the simulator (or a real device) and replays
+ * a weighted mix of commands, every connection keeps --depth commands in flight
+ * (closed loop), responses are matched in order per connection
+ *
+ * a response is either a single Control (text) message, or a chunked block
+ * (start_chunked, Data (binary) messages, end_chunked) as sent by BlockStreamer,
+ * the latency of a command is from sending it until its response is complete,
+ * for Data responses the time to the first Data message is reported as well
+ *
+ * usage: ws_loadgen [--host <host>] [--port <port>] [--path <path>]
+ *                   [--connections <n>] [--depth <n>] [--duration-s <s>] [--warmup-s <s>]
+ *                   [--requests <n>] [--timeout-ms <ms>] [--seed <n>]
+ *                   [--cmd <name>=<weight>:<command>]... [--mix-file <file>]
+ *                   [--label <text>] [--json <results.json>] [--baseline <results.json>]
+ *                   [--max-regression <percent>] [--max-p99-ms <ms>] [--max-error-rate <percent>]
+ *
+ * in commands {i} is replaced by a running sequence number and {r} by a random 0..99,
+ * a mix file has one "<name> <weight> <command>" per line, # starts a comment
+ *
+ * commands bin/read/<uid#func>, bin/exec/<uid#func> and bin/write/<uid#func>/<value>
+ * are sent as BinaryCommand frames (ReadPath, ExecPath, WritePath) instead of text,
+ * the value is sent as float when it has a '.', as int when negative, as bool for true/false, else as uint
+ *
+ * exit code is 1 when no connection could be made, 2 when a threshold was exceeded
+ * or when p99/throughput regressed more than --max-regression percent (default 10)
+ * compared to the --baseline results
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <winsock2.h>
+#include <ws2tcpip.h>
+typedef SOCKET loadgen_socket_t;
+#define LOADGEN_INVALID_SOCKET INVALID_SOCKET
+#define LOADGEN_POLL WSAPoll
+#define LOADGEN_CLOSE closesocket
+#define LOADGEN_WOULD_BLOCK() (WSAGetLastError() == WSAEWOULDBLOCK)
+#define LOADGEN_SEND_FLAGS 0
+#else
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netdb.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <cerrno>
+typedef int loadgen_socket_t;
+#define LOADGEN_INVALID_SOCKET (-1)
+#define LOADGEN_POLL poll
+#define LOADGEN_CLOSE close
+#define LOADGEN_WOULD_BLOCK() (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+#if defined(MSG_NOSIGNAL)
+#define LOADGEN_SEND_FLAGS MSG_NOSIGNAL
+#else
+#define LOADGEN_SEND_FLAGS 0
+#endif
+#endif
+
+namespace {
+
+    typedef std::chrono::steady_clock Clock;
+
+    struct MixEntry {
+        std::string name;
+        unsigned weight;
+        std::string command;
+    };
+
+    struct Options {
+        std::string host = "127.0.0.1";
+        int port = 82;
+        std::string path = "/";
+        int connections = 4;
+        int depth = 1;
+        double durationS = 10.0;
+        double warmupS = 1.0;
+        uint64_t requests = 0; // 0 = run for durationS
+        double timeoutMs = 5000.0;
+        uint32_t seed = 1;
+        std::vector<MixEntry> mix;
+        std::string label;
+        std::string jsonPath;
+        std::string baselinePath;
+        double maxRegressionPercent = 10.0;
+        double maxP99Ms = 0.0;         // 0 = no limit
+        double maxErrorRatePercent = -1.0; // < 0 = no limit
+    };
+
+    /** xorshift32, deterministic for a given --seed so runs replay the same command sequence */
+    struct Rng {
+        uint32_t s;
+        explicit Rng(uint32_t seed) : s(seed ? seed : 1) { }
+        uint32_t next() { s ^= s << 13; s ^= s >> 17; s ^= s << 5; return s; }
+    };
+
+    struct Stats {
+        std::vector<double> latencyMs;
+        std::vector<double> firstDataMs;
+        uint64_t errors = 0;
+        uint64_t timeouts = 0;
+        uint64_t bytes = 0;
+
+        void add(double ms, double firstData, uint64_t responseBytes, bool error) {
+            latencyMs.push_back(ms);
+            if (firstData >= 0.0) firstDataMs.push_back(firstData);
+            bytes += responseBytes;
+            if (error) errors++;
+        }
+    };
+
+    enum StatsClass { CLASS_CONTROL = 0, CLASS_DATA = 1, CLASS_COUNT = 2 };
+    const char* const CLASS_NAMES[CLASS_COUNT] = { "control", "data" };
+
+    struct InFlight {
+        size_t mixIndex;
+        Clock::time_point sent;
+        double firstDataMs = -1.0;
+        uint64_t bytes = 0;
+        bool sawData = false;
+        bool error = false;
+        bool measured;
+    };
+
+    enum class ConnState { Handshake, Open, Dead };
+
+    struct Connection {
+        loadgen_socket_t fd = LOADGEN_INVALID_SOCKET;
+        ConnState state = ConnState::Dead;
+        std::string in;
+        std::string out;
+        size_t outPos = 0;
+        std::deque<InFlight> inflight;
+        bool inChunked = false;
+        /** opcode of the fragmented message being reassembled, 0 when none */
+        uint8_t msgOpcode = 0;
+        std::string msg;
+    };
+
+    double ElapsedMs(Clock::time_point from, Clock::time_point to) {
+        return std::chrono::duration<double, std::milli>(to - from).count();
+    }
+
+    /** nearest rank percentile of a sorted vector */
+    double Percentile(const std::vector<double>& sorted, double p) {
+        if (sorted.empty()) return 0.0;
+        size_t rank = (size_t)std::ceil(p / 100.0 * (double)sorted.size());
+        if (rank == 0) rank = 1;
+        return sorted[rank - 1];
+    }
+
+    std::string JsonEscape(const std::string& s) {
+        std::string out;
+        for (char c : s) {
+            if (c == '"' || c == '\\') { out += '\\'; out += c; }
+            else if ((unsigned char)c < 0x20) { char buf[8]; snprintf(buf, sizeof(buf), "\\u%04x", c); out += buf; }
+            else out += c;
+        }
+        return out;
+    }
+
+    bool ParseMixEntry(const std::string& name, const std::string& weight, const std::string& command, std::vector<MixEntry>& mix) {
+        int w = atoi(weight.c_str());
+        if (name.empty() || command.empty() || w <= 0) return false;
+        mix.push_back({name, (unsigned)w, command});
+        return true;
+    }
+
+    /** <name>=<weight>:<command> */
+    bool ParseCmdOption(const std::string& arg, std::vector<MixEntry>& mix) {
+        size_t eq = arg.find('=');
+        size_t colon = arg.find(':', eq == std::string::npos ? 0 : eq);
+        if (eq == std::string::npos || colon == std::string::npos) return false;
+        return ParseMixEntry(arg.substr(0, eq), arg.substr(eq + 1, colon - eq - 1), arg.substr(colon + 1), mix);
+    }
+
+    bool LoadMixFile(const std::string& path, std::vector<MixEntry>& mix) {
+        std::ifstream f(path);
+        if (!f) { printf("could not read mix file %s\n", path.c_str()); return false; }
+        std::string line;
+        int lineNo = 0;
+        while (std::getline(f, line)) {
+            lineNo++;
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            size_t first = line.find_first_not_of(" \t");
+            if (first == std::string::npos || line[first] == '#') continue;
+            std::istringstream ss(line);
+            std::string name, weight, command;
+            ss >> name >> weight;
+            std::getline(ss >> std::ws, command);
+            if (!ParseMixEntry(name, weight, command, mix)) {
+                printf("%s:%d: expected <name> <weight> <command>\n", path.c_str(), lineNo);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** the simulator cfg (hal/cfg.json) has var0..var9 as script input variables and var1/var2 as plain ones */
+    void DefaultMix(std::vector<MixEntry>& mix) {
+        mix.push_back({"read", 40, "hal/read/value/var1"});
+        mix.push_back({"write", 25, "hal/write/value/var2/{r}"});
+        mix.push_back({"scriptvar", 25, "hal/write/value/var0/{r}"});
+        mix.push_back({"help", 5, "help"});
+        mix.push_back({"schema", 5, "hal/meta/reg/cfgschema"});
+    }
+
+    std::string ExpandCommand(const std::string& tmpl, uint64_t seq, Rng& rng) {
+        std::string out;
+        for (size_t i = 0; i < tmpl.size(); i++) {
+            if (tmpl.compare(i, 3, "{i}") == 0) { out += std::to_string(seq); i += 2; }
+            else if (tmpl.compare(i, 3, "{r}") == 0) { out += std::to_string(rng.next() % 100); i += 2; }
+            else out += tmpl[i];
+        }
+        return out;
+    }
+
+    /** see DALHAL_BinaryCommand.h, returns false if cmd is not a bin/ command */
+    bool EncodeBinaryCommand(const std::string& cmd, uint16_t requestId, std::string& frame) {
+        if (cmd.compare(0, 4, "bin/") != 0) return false;
+        size_t opEnd = cmd.find('/', 4);
+        if (opEnd == std::string::npos) return false;
+        const std::string op = cmd.substr(4, opEnd - 4);
+        std::string path = cmd.substr(opEnd + 1);
+        std::string value;
+        uint8_t opcode;
+        if (op == "read") opcode = 0x20;
+        else if (op == "exec") opcode = 0x22;
+        else if (op == "write") {
+            opcode = 0x21;
+            size_t valueStart = path.rfind('/');
+            if (valueStart == std::string::npos) return false;
+            const std::string text = path.substr(valueStart + 1);
+            path.resize(valueStart);
+            uint32_t bits;
+            if (text == "true" || text == "false") {
+                value += (char)4;
+                value += (char)(text == "true" ? 1 : 0);
+            } else {
+                if (text.find('.') != std::string::npos) {
+                    float f = strtof(text.c_str(), nullptr);
+                    memcpy(&bits, &f, sizeof(bits));
+                    value += (char)3;
+                } else if (text[0] == '-') {
+                    bits = (uint32_t)(int32_t)strtol(text.c_str(), nullptr, 10);
+                    value += (char)1;
+                } else {
+                    bits = (uint32_t)strtoul(text.c_str(), nullptr, 10);
+                    value += (char)2;
+                }
+                for (int i = 0; i < 4; i++) value += (char)((bits >> (8 * i)) & 0xff);
+            }
+        } else return false;
+        frame.clear();
+        frame += (char)0xDA;
+        frame += (char)opcode;
+        frame += (char)(requestId & 0xff);
+        frame += (char)(requestId >> 8);
+        frame += value;
+        frame += path;
+        return true;
+    }
+
+    /** client to server frames must be masked */
+    void AppendMaskedFrame(std::string& out, uint8_t firstByte, const char* data, size_t len, Rng& rng) {
+        out += (char)firstByte;
+        if (len < 126) {
+            out += (char)(0x80 | len);
+        } else if (len < 65536) {
+            out += (char)(0x80 | 126);
+            out += (char)((len >> 8) & 0xff);
+            out += (char)(len & 0xff);
+        } else {
+            out += (char)(0x80 | 127);
+            for (int i = 7; i >= 0; i--) out += (char)(((uint64_t)len >> (8 * i)) & 0xff);
+        }
+        uint32_t m = rng.next();
+        char mask[4] = { (char)(m >> 24), (char)(m >> 16), (char)(m >> 8), (char)m };
+        out.append(mask, 4);
+        for (size_t i = 0; i < len; i++) out += (char)(data[i] ^ mask[i & 3]);
+    }
+
+    class LoadGenerator {
+    public:
+        explicit LoadGenerator(const Options& options) : options(options), rng(options.seed), perCmd(options.mix.size()) {
+            for (const auto& m : options.mix) totalWeight += m.weight;
+        }
+
+        /** returns false when the initial connections could not be made */
+        bool Run() {
+            conns.resize(options.connections);
+            for (auto& c : conns) {
+                if (!Connect(c, false)) return false;
+            }
+
+            const Clock::time_point start = Clock::now();
+            warmEnd = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(options.warmupS));
+            const Clock::time_point sendEnd = warmEnd + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(options.durationS));
+            const auto timeout = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(options.timeoutMs));
+            lastCompletion = warmEnd;
+
+            std::vector<pollfd> pfds(conns.size());
+            for (;;) {
+                const Clock::time_point now = Clock::now();
+                const bool measuring = now >= warmEnd;
+                bool stopSending = lostTarget || ((options.requests > 0) ? (measuredSent >= options.requests) : (now >= sendEnd));
+
+                bool anyInFlight = false;
+                for (size_t i = 0; i < conns.size(); i++) {
+                    Connection& c = conns[i];
+                    if (c.state == ConnState::Dead && !stopSending && !Connect(c, true)) {
+                        printf("lost connection to %s:%d, stopping\n", options.host.c_str(), options.port);
+                        lostTarget = stopSending = true;
+                    }
+                    if (c.state == ConnState::Open) {
+                        while (!stopSending && c.state == ConnState::Open && (int)c.inflight.size() < options.depth) {
+                            SendNext(c, measuring);
+                            if (options.requests > 0 && measuredSent >= options.requests) stopSending = true;
+                        }
+                        if (!c.inflight.empty() && now - c.inflight.front().sent > timeout) {
+                            Timeout(c);
+                        }
+                    }
+                    if (!c.inflight.empty()) anyInFlight = true;
+                    pfds[i].fd = c.fd;
+                    pfds[i].events = (c.state == ConnState::Dead) ? 0 : (short)(POLLIN | (c.outPos < c.out.size() ? POLLOUT : 0));
+                    pfds[i].revents = 0;
+                    if (c.state == ConnState::Dead) pfds[i].fd = LOADGEN_INVALID_SOCKET;
+                }
+                if (stopSending && !anyInFlight) break;
+
+                int n = LOADGEN_POLL(pfds.data(), (unsigned long)pfds.size(), 10);
+                if (n <= 0) continue;
+                for (size_t i = 0; i < conns.size(); i++) {
+                    Connection& c = conns[i];
+                    if (c.state == ConnState::Dead || pfds[i].revents == 0) continue;
+                    if ((pfds[i].revents & POLLOUT) && !Flush(c)) { Drop(c); continue; }
+                    if (pfds[i].revents & (POLLIN | POLLHUP | POLLERR)) {
+                        if (!Receive(c)) Drop(c);
+                    }
+                }
+            }
+            for (auto& c : conns) {
+                if (c.fd != LOADGEN_INVALID_SOCKET) LOADGEN_CLOSE(c.fd);
+                c.fd = LOADGEN_INVALID_SOCKET;
+            }
+            return true;
+        }
+
+        void PrintSummary() {
+            SortAll();
+            const double elapsedS = ElapsedS();
+            printf("\n%-16s %9s %10s %9s %9s %9s %9s %9s %8s %8s\n", "name", "requests", "req/s", "p50 ms", "p95 ms", "p99 ms", "max ms", "1st data", "errors", "timeouts");
+            auto row = [&](const char* name, const Stats& s) {
+                double maxMs = s.latencyMs.empty() ? 0.0 : s.latencyMs.back();
+                char firstData[16] = "-";
+                if (!s.firstDataMs.empty()) snprintf(firstData, sizeof(firstData), "%.3f", Percentile(s.firstDataMs, 50));
+                printf("%-16s %9zu %10.1f %9.3f %9.3f %9.3f %9.3f %9s %8llu %8llu\n", name, s.latencyMs.size(),
+                       elapsedS > 0 ? (double)s.latencyMs.size() / elapsedS : 0.0,
+                       Percentile(s.latencyMs, 50), Percentile(s.latencyMs, 95), Percentile(s.latencyMs, 99), maxMs,
+                       firstData, (unsigned long long)s.errors, (unsigned long long)s.timeouts);
+            };
+            row("all", all);
+            for (int k = 0; k < CLASS_COUNT; k++) row(CLASS_NAMES[k], classes[k]);
+            for (size_t i = 0; i < perCmd.size(); i++) row(("cmd:" + options.mix[i].name).c_str(), perCmd[i]);
+            printf("\nmeasured %.2f s, %d connections, depth %d, %llu reconnects, %llu unsolicited messages\n",
+                   elapsedS, options.connections, options.depth, (unsigned long long)reconnects, (unsigned long long)unsolicited);
+            fflush(stdout);
+        }
+
+        bool WriteJson() {
+            if (options.jsonPath.empty()) return true;
+            SortAll();
+            const double elapsedS = ElapsedS();
+            std::string out = "{\n";
+            out += "  \"suite\": \"ws_loadgen\",\n";
+            out += "  \"label\": \"" + JsonEscape(options.label) + "\",\n";
+            out += "  \"target\": \"" + JsonEscape(options.host) + ":" + std::to_string(options.port) + "\",\n";
+            char buf[512];
+            snprintf(buf, sizeof(buf), "  \"connections\": %d,\n  \"depth\": %d,\n  \"durationS\": %.3f,\n  \"warmupS\": %.3f,\n  \"requestLimit\": %llu,\n  \"seed\": %u,\n  \"elapsedS\": %.3f,\n  \"reconnects\": %llu,\n  \"unsolicited\": %llu,\n",
+                     options.connections, options.depth, options.durationS, options.warmupS, (unsigned long long)options.requests,
+                     options.seed, elapsedS, (unsigned long long)reconnects, (unsigned long long)unsolicited);
+            out += buf;
+            out += "  \"mix\": [\n";
+            for (size_t i = 0; i < options.mix.size(); i++) {
+                out += "    {\"name\": \"" + JsonEscape(options.mix[i].name) + "\", \"weight\": " + std::to_string(options.mix[i].weight) +
+                       ", \"command\": \"" + JsonEscape(options.mix[i].command) + "\"}" + (i + 1 < options.mix.size() ? ",\n" : "\n");
+            }
+            out += "  ],\n";
+            // one result per line, CompareBaseline relies on that
+            out += "  \"results\": [\n";
+            std::vector<std::pair<std::string, const Stats*>> rows;
+            rows.push_back({"all", &all});
+            for (int k = 0; k < CLASS_COUNT; k++) rows.push_back({CLASS_NAMES[k], &classes[k]});
+            for (size_t i = 0; i < perCmd.size(); i++) rows.push_back({"cmd:" + options.mix[i].name, &perCmd[i]});
+            for (size_t i = 0; i < rows.size(); i++) {
+                const Stats& s = *rows[i].second;
+                snprintf(buf, sizeof(buf),
+                         "\"requests\": %zu, \"throughput\": %.3f, \"p50Ms\": %.4f, \"p95Ms\": %.4f, \"p99Ms\": %.4f, \"maxMs\": %.4f, "
+                         "\"firstDataP50Ms\": %.4f, \"firstDataP99Ms\": %.4f, \"bytes\": %llu, \"errors\": %llu, \"timeouts\": %llu",
+                         s.latencyMs.size(), elapsedS > 0 ? (double)s.latencyMs.size() / elapsedS : 0.0,
+                         Percentile(s.latencyMs, 50), Percentile(s.latencyMs, 95), Percentile(s.latencyMs, 99),
+                         s.latencyMs.empty() ? 0.0 : s.latencyMs.back(),
+                         Percentile(s.firstDataMs, 50), Percentile(s.firstDataMs, 99),
+                         (unsigned long long)s.bytes, (unsigned long long)s.errors, (unsigned long long)s.timeouts);
+                out += "    {\"name\": \"" + JsonEscape(rows[i].first) + "\", " + buf + "}" + (i + 1 < rows.size() ? ",\n" : "\n");
+            }
+            out += "  ]\n}\n";
+            FILE* f = fopen(options.jsonPath.c_str(), "wb");
+            if (f == nullptr) { printf("could not write %s\n", options.jsonPath.c_str()); return false; }
+            fwrite(out.data(), 1, out.size(), f);
+            fclose(f);
+            printf("\nresults written to %s\n", options.jsonPath.c_str());
+            return true;
+        }
+
+        /** returns false if p99 or throughput of any result regressed more than allowed compared to the baseline */
+        bool CompareBaseline() {
+            if (options.baselinePath.empty()) return true;
+            std::ifstream f(options.baselinePath);
+            if (!f) { printf("could not read baseline %s\n", options.baselinePath.c_str()); return false; }
+            SortAll();
+            const double elapsedS = ElapsedS();
+
+            bool pass = true;
+            printf("\ncompared to baseline %s\n", options.baselinePath.c_str());
+            printf("%-16s %14s %14s %9s %14s %14s %9s\n", "name", "base p99 ms", "p99 ms", "change", "base req/s", "req/s", "change");
+            std::string line;
+            while (std::getline(f, line)) {
+                std::string name;
+                if (!JsonLineString(line, "name", name) || line.find("\"p99Ms\"") == std::string::npos) continue;
+                const Stats* s = Find(name);
+                if (s == nullptr || s->latencyMs.empty()) continue;
+                double baseP99 = JsonLineNumber(line, "p99Ms");
+                double baseTput = JsonLineNumber(line, "throughput");
+                double p99 = Percentile(s->latencyMs, 99);
+                double tput = elapsedS > 0 ? (double)s->latencyMs.size() / elapsedS : 0.0;
+                double p99Change = baseP99 > 0 ? (p99 - baseP99) * 100.0 / baseP99 : 0.0;
+                double tputChange = baseTput > 0 ? (tput - baseTput) * 100.0 / baseTput : 0.0;
+                bool regressed = p99Change > options.maxRegressionPercent || -tputChange > options.maxRegressionPercent;
+                if (regressed) pass = false;
+                printf("%-16s %14.3f %14.3f %+8.1f%% %14.1f %14.1f %+8.1f%%%s\n", name.c_str(), baseP99, p99, p99Change,
+                       baseTput, tput, tputChange, regressed ? " REGRESSION" : "");
+            }
+            return pass;
+        }
+
+        /** returns false if --max-p99-ms or --max-error-rate was exceeded */
+        bool CheckThresholds() {
+            SortAll();
+            bool pass = true;
+            const uint64_t total = all.latencyMs.size() + all.timeouts;
+            if (total == 0) {
+                printf("no requests completed\n");
+                return false;
+            }
+            if (options.maxP99Ms > 0.0 && Percentile(all.latencyMs, 99) > options.maxP99Ms) {
+                printf("p99 %.3f ms exceeds --max-p99-ms %.3f\n", Percentile(all.latencyMs, 99), options.maxP99Ms);
+                pass = false;
+            }
+            if (options.maxErrorRatePercent >= 0.0) {
+                double rate = (double)(all.errors + all.timeouts) * 100.0 / (double)total;
+                if (rate > options.maxErrorRatePercent) {
+                    printf("error rate %.2f%% exceeds --max-error-rate %.2f%%\n", rate, options.maxErrorRatePercent);
+                    pass = false;
+                }
+            }
+            return pass;
+        }
+
+    private:
+        const Options& options;
+        Rng rng;
+        unsigned totalWeight = 0;
+        std::vector<Connection> conns;
+        Stats all;
+        Stats classes[CLASS_COUNT];
+        std::vector<Stats> perCmd;
+        uint64_t sequence = 0;
+        uint64_t measuredSent = 0;
+        uint64_t reconnects = 0;
+        uint64_t unsolicited = 0;
+        bool lostTarget = false;
+        Clock::time_point warmEnd;
+        Clock::time_point lastCompletion;
+
+        double ElapsedS() const {
+            double s = ElapsedMs(warmEnd, lastCompletion) / 1000.0;
+            return s > 0 ? s : 0.0;
+        }
+
+        void SortAll() {
+            auto sortStats = [](Stats& s) {
+                std::sort(s.latencyMs.begin(), s.latencyMs.end());
+                std::sort(s.firstDataMs.begin(), s.firstDataMs.end());
+            };
+            sortStats(all);
+            for (auto& s : classes) sortStats(s);
+            for (auto& s : perCmd) sortStats(s);
+        }
+
+        const Stats* Find(const std::string& name) const {
+            if (name == "all") return &all;
+            for (int k = 0; k < CLASS_COUNT; k++) if (name == CLASS_NAMES[k]) return &classes[k];
+            for (size_t i = 0; i < perCmd.size(); i++) if (name == "cmd:" + options.mix[i].name) return &perCmd[i];
+            return nullptr;
+        }
+
+        static bool JsonLineString(const std::string& line, const char* key, std::string& value) {
+            std::string k = std::string("\"") + key + "\": \"";
+            size_t p = line.find(k);
+            if (p == std::string::npos) return false;
+            p += k.size();
+            size_t e = line.find('"', p);
+            if (e == std::string::npos) return false;
+            value = line.substr(p, e - p);
+            return true;
+        }
+
+        static double JsonLineNumber(const std::string& line, const char* key) {
+            std::string k = std::string("\"") + key + "\": ";
+            size_t p = line.find(k);
+            return (p == std::string::npos) ? 0.0 : atof(line.c_str() + p + k.size());
+        }
+
+        bool Connect(Connection& c, bool reconnect) {
+            c = Connection();
+            addrinfo hints{};
+            hints.ai_family = AF_UNSPEC;
+            hints.ai_socktype = SOCK_STREAM;
+            addrinfo* res = nullptr;
+            if (getaddrinfo(options.host.c_str(), std::to_string(options.port).c_str(), &hints, &res) != 0 || res == nullptr) {
+                printf("could not resolve %s\n", options.host.c_str());
+                return false;
+            }
+            loadgen_socket_t fd = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+            bool ok = fd != LOADGEN_INVALID_SOCKET && connect(fd, res->ai_addr, (int)res->ai_addrlen) == 0;
+            freeaddrinfo(res);
+            if (!ok) {
+                if (fd != LOADGEN_INVALID_SOCKET) LOADGEN_CLOSE(fd);
+                if (!reconnect) printf("could not connect to %s:%d\n", options.host.c_str(), options.port);
+                return false;
+            }
+            int yes = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, (const char*)&yes, sizeof(yes));
+#if defined(_WIN32)
+            u_long nonBlocking = 1;
+            ioctlsocket(fd, FIONBIO, &nonBlocking);
+#else
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+#endif
+            if (reconnect) reconnects++;
+            c.fd = fd;
+            c.state = ConnState::Handshake;
+            // the Sec-WebSocket-Accept answer is not verified, so a fixed key is enough here
+            c.out = "GET " + options.path + " HTTP/1.1\r\n"
+                    "Host: " + options.host + "\r\n"
+                    "Upgrade: websocket\r\n"
+                    "Connection: Upgrade\r\n"
+                    "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+                    "Sec-WebSocket-Version: 13\r\n"
+                    "\r\n";
+            return Flush(c);
+        }
+
+        void Drop(Connection& c) {
+            Timeout(c, false);
+            if (c.fd != LOADGEN_INVALID_SOCKET) LOADGEN_CLOSE(c.fd);
+            c.fd = LOADGEN_INVALID_SOCKET;
+            c.state = ConnState::Dead;
+        }
+
+        /** the in order matching is lost after a missing response, so all in flight commands fail and the connection is reopened */
+        void Timeout(Connection& c, bool reopen = true) {
+            for (const auto& f : c.inflight) {
+                if (!f.measured) continue;
+                all.timeouts++;
+                perCmd[f.mixIndex].timeouts++;
+            }
+            c.inflight.clear();
+            if (reopen) {
+                if (c.fd != LOADGEN_INVALID_SOCKET) LOADGEN_CLOSE(c.fd);
+                c.fd = LOADGEN_INVALID_SOCKET;
+                c.state = ConnState::Dead;
+            }
+        }
+
+        void SendNext(Connection& c, bool measuring) {
+            uint32_t pick = rng.next() % totalWeight;
+            size_t idx = 0;
+            while (pick >= options.mix[idx].weight) { pick -= options.mix[idx].weight; idx++; }
+            std::string cmd = ExpandCommand(options.mix[idx].command, sequence, rng);
+            std::string frame;
+            if (EncodeBinaryCommand(cmd, (uint16_t)sequence, frame)) {
+                AppendMaskedFrame(c.out, 0x82, frame.data(), frame.size(), rng);
+            } else {
+                AppendMaskedFrame(c.out, 0x81, cmd.data(), cmd.size(), rng);
+            }
+            sequence++;
+            InFlight f;
+            f.mixIndex = idx;
+            f.sent = Clock::now();
+            f.measured = measuring;
+            c.inflight.push_back(f);
+            if (measuring) measuredSent++;
+            if (!Flush(c)) Drop(c);
+        }
+
+        bool Flush(Connection& c) {
+            while (c.outPos < c.out.size()) {
+                int n = (int)send(c.fd, c.out.data() + c.outPos, (int)(c.out.size() - c.outPos), LOADGEN_SEND_FLAGS);
+                if (n > 0) { c.outPos += (size_t)n; continue; }
+                if (n < 0 && LOADGEN_WOULD_BLOCK()) break;
+                return false;
+            }
+            if (c.outPos == c.out.size()) { c.out.clear(); c.outPos = 0; }
+            return true;
+        }
+
+        bool Receive(Connection& c) {
+            char buffer[65536];
+            for (;;) {
+                int n = (int)recv(c.fd, buffer, (int)sizeof(buffer), 0);
+                if (n > 0) { c.in.append(buffer, (size_t)n); continue; }
+                if (n == 0) return false;
+                if (LOADGEN_WOULD_BLOCK()) break;
+                return false;
+            }
+            if (c.state == ConnState::Handshake) {
+                size_t end = c.in.find("\r\n\r\n");
+                if (end == std::string::npos) return true;
+                if (c.in.compare(0, 12, "HTTP/1.1 101") != 0) {
+                    printf("websocket upgrade refused: %s\n", c.in.substr(0, c.in.find("\r\n")).c_str());
+                    return false;
+                }
+                c.in.erase(0, end + 4);
+                c.state = ConnState::Open;
+            }
+            return ParseFrames(c);
+        }
+
+        bool ParseFrames(Connection& c) {
+            size_t pos = 0;
+            for (;;) {
+                const size_t avail = c.in.size() - pos;
+                if (avail < 2) break;
+                const uint8_t* h = (const uint8_t*)c.in.data() + pos;
+                const bool fin = (h[0] & 0x80) != 0;
+                const uint8_t opcode = h[0] & 0x0f;
+                uint64_t len = h[1] & 0x7f;
+                size_t headerLen = 2;
+                if (len == 126) {
+                    if (avail < 4) break;
+                    len = ((uint64_t)h[2] << 8) | h[3];
+                    headerLen = 4;
+                } else if (len == 127) {
+                    if (avail < 10) break;
+                    len = 0;
+                    for (int i = 0; i < 8; i++) len = (len << 8) | h[2 + i];
+                    headerLen = 10;
+                }
+                if (h[1] & 0x80) headerLen += 4; // servers should not mask, tolerated anyway
+                if (avail < headerLen + len) break;
+                std::string payload(c.in.data() + pos + headerLen, (size_t)len);
+                if (h[1] & 0x80) {
+                    const uint8_t* mask = h + headerLen - 4;
+                    for (size_t i = 0; i < payload.size(); i++) payload[i] ^= (char)mask[i & 3];
+                }
+                pos += headerLen + (size_t)len;
+
+                if (opcode == 0x8) return false; // close
+                if (opcode == 0x9) { AppendMaskedFrame(c.out, 0x8A, payload.data(), payload.size(), rng); continue; }
+                if (opcode == 0xA) continue;
+                if (opcode == 0x0) {
+                    c.msg += payload;
+                    if (!fin) continue;
+                    OnMessage(c, c.msgOpcode, c.msg);
+                    c.msg.clear();
+                    c.msgOpcode = 0;
+                    continue;
+                }
+                if (!fin) { c.msgOpcode = opcode; c.msg = payload; continue; }
+                OnMessage(c, opcode, payload);
+            }
+            c.in.erase(0, pos);
+            return Flush(c);
+        }
+
+        void OnMessage(Connection& c, uint8_t opcode, const std::string& payload) {
+            if (c.inflight.empty()) { unsolicited++; return; } // broadcasts (log entries etc.)
+            InFlight& f = c.inflight.front();
+            const Clock::time_point now = Clock::now();
+            f.bytes += payload.size();
+
+            if (opcode == 0x2 && !payload.empty() && (uint8_t)payload[0] == 0xDB) { // BinaryCommand response, status 0 is Success
+                if (payload.size() < 5 || payload[4] != 0) f.error = true;
+                Complete(c, now);
+                return;
+            }
+            if (opcode == 0x2) { // Data
+                if (!f.sawData) f.firstDataMs = ElapsedMs(f.sent, now);
+                f.sawData = true;
+                if (payload.find("\"error\"") != std::string::npos) f.error = true;
+                return;
+            }
+            if (payload.compare(0, 23, "{\"type\":\"start_chunked\"") == 0) {
+                c.inChunked = true;
+                return;
+            }
+            if (c.inChunked && payload.compare(0, 21, "{\"type\":\"end_chunked\"") != 0) return;
+            if (!c.inChunked && payload.find("\"error\"") != std::string::npos) f.error = true;
+            c.inChunked = false;
+            Complete(c, now);
+        }
+
+        void Complete(Connection& c, Clock::time_point now) {
+            InFlight f = c.inflight.front();
+            c.inflight.pop_front();
+            if (!f.measured) return;
+            const double ms = ElapsedMs(f.sent, now);
+            const int cls = f.sawData ? CLASS_DATA : CLASS_CONTROL;
+            all.add(ms, f.firstDataMs, f.bytes, f.error);
+            classes[cls].add(ms, f.firstDataMs, f.bytes, f.error);
+            perCmd[f.mixIndex].add(ms, f.firstDataMs, f.bytes, f.error);
+            lastCompletion = now;
+        }
+    };
+
+    void PrintUsage() {
+        printf("usage: ws_loadgen [--host <host>] [--port <port>] [--path <path>] [--connections <n>] [--depth <n>]\n"
+               "                  [--duration-s <s>] [--warmup-s <s>] [--requests <n>] [--timeout-ms <ms>] [--seed <n>]\n"
+               "                  [--cmd <name>=<weight>:<command>]... [--mix-file <file>] [--label <text>]\n"
+               "                  [--json <file>] [--baseline <file>] [--max-regression <percent>]\n"
+               "                  [--max-p99-ms <ms>] [--max-error-rate <percent>]\n");
+    }
+
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        bool hasValue = (i + 1) < argc;
+        if (a == "--host" && hasValue) options.host = argv[++i];
+        else if (a == "--port" && hasValue) options.port = atoi(argv[++i]);
+        else if (a == "--path" && hasValue) options.path = argv[++i];
+        else if (a == "--connections" && hasValue) options.connections = atoi(argv[++i]);
+        else if (a == "--depth" && hasValue) options.depth = atoi(argv[++i]);
+        else if (a == "--duration-s" && hasValue) options.durationS = atof(argv[++i]);
+        else if (a == "--warmup-s" && hasValue) options.warmupS = atof(argv[++i]);
+        else if (a == "--requests" && hasValue) options.requests = strtoull(argv[++i], nullptr, 10);
+        else if (a == "--timeout-ms" && hasValue) options.timeoutMs = atof(argv[++i]);
+        else if (a == "--seed" && hasValue) options.seed = (uint32_t)strtoul(argv[++i], nullptr, 10);
+        else if (a == "--label" && hasValue) options.label = argv[++i];
+        else if (a == "--json" && hasValue) options.jsonPath = argv[++i];
+        else if (a == "--baseline" && hasValue) options.baselinePath = argv[++i];
+        else if (a == "--max-regression" && hasValue) options.maxRegressionPercent = atof(argv[++i]);
+        else if (a == "--max-p99-ms" && hasValue) options.maxP99Ms = atof(argv[++i]);
+        else if (a == "--max-error-rate" && hasValue) options.maxErrorRatePercent = atof(argv[++i]);
+        else if (a == "--cmd" && hasValue) {
+            if (!ParseCmdOption(argv[++i], options.mix)) { printf("invalid --cmd %s, expected <name>=<weight>:<command>\n", argv[i]); return 1; }
+        }
+        else if (a == "--mix-file" && hasValue) {
+            if (!LoadMixFile(argv[++i], options.mix)) return 1;
+        }
+        else {
+            PrintUsage();
+            return 1;
+        }
+    }
+    if (options.connections < 1 || options.depth < 1 || options.port <= 0) {
+        PrintUsage();
+        return 1;
+    }
+    if (options.mix.empty()) DefaultMix(options.mix);
+
+#if defined(_WIN32)
+    WSADATA wsaData;
+    if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) { printf("WSAStartup failed\n"); return 1; }
+#else
+    signal(SIGPIPE, SIG_IGN);
+#endif
+
+    printf("ws_loadgen %s:%d, %d connections, depth %d, ", options.host.c_str(), options.port, options.connections, options.depth);
+    if (options.requests > 0) printf("%llu requests", (unsigned long long)options.requests);
+    else printf("%.1f s", options.durationS);
+    printf(" (+%.1f s warmup)\n", options.warmupS);
+    for (const auto& m : options.mix) printf("  %-12s %4u  %s\n", m.name.c_str(), m.weight, m.command.c_str());
+    fflush(stdout);
+
+    LoadGenerator gen(options);
+    bool ran = gen.Run();
+#if defined(_WIN32)
+    WSACleanup();
+#endif
+    if (!ran) return 1;
+
+    gen.PrintSummary();
+    bool ok = gen.WriteJson();
+    if (!gen.CompareBaseline()) ok = false;
+    if (!gen.CheckThresholds()) ok = false;
+    return ok ? 0 : 2;
+}
@@ -0,0 +1,188 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/*
+ * ZeroCopyString scanning microbenchmark
+ * compares the reference byte loops (ZeroCopyStringKernels::Scalar) against the
+ * compile time selected kernels (SSE2/NEON/SWAR) on typical command, uid path,
+ * mqtt topic and script text inputs, and verifies that both give the same results.
+ *
+ * usage: zcs_bench [iterations] [script file ...]
+ */
+
+#include <DALHAL/Core/Types/DALHAL_ZeroCopyString.h>
+#include <DALHAL/Core/Types/DALHAL_ZeroCopyString_Kernels.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace DALHAL;
+namespace K = DALHAL::ZeroCopyStringKernels;
+
+namespace {
+
+    const char* const builtinInputs[] = {
+        "hal/write/value/livingroom:lamp1#brightness/128",
+        "hal/read/value/kitchen:sensors:temperature#value",
+        "hal/exec/livingroom:ledstrip/setColor/255,128,0",
+        "garage:door:motor:position#target",
+        "home/livingroom/lamp1/brightness/set",
+        "homeassistant/sensor/dalhal_esp32_0a1b2c/kitchen_temperature/config",
+        "on livingroom:motion:sensor#state == 1 do\n"
+        "    if kitchen:sensors:temperature > 22.5 and garage:door:state == 0 then\n"
+        "        livingroom:lamp1#brightness = 128\n"
+        "        hal:log:info = \"motion detected, lights on\"\n"
+        "    elseif kitchen:sensors:temperature < 18 then\n"
+        "        livingroom:heater#setpoint = 21\n"
+        "    endif\n"
+        "endon\n",
+        nullptr
+    };
+
+    const char* const keywords[] = { "then", "do", "endif", "endon", "elseif", nullptr };
+
+    volatile uintptr_t sink; // keeps the optimizer from dropping the work
+
+    template<typename F>
+    double TimeNsPerByte(const std::vector<std::string>& inputs, uint32_t iterations, F&& fn) {
+        size_t bytes = 0;
+        for (const auto& s : inputs) bytes += s.size();
+        auto t0 = std::chrono::steady_clock::now();
+        uintptr_t acc = 0;
+        for (uint32_t it = 0; it < iterations; ++it) {
+            for (const auto& s : inputs) acc += fn(s.data(), s.size());
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        sink = acc;
+        double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+        return ns / ((double)bytes * iterations);
+    }
+
+    /** compares each input against an upper cased copy, so the fold is actually exercised */
+    template<typename F>
+    double TimeEqualsIC(const std::vector<std::string>& inputs, uint32_t iterations, F&& fn) {
+        std::vector<std::string> upper(inputs);
+        for (auto& s : upper) for (auto& ch : s) if (ch >= 'a' && ch <= 'z') ch -= 32;
+        size_t bytes = 0;
+        for (const auto& s : inputs) bytes += s.size();
+        auto t0 = std::chrono::steady_clock::now();
+        uintptr_t acc = 0;
+        for (uint32_t it = 0; it < iterations; ++it) {
+            for (size_t i = 0; i < inputs.size(); ++i) acc += fn(inputs[i].data(), upper[i].data(), inputs[i].size());
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        sink = acc;
+        double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+        return ns / ((double)bytes * iterations);
+    }
+
+    uintptr_t ScalarFindAny(const char* p, size_t n) {
+        const char* best = nullptr;
+        for (int i = 0; keywords[i] != nullptr; ++i) {
+            const char* f = K::Scalar::FindString(p, n, keywords[i], std::strlen(keywords[i]));
+            if (f && (!best || f < best)) best = f;
+        }
+        return (uintptr_t)best;
+    }
+    uintptr_t KernelFindAny(const char* p, size_t n) {
+        return (uintptr_t)ZeroCopyString(p, n).FindAnyString(keywords, nullptr, nullptr);
+    }
+
+    bool Verify(const std::vector<std::string>& inputs) {
+        const char chars[] = { ':', '#', '/', '\n', 'e', 'Z', '\x80' };
+        for (const auto& s : inputs) {
+            // every offset and length so the head/word/tail paths are all covered
+            for (size_t off = 0; off < s.size() && off < 24; ++off) {
+                const char* p = s.data() + off;
+                for (size_t n = 0; off + n <= s.size(); ++n) {
+                    for (char c : chars) {
+                        if (K::FindChar(p, n, c) != K::Scalar::FindChar(p, n, c)) { printf("FindChar mismatch off:%zu n:%zu\n", off, n); return false; }
+                        if (K::FindCharReverse(p, n, c) != K::Scalar::FindCharReverse(p, n, c)) { printf("FindCharReverse mismatch off:%zu n:%zu\n", off, n); return false; }
+                        if (K::CountChar(p, n, c) != K::Scalar::CountChar(p, n, c)) { printf("CountChar mismatch off:%zu n:%zu\n", off, n); return false; }
+                    }
+                    std::string upper(p, n);
+                    for (auto& ch : upper) if (ch >= 'a' && ch <= 'z') ch -= 32;
+                    if (!K::EqualsIC(p, upper.data(), n)) { printf("EqualsIC mismatch off:%zu n:%zu\n", off, n); return false; }
+                    if (n > 0) {
+                        upper[n / 2] ^= 0x01;
+                        if (K::EqualsIC(p, upper.data(), n) != K::Scalar::EqualsIC(p, upper.data(), n)) { printf("EqualsIC(neq) mismatch off:%zu n:%zu\n", off, n); return false; }
+                    }
+                    if (KernelFindAny(p, n) != ScalarFindAny(p, n)) { printf("FindAnyString mismatch off:%zu n:%zu\n", off, n); return false; }
+                }
+            }
+        }
+        return true;
+    }
+
+    void Report(const char* name, double scalar, double kernel) {
+        printf("%-16s %10.3f %10.3f %8.2fx\n", name, scalar, kernel, scalar / kernel);
+    }
+
+}
+
+int main(int argc, char** argv) {
+    uint32_t iterations = (argc > 1) ? (uint32_t)strtoul(argv[1], nullptr, 10) : 20000;
+    if (iterations == 0) iterations = 1;
+
+    std::vector<std::string> inputs;
+    for (int i = 0; builtinInputs[i] != nullptr; ++i) inputs.emplace_back(builtinInputs[i]);
+    for (int i = 2; i < argc; ++i) {
+        std::ifstream f(argv[i], std::ios::binary);
+        if (!f) { printf("could not open %s\n", argv[i]); return 1; }
+        std::stringstream ss;
+        ss << f.rdbuf();
+        inputs.push_back(ss.str());
+    }
+
+    if (!Verify(inputs)) { printf("verification FAILED\n"); return 1; }
+
+    printf("kernel: %s, inputs: %zu, iterations: %u\n", DALHAL_ZCS_KERNELS_NAME, inputs.size(), iterations);
+    printf("%-16s %10s %10s %9s\n", "op", "scalar", "kernel", "speedup");
+    printf("%-16s %10s %10s\n", "", "(ns/byte)", "(ns/byte)");
+
+    // the searched chars are mostly absent or late so the whole input is scanned
+    Report("FindChar",
+        TimeNsPerByte(inputs, iterations, [](const char* p, size_t n) { return (uintptr_t)K::Scalar::FindChar(p, n, '$'); }),
+        TimeNsPerByte(inputs, iterations, [](const char* p, size_t n) { return (uintptr_t)ZeroCopyString(p, n).FindChar('$'); }));
+    Report("FindCharReverse",
+        TimeNsPerByte(inputs, iterations, [](const char* p, size_t n) { return (uintptr_t)K::Scalar::FindCharReverse(p, n, '$'); }),
+        TimeNsPerByte(inputs, iterations, [](const char* p, size_t n) { return (uintptr_t)ZeroCopyString(p, n).FindCharReverse('$'); }));
+    Report("CountChar",
+        TimeNsPerByte(inputs, iterations, [](const char* p, size_t n) { return (uintptr_t)K::Scalar::CountChar(p, n, ':'); }),
+        TimeNsPerByte(inputs, iterations, [](const char* p, size_t n) { return (uintptr_t)ZeroCopyString(p, n).CountChar(':'); }));
+    Report("EqualsIC",
+        TimeEqualsIC(inputs, iterations, [](const char* a, const char* b, size_t n) { return (uintptr_t)K::Scalar::EqualsIC(a, b, n); }),
+        TimeEqualsIC(inputs, iterations, [](const char* a, const char* b, size_t n) { return (uintptr_t)ZeroCopyString(a, n).EqualsIC(ZeroCopyString(b, n)); }));
+    Report("FindString",
+        TimeNsPerByte(inputs, iterations, [](const char* p, size_t n) { return (uintptr_t)K::Scalar::FindString(p, n, "endon", 5); }),
+        TimeNsPerByte(inputs, iterations, [](const char* p, size_t n) { return (uintptr_t)ZeroCopyString(p, n).FindString("endon"); }));
+    Report("FindAnyString",
+        TimeNsPerByte(inputs, iterations, ScalarFindAny),
+        TimeNsPerByte(inputs, iterations, KernelFindAny));
+    return 0;
+}
@@ -23,10 +23,15 @@
 
 #include "commandLoop.h"
 
+#include <cstdlib>
+#include <vector>
+
 #include <LittleFS_ext.h>
 #include <DALHAL/Core/Manager/DALHAL_DeviceManager.h>
 #include <DALHAL/ScriptEngine/Parser/DALHAL_SCRIPT_ENGINE_Parser_Tests.h>
 
+#include <DALHAL/Drivers/RF433.h>
+
 #include <DALHAL/Devices/HomeAssistant/Core/DALHAL_HA_DeviceDiscovery.h>
 #include <DALHAL/Devices/HomeAssistant/Core/DALHAL_PubSubClient_JsonWriter.h>
 #include <DALHAL/Devices/HomeAssistant/Core/DALHAL_HA_CountingPubSubClient.h>
@@ -48,6 +53,12 @@ void ParseHelpCommand(DALHAL::ZeroCopyString& zcCmd) {
         } else {
             std::cout << "Available commands: read, write, reloadcfg\n";
         }
+    } else if (zcCmdHelp == "pin") {
+        std::cout << "Format: pin/<pin>/<level> sets a simulated input level (fires attached pin interrupts)\n";
+    } else if (zcCmdHelp == "pulse") {
+        std::cout << "Format: pulse/<pin>/<count>/<optional width us> injects count high pulses on a simulated input\n";
+    } else if (zcCmdHelp == "rf433rec") {
+        std::cout << "prints and clears the pulse train recorded by the RF433 virtual pin backend, including timing error\n";
     } else if (zcCmdHelp == "exit") {
         std::cout << "exits this program\n";
     } else if (zcCmdHelp == "status") {
@@ -56,9 +67,9 @@ void ParseHelpCommand(DALHAL::ZeroCopyString& zcCmd) {
         std::cout << "shows this help\n";
     } else if (zcCmdHelp.NotEmpty()) {
         std::cout << "Unknown help chapter: " << zcCmdHelp.ToString() << "\n";
-        std::cout << "Available chapters: exit, status, help, hal\n";
+        std::cout << "Available chapters: exit, status, help, hal, pin, pulse, rf433rec\n";
     } else {
-        std::cout << "Available commands: exit, status, help, hal\n";
+        std::cout << "Available commands: exit, status, help, hal, pin, pulse, rf433rec\n";
     }
 }
 void exprTestLoad(DALHAL::ZeroCopyString& zcStr) {
@@ -110,6 +121,51 @@ void parseCommand(const char* cmd, bool oneShot) {
         running = false;
     } else if (zcCmdRoot == "status") {
         std::cout << "Status: running\n";
+    } else if (zcCmdRoot == "pin") {
+        DALHAL::NumberResult pinRes = zcCmd.SplitOffHead('/').ConvertStringToNumber();
+        DALHAL::NumberResult levelRes = zcCmd.SplitOffHead('/').ConvertStringToNumber();
+        if (pinRes.type != DALHAL::NumberType::UINT32 || levelRes.type != DALHAL::NumberType::UINT32) {
+            std::cout << "Format: pin/<pin>/<level>\n";
+            return;
+        }
+        SimulateInputLevel(pinRes.u32, levelRes.u32);
+    } else if (zcCmdRoot == "pulse") {
+        DALHAL::NumberResult pinRes = zcCmd.SplitOffHead('/').ConvertStringToNumber();
+        DALHAL::NumberResult countRes = zcCmd.SplitOffHead('/').ConvertStringToNumber();
+        DALHAL::ZeroCopyString zcWidth = zcCmd.SplitOffHead('/');
+        uint32_t widthUs = 100;
+        if (zcWidth.NotEmpty()) {
+            DALHAL::NumberResult widthRes = zcWidth.ConvertStringToNumber();
+            if (widthRes.type == DALHAL::NumberType::UINT32) widthUs = widthRes.u32;
+        }
+        if (pinRes.type != DALHAL::NumberType::UINT32 || countRes.type != DALHAL::NumberType::UINT32) {
+            std::cout << "Format: pulse/<pin>/<count>/<optional width us>\n";
+            return;
+        }
+        for (uint32_t i = 0; i < countRes.u32; i++) {
+            SimulateInputLevel(pinRes.u32, HIGH);
+            delayMicroseconds(widthUs);
+            SimulateInputLevel(pinRes.u32, LOW);
+            delayMicroseconds(widthUs);
+        }
+    } else if (zcCmdRoot == "rf433rec") {
+        std::vector<RF433::SimEdge> edges;
+        RF433::SimTakeRecording(edges);
+        int32_t maxErrorUs = 0;
+        int64_t sumAbsErrorUs = 0;
+        size_t measured = 0;
+        for (size_t i = 0; i + 1 < edges.size(); i++) {
+            if (edges[i].expectedUs == 0) continue; // end of frame
+            int32_t actualUs = (int32_t)(edges[i + 1].timeUs - edges[i].timeUs);
+            int32_t errorUs = actualUs - (int32_t)edges[i].expectedUs;
+            if (std::abs(errorUs) > std::abs(maxErrorUs)) maxErrorUs = errorUs;
+            sumAbsErrorUs += std::abs(errorUs);
+            measured++;
+        }
+        const RF433::TxStats& stats = RF433::GetTxStats();
+        std::cout << "edges: " << edges.size() << ", measured: " << measured;
+        if (measured > 0) std::cout << ", mean abs error: " << (sumAbsErrorUs / (int64_t)measured) << " us, max error: " << maxErrorUs << " us";
+        std::cout << "\nframes queued: " << stats.framesQueued << ", coalesced: " << stats.framesCoalesced << ", dropped: " << stats.framesDropped << ", sent: " << stats.framesSent << "\n";
     } else if (zcCmdRoot == "expr") {
         exprTestLoad(zcCmd);
     } else if (zcCmdRoot == "loadrules" || zcCmdRoot == "lr") {
@@ -157,6 +213,11 @@ void parseCommand(const char* cmd, bool oneShot) {
         std::chrono::duration<double, std::milli> duration = end - start;
 
         std::cout << "Parse time: " << duration.count() << " ms\n";
+    } else if (zcCmdRoot == "ldtok") {
+        DALHAL::ZeroCopyString zcFilePath = zcCmd.SplitOffHead('/');
+        std::cout << "using tokenize compare file:" << zcFilePath.ToString() << "\n";
+        std::string filePath = zcFilePath.ToString();
+        DALHAL::ScriptEngine::Parser::Tests::TokenizeFileTest(filePath.c_str());
     } else if (zcCmdRoot == "ldtest") {
         auto start = std::chrono::high_resolution_clock::now();
         // loads the json HAL config, 
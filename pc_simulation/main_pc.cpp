@@ -33,6 +33,7 @@
 
     #include <DALHAL/Core/Manager/DALHAL_DeviceManager.h>
     #include <DALHAL/API/DALHAL_CommandExecutor.h>
+    #include <DALHAL/API/DALHAL_BinaryCommand.h>
     #include <DALHAL/ScriptEngine/DALHAL_SCRIPT_ENGINE.h>
 #if defined(_WIN32) || defined(__linux__) || defined(__APPLE__) // use this to avoid getting vscode error here
    // #include "ports/DALHAL_REST/DALHAL_REST.h"
@@ -91,6 +92,10 @@
                 DALHAL::CommandExecutor::g_pending.pop();
                 CommandExecutor_UNLOCK_QUEUE();
 
+                if (pr.binary) {
+                    DALHAL::BinaryCommand::Execute(pr.command, pr.clientId, pr.cb);
+                    continue;
+                }
                 DALHAL::ZeroCopyString zcCmd(pr.command.c_str());
                 /*bool ok = */DALHAL::CommandExecutor::execute(zcCmd, pr.cb);
             }
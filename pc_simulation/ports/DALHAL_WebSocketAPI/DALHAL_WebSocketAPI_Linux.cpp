@@ -0,0 +1,698 @@
+/*
+  Dalhalla IoT — Linux Port
+  WebSocket API Implementation for Linux
+
+  One epoll event loop thread serves all clients using non-blocking sockets,
+  every client has its own inbound/outbound buffer so that a slow client
+  never blocks the others, and frames are (de)fragmented according to RFC 6455.
+  Messages from other threads (command callbacks, logger broadcasts) are
+  encoded by the caller and handed to the loop thread through a small outbox.
+
+  Copyright (C) 2026 Jannik Svensson
+  GNU General Public License v3.0 or later
+*/
+
+#if defined(__linux__)
+
+#include "DALHAL_WebSocketAPI_Windows.h"
+#include <iostream>
+#include <atomic>
+#include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <DALHAL/API/DALHAL_WebSocketAPI_httpFile.h>
+
+#include <DALHAL/API/DALHAL_CommandExecutor.h>
+#include <DALHAL/API/DALHAL_BinaryCommand.h>
+
+/** address to listen on, kept local by default (same as the Windows port) */
+#ifndef DALHAL_WS_LINUX_BIND_ADDRESS
+#define DALHAL_WS_LINUX_BIND_ADDRESS "127.0.0.1"
+#endif
+/** outgoing messages larger than this are sent as a fragmented message (first frame + continuation frames) */
+#ifndef DALHAL_WS_LINUX_MAX_FRAME_PAYLOAD
+#define DALHAL_WS_LINUX_MAX_FRAME_PAYLOAD 16384
+#endif
+/** largest accepted incoming message (after reassembly), larger ones close the connection with 1009 */
+#ifndef DALHAL_WS_LINUX_MAX_MESSAGE_SIZE
+#define DALHAL_WS_LINUX_MAX_MESSAGE_SIZE (1024 * 1024)
+#endif
+/** largest HTTP request header accepted before the upgrade */
+#ifndef DALHAL_WS_LINUX_MAX_HTTP_HEADER
+#define DALHAL_WS_LINUX_MAX_HTTP_HEADER 16384
+#endif
+/** pending outgoing bytes per client before it's dropped as a slow consumer */
+#ifndef DALHAL_WS_LINUX_MAX_OUTBOUND
+#define DALHAL_WS_LINUX_MAX_OUTBOUND (4 * 1024 * 1024)
+#endif
+
+namespace DALHAL {
+
+    namespace {
+
+        enum WsOpcode : uint8_t {
+            WS_OP_CONTINUATION = 0x0,
+            WS_OP_TEXT = 0x1,
+            WS_OP_BINARY = 0x2,
+            WS_OP_CLOSE = 0x8,
+            WS_OP_PING = 0x9,
+            WS_OP_PONG = 0xA
+        };
+
+        inline uint32_t rol32(uint32_t v, int n) { return (v << n) | (v >> (32 - n)); }
+
+        /** plain SHA-1, only used for the Sec-WebSocket-Accept handshake value */
+        void sha1(const uint8_t* data, size_t len, uint8_t out[20]) {
+            uint32_t h[5] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 };
+            const uint64_t bitLen = (uint64_t)len * 8;
+            size_t total = ((len + 8) / 64 + 1) * 64;
+            std::vector<uint8_t> msg(total, 0);
+            std::memcpy(msg.data(), data, len);
+            msg[len] = 0x80;
+            for (int i = 0; i < 8; i++) msg[total - 1 - i] = (uint8_t)(bitLen >> (8 * i));
+
+            for (size_t chunk = 0; chunk < total; chunk += 64) {
+                uint32_t w[80];
+                for (int i = 0; i < 16; i++) {
+                    const uint8_t* p = &msg[chunk + i * 4];
+                    w[i] = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+                }
+                for (int i = 16; i < 80; i++) w[i] = rol32(w[i-3] ^ w[i-8] ^ w[i-14] ^ w[i-16], 1);
+                uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+                for (int i = 0; i < 80; i++) {
+                    uint32_t f, k;
+                    if (i < 20)      { f = (b & c) | (~b & d);          k = 0x5A827999; }
+                    else if (i < 40) { f = b ^ c ^ d;                   k = 0x6ED9EBA1; }
+                    else if (i < 60) { f = (b & c) | (b & d) | (c & d); k = 0x8F1BBCDC; }
+                    else             { f = b ^ c ^ d;                   k = 0xCA62C1D6; }
+                    uint32_t t = rol32(a, 5) + f + e + k + w[i];
+                    e = d; d = c; c = rol32(b, 30); b = a; a = t;
+                }
+                h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e;
+            }
+            for (int i = 0; i < 5; i++) {
+                out[i*4 + 0] = (uint8_t)(h[i] >> 24);
+                out[i*4 + 1] = (uint8_t)(h[i] >> 16);
+                out[i*4 + 2] = (uint8_t)(h[i] >> 8);
+                out[i*4 + 3] = (uint8_t)(h[i]);
+            }
+        }
+
+        std::string base64(const uint8_t* data, size_t len) {
+            static const char* b64 = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+            std::string out;
+            out.reserve(((len + 2) / 3) * 4);
+            for (size_t i = 0; i < len; i += 3) {
+                uint32_t n = (uint32_t)data[i] << 16;
+                if (i+1 < len) n |= (uint32_t)data[i+1] << 8;
+                if (i+2 < len) n |= data[i+2];
+                out += b64[(n >> 18) & 63];
+                out += b64[(n >> 12) & 63];
+                out += (i+1 < len) ? b64[(n >> 6) & 63] : '=';
+                out += (i+2 < len) ? b64[n & 63] : '=';
+            }
+            return out;
+        }
+
+        /** server to client frames are never masked */
+        void appendFrame(std::string& out, uint8_t firstByte, const char* data, size_t len) {
+            out += (char)firstByte;
+            if (len < 126) {
+                out += (char)len;
+            } else if (len < 65536) {
+                out += (char)126;
+                out += (char)((len >> 8) & 0xff);
+                out += (char)(len & 0xff);
+            } else {
+                out += (char)127;
+                for (int i = 7; i >= 0; i--) out += (char)(((uint64_t)len >> (8 * i)) & 0xff);
+            }
+            out.append(data, len);
+        }
+
+        /** encodes a complete message, split into continuation frames when larger than DALHAL_WS_LINUX_MAX_FRAME_PAYLOAD */
+        std::string encodeMessage(uint8_t opcode, const char* data, size_t len) {
+            std::string out;
+            out.reserve(len + 14 * (len / DALHAL_WS_LINUX_MAX_FRAME_PAYLOAD + 1));
+            size_t pos = 0;
+            do {
+                size_t chunk = len - pos;
+                if (chunk > DALHAL_WS_LINUX_MAX_FRAME_PAYLOAD) chunk = DALHAL_WS_LINUX_MAX_FRAME_PAYLOAD;
+                bool fin = (pos + chunk) == len;
+                uint8_t op = (pos == 0) ? opcode : (uint8_t)WS_OP_CONTINUATION;
+                appendFrame(out, (uint8_t)((fin ? 0x80 : 0x00) | op), data + pos, chunk);
+                pos += chunk;
+            } while (pos < len);
+            return out;
+        }
+
+        /** case insensitive header lookup in a raw request header block, returns the trimmed value or empty */
+        std::string headerValue(const std::string& header, const char* name) {
+            const size_t nameLen = strlen(name);
+            size_t lineStart = header.find("\r\n");
+            while (lineStart != std::string::npos) {
+                lineStart += 2;
+                size_t lineEnd = header.find("\r\n", lineStart);
+                if (lineEnd == std::string::npos || lineEnd == lineStart) break;
+                if (lineEnd - lineStart > nameLen && header[lineStart + nameLen] == ':' &&
+                    strncasecmp(header.c_str() + lineStart, name, nameLen) == 0) {
+                    size_t v = lineStart + nameLen + 1;
+                    while (v < lineEnd && (header[v] == ' ' || header[v] == '\t')) v++;
+                    size_t e = lineEnd;
+                    while (e > v && (header[e-1] == ' ' || header[e-1] == '\t')) e--;
+                    return header.substr(v, e - v);
+                }
+                lineStart = lineEnd;
+            }
+            return "";
+        }
+
+        bool containsToken(const std::string& value, const char* token) {
+            const size_t tokenLen = strlen(token);
+            for (size_t i = 0; i + tokenLen <= value.size(); i++) {
+                if (strncasecmp(value.c_str() + i, token, tokenLen) == 0) return true;
+            }
+            return false;
+        }
+    }
+
+    // Internal WebSocket Server implementation
+    class WebSocketServer {
+    public:
+        WebSocketServer(int port) : port_(port), running_(false), clientCount_(0), nextClientId_(1) {}
+
+        ~WebSocketServer() {
+            stop();
+        }
+
+        bool start() {
+            if (running_) return false;
+
+            listenFd_ = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+            if (listenFd_ < 0) {
+                std::cerr << "socket failed: " << strerror(errno) << "\n";
+                return false;
+            }
+            int yes = 1;
+            setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+            sockaddr_in serverAddr{};
+            serverAddr.sin_family = AF_INET;
+            serverAddr.sin_addr.s_addr = inet_addr(DALHAL_WS_LINUX_BIND_ADDRESS);
+            serverAddr.sin_port = htons(port_);
+            if (bind(listenFd_, (sockaddr*)&serverAddr, sizeof(serverAddr)) < 0) {
+                std::cerr << "bind to port " << port_ << " failed: " << strerror(errno);
+                if (errno == EACCES) std::cerr << " (ports below 1024 need privileges, set DALHAL_WS_PORT to use another port)";
+                std::cerr << "\n";
+                closeFd(listenFd_);
+                return false;
+            }
+            if (listen(listenFd_, SOMAXCONN) < 0) {
+                std::cerr << "listen failed: " << strerror(errno) << "\n";
+                closeFd(listenFd_);
+                return false;
+            }
+
+            epollFd_ = epoll_create1(EPOLL_CLOEXEC);
+            wakeFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (epollFd_ < 0 || wakeFd_ < 0 || addToEpoll(listenFd_, EPOLLIN) == false || addToEpoll(wakeFd_, EPOLLIN) == false) {
+                std::cerr << "epoll setup failed: " << strerror(errno) << "\n";
+                closeFd(wakeFd_);
+                closeFd(epollFd_);
+                closeFd(listenFd_);
+                return false;
+            }
+
+            std::cout << "WebSocket server (epoll) listening on port " << port_ << std::endl;
+            running_ = true;
+            loopThread_ = std::thread(&WebSocketServer::eventLoop, this);
+            return true;
+        }
+
+        void stop() {
+            if (running_) {
+                running_ = false;
+                wake();
+            }
+            if (loopThread_.joinable()) loopThread_.join();
+
+            // the loop thread is gone, so the client map can be touched from here
+            for (auto& pair : clients_) close(pair.first);
+            clients_.clear();
+            fdById_.clear();
+            clientCount_ = 0;
+            closeFd(wakeFd_);
+            closeFd(epollFd_);
+            closeFd(listenFd_);
+        }
+
+        bool isRunning() const {
+            return running_;
+        }
+
+        int getClientCount() const {
+            return clientCount_;
+        }
+
+        void broadcastMessage(const std::string& msg) {
+            post(-1, encodeMessage(WS_OP_TEXT, msg.data(), msg.size()));
+        }
+
+        void sendToClient(int clientId, const std::string& msg, DALHAL::CmdCbType type) {
+            uint8_t opcode = (type != DALHAL::CmdCbType::Control) ? WS_OP_BINARY : WS_OP_TEXT;
+            post(clientId, encodeMessage(opcode, msg.data(), msg.size()));
+        }
+
+    private:
+        enum class ClientState { Http, WebSocket, Closing };
+
+        struct Client {
+            int fd;
+            int id;
+            std::string ip;
+            ClientState state = ClientState::Http;
+            /** received bytes not yet consumed */
+            std::string in;
+            /** encoded bytes not yet written, starting at outPos */
+            std::string out;
+            size_t outPos = 0;
+            /** EPOLLOUT is currently registered */
+            bool wantWrite = false;
+            /** opcode of the fragmented message being reassembled, 0 when none */
+            uint8_t msgOpcode = 0;
+            std::string msg;
+        };
+
+        struct Outgoing {
+            /** -1 is broadcast to all upgraded clients */
+            int clientId;
+            std::string frames;
+        };
+
+        int port_;
+        std::atomic<bool> running_;
+        std::atomic<int> clientCount_;
+        int listenFd_ = -1;
+        int epollFd_ = -1;
+        int wakeFd_ = -1;
+        std::thread loopThread_;
+        /** clients by fd, only touched by the loop thread */
+        std::unordered_map<int, Client> clients_;
+        std::unordered_map<int, int> fdById_;
+        int nextClientId_;
+        /** the only state shared with other threads, only held while moving already encoded frames */
+        std::mutex outboxMutex_;
+        std::vector<Outgoing> outbox_;
+
+        static void closeFd(int& fd) {
+            if (fd >= 0) close(fd);
+            fd = -1;
+        }
+
+        bool addToEpoll(int fd, uint32_t events) {
+            epoll_event ev{};
+            ev.events = events;
+            ev.data.fd = fd;
+            return epoll_ctl(epollFd_, EPOLL_CTL_ADD, fd, &ev) == 0;
+        }
+
+        void wake() {
+            if (wakeFd_ < 0) return;
+            uint64_t one = 1;
+            ssize_t r = write(wakeFd_, &one, sizeof(one));
+            (void)r;
+        }
+
+        void post(int clientId, std::string&& frames) {
+            {
+                std::lock_guard<std::mutex> lock(outboxMutex_);
+                outbox_.push_back({clientId, std::move(frames)});
+            }
+            wake();
+        }
+
+        void eventLoop() {
+            epoll_event events[128];
+            std::vector<int> toClose;
+            while (running_) {
+                int n = epoll_wait(epollFd_, events, 128, 500);
+                if (n < 0) {
+                    if (errno == EINTR) continue;
+                    std::cerr << "epoll_wait failed: " << strerror(errno) << "\n";
+                    break;
+                }
+                for (int i = 0; i < n; i++) {
+                    const int fd = events[i].data.fd;
+                    const uint32_t ev = events[i].events;
+                    if (fd == listenFd_) { acceptAll(); continue; }
+                    if (fd == wakeFd_) { drainOutbox(toClose); continue; }
+
+                    auto it = clients_.find(fd);
+                    if (it == clients_.end()) continue;
+                    Client& c = it->second;
+                    bool keep = true;
+                    if (ev & EPOLLIN) keep = onReadable(c);
+                    if (keep && (ev & EPOLLOUT)) keep = flush(c);
+                    if (keep && (ev & (EPOLLERR | EPOLLHUP)) && !(ev & EPOLLIN)) keep = false;
+                    if (!keep) toClose.push_back(fd);
+                }
+                for (int fd : toClose) closeClient(fd);
+                toClose.clear();
+            }
+        }
+
+        void acceptAll() {
+            for (;;) {
+                sockaddr_in clientAddr{};
+                socklen_t clientAddrLen = sizeof(clientAddr);
+                int fd = accept4(listenFd_, (sockaddr*)&clientAddr, &clientAddrLen, SOCK_NONBLOCK | SOCK_CLOEXEC);
+                if (fd < 0) {
+                    if (errno == EINTR) continue;
+                    if (errno != EAGAIN && errno != EWOULDBLOCK) std::cerr << "accept failed: " << strerror(errno) << "\n";
+                    return;
+                }
+                int yes = 1;
+                setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+                if (addToEpoll(fd, EPOLLIN | EPOLLRDHUP) == false) {
+                    close(fd);
+                    continue;
+                }
+                Client& c = clients_[fd];
+                c.fd = fd;
+                c.id = nextClientId_++;
+                c.ip = inet_ntoa(clientAddr.sin_addr);
+                fdById_[c.id] = fd;
+                clientCount_++;
+#if defined(DALHAL_WS_LINUX_VERBOSE)
+                std::cout << "Client #" << c.id << " connected from " << c.ip << std::endl;
+#endif
+            }
+        }
+
+        void closeClient(int fd) {
+            auto it = clients_.find(fd);
+            if (it == clients_.end()) return;
+#if defined(DALHAL_WS_LINUX_VERBOSE)
+            std::cout << "Client #" << it->second.id << " disconnected\n";
+#endif
+            epoll_ctl(epollFd_, EPOLL_CTL_DEL, fd, nullptr);
+            close(fd);
+            // queued behind the client's pending frames, releases its BinaryCommand handles
+            CommandExecutor_LOCK_QUEUE();
+            CommandExecutor::g_pending.push({ std::string(), nullptr, true, (uint32_t)it->second.id });
+            CommandExecutor_UNLOCK_QUEUE();
+            fdById_.erase(it->second.id);
+            clients_.erase(it);
+            clientCount_--;
+        }
+
+        void drainOutbox(std::vector<int>& toClose) {
+            uint64_t count;
+            while (read(wakeFd_, &count, sizeof(count)) > 0) { }
+
+            std::vector<Outgoing> pending;
+            {
+                std::lock_guard<std::mutex> lock(outboxMutex_);
+                pending.swap(outbox_);
+            }
+            for (auto& o : pending) {
+                if (o.clientId == -1) {
+                    for (auto& pair : clients_) {
+                        if (pair.second.state != ClientState::WebSocket) continue;
+                        if (queue(pair.second, o.frames.data(), o.frames.size()) == false) toClose.push_back(pair.first);
+                    }
+                    continue;
+                }
+                auto idIt = fdById_.find(o.clientId);
+                if (idIt == fdById_.end()) continue; // client already gone
+                Client& c = clients_[idIt->second];
+                if (c.state != ClientState::WebSocket) continue;
+                if (queue(c, o.frames.data(), o.frames.size()) == false) toClose.push_back(c.fd);
+            }
+        }
+
+        bool onReadable(Client& c) {
+            char buffer[16384];
+            for (;;) {
+                ssize_t n = recv(c.fd, buffer, sizeof(buffer), 0);
+                if (n > 0) {
+                    if (c.state != ClientState::Closing) c.in.append(buffer, (size_t)n);
+                    if ((size_t)n < sizeof(buffer)) break;
+                    continue;
+                }
+                if (n == 0) return false; // disconnected
+                if (errno == EINTR) continue;
+                if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+                return false;
+            }
+            if (c.state == ClientState::Http && handleHttp(c) == false) return false;
+            if (c.state == ClientState::WebSocket && handleFrames(c) == false) return false;
+            return true;
+        }
+
+        bool handleHttp(Client& c) {
+            size_t headerEnd = c.in.find("\r\n\r\n");
+            if (headerEnd == std::string::npos) {
+                return c.in.size() <= DALHAL_WS_LINUX_MAX_HTTP_HEADER;
+            }
+            std::string header = c.in.substr(0, headerEnd + 2);
+            c.in.erase(0, headerEnd + 4);
+
+            std::string key = headerValue(header, "Sec-WebSocket-Key");
+            if (containsToken(headerValue(header, "Upgrade"), "websocket") && !key.empty()) {
+                std::string acceptSrc = key + "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+                uint8_t digest[20];
+                sha1((const uint8_t*)acceptSrc.data(), acceptSrc.size(), digest);
+                std::string response =
+                    "HTTP/1.1 101 Switching Protocols\r\n"
+                    "Upgrade: websocket\r\n"
+                    "Connection: Upgrade\r\n"
+                    "Sec-WebSocket-Accept: " + base64(digest, sizeof(digest)) + "\r\n"
+                    "\r\n";
+                c.state = ClientState::WebSocket;
+                return queue(c, response.data(), response.size());
+            }
+
+            // plain http, serve the console page and close after it's written
+            const size_t len = strlen(HTML_WS_CONSOLE);
+            std::string response = "HTTP/1.1 200 OK\r\n";
+            response += "Content-Length: " + std::to_string(len) + "\r\n";
+            response += "Content-Type: text/html\r\nConnection: close\r\n\r\n";
+            response.append(HTML_WS_CONSOLE, len);
+            c.state = ClientState::Closing;
+            c.in.clear();
+            return queue(c, response.data(), response.size());
+        }
+
+        bool closeWithStatus(Client& c, uint16_t status) {
+            char payload[2] = { (char)(status >> 8), (char)(status & 0xff) };
+            std::string frame;
+            appendFrame(frame, 0x80 | WS_OP_CLOSE, payload, sizeof(payload));
+            c.state = ClientState::Closing;
+            c.in.clear();
+            return queue(c, frame.data(), frame.size());
+        }
+
+        /** parses all complete frames in c.in, partial frames stay buffered until the rest arrives */
+        bool handleFrames(Client& c) {
+            size_t pos = 0;
+            while (c.state == ClientState::WebSocket) {
+                const size_t avail = c.in.size() - pos;
+                if (avail < 2) break;
+                const uint8_t* h = (const uint8_t*)c.in.data() + pos;
+                const bool fin = (h[0] & 0x80) != 0;
+                const uint8_t opcode = h[0] & 0x0f;
+                const bool masked = (h[1] & 0x80) != 0;
+                uint64_t len = h[1] & 0x7f;
+                size_t headerLen = 2;
+                if (len == 126) {
+                    if (avail < 4) break;
+                    len = ((uint64_t)h[2] << 8) | h[3];
+                    headerLen = 4;
+                } else if (len == 127) {
+                    if (avail < 10) break;
+                    len = 0;
+                    for (int i = 0; i < 8; i++) len = (len << 8) | h[2 + i];
+                    headerLen = 10;
+                }
+                if ((h[0] & 0x70) != 0 || !masked) return closeWithStatus(c, 1002); // no extensions, client frames must be masked
+                if (len > DALHAL_WS_LINUX_MAX_MESSAGE_SIZE) return closeWithStatus(c, 1009);
+                headerLen += 4;
+                if (avail < headerLen + len) break;
+
+                const uint8_t* mask = h + headerLen - 4;
+                char* payload = &c.in[pos + headerLen];
+                for (size_t i = 0; i < len; i++) payload[i] ^= (char)mask[i & 3];
+                pos += headerLen + (size_t)len;
+
+                if (opcode >= 0x8) {
+                    // control frames, allowed in between the fragments of a message
+                    if (!fin || len > 125) return closeWithStatus(c, 1002);
+                    if (opcode == WS_OP_CLOSE) {
+                        uint16_t status = (len >= 2) ? (uint16_t)(((uint8_t)payload[0] << 8) | (uint8_t)payload[1]) : 1000;
+                        return closeWithStatus(c, status);
+                    }
+                    if (opcode == WS_OP_PING) {
+                        std::string pong;
+                        appendFrame(pong, 0x80 | WS_OP_PONG, payload, (size_t)len);
+                        if (queue(c, pong.data(), pong.size()) == false) return false;
+                    }
+                    continue; // pong or unknown control frame, ignored
+                }
+                if (opcode == WS_OP_CONTINUATION) {
+                    if (c.msgOpcode == 0) return closeWithStatus(c, 1002);
+                    if (c.msg.size() + len > DALHAL_WS_LINUX_MAX_MESSAGE_SIZE) return closeWithStatus(c, 1009);
+                    c.msg.append(payload, (size_t)len);
+                    if (fin) {
+                        dispatch(c, c.msgOpcode, std::move(c.msg));
+                        c.msg.clear();
+                        c.msgOpcode = 0;
+                    }
+                    continue;
+                }
+                if (opcode != WS_OP_TEXT && opcode != WS_OP_BINARY) return closeWithStatus(c, 1002);
+                if (c.msgOpcode != 0) return closeWithStatus(c, 1002); // new message before the previous one was finished
+                if (fin) {
+                    dispatch(c, opcode, std::string(payload, (size_t)len));
+                } else {
+                    c.msgOpcode = opcode;
+                    c.msg.assign(payload, (size_t)len);
+                }
+            }
+            if (pos > 0 && c.state == ClientState::WebSocket) c.in.erase(0, pos);
+            return true;
+        }
+
+        void dispatch(Client& c, uint8_t opcode, std::string&& message) {
+            if (message.empty()) return;
+            const bool binary = (opcode == WS_OP_BINARY);
+            if (binary && BinaryCommand::IsFrame((const uint8_t*)message.data(), message.size()) == false) return; // no uploads on this port
+#if defined(DALHAL_WS_LINUX_VERBOSE)
+            std::cout << "Client #" << c.id << " RX: " << message << std::endl;
+#endif
+            const int clientId = c.id;
+            CommandExecutor_LOCK_QUEUE();
+            CommandExecutor::g_pending.push({
+                std::move(message),
+                [clientId, this](const ZeroCopyString& body, CmdCbType type) -> bool {
+                    sendToClient(clientId, body.ToString(), type);
+                    return true;
+                },
+                binary,
+                (uint32_t)clientId
+            });
+            CommandExecutor_UNLOCK_QUEUE();
+        }
+
+        /** appends to the client outbound buffer and writes as much as the socket takes right away */
+        bool queue(Client& c, const char* data, size_t len) {
+            if ((c.out.size() - c.outPos) + len > DALHAL_WS_LINUX_MAX_OUTBOUND) {
+                std::cerr << "Client #" << c.id << " dropped, outbound buffer full (slow consumer)\n";
+                return false;
+            }
+            c.out.append(data, len);
+            return flush(c);
+        }
+
+        bool flush(Client& c) {
+            while (c.outPos < c.out.size()) {
+                ssize_t n = send(c.fd, c.out.data() + c.outPos, c.out.size() - c.outPos, MSG_NOSIGNAL);
+                if (n > 0) { c.outPos += (size_t)n; continue; }
+                if (n < 0 && errno == EINTR) continue;
+                if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+                return false;
+            }
+            if (c.outPos == c.out.size()) {
+                c.out.clear();
+                c.outPos = 0;
+            } else if (c.outPos > 65536 && c.outPos * 2 > c.out.size()) {
+                c.out.erase(0, c.outPos); // keep the buffer from growing while a client is slowly draining it
+                c.outPos = 0;
+            }
+            const bool pending = !c.out.empty();
+            if (pending != c.wantWrite) {
+                epoll_event ev{};
+                ev.events = EPOLLIN | EPOLLRDHUP | (pending ? EPOLLOUT : 0);
+                ev.data.fd = c.fd;
+                epoll_ctl(epollFd_, EPOLL_CTL_MOD, c.fd, &ev);
+                c.wantWrite = pending;
+            }
+            if (!pending && c.state == ClientState::Closing) return false; // everything is written, close now
+            return true;
+        }
+    };
+
+    // Static members
+    std::unique_ptr<WebSocketServer> WebSocketAPI::server = nullptr;
+    std::mutex WebSocketAPI::serverMutex;
+
+    void WebSocketAPI::setup(int port) {
+        std::lock_guard<std::mutex> lock(serverMutex);
+        if (!server) {
+            // allows running unprivileged (the default port is below 1024) and several instances side by side
+            const char* envPort = getenv("DALHAL_WS_PORT");
+            if (envPort != nullptr && atoi(envPort) > 0) port = atoi(envPort);
+            server = std::make_unique<WebSocketServer>(port);
+            server->start();
+        }
+    }
+
+    void WebSocketAPI::shutdown() {
+        std::lock_guard<std::mutex> lock(serverMutex);
+        if (server) {
+            server->stop();
+            server.reset();
+        }
+    }
+
+    bool WebSocketAPI::isRunning() {
+        std::lock_guard<std::mutex> lock(serverMutex);
+        return server && server->isRunning();
+    }
+
+    int WebSocketAPI::getClientCount() {
+        std::lock_guard<std::mutex> lock(serverMutex);
+        return server ? server->getClientCount() : 0;
+    }
+
+    void WebSocketAPI::Broadcast(const std::string& msg) {
+        std::lock_guard<std::mutex> lock(serverMutex);
+        if (server) {
+            server->broadcastMessage(msg);
+        }
+    }
+
+    void WebSocketAPI::Broadcast(const char* msg) {
+        Broadcast(std::string(msg));
+    }
+
+    void WebSocketAPI::Broadcast(const char* source, const char* msg) {
+        std::string combined = std::string(source) + msg;
+        Broadcast(combined);
+    }
+
+    bool WebSocketAPI::BroadcastCb(const ZeroCopyString& zcStr, CmdCbType type) {
+        Broadcast(zcStr.ToString());
+        return true;
+    }
+
+    void WebSocketAPI::broadcastMessage(const std::string& msg) {
+        Broadcast(msg);
+    }
+
+}
+
+#endif
@@ -8,6 +8,8 @@
   GNU General Public License v3.0 or later
 */
 
+#if defined(_WIN32)
+
 #include "DALHAL_WebSocketAPI_Windows.h"
 #include <iostream>
 #include <sstream>
@@ -318,7 +320,7 @@ namespace DALHAL {
             std::vector<unsigned char> frame;
             
             // text = 0x81, binary = 0x82
-            unsigned char opcode = (type == CmdCbType::Data) ? 0x82 : 0x81;
+            unsigned char opcode = (type != CmdCbType::Control) ? 0x82 : 0x81;
             frame.push_back(opcode);
 
             size_t msgLen = message.length();
@@ -438,3 +440,5 @@ namespace DALHAL {
     }
 
 }
+
+#endif
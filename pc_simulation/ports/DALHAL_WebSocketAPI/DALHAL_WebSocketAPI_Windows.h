@@ -3,6 +3,8 @@
   WebSocket API for Windows using SimpleWebSocketServer
   
   Provides cross-platform WebSocket server for home automation commands.
+  Implemented by DALHAL_WebSocketAPI_Windows.cpp (Winsock) and
+  DALHAL_WebSocketAPI_Linux.cpp (epoll).
 
   Copyright (C) 2026 Jannik Svensson
 
@@ -26,6 +26,7 @@
 #include <iostream>
 #include <chrono>
 #include <cstring>   // for strlen
+#include <cstdio>    // for std::rename/std::remove
 
 namespace LittleFS_ext {
 
@@ -127,4 +128,101 @@ namespace LittleFS_ext {
         return FileResult::Success;
     }
 
-}
\ No newline at end of file
+    int getFileSize(const char* file_name) {
+        std::ifstream file(file_name, std::ios::binary | std::ios::ate);
+        if (!file) {
+            return -1;
+        }
+        return (int)file.tellg();
+    }
+
+    TextFileReader::~TextFileReader() {
+        close();
+    }
+
+    FileResult TextFileReader::open(const char* file_name) {
+        if (file_name == nullptr || strlen(file_name) == 0) {
+            return FileResult::FileNameEmpty;
+        }
+        close();
+        file.open(file_name, std::ios::binary | std::ios::ate);
+        if (!file) {
+            std::cout << "file not found: " << file_name << "\n";
+            return FileResult::FileNotFound;
+        }
+        if (file.tellg() <= 0) {
+            std::cout << "file is empty: " << file_name << "\n";
+            file.close();
+            return FileResult::FileEmpty;
+        }
+        file.seekg(0);
+        return FileResult::Success;
+    }
+
+    size_t TextFileReader::read(char* buffer, size_t maxCount) {
+        if (!file.is_open()) return 0;
+        file.read(buffer, maxCount);
+        return static_cast<size_t>(file.gcount());
+    }
+
+    void TextFileReader::close() {
+        if (file.is_open()) file.close();
+        file.clear();
+    }
+
+    FileWriter::~FileWriter() {
+        close();
+    }
+
+    static uint32_t changeCounter = 0;
+
+    void notify_changed() {
+        changeCounter++;
+    }
+
+    uint32_t change_counter() {
+        return changeCounter;
+    }
+
+    FileResult FileWriter::open(const char* file_name) {
+        if (file_name == nullptr || strlen(file_name) == 0) {
+            return FileResult::FileNameEmpty;
+        }
+        close();
+        file.open(file_name, std::ios::binary | std::ios::trunc);
+        notify_changed(); // trunc, even if the open itself failed
+        if (!file) {
+            std::cout << "could not open file for write: " << file_name << "\n";
+            return FileResult::FileWriteError;
+        }
+        return FileResult::Success;
+    }
+
+    bool FileWriter::write(const uint8_t* data, size_t count) {
+        if (!file.is_open()) return false;
+        file.write(reinterpret_cast<const char*>(data), count);
+        return file.good();
+    }
+
+    void FileWriter::close() {
+        if (file.is_open()) {
+            file.close();
+            notify_changed(); // the content is complete now
+        }
+        file.clear();
+    }
+
+    bool rename_file(const char* from_file_name, const char* to_file_name) {
+        std::remove(to_file_name); // std::rename does not replace on windows
+        bool ok = std::rename(from_file_name, to_file_name) == 0;
+        notify_changed();
+        return ok;
+    }
+
+    bool remove_file(const char* file_name) {
+        bool ok = std::remove(file_name) == 0;
+        notify_changed();
+        return ok;
+    }
+
+}
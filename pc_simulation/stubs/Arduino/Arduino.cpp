@@ -36,4 +36,43 @@ void digitalWrite(int pin, int val) {
     //std::cout << "[" << micros-lastmicros << " uS] digitalWrite(" << pin << ", " << val << ")\n";
     std::cout << "digitalWrite(" << pin << ", " << val << ")\n";
     //lastmicros = micros;
-}
\ No newline at end of file
+}
+
+constexpr int SIM_PIN_COUNT = 64;
+static int simPinLevels[SIM_PIN_COUNT] = {0};
+struct SimPinInterrupt {
+    void (*func)(void*) = nullptr;
+    void* arg = nullptr;
+    int mode = 0;
+};
+static SimPinInterrupt simPinInterrupts[SIM_PIN_COUNT];
+
+int digitalRead(int pin) {
+    if (pin < 0 || pin >= SIM_PIN_COUNT) return 0;
+    return simPinLevels[pin];
+}
+
+void attachInterruptArg(uint8_t pin, void (*userFunc)(void*), void* arg, int mode) {
+    if (pin >= SIM_PIN_COUNT) return;
+    simPinInterrupts[pin].func = userFunc;
+    simPinInterrupts[pin].arg = arg;
+    simPinInterrupts[pin].mode = mode;
+}
+
+void detachInterrupt(uint8_t pin) {
+    if (pin >= SIM_PIN_COUNT) return;
+    simPinInterrupts[pin] = SimPinInterrupt();
+}
+
+void SimulateInputLevel(int pin, int level) {
+    if (pin < 0 || pin >= SIM_PIN_COUNT) return;
+    level = level ? HIGH : LOW;
+    int prev = simPinLevels[pin];
+    simPinLevels[pin] = level;
+    if (prev == level) return;
+    SimPinInterrupt& irq = simPinInterrupts[pin];
+    if (irq.func == nullptr) return;
+    if (irq.mode == CHANGE || (irq.mode == RISING && level == HIGH) || (irq.mode == FALLING && level == LOW)) {
+        irq.func(irq.arg);
+    }
+}
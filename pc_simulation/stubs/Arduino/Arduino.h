@@ -53,6 +53,10 @@
 #define INPUT_PULLDOWN 0x09
 #define INPUT_PULLUP 0x05
 
+#define RISING  0x01
+#define FALLING 0x02
+#define CHANGE  0x03
+
 inline void yield() {
     std::this_thread::yield();
 }
@@ -65,7 +69,13 @@ inline unsigned long millis() {
     return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count();
 }
 
-// Simulate delay() using std::this_thread::sleep_for
+// Simulate micros() using std::chrono
+inline unsigned long micros() {
+    static auto start = std::chrono::steady_clock::now();
+    auto now = std::chrono::steady_clock::now();
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(now - start).count();
+}
+
 inline void delay(unsigned long ms) {
     std::this_thread::sleep_for(std::chrono::milliseconds(ms));
 }
@@ -79,11 +89,16 @@ inline void pinMode(int pin, int mode) {
     printf("pinMode(%d, %d)\n", pin, mode);
 }
 void digitalWrite(int pin, int val);
-inline int digitalRead(int pin) {
-    int val = 42;
-    printf("digitalRead(%d, %d)\n", pin, val);
-    return 0; // always low
-}
+int digitalRead(int pin);
+// Stub interrupts, edges are injected with SimulateInputLevel
+inline int digitalPinToInterrupt(int pin) { return pin; }
+void attachInterruptArg(uint8_t pin, void (*userFunc)(void*), void* arg, int mode);
+void detachInterrupt(uint8_t pin);
+inline void noInterrupts() {}
+inline void interrupts() {}
+/** simulation only: sets the level returned by digitalRead and fires any attached pin interrupt */
+void SimulateInputLevel(int pin, int level);
+
 inline void analogWrite(int pin, float val) {
     printf("analogWrite(%d, %f)\n", pin, val);
 }
@@ -47,4 +47,26 @@ float DallasTemperature::getTempC(const uint8_t* deviceAddress) {
 }
 float DallasTemperature::getTempF(const uint8_t* deviceAddress) {
     return tempC * 9.0 / 5.0 + 32.0;
+}
+bool DallasTemperature::setResolution(const uint8_t* deviceAddress, uint8_t newResolution) {
+    if (newResolution < 9) newResolution = 9;
+    else if (newResolution > 12) newResolution = 12;
+    resolution = newResolution;
+    return true;
+}
+bool DallasTemperature::isConnected(const uint8_t* deviceAddress, uint8_t* scratchPad) {
+    return readScratchPad(deviceAddress, scratchPad);
+}
+bool DallasTemperature::readScratchPad(const uint8_t* deviceAddress, uint8_t* scratchPad) {
+    int16_t raw = (int16_t)(tempC * 16.0f);
+    scratchPad[0] = (uint8_t)(raw & 0xFF);
+    scratchPad[1] = (uint8_t)((raw >> 8) & 0xFF);
+    scratchPad[2] = 0;
+    scratchPad[3] = 0;
+    scratchPad[4] = (uint8_t)(((resolution - 9) << 5) | 0x1F);
+    scratchPad[5] = 0xFF;
+    scratchPad[6] = 0;
+    scratchPad[7] = 0x10;
+    scratchPad[8] = 0;
+    return true;
 }
\ No newline at end of file
@@ -31,9 +31,12 @@
 #define DEVICE_DISCONNECTED_C -127
 #define DEVICE_DISCONNECTED_F -196.6
 
+typedef uint8_t ScratchPad[9];
+
 class DallasTemperature {
 private:
     float tempC = 20.0f;
+    uint8_t resolution = 12;
 public:
     DallasTemperature(OneWire* _oneWire);
     void setWaitForConversion(bool val);
@@ -41,4 +44,8 @@ public:
     float getTempC(const uint8_t* deviceAddress);
     float getTempF(const uint8_t* deviceAddress);
     void setTempC(float value);
+    bool setResolution(const uint8_t* deviceAddress, uint8_t newResolution);
+    /** fills the scratchpad as a DS18B20 would, always returns true (no crc errors simulated) */
+    bool isConnected(const uint8_t* deviceAddress, uint8_t* scratchPad);
+    bool readScratchPad(const uint8_t* deviceAddress, uint8_t* scratchPad);
 };
\ No newline at end of file
@@ -23,6 +23,7 @@
 
 #pragma once
 #include "DALHAL_CommandExecutor.h"
+#include "DALHAL_BinaryCommand.h"
 #include "DALHAL_SerialAPI.h"
 #if defined(ESP8266) || defined(ESP32)
 #include <DALHAL/API/WebSocket/DALHAL_WebSocketAPI.h> // for SendMessage
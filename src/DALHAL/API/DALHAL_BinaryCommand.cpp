@@ -0,0 +1,318 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DALHAL_BinaryCommand.h"
+
+#include <string.h>
+
+#include <DALHAL/Core/Manager/DALHAL_DeviceManager.h>
+#include <DALHAL/Core/Types/DALHAL_CachedDeviceAccess.h>
+#include <DALHAL/Core/Types/DALHAL_OperationResult.h>
+#include <DALHAL/Core/Types/DALHAL_Value.h>
+#include <DALHAL/Core/Types/DALHAL_ZeroCopyString.h>
+
+namespace DALHAL {
+
+    static_assert(DALHAL_BINARY_COMMAND_MAX_HANDLES <= 0xFFFF, "handles are sent as u16");
+
+    BinaryCommand::Handle BinaryCommand::handles[DALHAL_BINARY_COMMAND_MAX_HANDLES];
+
+    static const size_t RequestHeaderSize = 4;
+
+    static uint16_t Get16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+    static uint32_t Get32(const uint8_t* p) { return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+    static void Put16(std::string& out, uint16_t v) {
+        out += (char)(v & 0xFF);
+        out += (char)(v >> 8);
+    }
+    static void Put32(std::string& out, uint32_t v) {
+        out += (char)(v & 0xFF);
+        out += (char)((v >> 8) & 0xFF);
+        out += (char)((v >> 16) & 0xFF);
+        out += (char)(v >> 24);
+    }
+
+    /** returns the position after the value or nullptr if it is malformed, a string is copied to strStorage */
+    static const uint8_t* DecodeValue(const uint8_t* p, const uint8_t* end, HALValue& value, std::string& strStorage) {
+        if (p >= end) return nullptr;
+        const BinaryCommand::ValueTag tag = (BinaryCommand::ValueTag)*p++;
+        const size_t left = (size_t)(end - p);
+        switch (tag) {
+            case BinaryCommand::ValueTag::Unset:
+                value = HALValue();
+                return p;
+            case BinaryCommand::ValueTag::Int:
+                if (left < 4) return nullptr;
+                value = (int32_t)Get32(p);
+                return p + 4;
+            case BinaryCommand::ValueTag::UInt:
+                if (left < 4) return nullptr;
+                value = Get32(p);
+                return p + 4;
+            case BinaryCommand::ValueTag::Float: {
+                if (left < 4) return nullptr;
+                uint32_t bits = Get32(p);
+                float f;
+                memcpy(&f, &bits, sizeof(f));
+                value = f;
+                return p + 4;
+            }
+            case BinaryCommand::ValueTag::Bool:
+                if (left < 1) return nullptr;
+                value.set(*p != 0);
+                return p + 1;
+            case BinaryCommand::ValueTag::String: {
+                if (left < 2) return nullptr;
+                const size_t len = Get16(p);
+                if (left - 2 < len) return nullptr;
+                // devices expect a nul terminated string
+                strStorage.assign((const char*)p + 2, len);
+                value.set(strStorage.c_str());
+                return p + 2 + len;
+            }
+            default:
+                return nullptr;
+        }
+    }
+
+    static void EncodeValue(const HALValue& value, std::string& out) {
+        switch (value.getType()) {
+            case HALValue::Type::INT:
+                out += (char)BinaryCommand::ValueTag::Int;
+                Put32(out, (uint32_t)value.asRawInt());
+                break;
+            case HALValue::Type::UINT:
+                out += (char)BinaryCommand::ValueTag::UInt;
+                Put32(out, value.asRawUInt());
+                break;
+            case HALValue::Type::FLOAT: {
+                out += (char)BinaryCommand::ValueTag::Float;
+                float f = value.asRawFloat();
+                uint32_t bits;
+                memcpy(&bits, &f, sizeof(bits));
+                Put32(out, bits);
+                break;
+            }
+            case HALValue::Type::BOOL:
+                out += (char)BinaryCommand::ValueTag::Bool;
+                out += (char)(value.asRawBool() ? 1 : 0);
+                break;
+            case HALValue::Type::CSTRING: {
+                const char* str = value.asRawConstChar();
+                size_t len = (str != nullptr) ? strlen(str) : 0;
+                if (len > 0xFFFF) len = 0xFFFF;
+                out += (char)BinaryCommand::ValueTag::String;
+                Put16(out, (uint16_t)len);
+                out.append(str != nullptr ? str : "", len);
+                break;
+            }
+            default:
+                out += (char)BinaryCommand::ValueTag::Unset;
+                break;
+        }
+    }
+
+    bool BinaryCommand::IsFrame(const uint8_t* data, size_t len) {
+        return len > 0 && data[0] == DALHAL_BINARY_COMMAND_REQUEST_MAGIC;
+    }
+
+    bool BinaryCommand::Execute(const std::string& frame, uint32_t clientId, CommandCallback& cb) {
+        if (frame.empty()) {
+            ReleaseClient(clientId);
+            return true;
+        }
+        const uint8_t* p = (const uint8_t*)frame.data();
+        const uint8_t* end = p + frame.size();
+
+        std::string response;
+        response.reserve(16);
+        response += (char)DALHAL_BINARY_COMMAND_RESPONSE_MAGIC;
+        if (frame.size() < RequestHeaderSize || p[0] != DALHAL_BINARY_COMMAND_REQUEST_MAGIC) {
+            // nothing to echo, answered with opcode and request id as far as they were given
+            response += (char)(frame.size() > 1 ? p[1] : 0);
+            Put16(response, 0);
+            response += (char)Status::MalformedFrame;
+            return cb(ZeroCopyString(response.data(), response.size()), CmdCbType::BinaryMessage);
+        }
+        const uint8_t opcode = p[1];
+        response.append((const char*)p + 1, 3); // opcode and request id
+        const size_t statusPos = response.size();
+        response += (char)HALOperationResult::Success;
+        p += RequestHeaderSize;
+
+        uint8_t status = (uint8_t)HALOperationResult::Success;
+        switch ((Opcode)opcode) {
+            case Opcode::Ping:
+                response += (char)DALHAL_BINARY_COMMAND_VERSION;
+                break;
+            case Opcode::Resolve:
+                status = Resolve(clientId, (const char*)p, (size_t)(end - p), response);
+                break;
+            case Opcode::Release:
+                status = (end - p == 2) ? Release(clientId, Get16(p)) : (uint8_t)Status::MalformedFrame;
+                break;
+            case Opcode::Read:
+            case Opcode::Write:
+            case Opcode::Exec: {
+                if (end - p < 2) { status = (uint8_t)Status::MalformedFrame; break; }
+                CachedDeviceAccess* access = GetAccess(clientId, Get16(p), status);
+                if (access == nullptr) break;
+                status = Run(opcode, *access, p + 2, end, response);
+                break;
+            }
+            case Opcode::ReadPath:
+            case Opcode::WritePath:
+            case Opcode::ExecPath: {
+                const uint8_t* valueStart = p;
+                const uint8_t* valueEnd = p;
+                if ((Opcode)opcode == Opcode::WritePath) {
+                    HALValue dummy;
+                    std::string dummyStorage;
+                    valueEnd = DecodeValue(p, end, dummy, dummyStorage);
+                    if (valueEnd == nullptr) { status = (uint8_t)Status::MalformedFrame; break; }
+                }
+                if (valueEnd == end) { status = (uint8_t)HALOperationResult::DeviceUIDPathEmpty; break; }
+                std::string path((const char*)valueEnd, (size_t)(end - valueEnd));
+                CachedDeviceAccess access;
+                if (access.Set(path.c_str()) == false) { status = (uint8_t)HALOperationResult::DeviceNotFound; break; }
+                // the path variants map onto the handle variants
+                status = Run(opcode - ((uint8_t)Opcode::ReadPath - (uint8_t)Opcode::Read), access, valueStart, valueEnd, response);
+                break;
+            }
+            default:
+                status = (uint8_t)Status::UnknownOpcode;
+                break;
+        }
+        if (status != (uint8_t)HALOperationResult::Success) {
+            response.resize(statusPos + 1); // an error has no payload
+            response[statusPos] = (char)status;
+        }
+        return cb(ZeroCopyString(response.data(), response.size()), CmdCbType::BinaryMessage);
+    }
+
+    uint8_t BinaryCommand::Run(uint8_t opcode, CachedDeviceAccess& access, const uint8_t* valueStart, const uint8_t* valueEnd, std::string& response) {
+        HALOperationResult res;
+        if ((Opcode)opcode == Opcode::Read) {
+            if (valueStart != valueEnd) return (uint8_t)Status::MalformedFrame;
+            HALValue value;
+            res = access.ReadSimple(value);
+            if (res == HALOperationResult::Success) EncodeValue(value, response);
+        } else if ((Opcode)opcode == Opcode::Write) {
+            HALValue value;
+            std::string strStorage;
+            if (DecodeValue(valueStart, valueEnd, value, strStorage) != valueEnd) return (uint8_t)Status::MalformedFrame;
+            res = access.WriteSimple(value);
+        } else { // Opcode::Exec
+            if (valueStart != valueEnd) return (uint8_t)Status::MalformedFrame;
+            res = access.Exec();
+        }
+        return (uint8_t)res;
+    }
+
+    uint8_t BinaryCommand::Resolve(uint32_t clientId, const char* path, size_t pathLen, std::string& response) {
+        if (pathLen == 0) return (uint8_t)HALOperationResult::DeviceUIDPathEmpty;
+        int freeIndex = -1;
+        for (int i = 0; i < DALHAL_BINARY_COMMAND_MAX_HANDLES; i++) {
+            Handle& h = handles[i];
+            if (h.refs == 0) {
+                if (freeIndex == -1) freeIndex = i;
+                continue;
+            }
+            if (h.owner == clientId && h.path.length() == pathLen && memcmp(h.path.data(), path, pathLen) == 0) {
+                uint8_t status;
+                if (GetAccess(clientId, (uint16_t)i, status) == nullptr) return status;
+                h.refs++;
+                Put16(response, (uint16_t)i);
+                return (uint8_t)HALOperationResult::Success;
+            }
+        }
+        if (freeIndex == -1) return (uint8_t)Status::HandleTableFull;
+
+        CachedDeviceAccess* access = new CachedDeviceAccess();
+        if (access == nullptr) return (uint8_t)HALOperationResult::ExecutionFailed;
+        Handle& h = handles[freeIndex];
+        h.path.assign(path, pathLen);
+        if (access->Set(h.path.c_str()) == false) {
+            delete access;
+            std::string().swap(h.path);
+            return (uint8_t)HALOperationResult::DeviceNotFound;
+        }
+        h.access = access;
+        h.generation = DeviceManager::LoadGeneration();
+        h.owner = clientId;
+        h.refs = 1;
+        Put16(response, (uint16_t)freeIndex);
+        return (uint8_t)HALOperationResult::Success;
+    }
+
+    void BinaryCommand::FreeHandle(Handle& h) {
+        delete h.access;
+        h.access = nullptr;
+        h.refs = 0;
+        std::string().swap(h.path);
+    }
+
+    uint8_t BinaryCommand::Release(uint32_t clientId, uint16_t handle) {
+        if (handle >= DALHAL_BINARY_COMMAND_MAX_HANDLES || handles[handle].refs == 0 || handles[handle].owner != clientId) return (uint8_t)Status::InvalidHandle;
+        Handle& h = handles[handle];
+        if (--h.refs > 0) return (uint8_t)HALOperationResult::Success;
+        FreeHandle(h);
+        return (uint8_t)HALOperationResult::Success;
+    }
+
+    void BinaryCommand::ReleaseClient(uint32_t clientId) {
+        for (int i = 0; i < DALHAL_BINARY_COMMAND_MAX_HANDLES; i++) {
+            if (handles[i].refs != 0 && handles[i].owner == clientId) FreeHandle(handles[i]);
+        }
+    }
+
+    CachedDeviceAccess* BinaryCommand::GetAccess(uint32_t clientId, uint16_t handle, uint8_t& status) {
+        if (handle >= DALHAL_BINARY_COMMAND_MAX_HANDLES || handles[handle].refs == 0 || handles[handle].owner != clientId) {
+            status = (uint8_t)Status::InvalidHandle;
+            return nullptr;
+        }
+        Handle& h = handles[handle];
+        const uint32_t generation = DeviceManager::LoadGeneration();
+        if (h.access == nullptr || h.generation != generation) {
+            // the cfg was reloaded, the cached device pointers are gone
+            delete h.access;
+            h.access = new CachedDeviceAccess();
+            if (h.access == nullptr) {
+                status = (uint8_t)HALOperationResult::ExecutionFailed;
+                return nullptr;
+            }
+            if (h.access->Set(h.path.c_str()) == false) {
+                // kept so that the handle works again after a reload that brings the device back
+                delete h.access;
+                h.access = nullptr;
+                status = (uint8_t)HALOperationResult::DeviceNotFound;
+                return nullptr;
+            }
+            h.generation = generation;
+        }
+        status = (uint8_t)HALOperationResult::Success;
+        return h.access;
+    }
+
+}
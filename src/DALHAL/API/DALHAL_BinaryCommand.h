@@ -0,0 +1,137 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+
+#include <DALHAL/API/DALHAL_CommandCallback.h>
+
+/** first byte of a request frame, can never be the first byte of a text command */
+#define DALHAL_BINARY_COMMAND_REQUEST_MAGIC 0xDA
+/** first byte of a response frame */
+#define DALHAL_BINARY_COMMAND_RESPONSE_MAGIC 0xDB
+/** reported by Ping, bumped on incompatible frame changes */
+#define DALHAL_BINARY_COMMAND_VERSION 1
+
+/** max number of resolved device handles, shared by all clients, each handle belongs to the client that resolved it */
+#ifndef DALHAL_BINARY_COMMAND_MAX_HANDLES
+#if defined(ESP8266)
+#define DALHAL_BINARY_COMMAND_MAX_HANDLES 16
+#else
+#define DALHAL_BINARY_COMMAND_MAX_HANDLES 64
+#endif
+#endif
+
+namespace DALHAL {
+
+    class CachedDeviceAccess; // forward declaration
+
+    /**
+     * compact binary alternative to the text command grammar, for machine clients,
+     * one request frame per (websocket binary) message, all integers little endian
+     *
+     * request:  u8 magic 0xDA, u8 opcode, u16 request id, payload
+     * response: u8 magic 0xDB, u8 opcode, u16 request id, u8 status, payload
+     *
+     * the status is a HALOperationResult value or one of Status below,
+     * the request id is only echoed so that pipelined requests can be matched to their responses
+     *
+     * a handle is a resolved "uid:path#function" owned by the client that resolved it,
+     * it stays valid until released or the client disconnects
+     * and is resolved again on first use after the cfg was reloaded
+     *
+     * value: u8 ValueTag followed by i32, u32, f32, u8 (bool) or u16 length + bytes (string), nothing for Unset
+     */
+    class BinaryCommand {
+    public:
+        enum class Opcode : uint8_t {
+            /** -> u8 version */
+            Ping = 0x00,
+            /** path -> u16 handle */
+            Resolve = 0x01,
+            /** u16 handle */
+            Release = 0x02,
+            /** u16 handle -> value */
+            Read = 0x10,
+            /** u16 handle, value */
+            Write = 0x11,
+            /** u16 handle */
+            Exec = 0x12,
+            /** path -> value */
+            ReadPath = 0x20,
+            /** value, path */
+            WritePath = 0x21,
+            /** path */
+            ExecPath = 0x22
+        };
+
+        enum class ValueTag : uint8_t {
+            Unset = 0,
+            Int = 1,
+            UInt = 2,
+            Float = 3,
+            Bool = 4,
+            String = 5
+        };
+
+        /** protocol errors, above the range used by HALOperationResult */
+        enum class Status : uint8_t {
+            MalformedFrame = 0xF0,
+            UnknownOpcode = 0xF1,
+            InvalidHandle = 0xF2,
+            HandleTableFull = 0xF3
+        };
+
+        /** true if data starts like a request frame */
+        static bool IsFrame(const uint8_t* data, size_t len);
+        /**
+         * executes one request frame from clientId, the response is given to cb as CmdCbType::BinaryMessage,
+         * an empty frame releases all handles of clientId (queued on disconnect, after the client's last frame)
+         */
+        static bool Execute(const std::string& frame, uint32_t clientId, CommandCallback& cb);
+
+    private:
+        struct Handle {
+            /** "uid:path#function" as given to Resolve, kept to resolve again after a cfg reload */
+            std::string path;
+            CachedDeviceAccess* access = nullptr;
+            uint32_t generation = 0;
+            /** the client that resolved it, other clients get InvalidHandle */
+            uint32_t owner = 0;
+            /** number of Resolve calls not yet released, the slot is free when 0 */
+            uint16_t refs = 0;
+        };
+        static Handle handles[DALHAL_BINARY_COMMAND_MAX_HANDLES];
+
+        static uint8_t Resolve(uint32_t clientId, const char* path, size_t pathLen, std::string& response);
+        static uint8_t Release(uint32_t clientId, uint16_t handle);
+        static void ReleaseClient(uint32_t clientId);
+        static void FreeHandle(Handle& h);
+        static CachedDeviceAccess* GetAccess(uint32_t clientId, uint16_t handle, uint8_t& status);
+        static uint8_t Run(uint8_t opcode, CachedDeviceAccess& access, const uint8_t* valueStart, const uint8_t* valueEnd, std::string& response);
+    };
+
+}
@@ -31,7 +31,9 @@ namespace DALHAL {
 
     enum class CmdCbType {
         Control,
-        Data
+        Data,
+        /** sent binary like Data, but always as a message of its own (BinaryCommand responses have no length field) */
+        BinaryMessage
     };
 
     using CommandCallback = std::function<bool(const ZeroCopyString& response, CmdCbType type)>;
@@ -34,12 +34,14 @@
 
 #include <DALHAL/Core/Manager/DALHAL_GPIO_Manager.h>
 #include <DALHAL/Core/Manager/DALHAL_DeviceManager.h>
+#include <DALHAL/Core/Manager/DALHAL_DeviceArena.h>
 #include <DALHAL/Core/Types/DALHAL_Registry.h>
 
 #include <DALHAL/Core/Types/DALHAL_DeviceFunctionTable.h>
 
 #include <DALHAL/Devices/_Registry/DALHAL_DevicesRegistry.h>
 #include <DALHAL/ScriptEngine/DALHAL_SCRIPT_ENGINE.h>
+#include <DALHAL/ScriptEngine/Runtime/DALHAL_SCRIPT_ENGINE_ScriptBlocks.h>
 #if defined(ESP8266) || defined(ESP32)
 #include <System/Info.h>
 
@@ -50,6 +52,7 @@
 
 //#include <DALHAL/Core/JsonConfig/DALHAL_JSON_Schema_ToJsonString.h>
 #include <DALHAL/Core/JsonConfig/DALHAL_JSON_Schema_ToJsonString.h>
+#include <DALHAL/Core/JsonConfig/DALHAL_JSON_Schema_Cache.h>
 
 #include <DALHAL/API/DALHAL_BlockStreamer.h>
 #include <DALHAL/API/DALHAL_StringBuilderStreamer.h>
@@ -235,7 +238,7 @@ namespace DALHAL {
         DALHAL_CMD_EXEC_ENTRY_WFLAG("types", Exec_Hal_PrintRegistry_Types, CommandNode::Flags::AUTOGEN_BUTTON, "print device type registry basedata"),
         DALHAL_CMD_EXEC_ENTRY_WFLAG("functions", Exec_Hal_PrintRegistry_Functions, CommandNode::Flags::AUTOGEN_BUTTON, "print device type registry with functions"),
         DALHAL_CMD_EXEC_ENTRY_WFLAG("events", Exec_Hal_PrintRegistry_Events, CommandNode::Flags::AUTOGEN_BUTTON, "print device type registry with events"),
-        DALHAL_CMD_EXEC_ENTRY_WFLAG("cfgschema", Exec_Hal_PrintJsonSchemas, CommandNode::Flags::AUTOGEN_BUTTON, "print config json schema"),
+        DALHAL_CMD_EXEC_ENTRY_WFLAG("cfgschema", Exec_Hal_PrintJsonSchemas, CommandNode::Flags::AUTOGEN_BUTTON, "print config json schema (cached per build), optional arg: etag, live or the ETag of a cached copy"),
     };
 
     static constexpr CommandNode HalMetaItems[] = {
@@ -538,6 +541,13 @@ namespace DALHAL {
 #elif defined(ESP32)
         sbs.write_json_value_separator(); sbs.write_jsonNumber(F("Max block"), ESP.getMaxAllocHeap());
 #endif
+        sbs.write_json_value_separator(); sbs.write_jsonNumber(F("Fragmentation"), (uint32_t)DeviceArena::HeapFragmentation());
+        sbs.write_json_value_separator(); sbs.write_jsonMemberStart(F("deviceArena"));
+        DeviceArena::PrintTo(sbs);
+        sbs.write_json_value_separator(); sbs.write_jsonMemberStart(F("scriptArena"));
+        sbs.write_json_object_begin();
+        ScriptEngine::ScriptBlocks::arena.PrintTo(sbs);
+        sbs.write_json_object_end();
         sbs.write_json_object_end();
         return HALOperationResult::Success;
     }
@@ -1026,8 +1036,34 @@ namespace DALHAL {
         return HALOperationResult::Success;
     }
     HALOperationResult Exec_Hal_PrintJsonSchemas(ZeroCopyString& zcStr, CommandCallback cb) {
+        // optional arg:
+        //   etag     - reply the current ETag only
+        //   build    - make sure the cache is rendered, used by the http route
+        //   live     - bypass the cache
+        //   <etag>   - the ETag of the copy the client has, replies notModified if still valid
+        ZeroCopyString zcArg = zcStr.SplitOffHead('/');
+        const char* etag = JsonSchema::Cache::GetETag();
+        const ZeroCopyString zcETag(etag + 1, strlen(etag) - 2); // without the quotes
+
+        if (zcArg.EqualsIC(F("etag")) || (zcArg.NotEmpty() && zcArg.Equals(zcETag))) {
+            std::string reply = "{\"etag\":\"";
+            reply.append(zcETag.start, zcETag.Length());
+            reply += zcArg.EqualsIC(F("etag")) ? "\"}" : "\",\"notModified\":true}";
+            cb(reply.c_str(), CmdCbType::Control);
+            return HALOperationResult::Success;
+        }
+        if (zcArg.EqualsIC(F("build"))) {
+            if (JsonSchema::Cache::Ensure(RootDevicesRegistry) == false) {
+                return HALOperationResult::ExecutionFailed;
+            }
+            cb("{\"info\":\"schema cache ready\"}", CmdCbType::Control);
+            return HALOperationResult::Success;
+        }
+
         DALHAL::BlockStreamer bs(cb, "schema", BlockStreamer::DataType::Json);
-        JsonSchema::ToJsonString::buildCompleteJsonSchemasStartingFrom(RootDevicesRegistry, bs.writer());
+        if (zcArg.EqualsIC(F("live")) || JsonSchema::Cache::Ensure(RootDevicesRegistry) == false || JsonSchema::Cache::StreamTo(bs.writer()) == false) {
+            JsonSchema::ToJsonString::buildCompleteJsonSchemasStartingFrom(RootDevicesRegistry, bs.writer());
+        }
         return HALOperationResult::Success;
     }
     HALOperationResult Exec_Api_PrintVirtualFiles(ZeroCopyString& zcStr, CommandCallback cb) {
@@ -45,6 +45,10 @@ namespace DALHAL {
     struct PendingRequest {
         std::string command;
         CommandCallback cb;
+        /** command is a BinaryCommand frame, an empty one is queued when the client disconnects */
+        bool binary = false;
+        /** the client a binary frame came from, it owns the handles it resolves */
+        uint32_t clientId = 0;
     };
 
     struct CommandNode {
@@ -0,0 +1,161 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DALHAL_PreparedCommand.h"
+
+#include <DALHAL/API/DALHAL_CommandExecutor.h>
+#include <DALHAL/API/DALHAL_StringBuilderStreamer.h>
+#include <DALHAL/Core/Manager/DALHAL_DeviceManager.h>
+#include <DALHAL/Core/Types/DALHAL_DeviceFunctionTable.h>
+#include <DALHAL/Core/Types/DALHAL_UID_Path.h>
+#include <DALHAL/Support/DALHAL_Logger.h>
+
+namespace DALHAL {
+
+    PreparedCommand::PreparedCommand(const char* command) : cmd(command ? command : "") {
+        Prepare();
+    }
+
+    void PreparedCommand::Prepare() {
+        kind = Kind::Generic;
+        ZeroCopyString zcStr(cmd.c_str(), cmd.c_str() + cmd.length());
+        zcStr.Trim();
+        if (zcStr.StartsWith('?')) { return; } // help requests are rare, keep them generic
+
+        ZeroCopyString zcRoot = zcStr.SplitOffHead('/');
+        if (zcRoot.Equals("hal") == false) { return; }
+
+        ZeroCopyString zcGroup = zcStr.SplitOffHead('/');
+        if (zcGroup.Equals("exec")) {
+            CommandExecutor::ExecCmdParameters params(zcStr);
+            if (params.zcUid.IsEmpty() || params.cmdIsPresent == false) { return; }
+            zcUid = params.zcUid;
+            zcFunc = params.zcCmd;
+            kind = Kind::Exec;
+            return;
+        }
+        if (zcGroup.Equals("write") == false && zcGroup.Equals("wr") == false) { return; }
+
+        ZeroCopyString zcType = zcStr.SplitOffHead('/');
+        bool isValue = zcType.Equals("value") || zcType.Equals("val");
+        bool isString = zcType.Equals("string") || zcType.Equals("str");
+        if (!isValue && !isString) { return; }
+
+        CommandExecutor::ReadWriteCmdParameters params(zcStr);
+        if (params.isHelpRequest || params.isBracketOp || params.zcUid.IsEmpty() || params.cmdIsPresent == false) { return; }
+
+        if (isValue) {
+            // same conversion rules as hal/write/value
+            NumberResult numRes = params.zcParameters.ConvertStringToNumber();
+            if (numRes.type == NumberType::FLOAT) {
+                value = numRes.f32;
+            } else if (numRes.type == NumberType::UINT32) {
+                value = numRes.u32;
+            } else if (numRes.type == NumberType::INT32) {
+                value = numRes.i32;
+            } else {
+                bool bValue = false;
+                if (params.zcParameters.ConvertTo_bool(bValue) == false) { return; } // let the generic path report the error
+                value = bValue;
+            }
+            kind = Kind::WriteValue;
+        } else {
+            kind = Kind::WriteString;
+        }
+        zcUid = params.zcUid;
+        zcFunc = params.zcCmd;
+        zcParameters = params.zcParameters;
+    }
+
+    HALOperationResult PreparedCommand::Resolve() {
+        device = nullptr;
+        execFn = nullptr;
+        writeValueFn = nullptr;
+        writeStringFn = nullptr;
+        resolvedGeneration = 0;
+
+        UIDPath uidPath(zcUid);
+        Device* found = nullptr;
+        if (DeviceManager::findDevice(uidPath, found) != DeviceFindResult::Success) {
+            return HALOperationResult::DeviceNotFound;
+        }
+        HALOperationResult res = HALOperationResult::UnsupportedCommand;
+        if (kind == Kind::Exec) {
+            auto fnRes = GetDeviceFunction<FunctionTypes::Exec>(found, zcFunc);
+            res = fnRes.result;
+            execFn = fnRes.fn;
+        } else if (kind == Kind::WriteValue) {
+            auto fnRes = GetDeviceFunction<FunctionTypes::WriteHALValue>(found, zcFunc);
+            res = fnRes.result;
+            writeValueFn = fnRes.fn;
+        } else if (kind == Kind::WriteString) {
+            auto fnRes = GetDeviceFunctionEntry<FunctionTypes::WriteString>(found, zcFunc);
+            res = fnRes.result;
+            if (fnRes.entry != nullptr) { writeStringFn = fnRes.entry->fn; }
+        }
+        if (res != HALOperationResult::Success) {
+            return res;
+        }
+        device = found;
+        resolvedGeneration = DeviceManager::LoadGeneration();
+        return HALOperationResult::Success;
+    }
+
+    bool PreparedCommand::ExecuteGeneric(CommandCallback& cb) {
+        ZeroCopyString zcCmd(cmd.c_str(), cmd.c_str() + cmd.length());
+        return CommandExecutor::execute(zcCmd, cb);
+    }
+
+    bool PreparedCommand::Execute(CommandCallback cb) {
+        if (!cb) {
+            cb = [](const ZeroCopyString& response, CmdCbType type) -> bool { return true; };
+        }
+        if (kind == Kind::Generic) {
+            return ExecuteGeneric(cb);
+        }
+        if (resolvedGeneration != DeviceManager::LoadGeneration()) {
+            if (Resolve() != HALOperationResult::Success) {
+                // the normal path gives the same error response as if the command was typed
+                return ExecuteGeneric(cb);
+            }
+        }
+
+        HALOperationResult res = HALOperationResult::NotSet;
+        if (kind == Kind::Exec) {
+            res = execFn(device);
+        } else if (kind == Kind::WriteValue) {
+            res = writeValueFn(device, value);
+        } else { // Kind::WriteString
+            // the response of a stored command have no receiver
+            StringBuilderStreamer sbs(cb, [](const char* buf, size_t len) -> bool { return true; });
+            res = writeStringFn(device, zcParameters, sbs);
+        }
+        if (res != HALOperationResult::Success) {
+            GlobalLogger.Error(F("prepared cmd fail: "), cmd.c_str());
+            GlobalLogger.setLastEntrySource(HALOperationResultToString(res));
+            return false;
+        }
+        return true;
+    }
+
+}
@@ -0,0 +1,88 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <string>
+
+#include <DALHAL/Core/Types/DALHAL_ZeroCopyString.h>
+#include <DALHAL/Core/Types/DALHAL_Value.h>
+#include <DALHAL/Core/Types/DALHAL_OperationResult.h>
+#include <DALHAL/Core/Types/DALHAL_DeviceFunctionTypes.h>
+#include <DALHAL/API/DALHAL_CommandCallback.h>
+
+namespace DALHAL {
+
+    class Device; // forward declaration
+
+    /**
+     * a command string that is parsed once and then executed many times,
+     * used by schedules and other stored commands that fire repeatedly
+     *
+     * hal/exec, hal/write/value and hal/write/string commands are split at construction,
+     * the device and function pointers are resolved at the first execute and then cached
+     * until DeviceManager::LoadGeneration() change (i.e. the cfg was reloaded)
+     * every other command (and bracket/help variants) is passed on to CommandExecutor::execute as before
+     */
+    class PreparedCommand {
+    public:
+        enum class Kind : uint8_t {
+            Generic,
+            Exec,
+            WriteValue,
+            WriteString
+        };
+
+    private:
+        /** owns the text, all ZeroCopyString members below point into it */
+        std::string cmd;
+        Kind kind = Kind::Generic;
+        ZeroCopyString zcUid;
+        ZeroCopyString zcFunc;
+        ZeroCopyString zcParameters;
+        HALValue value;
+
+        uint32_t resolvedGeneration = 0;
+        Device* device = nullptr;
+        FunctionTypes::Exec execFn = nullptr;
+        FunctionTypes::WriteHALValue writeValueFn = nullptr;
+        FunctionTypes::WriteString writeStringFn = nullptr;
+
+        void Prepare();
+        HALOperationResult Resolve();
+        bool ExecuteGeneric(CommandCallback& cb);
+
+    public:
+        PreparedCommand(const char* command);
+        PreparedCommand(const PreparedCommand&) = delete;
+        PreparedCommand& operator=(const PreparedCommand&) = delete;
+
+        Kind GetKind() const { return kind; }
+        const char* c_str() const { return cmd.c_str(); }
+
+        /** cb can be empty, then any response is discarded */
+        bool Execute(CommandCallback cb = nullptr);
+    };
+
+}
@@ -24,6 +24,7 @@
 #include "DALHAL_StringBuilderStreamer.h"
 
 #include <DALHAL/Support/DALHAL_Logger.h>
+#include <DALHAL/Support/DALHAL_NumberCodec.h>
 
 #include <math.h>
 
@@ -243,19 +244,16 @@ namespace DALHAL {
     }
 
     void StringBuilderStreamer::write(uint32_t v) {
-        char buf[11]; // max 4294967295 + '\0'
-        int n = snprintf(buf, sizeof(buf), "%lu", (unsigned long)v);
-        if (n > 0) write(buf, (size_t)n);
+        char buf[DALHAL_NUMBER_CODEC_UINT32_BUFFER_SIZE];
+        write(buf, NumberCodec::WriteUInt32(buf, v));
     }
     void StringBuilderStreamer::write(int32_t v) {
-        char buf[12]; // max -2147483648 + '\0'
-        int n = snprintf(buf, sizeof(buf), "%ld", (long)v);
-        if (n > 0) write(buf, (size_t)n);
+        char buf[DALHAL_NUMBER_CODEC_INT32_BUFFER_SIZE];
+        write(buf, NumberCodec::WriteInt32(buf, v));
     }
     void StringBuilderStreamer::write(float v) {
-        char buf[32];
-        int n = snprintf(buf, sizeof(buf), "%g", (double)v);
-        if (n > 0) write(buf, (size_t)n);
+        char buf[DALHAL_NUMBER_CODEC_FLOAT_BUFFER_SIZE];
+        write(buf, NumberCodec::WriteFloat(buf, v));
     }
 
     void StringBuilderStreamer::write(uint32_t v, const char* fmt) {
@@ -339,9 +337,8 @@ namespace DALHAL {
             write(F("null")); // otherwise it will print nan which is a invalid json type
             return;
         }
-        char buf[32];
-        int n = snprintf(buf, sizeof(buf), "%g", (double)v);
-        if (n > 0) write(buf, (size_t)n);
+        char buf[DALHAL_NUMBER_CODEC_FLOAT_BUFFER_SIZE];
+        write(buf, NumberCodec::WriteFloat(buf, v));
     }
 
     void StringBuilderStreamer::write_json_null() {
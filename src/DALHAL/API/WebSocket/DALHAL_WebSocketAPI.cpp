@@ -31,6 +31,8 @@
 #endif
 
 #include <DALHAL/API/DALHAL_CommandExecutor.h>
+#include "DALHAL_WebSocketRx.h"
+#include "DALHAL_WebSocketTx.h"
 
 #include <DALHAL/Support/DALHAL_Logger.h>
 
@@ -44,12 +46,46 @@
 #include "FrontendFiles/DALHAL_VirtualFile.h"
 #include "FrontendFiles/DALHAL_FileList.h"
 
+#include <DALHAL/Core/JsonConfig/DALHAL_JSON_Schema_Cache.h>
+
 namespace DALHAL {
 
     AsyncWebServer* WebSocketAPI::asyncWebserver = nullptr;
     AsyncWebSocket* WebSocketAPI::asyncWebSocket = nullptr;
     bool WebSocketAPI::failsafeMode = false;
 
+    CommandCallback WebSocketAPI::ClientCallback(uint32_t clientId) {
+        // never waits for the socket, a slow client must not stall the main loop for everyone
+        return [clientId](const ZeroCopyString& body, CmdCbType type) -> bool {
+            return WebSocketTx::Enqueue(clientId, body.start, body.Length(), type);
+        };
+    }
+
+    WebSocketTx::SendResult WebSocketAPI::TrySend(uint32_t clientId, const char* data, size_t len, CmdCbType type) {
+        AsyncWebSocketClient* c = asyncWebSocket->client(clientId);
+        if (c == nullptr) {
+            return WebSocketTx::SendResult::Gone;
+        }
+        if (c->canSend() == false) {
+            return WebSocketTx::SendResult::Busy; // TCP buffer full / closing
+        }
+        if (type == CmdCbType::Control) {
+            // send control as text
+            c->text(data, len);
+        } else {
+            // send data as binary to make it separate from control
+            c->binary(data, len);
+        }
+        return WebSocketTx::SendResult::Sent;
+    }
+
+    void WebSocketAPI::DisconnectClient(uint32_t clientId) {
+        AsyncWebSocketClient* c = asyncWebSocket->client(clientId);
+        if (c != nullptr) {
+            c->close(1008, "outbound queue over quota");
+        }
+    }
+
     void WebSocketAPI::onWsEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len)
     {
         //Serial.println("onWsEvent");
@@ -74,68 +110,49 @@ namespace DALHAL {
             Serial.print(F("WS client #"));
             Serial.print(client->id());
             Serial.print(F(" disconnected"));
-            
+            WebSocketRx::OnDisconnect(client->id());
+            // queued behind the client's pending frames, releases its BinaryCommand handles
+            CommandExecutor_LOCK_QUEUE();
+            CommandExecutor::g_pending.push({ std::string(), nullptr, true, client->id() });
+            CommandExecutor_UNLOCK_QUEUE();
             break;
 
         case WS_EVT_DATA: {
             AwsFrameInfo *info = (AwsFrameInfo*)arg;
-
-            if (!info->final || info->index != 0 || info->len != len) {
-                Serial.println(F("WS EVT_DATA rx error"));
-                return;
+            // a message can be split into several frames and each frame into several tcp chunks
+            const bool messageStart = (info->num == 0) && (info->index == 0);
+            const bool messageEnd = info->final && (info->index + len) == info->len;
+            const bool isText = info->message_opcode == WS_TEXT;
+            const uint32_t clientId = client->id();
+            CommandCallback cb = ClientCallback(clientId);
+
+            std::string cmd;
+            WebSocketRx::Result res = WebSocketRx::OnData(clientId, isText, messageStart, messageEnd, data, len, cb, cmd);
+            if (res == WebSocketRx::Result::Reply) {
+                client->text(cmd.c_str(), cmd.length());
+                break;
             }
-            if (info->opcode != WS_TEXT) {
-                Serial.println(F("info->opcode != WS_TEXT"));
-                return;
+            if (res == WebSocketRx::Result::BinaryCommand) {
+                CommandExecutor_LOCK_QUEUE();
+                CommandExecutor::g_pending.push({ std::move(cmd), cb, true, clientId });
+                CommandExecutor_UNLOCK_QUEUE();
+                break;
+            }
+            if (res != WebSocketRx::Result::Command) {
+                break;
             }
-
-            std::string cmd((char*)data, len);
             //Serial.printf("WS RX: %s\n", cmd.c_str());
 #if defined(DALHAL_SYSTEM_H_)
             // absolute failsafe command as WS run througth AsyncWebServer and runs in the BG it's mostly allways available
-            ZeroCopyString zcCmd((char*)data, len);
+            ZeroCopyString zcCmd(cmd.c_str(), cmd.length());
             
             if (zcCmd.EqualsIC(F("system/EnterRecoveryMode"))) {
                 System::EnterRecoveryMode();
             }
 #endif
             //client->text("ACK");
-            uint32_t clientId = client->id();
-
             CommandExecutor_LOCK_QUEUE();
-            CommandExecutor::g_pending.push({
-                std::move(cmd),
-                [clientId](const ZeroCopyString& body, CmdCbType type) -> bool {
-                    
-                    AsyncWebSocketClient* c = asyncWebSocket->client(clientId);
-
-                    if (!c) {
-                        GlobalLogger.Error(F("client gone while WebSocket write"));
-                        Serial.println(F("client gone while WebSocket write"));
-                        return false;                 // client gone
-                    }
-                    //bool abortSend = false;
-                    uint32_t retryCount = 0;
-                    while (!c->canSend()) {
-                        delay(1);
-                        retryCount++;
-                        if (retryCount > 10000) {
-                            //abortSend = true;
-                            GlobalLogger.Error(F("client could not write WebSocket data"));
-                            Serial.println(F("client could not write WebSocket data"));
-                            return false;
-                        }
-                    }      // TCP buffer full / closing
-                    if (type == CmdCbType::Control) {
-                        // send control as text
-                        c->text(body.start, body.Length());
-                    } else if (type == CmdCbType::Data) {
-                        // send data as binary to make it separate from control
-                        c->binary(body.start, body.Length());
-                    }                    
-                    return true;
-                }
-            });
+            CommandExecutor::g_pending.push({ std::move(cmd), cb });
             CommandExecutor_UNLOCK_QUEUE();
 
             break;
@@ -167,6 +184,49 @@ namespace DALHAL {
         request->send_P(200, F("text/html"), HTML_WS_CONSOLE);
     }*/
 
+    /** cached LittleFS.exists results of the /api/<file> overrides of the virtual files,
+        bit n belongs to virtual file n and the cache is reset when LittleFS_ext reports a change */
+    static uint32_t fsOverrideKnown = 0;
+    static uint32_t fsOverridePresent = 0;
+    static uint32_t fsOverrideChangeCounter = 0;
+
+    static bool HasFsOverride(const ApiVirtualFile* vFile, const String& path) {
+        const size_t index = GetApiVirtualFileIndex(vFile);
+        if (index >= 32) return LittleFS.exists(path);
+
+        if (fsOverrideChangeCounter != LittleFS_ext::change_counter()) {
+            fsOverrideChangeCounter = LittleFS_ext::change_counter();
+            fsOverrideKnown = 0;
+            fsOverridePresent = 0;
+        }
+        const uint32_t bit = 1UL << index;
+        if ((fsOverrideKnown & bit) == 0) {
+            fsOverrideKnown |= bit;
+            if (LittleFS.exists(path)) fsOverridePresent |= bit;
+        }
+        return (fsOverridePresent & bit) != 0;
+    }
+
+    /** etag can be in progmem or ram */
+    static void AddETagHeaders(AsyncWebServerResponse* response, PGM_P etag) {
+        response->addHeader(F("ETag"), String(FPSTR(etag)));
+        // the ETag changes with the firmware, so let the browser revalidate instead of guessing an age
+        response->addHeader(F("Cache-Control"), F("no-cache"));
+    }
+
+    /** answers 304 and returns true when the client already has etag */
+    static bool SendNotModified(AsyncWebServerRequest* request, PGM_P etag) {
+        if (request->hasHeader(F("If-None-Match")) == false) return false;
+        const AsyncWebHeader* ifNoneMatch = request->getHeader(F("If-None-Match"));
+        // strstr as the header can be a list and/or have a W/ prefix
+        if (ifNoneMatch == nullptr || strstr_P(ifNoneMatch->value().c_str(), etag) == nullptr) return false;
+
+        AsyncWebServerResponse* response = request->beginResponse(304);
+        AddETagHeaders(response, etag);
+        request->send(response);
+        return true;
+    }
+
     void WebSocketAPI::GetAnyFile_Handler(AsyncWebServerRequest* request) {
         const String& url = request->url();
         const bool isRoot = url.length() == 1;
@@ -182,21 +242,69 @@ namespace DALHAL {
             path += url;
         }
 
-        if (LittleFS.exists(path)) {
-            request->send(LittleFS, path);
-        } else {
-            
-            ZeroCopyString zcFilePath = url.c_str();
-            if (zcFilePath.StartsWith('/')) {
-                zcFilePath.start++;
-            }
-            const ApiVirtualFile* vFile = GetApiVirtualFile(zcFilePath);
-            if (vFile == nullptr) {
+        ZeroCopyString zcFilePath = path.c_str() + sizeof("/api"); // skip /api/, also maps / to index.html
+        const ApiVirtualFile* vFile = GetApiVirtualFile(zcFilePath);
+
+        if (vFile == nullptr) {
+            // only files on LittleFS left, these are rare so no caching here
+            if (LittleFS.exists(path)) {
+                request->send(LittleFS, path);
+            } else {
                 request->send(404, F("text/plain"), F("file not found"));
+            }
+            return;
+        }
+        if (HasFsOverride(vFile, path)) {
+            request->send(LittleFS, path);
+            return;
+        }
+
+        if (vFile->etag != nullptr && SendNotModified(request, vFile->etag)) {
+            return;
+        }
+        AsyncWebServerResponse* response = request->beginResponse_P(200, vFile->mime, vFile->data, vFile->size);
+        if (vFile->gzip) {
+            response->addHeader(F("Content-Encoding"), F("gzip"));
+        }
+        if (vFile->etag != nullptr) {
+            AddETagHeaders(response, vFile->etag);
+        }
+        request->send(response);
+    }
+
+    void WebSocketAPI::GetCfgSchema_Handler(AsyncWebServerRequest* request) {
+#if DALHAL_JSON_SCHEMA_CACHE
+        const char* etag = JsonSchema::Cache::GetETag();
+        if (JsonSchema::Cache::IsReady() == false) {
+            // rendering takes a while, let the main loop do it instead of the web server task
+            CommandExecutor_LOCK_QUEUE();
+            CommandExecutor::g_pending.push({ std::string("hal/meta/reg/cfgschema/build"), [](const ZeroCopyString&, CmdCbType) -> bool { return true; } });
+            CommandExecutor_UNLOCK_QUEUE();
+            AsyncWebServerResponse* response = request->beginResponse(503, F("text/plain"), F("schema is being rendered"));
+            response->addHeader(F("Retry-After"), F("1"));
+            request->send(response);
+            return;
+        }
+        if (JsonSchema::Cache::HasGzip()) {
+            etag = JsonSchema::Cache::GetGzipETag();
+            if (SendNotModified(request, etag)) {
                 return;
             }
-            request->send_P(200, vFile->mime, vFile->data, vFile->size);
+            AsyncWebServerResponse* response = request->beginResponse(LittleFS, F(DALHAL_JSON_SCHEMA_CACHE_GZ_FILE), F("application/json"));
+            response->addHeader(F("Content-Encoding"), F("gzip"));
+            AddETagHeaders(response, etag);
+            request->send(response);
+            return;
         }
+        if (SendNotModified(request, etag)) {
+            return;
+        }
+        AsyncWebServerResponse* response = request->beginResponse(LittleFS, F(DALHAL_JSON_SCHEMA_CACHE_FILE), F("application/json"));
+        AddETagHeaders(response, etag);
+        request->send(response);
+#else
+        request->send(404, F("text/plain"), F("schema cache disabled, use the hal/meta/reg/cfgschema cmd"));
+#endif
     }
 
     void WebSocketAPI::setup(bool failsafeMode) {
@@ -210,11 +318,13 @@ namespace DALHAL {
             asyncWebserver->begin();
             return;
         }
+        WebSocketTx::Setup(TrySend, DisconnectClient);
         asyncWebserver = new AsyncWebServer(82);
         asyncWebSocket = new AsyncWebSocket("/ws");
         asyncWebSocket->onEvent(onWsEvent);
         asyncWebserver->addHandler(asyncWebSocket);
         //asyncWebserver->on("/", GetRootPage_Handler);
+        asyncWebserver->on("/cfgschema.json", HTTP_GET, GetCfgSchema_Handler);
         asyncWebserver->onNotFound(GetAnyFile_Handler);
         asyncWebserver->begin();
         asyncWebSocket->enable(true);
@@ -227,7 +337,7 @@ namespace DALHAL {
             if (type == CmdCbType::Control) {
                 asyncWebSocket->textAll(msg, len);
                 return true;
-            } else if (type == CmdCbType::Data) {
+            } else {
                 // send data as binary to make it separate from control
                 asyncWebSocket->binaryAll(msg, len);
                 return true;
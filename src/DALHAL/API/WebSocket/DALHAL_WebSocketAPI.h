@@ -30,6 +30,7 @@
 
 #include <DALHAL/Core/Types/DALHAL_ZeroCopyString.h>
 #include <DALHAL/API/DALHAL_CommandCallback.h>
+#include "DALHAL_WebSocketTx.h"
 
 #if defined(ESP32) || defined(ESP8266)
   #include <Support/LittleFS_ext.h>
@@ -51,11 +52,17 @@ namespace DALHAL {
         static AsyncWebSocket* asyncWebSocket;
         //static void GetRootPage_Handler(AsyncWebServerRequest* request);
         static void GetAnyFile_Handler(AsyncWebServerRequest* request);
+        static void GetCfgSchema_Handler(AsyncWebServerRequest* request);
         static void onWsEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len);
+        /** callback that queues command results for the given client */
+        static CommandCallback ClientCallback(uint32_t clientId);
+        static WebSocketTx::SendResult TrySend(uint32_t clientId, const char* data, size_t len, CmdCbType type);
+        static void DisconnectClient(uint32_t clientId);
         static bool failsafeMode;
     public:
         static void setup(bool failsafeMode = false);
         inline static void loop() { 
+          WebSocketTx::Drain();
           asyncWebSocket->cleanupClients();
         }
 
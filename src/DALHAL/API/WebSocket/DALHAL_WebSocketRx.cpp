@@ -0,0 +1,366 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DALHAL_WebSocketRx.h"
+
+#include <string.h>
+
+#include <DALHAL/API/DALHAL_BinaryCommand.h>
+#include <DALHAL/API/DALHAL_CommandExecutor.h>
+#include <DALHAL/Support/DALHAL_Logger.h>
+#include <DALHAL/Support/base64.h>
+
+namespace DALHAL {
+
+    WebSocketRx::ClientSlot WebSocketRx::slots[DALHAL_WEBSOCKET_API_RX_MAX_CLIENTS];
+
+    //  ███████ ██ ██      ███████     ███████ ██ ███    ██ ██   ██
+    //  ██      ██ ██      ██          ██      ██ ████   ██ ██  ██
+    //  █████   ██ ██      █████       ███████ ██ ██ ██  ██ █████
+    //  ██      ██ ██      ██               ██ ██ ██  ██ ██ ██  ██
+    //  ██      ██ ███████ ███████     ███████ ██ ██   ████ ██   ██
+
+    WebSocketFileSink* WebSocketFileSink::Create(const ZeroCopyString& zcPath) {
+        WebSocketFileSink* sink = new WebSocketFileSink();
+        if (sink == nullptr) return nullptr;
+#if defined(ESP32) || defined(ESP8266)
+        sink->path = '/';
+#endif
+        sink->path += zcPath.ToString();
+        sink->partPath = sink->path + ".part";
+        if (sink->writer.open(sink->partPath.c_str()) != LittleFS_ext::FileResult::Success) {
+            GlobalLogger.Error(F("ws upload could not create: "), sink->partPath.c_str());
+            delete sink;
+            return nullptr;
+        }
+        return sink;
+    }
+
+    bool WebSocketFileSink::write(const uint8_t* data, size_t len) {
+        return writer.write(data, len);
+    }
+
+    bool WebSocketFileSink::finish() {
+        writer.close();
+        if (LittleFS_ext::rename_file(partPath.c_str(), path.c_str()) == false) {
+            GlobalLogger.Error(F("ws upload could not rename to: "), path.c_str());
+            LittleFS_ext::remove_file(partPath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    void WebSocketFileSink::abort() {
+        writer.close();
+        LittleFS_ext::remove_file(partPath.c_str());
+    }
+
+    //  ██████  ███████ ██    ██ ██  ██████ ███████     ███████ ██ ███    ██ ██   ██
+    //  ██   ██ ██      ██    ██ ██ ██      ██          ██      ██ ████   ██ ██  ██
+    //  ██   ██ █████   ██    ██ ██ ██      █████       ███████ ██ ██ ██  ██ █████
+    //  ██   ██ ██       ██  ██  ██ ██      ██               ██ ██ ██  ██ ██ ██  ██
+    //  ██████  ███████   ████   ██  ██████ ███████     ███████ ██ ██   ████ ██   ██
+
+    WebSocketDeviceSink::WebSocketDeviceSink(const ZeroCopyString& zcTarget, uint8_t unitBytes, uint32_t startOffset, CommandCallback replyCb) :
+        target(zcTarget.ToString()), unitBytes(unitBytes), offset(startOffset), replyCb(replyCb) { }
+
+    bool WebSocketDeviceSink::write(const uint8_t* data, size_t len) {
+        // complete an element that was split between the previous and this fragment
+        if (carryLen > 0) {
+            while (carryLen < unitBytes && len > 0) {
+                carry[carryLen++] = *data++;
+                len--;
+            }
+            if (carryLen < unitBytes) return true;
+            queueChunk(carry, carryLen);
+            carryLen = 0;
+        }
+        const size_t whole = len - (len % unitBytes);
+        if (whole > 0) queueChunk(data, whole);
+        for (size_t i = whole; i < len; i++) carry[carryLen++] = data[i];
+        return true;
+    }
+
+    bool WebSocketDeviceSink::finish() {
+        if (carryLen != 0 || heldChunk.empty()) {
+            heldChunk.clear();
+            return false; // not a whole number of elements
+        }
+        queueHeld(true);
+        return true;
+    }
+
+    void WebSocketDeviceSink::abort() {
+        // chunks already queued stay staged (hold) in the device and are never shown
+        heldChunk.clear();
+    }
+
+    void WebSocketDeviceSink::queueChunk(const uint8_t* data, size_t len) {
+        if (!heldChunk.empty()) queueHeld(false);
+        String b64 = b64urlEncode(data, len);
+        heldChunk.reserve(sizeof("hal/write/string//4294967295/") + target.length() + b64.length());
+        heldChunk = "hal/write/string/";
+        heldChunk += target;
+        heldChunk += '/';
+        heldChunk += std::to_string(offset);
+        heldChunk += '/';
+        heldChunk.append(b64.c_str(), b64.length());
+        offset += len / unitBytes;
+    }
+
+    void WebSocketDeviceSink::queueHeld(bool last) {
+        if (!last) heldChunk += "/hold";
+        // only the result of the last chunk is of interest to the client
+        CommandCallback cb = last ? replyCb : CommandCallback([](const ZeroCopyString&, CmdCbType) -> bool { return true; });
+        CommandExecutor_LOCK_QUEUE();
+        CommandExecutor::g_pending.push({ std::move(heldChunk), cb });
+        CommandExecutor_UNLOCK_QUEUE();
+        heldChunk.clear();
+    }
+
+    //  ██████  ██   ██
+    //  ██   ██  ██ ██
+    //  ██████    ███
+    //  ██   ██  ██ ██
+    //  ██   ██ ██   ██
+
+    WebSocketRx::ClientSlot* WebSocketRx::GetSlot(uint32_t clientId, bool create) {
+        ClientSlot* freeSlot = nullptr;
+        for (int i = 0; i < DALHAL_WEBSOCKET_API_RX_MAX_CLIENTS; i++) {
+            if (slots[i].used) {
+                if (slots[i].clientId == clientId) return &slots[i];
+            } else if (freeSlot == nullptr) {
+                freeSlot = &slots[i];
+            }
+        }
+        if (create == false || freeSlot == nullptr) return nullptr;
+        freeSlot->used = true;
+        freeSlot->clientId = clientId;
+        return freeSlot;
+    }
+
+    void WebSocketRx::ReleaseIfIdle(ClientSlot& slot) {
+        if (slot.sink != nullptr || slot.buffer.empty() == false || slot.overflow) return;
+        std::string().swap(slot.buffer); // give the memory back
+        slot.used = false;
+    }
+
+    void WebSocketRx::EndUpload(ClientSlot& slot, bool abortSink) {
+        if (slot.sink != nullptr) {
+            if (abortSink) slot.sink->abort();
+            delete slot.sink;
+            slot.sink = nullptr;
+        }
+        slot.sinkStarted = false;
+        slot.sinkBytes = 0;
+        ReleaseIfIdle(slot);
+    }
+
+    void WebSocketRx::OnDisconnect(uint32_t clientId) {
+        ClientSlot* slot = GetSlot(clientId, false);
+        if (slot == nullptr) return;
+        slot->buffer.clear();
+        slot->bufferIsBinary = false;
+        slot->overflow = false;
+        EndUpload(*slot, true);
+    }
+
+    WebSocketRx::Result WebSocketRx::OnData(uint32_t clientId, bool isText, bool messageStart, bool messageEnd,
+                                            const uint8_t* data, size_t len, const CommandCallback& replyCb, std::string& out) {
+        if (isText == false) {
+            return OnBinaryData(clientId, messageStart, messageEnd, data, len, out);
+        }
+        if (messageStart && messageEnd) {
+            // the common case, a whole command in one piece
+            return OnTextMessage(clientId, (const char*)data, len, replyCb, out);
+        }
+        ClientSlot* slot = GetSlot(clientId, messageStart);
+        if (slot == nullptr) {
+            if (messageStart == false) return Result::None; // rest of a message that could not be received
+            out = "{\"error\":\"no free rx slot\"}";
+            return Result::Reply;
+        }
+        if (messageStart) {
+            slot->buffer.clear();
+            slot->bufferIsBinary = false;
+            slot->overflow = false;
+        }
+        if (slot->overflow == false) {
+            if (slot->buffer.length() + len > DALHAL_WEBSOCKET_API_RX_MAX_MESSAGE_SIZE) {
+                slot->overflow = true;
+                std::string().swap(slot->buffer);
+            } else {
+                slot->buffer.append((const char*)data, len);
+            }
+        }
+        if (messageEnd == false) return Result::None;
+
+        if (slot->overflow) {
+            slot->overflow = false;
+            ReleaseIfIdle(*slot);
+            out = "{\"error\":\"message too large\",\"max\":" + std::to_string(DALHAL_WEBSOCKET_API_RX_MAX_MESSAGE_SIZE) + "}";
+            return Result::Reply;
+        }
+        std::string message;
+        message.swap(slot->buffer);
+        ReleaseIfIdle(*slot);
+        Result res = OnTextMessage(clientId, message.c_str(), message.length(), replyCb, out);
+        if (res == Result::Command) out.swap(message); // hand over the reassembled buffer instead of copying it
+        return res;
+    }
+
+    WebSocketRx::Result WebSocketRx::OnTextMessage(uint32_t clientId, const char* data, size_t len, const CommandCallback& replyCb, std::string& out) {
+        const size_t prefixLen = sizeof(DALHAL_WEBSOCKET_API_RX_UPLOAD_CMD) - 1;
+        if (len <= prefixLen || strncmp(data, DALHAL_WEBSOCKET_API_RX_UPLOAD_CMD, prefixLen) != 0) {
+            out.assign(data, len);
+            return Result::Command;
+        }
+        ClientSlot* slot = GetSlot(clientId, true);
+        if (slot == nullptr) {
+            out = "{\"error\":\"no free rx slot\"}";
+            return Result::Reply;
+        }
+        ZeroCopyString zcUploadCmd(data + prefixLen, len - prefixLen);
+        return ArmUpload(*slot, zcUploadCmd, replyCb, out);
+    }
+
+    /** file/<path> or device/<uid#function>[/<unitBytes>[/<startOffset>]] */
+    WebSocketRx::Result WebSocketRx::ArmUpload(ClientSlot& slot, ZeroCopyString& zcUploadCmd, const CommandCallback& replyCb, std::string& out) {
+        EndUpload(slot, true); // a new upload replaces one that was armed but not started
+        slot.used = true;
+
+        ZeroCopyString zcType = zcUploadCmd.SplitOffHead('/');
+        zcUploadCmd.Trim();
+        if (zcType.EqualsIC("file")) {
+            if (zcUploadCmd.IsEmpty() || zcUploadCmd.FindString("..") != nullptr) {
+                out = "{\"error\":\"invalid upload path\"}";
+            } else {
+                slot.sink = WebSocketFileSink::Create(zcUploadCmd);
+                if (slot.sink == nullptr) out = "{\"error\":\"could not create file\"}";
+            }
+        } else if (zcType.EqualsIC("device")) {
+            ZeroCopyString zcTarget = zcUploadCmd.SplitOffHead('/');
+            ZeroCopyString zcUnitBytes = zcUploadCmd.SplitOffHead('/');
+            ZeroCopyString zcStartOffset = zcUploadCmd.SplitOffHead('/');
+            uint32_t unitBytes = 1;
+            uint32_t startOffset = 0;
+            if (zcTarget.IsEmpty() ||
+                (zcUnitBytes.NotEmpty() && (zcUnitBytes.ConvertTo_uint32(unitBytes) == false || unitBytes == 0 || unitBytes > 8)) ||
+                (zcStartOffset.NotEmpty() && zcStartOffset.ConvertTo_uint32(startOffset) == false)) {
+                out = "{\"error\":\"invalid device upload parameters\"}";
+            } else {
+                slot.sink = new WebSocketDeviceSink(zcTarget, (uint8_t)unitBytes, startOffset, replyCb);
+                if (slot.sink == nullptr) out = "{\"error\":\"alloc fail\"}";
+            }
+        } else {
+            out = "{\"error\":\"unknown upload type\"}";
+        }
+        if (slot.sink == nullptr) {
+            ReleaseIfIdle(slot);
+            return Result::Reply;
+        }
+        out = "{\"upload\":\"ready\",\"max\":" + std::to_string(slot.sink->maxSize()) + "}";
+        return Result::Reply;
+    }
+
+    WebSocketRx::Result WebSocketRx::OnBinaryData(uint32_t clientId, bool messageStart, bool messageEnd, const uint8_t* data, size_t len, std::string& out) {
+        ClientSlot* slot = GetSlot(clientId, false);
+        if (slot == nullptr || slot->sink == nullptr) {
+            // without an armed upload only binary command frames are accepted
+            return OnBinaryCommandData(clientId, messageStart, messageEnd, data, len, out);
+        }
+        if (messageStart) {
+            slot->sinkStarted = true;
+            slot->sinkBytes = 0;
+        }
+        if (slot->sinkStarted == false) return Result::None; // tail of a message that started before the upload was armed
+
+        slot->sinkBytes += len;
+        const size_t maxSize = slot->sink->maxSize();
+        if (slot->sinkBytes > maxSize) {
+            EndUpload(*slot, true);
+            out = "{\"upload\":\"FAIL\",\"error\":\"too large\",\"max\":" + std::to_string(maxSize) + "}";
+            return Result::Reply;
+        }
+        if (len > 0 && slot->sink->write(data, len) == false) {
+            EndUpload(*slot, true);
+            out = "{\"upload\":\"FAIL\",\"error\":\"write failed\"}";
+            return Result::Reply;
+        }
+        if (messageEnd == false) return Result::None;
+
+        const size_t bytes = slot->sinkBytes;
+        const bool ok = slot->sink->finish();
+        EndUpload(*slot, false);
+        if (ok) {
+            out = "{\"upload\":\"OK\",\"bytes\":" + std::to_string(bytes) + "}";
+        } else {
+            out = "{\"upload\":\"FAIL\",\"bytes\":" + std::to_string(bytes) + "}";
+        }
+        return Result::Reply;
+    }
+
+    WebSocketRx::Result WebSocketRx::OnBinaryCommandData(uint32_t clientId, bool messageStart, bool messageEnd, const uint8_t* data, size_t len, std::string& out) {
+        if (messageStart && BinaryCommand::IsFrame(data, len) == false) return Result::None; // not a command, ignored
+        if (messageStart && messageEnd) {
+            // the common case, a whole frame in one piece
+            out.assign((const char*)data, len);
+            return Result::BinaryCommand;
+        }
+        ClientSlot* slot = GetSlot(clientId, messageStart);
+        if (slot == nullptr) {
+            if (messageStart == false) return Result::None; // rest of a message that could not be received
+            out = "{\"error\":\"no free rx slot\"}";
+            return Result::Reply;
+        }
+        if (messageStart) {
+            slot->buffer.clear();
+            slot->bufferIsBinary = true;
+            slot->overflow = false;
+        } else if (slot->bufferIsBinary == false) {
+            return Result::None; // rest of a binary message that is not a command
+        }
+        if (slot->overflow == false) {
+            if (slot->buffer.length() + len > DALHAL_WEBSOCKET_API_RX_MAX_MESSAGE_SIZE) {
+                slot->overflow = true;
+                std::string().swap(slot->buffer);
+            } else {
+                slot->buffer.append((const char*)data, len);
+            }
+        }
+        if (messageEnd == false) return Result::None;
+
+        slot->bufferIsBinary = false;
+        if (slot->overflow) {
+            slot->overflow = false;
+            ReleaseIfIdle(*slot);
+            out = "{\"error\":\"message too large\",\"max\":" + std::to_string(DALHAL_WEBSOCKET_API_RX_MAX_MESSAGE_SIZE) + "}";
+            return Result::Reply;
+        }
+        out.clear();
+        out.swap(slot->buffer);
+        ReleaseIfIdle(*slot);
+        return Result::BinaryCommand;
+    }
+
+}
@@ -0,0 +1,179 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+
+#include <DALHAL/Core/Types/DALHAL_ZeroCopyString.h>
+#include <DALHAL/API/DALHAL_CommandCallback.h>
+
+#if defined(ESP32) || defined(ESP8266)
+  #include <Support/LittleFS_ext.h>
+#else
+  #include <LittleFS_ext.h>
+#endif
+
+/** max number of clients that can have a fragmented message or an upload in progress at the same time */
+#ifndef DALHAL_WEBSOCKET_API_RX_MAX_CLIENTS
+#define DALHAL_WEBSOCKET_API_RX_MAX_CLIENTS 8
+#endif
+
+/** max size of a text command or binary command frame that arrives in more than one fragment */
+#ifndef DALHAL_WEBSOCKET_API_RX_MAX_MESSAGE_SIZE
+#if defined(ESP8266)
+#define DALHAL_WEBSOCKET_API_RX_MAX_MESSAGE_SIZE 4096
+#else
+#define DALHAL_WEBSOCKET_API_RX_MAX_MESSAGE_SIZE 16384
+#endif
+#endif
+
+/** max size of a streamed upload, the data itself is never buffered as a whole */
+#ifndef DALHAL_WEBSOCKET_API_RX_MAX_UPLOAD_SIZE
+#define DALHAL_WEBSOCKET_API_RX_MAX_UPLOAD_SIZE (1024*1024)
+#endif
+
+/** 
+ * max size of a streamed device upload, every fragment is queued as a base64 command
+ * until the main loop executes it, so this bounds the memory the queue can take
+ */
+#ifndef DALHAL_WEBSOCKET_API_RX_MAX_DEVICE_UPLOAD_SIZE
+#define DALHAL_WEBSOCKET_API_RX_MAX_DEVICE_UPLOAD_SIZE DALHAL_WEBSOCKET_API_RX_MAX_MESSAGE_SIZE
+#endif
+
+/** text command prefix that arms an upload for the next binary message of the same client */
+#define DALHAL_WEBSOCKET_API_RX_UPLOAD_CMD "ws/upload/"
+
+namespace DALHAL {
+
+    /** receives one binary message fragment by fragment, as they arrive */
+    class WebSocketRxSink {
+    public:
+        virtual ~WebSocketRxSink() = default;
+        /** returns false to abort the upload */
+        virtual bool write(const uint8_t* data, size_t len) = 0;
+        /** called after the last fragment, returns false if the upload could not be completed */
+        virtual bool finish() = 0;
+        /** called instead of finish when the upload is aborted (disconnect, error or too large) */
+        virtual void abort() = 0;
+        /** max total size of the upload */
+        virtual size_t maxSize() const { return DALHAL_WEBSOCKET_API_RX_MAX_UPLOAD_SIZE; }
+    };
+
+    /** 
+     * writes to <path>.part and renames it to <path> when the whole message has been received,
+     * so a broken upload never replaces a working file
+     */
+    class WebSocketFileSink : public WebSocketRxSink {
+    public:
+        /** returns nullptr if the file could not be created */
+        static WebSocketFileSink* Create(const ZeroCopyString& zcPath);
+
+        bool write(const uint8_t* data, size_t len) override;
+        bool finish() override;
+        void abort() override;
+    private:
+        WebSocketFileSink() = default;
+        std::string path;
+        std::string partPath;
+        LittleFS_ext::FileWriter writer;
+    };
+
+    /** 
+     * forwards every fragment as a queued hal/write/string/<target>/<offset>/<b64url data>/hold command,
+     * the last one without hold, so any device string function with that signature (i.e. WS2812 frame)
+     * can take streamed data, the commands are executed from the main loop as any other command
+     */
+    class WebSocketDeviceSink : public WebSocketRxSink {
+    public:
+        /** unitBytes is the size of one element (3 for RGB pixels), offsets are counted in elements */
+        WebSocketDeviceSink(const ZeroCopyString& zcTarget, uint8_t unitBytes, uint32_t startOffset, CommandCallback replyCb);
+
+        bool write(const uint8_t* data, size_t len) override;
+        bool finish() override;
+        void abort() override;
+        size_t maxSize() const override { return DALHAL_WEBSOCKET_API_RX_MAX_DEVICE_UPLOAD_SIZE; }
+    private:
+        std::string target;
+        uint8_t unitBytes;
+        uint32_t offset;
+        CommandCallback replyCb;
+        /** bytes of an element split between two fragments */
+        uint8_t carry[8];
+        uint8_t carryLen = 0;
+        /** the previous chunk is held back so that the last one can be sent without hold */
+        std::string heldChunk;
+        void queueChunk(const uint8_t* data, size_t len);
+        void queueHeld(bool last);
+    };
+
+    class WebSocketRx {
+    public:
+        enum class Result {
+            /** nothing to do (fragment consumed or message ignored) */
+            None,
+            /** out holds a complete command to queue */
+            Command,
+            /** out holds a reply to send to the client */
+            Reply,
+            /** out holds a complete BinaryCommand frame to queue */
+            BinaryCommand
+        };
+
+        /** 
+         * feed the data of one receive event, messages that arrive in one piece don't use any slot,
+         * replyCb is used for replies of commands generated by an upload
+         */
+        static Result OnData(uint32_t clientId, bool isText, bool messageStart, bool messageEnd,
+                             const uint8_t* data, size_t len, const CommandCallback& replyCb, std::string& out);
+        /** releases the slot of the client and aborts any upload in progress */
+        static void OnDisconnect(uint32_t clientId);
+
+    private:
+        struct ClientSlot {
+            bool used = false;
+            uint32_t clientId = 0;
+            /** text message or binary command frame being reassembled */
+            std::string buffer;
+            /** buffer holds a binary command frame */
+            bool bufferIsBinary = false;
+            /** the rest of the current message is dropped */
+            bool overflow = false;
+            /** armed by a DALHAL_WEBSOCKET_API_RX_UPLOAD_CMD, takes the next binary message */
+            WebSocketRxSink* sink = nullptr;
+            bool sinkStarted = false;
+            size_t sinkBytes = 0;
+        };
+        static ClientSlot slots[DALHAL_WEBSOCKET_API_RX_MAX_CLIENTS];
+
+        static ClientSlot* GetSlot(uint32_t clientId, bool create);
+        static void ReleaseIfIdle(ClientSlot& slot);
+        static void EndUpload(ClientSlot& slot, bool abortSink);
+        static Result ArmUpload(ClientSlot& slot, ZeroCopyString& zcUploadCmd, const CommandCallback& replyCb, std::string& out);
+        static Result OnTextMessage(uint32_t clientId, const char* data, size_t len, const CommandCallback& replyCb, std::string& out);
+        static Result OnBinaryData(uint32_t clientId, bool messageStart, bool messageEnd, const uint8_t* data, size_t len, std::string& out);
+        static Result OnBinaryCommandData(uint32_t clientId, bool messageStart, bool messageEnd, const uint8_t* data, size_t len, std::string& out);
+    };
+}
@@ -0,0 +1,156 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DALHAL_WebSocketTx.h"
+
+#include <DALHAL/Support/DALHAL_Logger.h>
+
+namespace DALHAL {
+
+    WebSocketTx::OverflowPolicy WebSocketTx::policy = DALHAL_WEBSOCKET_API_TX_OVERFLOW_POLICY;
+    WebSocketTx::ClientSlot WebSocketTx::slots[DALHAL_WEBSOCKET_API_TX_MAX_CLIENTS];
+    WebSocketTx::TrySendFn WebSocketTx::trySend = nullptr;
+    WebSocketTx::DisconnectFn WebSocketTx::disconnect = nullptr;
+
+    void WebSocketTx::Setup(TrySendFn trySendFn, DisconnectFn disconnectFn) {
+        trySend = trySendFn;
+        disconnect = disconnectFn;
+    }
+
+    WebSocketTx::ClientSlot* WebSocketTx::GetSlot(uint32_t clientId, bool create) {
+        ClientSlot* freeSlot = nullptr;
+        for (int i = 0; i < DALHAL_WEBSOCKET_API_TX_MAX_CLIENTS; i++) {
+            if (slots[i].used) {
+                if (slots[i].clientId == clientId) return &slots[i];
+            } else if (freeSlot == nullptr) {
+                freeSlot = &slots[i];
+            }
+        }
+        if (create == false || freeSlot == nullptr) return nullptr;
+        freeSlot->used = true;
+        freeSlot->clientId = clientId;
+        return freeSlot;
+    }
+
+    void WebSocketTx::Release(ClientSlot& slot) {
+        std::deque<Entry>().swap(slot.queue); // give the memory back
+        slot.queuedBytes = 0;
+        slot.overQuota = false;
+        slot.droppedMessages = 0;
+        slot.used = false;
+    }
+
+    bool WebSocketTx::Enqueue(uint32_t clientId, const char* data, size_t len, CmdCbType type) {
+        if (trySend == nullptr) return false;
+        ClientSlot* slot = GetSlot(clientId, true);
+        if (slot == nullptr) {
+            GlobalLogger.Error(F("ws tx no free slot"));
+            return false;
+        }
+        // Data is one byte stream between the start/end markers, so consecutive chunks can share a frame,
+        // Control and BinaryMessage entries are separate messages and are never merged
+        if (type == CmdCbType::Data && slot->queue.empty() == false && slot->queue.back().type == CmdCbType::Data &&
+            slot->queue.back().payload.length() + len <= DALHAL_WEBSOCKET_API_TX_FRAME_SIZE) {
+            slot->queue.back().payload.append(data, len);
+        } else {
+            slot->queue.push_back({type, std::string()});
+            std::string& payload = slot->queue.back().payload;
+            if (type == CmdCbType::Data && len < DALHAL_WEBSOCKET_API_TX_FRAME_SIZE) payload.reserve(DALHAL_WEBSOCKET_API_TX_FRAME_SIZE);
+            payload.assign(data, len);
+        }
+        slot->queuedBytes += len;
+
+        if (DrainSlot(*slot, false) == false) {
+            Release(*slot);
+            return false;
+        }
+        return ApplyQuota(*slot);
+    }
+
+    bool WebSocketTx::DrainSlot(ClientSlot& slot, bool flushTail) {
+        while (slot.queue.empty() == false) {
+            Entry& e = slot.queue.front();
+            // keep filling a Data frame that is still the last queued item
+            if (!flushTail && slot.queue.size() == 1 && e.type == CmdCbType::Data && e.payload.length() < DALHAL_WEBSOCKET_API_TX_FRAME_SIZE) break;
+            SendResult res = trySend(slot.clientId, e.payload.c_str(), e.payload.length(), e.type);
+            if (res == SendResult::Busy) break;
+            if (res == SendResult::Gone) return false;
+            slot.queuedBytes -= e.payload.length();
+            slot.queue.pop_front();
+        }
+        if (slot.queuedBytes <= DALHAL_WEBSOCKET_API_TX_MAX_QUEUED_BYTES) slot.overQuota = false;
+        return true;
+    }
+
+    bool WebSocketTx::ApplyQuota(ClientSlot& slot) {
+        if (slot.queuedBytes <= DALHAL_WEBSOCKET_API_TX_MAX_QUEUED_BYTES) {
+            slot.overQuota = false;
+            return true;
+        }
+        if (policy == OverflowPolicy::DropOldest) {
+            // the newest message is always kept, even if it alone is over the quota
+            while (slot.queuedBytes > DALHAL_WEBSOCKET_API_TX_MAX_QUEUED_BYTES && slot.queue.size() > 1) {
+                slot.queuedBytes -= slot.queue.front().payload.length();
+                slot.queue.pop_front();
+                if (slot.droppedMessages++ == 0) GlobalLogger.Error(F("ws tx queue full, dropping oldest"));
+            }
+            return true;
+        }
+        if (slot.overQuota == false) {
+            slot.overQuota = true;
+            slot.overQuotaSince = millis();
+        }
+        if (slot.queuedBytes > 2 * DALHAL_WEBSOCKET_API_TX_MAX_QUEUED_BYTES) {
+            GlobalLogger.Error(F("ws tx queue overflow, disconnecting client"));
+            disconnect(slot.clientId);
+            Release(slot);
+            return false;
+        }
+        return true;
+    }
+
+    void WebSocketTx::Drain() {
+        if (trySend == nullptr) return;
+        for (int i = 0; i < DALHAL_WEBSOCKET_API_TX_MAX_CLIENTS; i++) {
+            ClientSlot& slot = slots[i];
+            if (slot.used == false) continue;
+            if (DrainSlot(slot, true) == false) {
+                Release(slot); // client gone
+                continue;
+            }
+            if (slot.overQuota && (uint32_t)(millis() - slot.overQuotaSince) > DALHAL_WEBSOCKET_API_TX_OVER_QUOTA_TIMEOUT_MS) {
+                GlobalLogger.Error(F("ws tx client stayed over quota, disconnecting"));
+                disconnect(slot.clientId);
+                Release(slot);
+                continue;
+            }
+            if (slot.queue.empty()) Release(slot);
+        }
+    }
+
+    size_t WebSocketTx::QueuedBytes(uint32_t clientId) {
+        ClientSlot* slot = GetSlot(clientId, false);
+        return (slot != nullptr) ? slot->queuedBytes : 0;
+    }
+
+}
@@ -0,0 +1,117 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <deque>
+
+#include <DALHAL/API/DALHAL_CommandCallback.h>
+
+/** max number of clients that can have queued output at the same time */
+#ifndef DALHAL_WEBSOCKET_API_TX_MAX_CLIENTS
+#define DALHAL_WEBSOCKET_API_TX_MAX_CLIENTS 8
+#endif
+
+/** Data chunks are coalesced into frames of up to this size (about one tcp segment) */
+#ifndef DALHAL_WEBSOCKET_API_TX_FRAME_SIZE
+#define DALHAL_WEBSOCKET_API_TX_FRAME_SIZE 1400
+#endif
+
+/** queued bytes per client before the overflow policy kicks in */
+#ifndef DALHAL_WEBSOCKET_API_TX_MAX_QUEUED_BYTES
+#if defined(ESP8266)
+#define DALHAL_WEBSOCKET_API_TX_MAX_QUEUED_BYTES 8192
+#else
+#define DALHAL_WEBSOCKET_API_TX_MAX_QUEUED_BYTES 32768
+#endif
+#endif
+
+/** with the Disconnect policy, a client that stays over its quota this long is disconnected */
+#ifndef DALHAL_WEBSOCKET_API_TX_OVER_QUOTA_TIMEOUT_MS
+#define DALHAL_WEBSOCKET_API_TX_OVER_QUOTA_TIMEOUT_MS 2000
+#endif
+
+/** WebSocketTx::OverflowPolicy::DropOldest or WebSocketTx::OverflowPolicy::Disconnect */
+#ifndef DALHAL_WEBSOCKET_API_TX_OVERFLOW_POLICY
+#define DALHAL_WEBSOCKET_API_TX_OVERFLOW_POLICY WebSocketTx::OverflowPolicy::Disconnect
+#endif
+
+namespace DALHAL {
+
+    /** 
+     * per client outbound queues, command responses are queued without blocking
+     * and sent from WebSocketAPI::loop() (and opportunistically while queuing) as the socket allows,
+     * must only be used from the main loop
+     */
+    class WebSocketTx {
+    public:
+        enum class OverflowPolicy {
+            /** drop the oldest queued data until the client is within its quota */
+            DropOldest,
+            /** disconnect clients that stay over their quota (or go over twice the quota) */
+            Disconnect
+        };
+        enum class SendResult { Sent, Busy, Gone };
+        using TrySendFn = SendResult(*)(uint32_t clientId, const char* data, size_t len, CmdCbType type);
+        using DisconnectFn = void(*)(uint32_t clientId);
+
+        static OverflowPolicy policy;
+
+        static void Setup(TrySendFn trySend, DisconnectFn disconnect);
+        /** queues a message, returns false if the client could not take it (gone, no free slot or disconnected by the policy) */
+        static bool Enqueue(uint32_t clientId, const char* data, size_t len, CmdCbType type);
+        /** sends as much as the clients can take, called from the main loop */
+        static void Drain();
+        static size_t QueuedBytes(uint32_t clientId);
+
+    private:
+        struct Entry {
+            CmdCbType type;
+            std::string payload;
+        };
+        struct ClientSlot {
+            bool used = false;
+            uint32_t clientId = 0;
+            std::deque<Entry> queue;
+            size_t queuedBytes = 0;
+            bool overQuota = false;
+            /** millis() when the client went over its quota */
+            uint32_t overQuotaSince = 0;
+            uint32_t droppedMessages = 0;
+        };
+        static ClientSlot slots[DALHAL_WEBSOCKET_API_TX_MAX_CLIENTS];
+        static TrySendFn trySend;
+        static DisconnectFn disconnect;
+
+        static ClientSlot* GetSlot(uint32_t clientId, bool create);
+        static void Release(ClientSlot& slot);
+        /** returns false if the client is gone, flushTail also sends a Data frame that is not full yet */
+        static bool DrainSlot(ClientSlot& slot, bool flushTail);
+        /** returns false if the client was disconnected */
+        static bool ApplyQuota(ClientSlot& slot);
+    };
+}
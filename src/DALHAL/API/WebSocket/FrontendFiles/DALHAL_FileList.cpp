@@ -24,6 +24,32 @@
 #include "DALHAL_FileList.h"
 #include "DALHAL_VirtualFile.h"
 
+#ifndef DALHAL_WEBSOCKET_API_GZIP_FRONTEND
+/** serve the frontend from the precompressed headers in Files/gzip (regenerated by gzip_frontend_files.py) */
+#define DALHAL_WEBSOCKET_API_GZIP_FRONTEND 1
+#endif
+
+#if DALHAL_WEBSOCKET_API_GZIP_FRONTEND
+
+#include "Files/gzip/DALHAL_WebSocketAPI_index_html_gz.h"
+#include "Files/gzip/DALHAL_WebSocketAPI_main_css_gz.h"
+#include "Files/gzip/DALHAL_WebSocketAPI_main.js_gz.h"
+#include "Files/gzip/DALHAL_WebSocketAPI_log_helpers_js_gz.h"
+
+#include "Files/gzip/DALHAL_WebSocketAPI_wifi_config_css_gz.h"
+
+#include "Files/gzip/DALHAL_WebSocketAPI_autocomplete_js_gz.h"
+#include "Files/gzip/DALHAL_WebSocketAPI_wifi_config_js_gz.h"
+
+#include "Files/gzip/DALHAL_WebSocketAPI_modal_css_gz.h"
+#include "Files/gzip/DALHAL_WebSocketAPI_modal_js_gz.h"
+
+#include "Files/gzip/DALHAL_WebSocketAPI_control-panel_js_gz.h"
+
+#define API_FRONTEND_FILE_ENTRY(filename, name, mime) API_GZIP_FILE_ENTRY(filename, name, mime)
+
+#else
+
 #include "Files/DALHAL_WebSocketAPI_index_html.h"
 #include "Files/DALHAL_WebSocketAPI_main_css.h"
 #include "Files/DALHAL_WebSocketAPI_main.js.h"
@@ -39,22 +65,26 @@
 
 #include "Files/DALHAL_WebSocketAPI_control-panel_js.h"
 
+#define API_FRONTEND_FILE_ENTRY(filename, name, mime) API_TEXT_FILE_ENTRY(filename, name, mime)
+
+#endif
+
 namespace DALHAL {
 
     constexpr ApiVirtualFile VirtualFiles[] = {
-        API_TEXT_FILE_ENTRY("index.html", WS_API_INDEX_HTML, MIME_HTML),
-        API_TEXT_FILE_ENTRY("css/main.css", WS_API_MAIN_CSS, MIME_CSS),
-        API_TEXT_FILE_ENTRY("css/modal.css", WS_API_MODAL_CSS, MIME_CSS),
-        API_TEXT_FILE_ENTRY("css/wifi-config.css", WS_API_WIFI_CONFIG_CSS, MIME_CSS),
+        API_FRONTEND_FILE_ENTRY("index.html", WS_API_INDEX_HTML, MIME_HTML),
+        API_FRONTEND_FILE_ENTRY("css/main.css", WS_API_MAIN_CSS, MIME_CSS),
+        API_FRONTEND_FILE_ENTRY("css/modal.css", WS_API_MODAL_CSS, MIME_CSS),
+        API_FRONTEND_FILE_ENTRY("css/wifi-config.css", WS_API_WIFI_CONFIG_CSS, MIME_CSS),
 
-        API_TEXT_FILE_ENTRY("main.js", WS_API_MAIN_JS, MIME_JS),
+        API_FRONTEND_FILE_ENTRY("main.js", WS_API_MAIN_JS, MIME_JS),
         
-        API_TEXT_FILE_ENTRY("modal.js", WS_API_MODAL_JS, MIME_JS),
-        API_TEXT_FILE_ENTRY("control-panel.js", WS_API_CONTROL_PANEL_JS, MIME_JS),
-        API_TEXT_FILE_ENTRY("log-helpers.js", WS_API_LOG_HELPERS_JS, MIME_JS),
+        API_FRONTEND_FILE_ENTRY("modal.js", WS_API_MODAL_JS, MIME_JS),
+        API_FRONTEND_FILE_ENTRY("control-panel.js", WS_API_CONTROL_PANEL_JS, MIME_JS),
+        API_FRONTEND_FILE_ENTRY("log-helpers.js", WS_API_LOG_HELPERS_JS, MIME_JS),
         
-        API_TEXT_FILE_ENTRY("wifi-config.js", WS_API_WIFI_CONFIG_JS, MIME_JS),
-        API_TEXT_FILE_ENTRY("autocomplete.js", WS_API_AUTOCOMPLETE_JS, MIME_JS),
+        API_FRONTEND_FILE_ENTRY("wifi-config.js", WS_API_WIFI_CONFIG_JS, MIME_JS),
+        API_FRONTEND_FILE_ENTRY("autocomplete.js", WS_API_AUTOCOMPLETE_JS, MIME_JS),
     };
     constexpr size_t VirtualFiles_Size = sizeof(VirtualFiles) / sizeof(VirtualFiles[0]);
 
@@ -69,13 +99,21 @@ namespace DALHAL {
         return nullptr;
     }
 
+    size_t GetApiVirtualFileCount() {
+        return VirtualFiles_Size;
+    }
+
+    size_t GetApiVirtualFileIndex(const ApiVirtualFile* vFile) {
+        return (size_t)(vFile - VirtualFiles);
+    }
+
     void GetVirtualFiles(StringBuilderStreamer& sbs) {
         size_t totalSize = 0;
         for (size_t i = 0; i < VirtualFiles_Size; i++) {
             totalSize += VirtualFiles[i].size;
         }
         sbs.write_json_object_begin();
-        sbs.write_jsonNumber(F("totalSize"), totalSize);
+        sbs.write_jsonNumber(F("totalSize"), (uint32_t)totalSize);
         sbs.write_json_value_separator();
         sbs.write_jsonMemberStart(F("files"));
         sbs.write_json_array_begin();
@@ -87,7 +125,11 @@ namespace DALHAL {
             sbs.write_jsonMemberStart(F("name"));
             VirtualFiles[i].filename(nullptr, &sbs);
             sbs.write_json_value_separator();
-            sbs.write_jsonNumber(F("size"), VirtualFiles[i].size);
+            sbs.write_jsonNumber(F("size"), (uint32_t)VirtualFiles[i].size);
+            if (VirtualFiles[i].gzip) {
+                sbs.write_json_value_separator();
+                sbs.write_jsonString(F("encoding"), F("gzip"));
+            }
             sbs.write_json_value_separator();
             sbs.write_jsonMemberStart(F("mime"));
             sbs.write_char('"');
@@ -30,6 +30,9 @@ namespace DALHAL {
     class StringBuilderStreamer;
 
     const ApiVirtualFile* GetApiVirtualFile(ZeroCopyString& filePath);
+    size_t GetApiVirtualFileCount();
+    /** position of vFile in the file list, 0 .. GetApiVirtualFileCount()-1 */
+    size_t GetApiVirtualFileIndex(const ApiVirtualFile* vFile);
     void GetVirtualFiles(StringBuilderStreamer& sbs);
 
 }
\ No newline at end of file
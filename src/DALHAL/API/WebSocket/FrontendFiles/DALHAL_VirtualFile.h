@@ -51,14 +51,22 @@ namespace DALHAL {
         const uint8_t* data;
         size_t size;
         PGM_P mime;
+        /** progmem ptr to a quoted strong ETag, nullptr when the file has none */
+        PGM_P etag;
+        /** data is gzip compressed and must be sent with Content-Encoding: gzip */
+        bool gzip;
 
-        constexpr ApiVirtualFile(ConstExpressionStringComparableFn filename, const uint8_t* data, size_t size, PGM_P mime) : filename(filename), data(data), size(size), mime(mime) {}
+        constexpr ApiVirtualFile(ConstExpressionStringComparableFn filename, const uint8_t* data, size_t size, PGM_P mime, PGM_P etag = nullptr, bool gzip = false) : filename(filename), data(data), size(size), mime(mime), etag(etag), gzip(gzip) {}
     };
 #define API_TEXT_FILE_ENTRY(filename, data, mime) \
     { CE_MATCH_EMIT_STR(filename), data, sizeof(data) - 1, mime }
 
 #define API_BINARY_FILE_ENTRY(filename, data, mime) \
     { CE_MATCH_EMIT_STR(filename), data, sizeof(data), mime }
+
+/** uses name##_GZ and name##_ETAG from the headers generated by gzip_frontend_files.py */
+#define API_GZIP_FILE_ENTRY(filename, name, mime) \
+    { CE_MATCH_EMIT_STR(filename), name##_GZ, sizeof(name##_GZ), mime, name##_ETAG, true }
 //#define API_VIRTUAL_FILE_ENTRY(filename, data, mime) {CE_MATCH_EMIT_STR(filename), data, sizeof(data)/sizeof(data[0]), mime}
 
 }
\ No newline at end of file
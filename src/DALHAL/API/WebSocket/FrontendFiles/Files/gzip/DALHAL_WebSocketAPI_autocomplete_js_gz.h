@@ -0,0 +1,144 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// generated by gzip_frontend_files.py from Files/DALHAL_WebSocketAPI_autocomplete_js.h, do not edit
+
+#pragma once
+
+#include "stdint.h"
+#include <pgmspace.h>
+
+namespace DALHAL {
+
+// 5044 bytes uncompressed, 1681 bytes gzip
+static const uint8_t WS_API_AUTOCOMPLETE_JS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x58, 0xdb, 0x6e, 0xdb, 0x38,
+    0x10, 0x7d, 0xcf, 0x57, 0x30, 0x46, 0x51, 0x49, 0xb0, 0xa3, 0x24, 0xaf, 0x71, 0xe4, 0x22, 0x4d,
+    0x0b, 0x34, 0x40, 0x6f, 0x40, 0xb2, 0xbb, 0x0f, 0x41, 0x80, 0x2a, 0xd2, 0xd8, 0xe6, 0x46, 0x26,
+    0xb5, 0x22, 0x95, 0x0b, 0x5c, 0x03, 0xfb, 0x11, 0xfb, 0x85, 0xfb, 0x25, 0x3b, 0x43, 0x52, 0x12,
+    0x25, 0x3b, 0x69, 0x81, 0x7d, 0x29, 0x10, 0x24, 0x12, 0x39, 0xd7, 0xc3, 0x33, 0x33, 0x54, 0xf6,
+    0x0e, 0x0f, 0xd9, 0xbf, 0xff, 0xfc, 0x8d, 0x3f, 0xec, 0xac, 0xd6, 0x32, 0x93, 0xab, 0xb2, 0x00,
+    0x0d, 0x4c, 0x43, 0xb5, 0xe2, 0x22, 0x2d, 0xdc, 0xe6, 0x2f, 0xfb, 0xb3, 0xd7, 0xc5, 0x7f, 0x2e,
+    0x57, 0xab, 0x54, 0xe4, 0x4c, 0x57, 0x00, 0xbf, 0x7a, 0xd8, 0x2f, 0x65, 0x74, 0x9f, 0x56, 0x6c,
+    0x09, 0x45, 0x79, 0x45, 0x79, 0x24, 0x6c, 0xbd, 0x99, 0xee, 0xed, 0x65, 0x52, 0x28, 0xcd, 0xb8,
+    0x28, 0x6b, 0xcd, 0x18, 0x2e, 0xe6, 0x32, 0xab, 0x57, 0x20, 0x74, 0xbc, 0x00, 0xfd, 0xbe, 0x00,
+    0x7a, 0x7c, 0xfb, 0x74, 0x91, 0x87, 0x41, 0xb6, 0xca, 0x0f, 0x8c, 0x58, 0x10, 0x4d, 0x9d, 0x96,
+    0xaa, 0x17, 0x6f, 0xe5, 0xe3, 0x8b, 0x5a, 0x28, 0xb2, 0x00, 0xa5, 0x39, 0xca, 0x77, 0x7a, 0x44,
+    0x81, 0x2f, 0xe8, 0xef, 0x05, 0xbd, 0xd4, 0xa3, 0xcc, 0x81, 0xac, 0xb5, 0xf3, 0x8b, 0xaf, 0x2c,
+    0xcd, 0x34, 0xbf, 0x87, 0x8b, 0xfc, 0x11, 0xf5, 0x0f, 0x8e, 0x27, 0x2c, 0xab, 0xab, 0x0a, 0xf5,
+    0x2e, 0xeb, 0x85, 0xc2, 0x95, 0xeb, 0x9b, 0x09, 0x5b, 0x72, 0xa5, 0x65, 0xf5, 0xe4, 0xbd, 0x35,
+    0xd2, 0x98, 0xf0, 0xbc, 0x16, 0x19, 0xc5, 0x63, 0xa2, 0xf8, 0x5a, 0x71, 0xa1, 0x3f, 0x72, 0x01,
+    0xa1, 0x86, 0x47, 0x8d, 0xb6, 0x0a, 0x15, 0xb1, 0xf5, 0x1e, 0x63, 0x36, 0xd0, 0x9c, 0xdf, 0xfb,
+    0x41, 0x66, 0x15, 0xa4, 0x1a, 0x5c, 0x9c, 0x61, 0x80, 0xbb, 0x14, 0x13, 0x23, 0xb1, 0x38, 0x2b,
+    0x52, 0xa5, 0x3e, 0xa7, 0x2b, 0x02, 0x16, 0xad, 0x34, 0xcb, 0x64, 0xf6, 0x5c, 0x0a, 0x8d, 0x0a,
+    0xb8, 0x41, 0x6f, 0xb4, 0xe3, 0x00, 0x88, 0xd3, 0xb2, 0x04, 0x91, 0x9f, 0x2f, 0x79, 0x91, 0x87,
+    0x28, 0x1d, 0xf9, 0x7b, 0x2a, 0xab, 0x64, 0x51, 0x5c, 0xc9, 0xd2, 0xe8, 0xf9, 0x6b, 0x1f, 0x80,
+    0x2f, 0x96, 0x68, 0x67, 0xe3, 0x25, 0xa3, 0xca, 0x82, 0xeb, 0xf3, 0x55, 0x1e, 0xde, 0xa7, 0x85,
+    0x9f, 0x81, 0xe2, 0xa8, 0x8e, 0x6b, 0x31, 0x86, 0xa7, 0x2f, 0x44, 0x0e, 0x8f, 0x5f, 0xe6, 0x61,
+    0x70, 0x68, 0xe3, 0xe6, 0x73, 0x16, 0x92, 0x40, 0x42, 0xd0, 0x44, 0xac, 0x02, 0x5d, 0x57, 0x82,
+    0xad, 0x59, 0x59, 0xc1, 0x9c, 0x3f, 0x9e, 0xb0, 0x20, 0x98, 0x30, 0xd2, 0x3b, 0x21, 0x0b, 0x13,
+    0x56, 0xa6, 0x95, 0x56, 0xe6, 0x99, 0xbd, 0x41, 0x64, 0xd9, 0x09, 0xfd, 0xda, 0x90, 0xa1, 0x46,
+    0x13, 0x1f, 0x59, 0xab, 0x4d, 0x5e, 0x55, 0xc1, 0x33, 0x08, 0x8f, 0x26, 0x14, 0xc7, 0x98, 0x1d,
+    0x47, 0x13, 0x23, 0x61, 0x6d, 0x32, 0x4f, 0xa2, 0xb7, 0xed, 0xfc, 0x0c, 0x0d, 0x44, 0xb1, 0x49,
+    0xd2, 0x44, 0x1f, 0xcf, 0x79, 0x81, 0xa0, 0x84, 0x6f, 0xa5, 0x2c, 0x20, 0x15, 0x11, 0xea, 0x6d,
+    0xfa, 0x80, 0x20, 0xa1, 0x3e, 0xcb, 0x1c, 0x42, 0x63, 0xcc, 0x22, 0x42, 0xe4, 0x11, 0xb8, 0x86,
+    0x88, 0x34, 0x55, 0x10, 0x57, 0x52, 0x9a, 0x13, 0x99, 0xcb, 0x8a, 0x85, 0x16, 0xb2, 0x92, 0xc9,
+    0x39, 0xf3, 0xd4, 0x2c, 0x4e, 0xfb, 0xa4, 0x19, 0x67, 0x74, 0x54, 0xc8, 0xb6, 0x16, 0x2c, 0x51,
+    0x17, 0xc5, 0xd4, 0x08, 0x59, 0xe5, 0xb9, 0xac, 0xb1, 0x51, 0x24, 0xac, 0x27, 0x8d, 0xd1, 0x8a,
+    0x3c, 0xcc, 0x58, 0x32, 0x63, 0x59, 0x2c, 0x0c, 0x47, 0x10, 0xf2, 0x32, 0x9a, 0x76, 0xd6, 0x8d,
+    0xde, 0x0e, 0xab, 0x2e, 0x5e, 0xb3, 0x4d, 0x2b, 0x9b, 0x0e, 0x6d, 0xda, 0xda, 0xca, 0xf9, 0xb2,
+    0xab, 0xb7, 0x21, 0x15, 0xd6, 0x36, 0x29, 0x7b, 0xa4, 0x6c, 0x83, 0x56, 0x7b, 0xa4, 0x21, 0xeb,
+    0xd8, 0xf2, 0x2e, 0xe6, 0x68, 0x98, 0x29, 0x94, 0x59, 0xb2, 0x27, 0xc0, 0x92, 0x50, 0x90, 0x56,
+    0xd9, 0x92, 0x11, 0x50, 0xac, 0x49, 0xa8, 0xb5, 0x89, 0x16, 0x91, 0xd9, 0x5f, 0xc9, 0xae, 0xe3,
+    0x19, 0x17, 0x59, 0x51, 0xe7, 0xa0, 0xcc, 0x31, 0x21, 0x4f, 0x8c, 0x4f, 0x43, 0x95, 0xe9, 0x40,
+    0xeb, 0xb3, 0x4d, 0xcd, 0x3b, 0xa8, 0xc6, 0x54, 0x4b, 0xce, 0x7d, 0x4f, 0xf2, 0xfb, 0x77, 0xe6,
+    0xbd, 0x6e, 0x9f, 0x84, 0xef, 0x40, 0xcb, 0x3b, 0x10, 0xcf, 0x04, 0x64, 0xb2, 0x37, 0xec, 0xf4,
+    0x98, 0xbb, 0xc3, 0xb0, 0x81, 0xbf, 0xe1, 0x99, 0x77, 0x76, 0xb1, 0x96, 0x1f, 0xe5, 0x03, 0x54,
+    0xe7, 0xa9, 0x82, 0x10, 0x39, 0xa9, 0x29, 0xe2, 0x3f, 0xb8, 0x5e, 0x86, 0xc6, 0x6b, 0x7f, 0x3b,
+    0x8a, 0xac, 0x99, 0x55, 0x5a, 0x5a, 0x1b, 0xe1, 0x9a, 0x91, 0x91, 0x13, 0x67, 0x6c, 0x62, 0x98,
+    0x48, 0x6f, 0xf4, 0x17, 0xdf, 0x52, 0x75, 0xee, 0xfc, 0x9f, 0xb0, 0xfd, 0xfd, 0x30, 0x6b, 0xc3,
+    0x61, 0xaf, 0x5f, 0xb3, 0xee, 0x2d, 0x2e, 0x40, 0x2c, 0xf4, 0x32, 0x62, 0x9b, 0x28, 0xda, 0xe2,
+    0x00, 0x8d, 0x2b, 0x29, 0xbe, 0x9a, 0x32, 0x0c, 0x95, 0xae, 0x1c, 0x8f, 0x0d, 0xa0, 0xf4, 0xda,
+    0x2a, 0xbb, 0xe4, 0x83, 0x60, 0xea, 0xaa, 0x83, 0x7a, 0x0d, 0x49, 0x5c, 0x1f, 0xdd, 0xb4, 0x45,
+    0x41, 0xeb, 0xd4, 0x44, 0x8e, 0xa7, 0xf8, 0xe7, 0x94, 0x79, 0x06, 0x70, 0x61, 0x3c, 0x8e, 0xd8,
+    0x03, 0xc6, 0x04, 0xce, 0xf4, 0x35, 0xbf, 0x79, 0x1e, 0x9f, 0x72, 0x88, 0x8d, 0xf1, 0x57, 0xb6,
+    0x35, 0x8e, 0x3d, 0xc8, 0x3f, 0x92, 0x7e, 0x5e, 0x98, 0x74, 0x0e, 0x95, 0x4f, 0x6f, 0x1c, 0x2d,
+    0x4d, 0xb3, 0xee, 0x4d, 0x00, 0x5a, 0x9f, 0x0e, 0xa6, 0x44, 0x4b, 0x28, 0xda, 0x6c, 0xf3, 0x5f,
+    0xbb, 0x09, 0x86, 0x41, 0x3e, 0x15, 0x10, 0xe7, 0x1c, 0x0b, 0x22, 0xa5, 0xb1, 0x11, 0x08, 0x29,
+    0x20, 0x98, 0xba, 0x50, 0xa6, 0xa6, 0xea, 0x9e, 0x13, 0xbd, 0x2d, 0x64, 0x76, 0x67, 0x10, 0x74,
+    0x12, 0x5c, 0x08, 0xa8, 0x3e, 0x5c, 0x7d, 0xfa, 0xe8, 0x62, 0x31, 0x87, 0x1f, 0xaa, 0x09, 0x8f,
+    0x88, 0x00, 0xdf, 0x4e, 0x69, 0xa8, 0x98, 0x69, 0x91, 0x8c, 0x70, 0x7b, 0xc4, 0xf2, 0x54, 0xa7,
+    0x07, 0x3c, 0x7f, 0x4c, 0x46, 0xaf, 0xd6, 0x7c, 0x33, 0xc2, 0x4a, 0x2b, 0x20, 0x19, 0xc9, 0x92,
+    0xb2, 0x1c, 0xb1, 0xb4, 0xe2, 0xe9, 0x81, 0x82, 0x02, 0x32, 0x0d, 0x79, 0x32, 0x9a, 0xa7, 0x85,
+    0x82, 0xd1, 0xcc, 0xb0, 0xea, 0x54, 0x95, 0xa9, 0xf0, 0x4c, 0x1d, 0x10, 0xa3, 0x5e, 0xad, 0x55,
+    0xec, 0xb1, 0xe8, 0x4d, 0x40, 0x9c, 0x3a, 0x68, 0x78, 0x13, 0x9c, 0x04, 0xc1, 0x66, 0x34, 0x23,
+    0x21, 0x12, 0xde, 0x9c, 0x1e, 0x92, 0x8d, 0x67, 0xcc, 0x11, 0x25, 0xad, 0x2c, 0x3d, 0x79, 0xb2,
+    0xa7, 0x87, 0x98, 0xc3, 0xec, 0x5b, 0x14, 0xff, 0x29, 0xb9, 0x08, 0x03, 0x3b, 0x4c, 0x5c, 0xf6,
+    0x7f, 0xd5, 0x50, 0x3d, 0x5d, 0x9a, 0x78, 0x65, 0x75, 0x56, 0x14, 0x61, 0x10, 0xe3, 0x0e, 0x75,
+    0x6c, 0x59, 0xbd, 0x4f, 0xb3, 0x65, 0x08, 0x05, 0xc2, 0x60, 0x1c, 0x42, 0x11, 0xa7, 0x79, 0xfe,
+    0xfe, 0x1e, 0x68, 0x04, 0x2b, 0x1c, 0x91, 0x58, 0x68, 0xc1, 0x4a, 0xd6, 0x0a, 0x72, 0xf9, 0x20,
+    0x70, 0xf6, 0x00, 0x01, 0xb6, 0x66, 0x10, 0xe3, 0x48, 0x21, 0xa9, 0x77, 0x30, 0x4f, 0xeb, 0x42,
+    0x87, 0xd1, 0x94, 0x95, 0x3c, 0xbb, 0xeb, 0xc8, 0x10, 0x8e, 0xd1, 0x16, 0xe1, 0xa8, 0x40, 0xc7,
+    0x08, 0x25, 0x0a, 0x6c, 0xa8, 0xf2, 0x06, 0xb5, 0xb1, 0xe4, 0x39, 0xf8, 0x0c, 0x7a, 0x8e, 0x01,
+    0x49, 0x73, 0xfe, 0x1e, 0xb1, 0x12, 0xec, 0x2f, 0x1d, 0xa9, 0x12, 0xa4, 0x14, 0xeb, 0xcd, 0x5f,
+    0xd0, 0x67, 0x66, 0x33, 0x24, 0xf7, 0x5e, 0xd7, 0xe5, 0x1a, 0x56, 0x8e, 0x95, 0x2f, 0xc1, 0x63,
+    0x08, 0x4a, 0xa2, 0x2d, 0x4e, 0x08, 0x94, 0xa3, 0xcc, 0x9a, 0x90, 0x32, 0xe7, 0x42, 0x30, 0x61,
+    0x11, 0x2d, 0x16, 0x05, 0xe0, 0x15, 0xc9, 0xf8, 0x43, 0x98, 0x38, 0x4e, 0x13, 0x9b, 0x34, 0xca,
+    0x51, 0x20, 0x5a, 0x57, 0xfc, 0xb6, 0xd6, 0x24, 0xe3, 0xb3, 0xa7, 0x27, 0xba, 0x69, 0x9b, 0x2c,
+    0xbe, 0xcf, 0x92, 0x23, 0xea, 0x2f, 0x26, 0x80, 0x6b, 0x7c, 0xbf, 0x89, 0xbc, 0x67, 0x77, 0xeb,
+    0xb8, 0x10, 0x5a, 0xfe, 0xce, 0xe1, 0x21, 0x5c, 0x1b, 0xc6, 0x9f, 0x04, 0x02, 0x07, 0x03, 0x22,
+    0x19, 0x58, 0x4b, 0x7e, 0xbd, 0xa1, 0x56, 0x1f, 0xf8, 0xc1, 0x69, 0xb5, 0x10, 0x39, 0xf7, 0xd8,
+    0x56, 0x8e, 0xa8, 0xbf, 0xd3, 0xe3, 0x2c, 0xf1, 0x51, 0x1f, 0xb4, 0xaa, 0xae, 0xc3, 0x23, 0x68,
+    0xac, 0x27, 0x69, 0x42, 0x9d, 0xfa, 0xc3, 0xce, 0xf4, 0xbf, 0xfe, 0x9c, 0x33, 0xf7, 0xd7, 0x18,
+    0x5b, 0x7f, 0x0d, 0x36, 0xfd, 0xee, 0x1d, 0xc5, 0xfc, 0xed, 0xed, 0x39, 0x66, 0xcd, 0xd1, 0xa5,
+    0x28, 0xc2, 0xbb, 0x0a, 0xfa, 0xb7, 0x93, 0x7c, 0xcc, 0xa8, 0x11, 0xf9, 0x25, 0x87, 0xc2, 0xa8,
+    0x63, 0x25, 0xc9, 0xc9, 0x16, 0xeb, 0x3a, 0xcf, 0x73, 0xbc, 0x59, 0xba, 0x85, 0xba, 0x44, 0xfe,
+    0x0e, 0xe5, 0x7c, 0x0c, 0x77, 0x08, 0x74, 0x6d, 0xdd, 0x8f, 0x1c, 0x0f, 0x7f, 0x85, 0xdd, 0x15,
+    0x21, 0xd8, 0xf6, 0xdc, 0xeb, 0x68, 0xdb, 0x2d, 0x75, 0x70, 0x81, 0xf0, 0xe1, 0xb2, 0xd1, 0xd8,
+    0x95, 0xed, 0xaa, 0xb5, 0x1f, 0x06, 0x93, 0xed, 0x20, 0x51, 0xed, 0x59, 0xa5, 0x3b, 0x78, 0xea,
+    0x15, 0x7a, 0x7b, 0x78, 0xf7, 0x5c, 0xf1, 0xdb, 0x02, 0xba, 0xaa, 0xe9, 0x37, 0xdd, 0xfd, 0xa4,
+    0xed, 0xd0, 0x7b, 0x0e, 0x00, 0x88, 0xd1, 0x98, 0xb9, 0x55, 0x05, 0x57, 0xe9, 0x6d, 0xd0, 0x5c,
+    0xdc, 0x76, 0x74, 0x0e, 0xef, 0xae, 0xa6, 0xec, 0xbc, 0x78, 0x21, 0x69, 0xef, 0x82, 0xa6, 0x76,
+    0xb3, 0xd1, 0x5d, 0xa2, 0xbb, 0x4d, 0x13, 0xc4, 0x31, 0xa1, 0x3f, 0x20, 0xfd, 0xd1, 0x00, 0xfd,
+    0x21, 0x53, 0x77, 0xdd, 0xcb, 0xb6, 0x63, 0xb1, 0x3a, 0x99, 0x99, 0xf0, 0x36, 0xf6, 0xfe, 0xb4,
+    0x6f, 0xe6, 0x8d, 0x4a, 0x66, 0xb6, 0xc5, 0x47, 0x3d, 0xc5, 0xe6, 0x62, 0xf4, 0x12, 0xd3, 0xdd,
+    0x05, 0xc9, 0x13, 0xe9, 0x12, 0xb5, 0x8e, 0x9b, 0x54, 0x67, 0xd6, 0x5e, 0x37, 0x4f, 0x8d, 0xdc,
+    0xff, 0x29, 0x2b, 0x6b, 0x7f, 0xea, 0xec, 0xec, 0xac, 0x09, 0xda, 0xd8, 0x60, 0xa7, 0x53, 0xd0,
+    0xfa, 0x7b, 0xe6, 0x6e, 0xe0, 0x64, 0xf7, 0xac, 0x48, 0x73, 0x62, 0x9b, 0x1d, 0x9c, 0x39, 0xab,
+    0x2a, 0xf9, 0xf0, 0x8e, 0xb8, 0xf8, 0x23, 0xe6, 0x18, 0x2e, 0x38, 0x7e, 0xd2, 0x21, 0xef, 0x0a,
+    0x71, 0x70, 0xcc, 0xdd, 0x68, 0xf8, 0x94, 0xea, 0x65, 0xbc, 0xc2, 0x91, 0xd9, 0x36, 0xcb, 0x71,
+    0xff, 0xfb, 0xd5, 0x21, 0x89, 0x17, 0x21, 0xe7, 0xee, 0x27, 0xc2, 0xfe, 0xad, 0xfc, 0xa9, 0xa0,
+    0x9b, 0x9a, 0xc2, 0x36, 0xdf, 0xb5, 0xea, 0x19, 0x3b, 0x32, 0x33, 0xb0, 0x8d, 0xb0, 0xdd, 0xa2,
+    0xbb, 0xd8, 0x20, 0x0f, 0x3f, 0x75, 0x32, 0xd3, 0x7c, 0x57, 0x9f, 0x36, 0xdf, 0xdb, 0x5d, 0xf4,
+    0xa6, 0xf7, 0x98, 0xdd, 0xf1, 0x78, 0xea, 0xd3, 0x21, 0x71, 0xa2, 0xd7, 0x6e, 0x1b, 0x67, 0xea,
+    0x8e, 0x26, 0xf5, 0x33, 0x47, 0xf6, 0x5e, 0x65, 0x69, 0x09, 0xc1, 0x0f, 0xdb, 0xdc, 0x0e, 0x4d,
+    0xfc, 0x1a, 0xaf, 0x02, 0xff, 0xdb, 0x6e, 0x37, 0x36, 0x89, 0x05, 0x67, 0x50, 0xc6, 0xad, 0xc0,
+    0x16, 0x3e, 0x3b, 0xfb, 0x7c, 0x5b, 0xb1, 0xab, 0x7c, 0x50, 0x76, 0xb6, 0x4d, 0x7b, 0xa5, 0xb5,
+    0xca, 0xbb, 0x0a, 0x6a, 0x10, 0xad, 0x85, 0x5a, 0xf2, 0xb9, 0x36, 0x9b, 0xd3, 0xc1, 0x7f, 0x32,
+    0xac, 0xe4, 0x83, 0xba, 0x04, 0xfa, 0xb8, 0x24, 0x01, 0x8f, 0xef, 0xfd, 0x12, 0xb4, 0x37, 0xfc,
+    0x3e, 0xa4, 0x9b, 0xae, 0x35, 0xb7, 0x63, 0xe8, 0x3f, 0x24, 0x70, 0x91, 0x79, 0xb4, 0x13, 0x00,
+    0x00,
+};
+static const char WS_API_AUTOCOMPLETE_JS_ETAG[] PROGMEM = "\"4e6e0aa9f82dc054\"";
+
+}
@@ -0,0 +1,163 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// generated by gzip_frontend_files.py from Files/DALHAL_WebSocketAPI_control-panel_js.h, do not edit
+
+#pragma once
+
+#include "stdint.h"
+#include <pgmspace.h>
+
+namespace DALHAL {
+
+// 5520 bytes uncompressed, 1997 bytes gzip
+static const uint8_t WS_API_CONTROL_PANEL_JS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x58, 0xfd, 0x6e, 0xdb, 0x46,
+    0x12, 0xff, 0xdb, 0x7e, 0x8a, 0xa9, 0x90, 0x6b, 0x28, 0x57, 0xa2, 0xec, 0x5c, 0x2e, 0x05, 0x64,
+    0xb8, 0xc6, 0x35, 0x4d, 0x9a, 0x00, 0x49, 0x5c, 0x34, 0x39, 0x04, 0x87, 0xa2, 0x88, 0x56, 0xe4,
+    0x4a, 0xda, 0x84, 0xe2, 0xb2, 0xbb, 0x2b, 0xcb, 0xaa, 0x2a, 0xe0, 0x1e, 0xe2, 0x9e, 0xf0, 0x9e,
+    0xe4, 0x66, 0x66, 0x77, 0x29, 0x92, 0xb6, 0xe2, 0xe0, 0x70, 0x35, 0x60, 0x48, 0xe4, 0xce, 0xfc,
+    0xe6, 0x63, 0xe7, 0x53, 0xc7, 0xa3, 0x93, 0x93, 0x63, 0x38, 0x81, 0x4c, 0x97, 0xce, 0xe8, 0x62,
+    0x58, 0x89, 0x52, 0x16, 0xe9, 0x47, 0x0b, 0xff, 0xf9, 0xd7, 0xbf, 0x61, 0x2e, 0x4b, 0x69, 0x54,
+    0x06, 0xb9, 0xcc, 0x0a, 0x61, 0x84, 0x53, 0xd7, 0x12, 0x7a, 0x33, 0x6d, 0x96, 0xb9, 0x70, 0xa2,
+    0x07, 0x46, 0x96, 0xb9, 0x34, 0xd2, 0xa4, 0x08, 0x40, 0x18, 0xff, 0xd4, 0x2b, 0x58, 0x88, 0x32,
+    0x07, 0xe5, 0x40, 0x94, 0x20, 0x8c, 0x11, 0x1b, 0xd0, 0xb3, 0x88, 0x8d, 0x30, 0x36, 0x33, 0xaa,
+    0x72, 0xda, 0x58, 0x20, 0x32, 0x01, 0x56, 0x95, 0xf3, 0x42, 0x42, 0xae, 0x6c, 0x25, 0x5c, 0xb6,
+    0x20, 0x90, 0xd9, 0xaa, 0xcc, 0x9c, 0xd2, 0x65, 0x0a, 0x2f, 0x1d, 0x94, 0xf2, 0x5a, 0x1a, 0xc8,
+    0x44, 0x51, 0x10, 0xc7, 0xc6, 0x2d, 0x90, 0x1e, 0x61, 0xae, 0x55, 0x26, 0x87, 0xb6, 0x92, 0x99,
+    0x9a, 0xa1, 0x76, 0xca, 0x59, 0x59, 0xcc, 0x58, 0x61, 0x22, 0xdf, 0x10, 0x8a, 0x2a, 0x9d, 0x34,
+    0x82, 0x81, 0xe0, 0xe3, 0xca, 0xba, 0x80, 0x31, 0xd1, 0xe5, 0xdf, 0xf9, 0x65, 0x12, 0x74, 0x4a,
+    0x3d, 0xcd, 0x20, 0xea, 0x38, 0x20, 0x88, 0xd2, 0xf5, 0x27, 0x64, 0x13, 0xbc, 0x5b, 0x08, 0xf7,
+    0xd0, 0x82, 0x5b, 0xa0, 0xd9, 0x85, 0xd6, 0x56, 0x12, 0x59, 0x29, 0x99, 0xa5, 0x37, 0x06, 0xbb,
+    0x16, 0x15, 0x1f, 0x06, 0x66, 0x1b, 0x4c, 0xfe, 0xa6, 0x36, 0x48, 0x1a, 0x82, 0x21, 0x5b, 0x37,
+    0xe8, 0x9b, 0xb9, 0x44, 0xbf, 0xc0, 0x7b, 0xf5, 0x5c, 0x81, 0x95, 0xce, 0xa1, 0x2d, 0x16, 0xd8,
+    0xdf, 0x03, 0x7c, 0xfd, 0xf3, 0xb3, 0x1f, 0xaf, 0x9e, 0x9c, 0x9e, 0xc6, 0x17, 0x6b, 0x14, 0xcd,
+    0xc6, 0x93, 0x59, 0x28, 0x83, 0x70, 0x9e, 0x7a, 0x31, 0x3f, 0x11, 0x05, 0xca, 0xcc, 0x65, 0xf4,
+    0x0f, 0x3a, 0x7d, 0x2e, 0x6d, 0xbc, 0x86, 0xa7, 0xb7, 0xdc, 0x0d, 0x76, 0x21, 0x2a, 0x39, 0xa6,
+    0x43, 0x80, 0xad, 0xff, 0x00, 0x50, 0xf9, 0x18, 0x7a, 0x53, 0x57, 0x0e, 0xab, 0xb5, 0xe9, 0x0d,
+    0xa0, 0xf5, 0x37, 0x1a, 0xc1, 0xaa, 0x54, 0xbf, 0xad, 0x24, 0xac, 0x15, 0x79, 0x9d, 0xcd, 0x64,
+    0xd5, 0x22, 0xb7, 0xdb, 0x20, 0x22, 0xf2, 0xaf, 0x9c, 0x43, 0x67, 0xfc, 0xd1, 0x53, 0x4b, 0x31,
+    0x97, 0xf8, 0x69, 0x2b, 0xa3, 0x1c, 0x7d, 0x71, 0xf2, 0xc6, 0xe1, 0x47, 0x86, 0xde, 0xd7, 0xcb,
+    0xde, 0x20, 0xf2, 0x15, 0x62, 0x2a, 0x0b, 0x64, 0xd4, 0xe5, 0x48, 0xcf, 0x66, 0x6d, 0xb9, 0x28,
+    0xd5, 0xe3, 0x8d, 0x88, 0xd9, 0x93, 0x46, 0x3e, 0x6b, 0x32, 0xe4, 0x92, 0x25, 0xd9, 0x6d, 0x46,
+    0xd6, 0xc9, 0x6a, 0x78, 0x7a, 0x96, 0x56, 0xe5, 0x1c, 0x21, 0x90, 0x8f, 0xc5, 0xb3, 0x52, 0x35,
+    0x83, 0xdb, 0x14, 0xa8, 0xe1, 0x16, 0x9c, 0xae, 0x90, 0xf3, 0xec, 0x6f, 0x67, 0xd5, 0x0d, 0xd2,
+    0x16, 0x72, 0xe6, 0xf0, 0xf1, 0xc9, 0xa3, 0xc7, 0xfc, 0xb8, 0x56, 0xb9, 0x5b, 0xd0, 0xf3, 0x13,
+    0x7e, 0x4c, 0xd3, 0x14, 0x76, 0xb5, 0xae, 0x3e, 0x38, 0x08, 0xc3, 0xbf, 0xef, 0xe8, 0x2a, 0xcc,
+    0x54, 0x39, 0x23, 0xcc, 0x06, 0x3d, 0xb3, 0x29, 0xb4, 0xc8, 0x07, 0xa0, 0x2b, 0x41, 0x4e, 0x73,
+    0xfa, 0xb6, 0xc3, 0x7c, 0xb6, 0x8c, 0x21, 0xe9, 0xc3, 0xc5, 0x77, 0xf0, 0xe2, 0xdd, 0xeb, 0x57,
+    0xcf, 0x0a, 0xb9, 0xc4, 0x60, 0x1b, 0x30, 0x98, 0xf7, 0x13, 0x5b, 0x00, 0xba, 0x2c, 0x36, 0xe1,
+    0x32, 0x83, 0x28, 0xef, 0x55, 0x7f, 0x4a, 0x11, 0xa1, 0x4b, 0x19, 0x4c, 0x9e, 0xa9, 0x42, 0x0e,
+    0x60, 0x89, 0xd9, 0x01, 0x33, 0x23, 0x96, 0xd2, 0x0e, 0xa0, 0xd4, 0x50, 0x49, 0x33, 0xe4, 0x47,
+    0x58, 0x55, 0xa4, 0x99, 0x1d, 0xdf, 0xe9, 0xc7, 0xa1, 0xc7, 0xf5, 0x6e, 0x8c, 0x14, 0xcc, 0xf7,
+    0xde, 0xfb, 0xe5, 0xec, 0xd1, 0xe3, 0x81, 0x7f, 0xf1, 0x42, 0xaa, 0xf9, 0xc2, 0xf9, 0x37, 0x91,
+    0x32, 0xd3, 0xc5, 0x6a, 0x59, 0x5a, 0x7a, 0xd9, 0x89, 0x1f, 0x56, 0xda, 0xeb, 0x43, 0xba, 0x80,
+    0xd1, 0x6b, 0x08, 0x51, 0x64, 0x17, 0x52, 0xba, 0x96, 0xac, 0x31, 0x9c, 0xde, 0x62, 0xf7, 0x08,
+    0xaa, 0x54, 0x4e, 0x89, 0xc2, 0x93, 0xe1, 0x53, 0x2e, 0x6f, 0x20, 0x39, 0x1d, 0x4e, 0x85, 0x95,
+    0x79, 0xdf, 0x63, 0xec, 0x82, 0xa3, 0xfe, 0x61, 0xd1, 0x1b, 0xc1, 0x4a, 0xcc, 0x47, 0x4c, 0x79,
+    0xf6, 0x3e, 0x5c, 0x60, 0x92, 0xac, 0x5b, 0xa9, 0x93, 0x6c, 0xf7, 0xfa, 0xfb, 0xbc, 0x1d, 0xc7,
+    0xec, 0xfb, 0xf0, 0xf4, 0xea, 0xcd, 0xbb, 0x9f, 0xaf, 0x5e, 0xbd, 0xad, 0x4d, 0x9c, 0x8a, 0xec,
+    0xd3, 0xdc, 0xe8, 0x55, 0x49, 0xc9, 0xc2, 0x55, 0x65, 0x26, 0xb0, 0xf8, 0x4c, 0xe7, 0x6d, 0x9f,
+    0xc5, 0xba, 0x82, 0xd7, 0x7b, 0x47, 0x45, 0x71, 0x7c, 0xe5, 0xb1, 0x28, 0x74, 0x29, 0xfa, 0x01,
+    0x65, 0xd7, 0x3f, 0xf7, 0x5f, 0x96, 0x3a, 0x17, 0x45, 0x8a, 0x25, 0xe2, 0x7b, 0x9d, 0x6f, 0x12,
+    0x5f, 0x91, 0x65, 0xc1, 0xa7, 0xa3, 0x63, 0xac, 0xc4, 0xd6, 0xb6, 0x4b, 0xc1, 0xf6, 0xf8, 0x88,
+    0x2d, 0x36, 0xab, 0x0c, 0x93, 0x3d, 0xd9, 0xee, 0xeb, 0xd1, 0x05, 0xfc, 0xf2, 0xeb, 0xa0, 0x61,
+    0x43, 0x88, 0xf7, 0x01, 0x2c, 0xf8, 0x36, 0x51, 0x05, 0x42, 0x7b, 0x43, 0xce, 0xbd, 0x80, 0x1e,
+    0xc6, 0x7f, 0xb4, 0x03, 0x76, 0xf8, 0x62, 0xbb, 0xeb, 0x13, 0xf6, 0x11, 0x16, 0x00, 0x9b, 0x36,
+    0x30, 0xe3, 0xd7, 0xf3, 0x78, 0x56, 0x73, 0x5d, 0xd4, 0x00, 0xf5, 0x59, 0x89, 0x71, 0x66, 0x19,
+    0xec, 0xfc, 0x38, 0xbe, 0xe3, 0x6b, 0xc9, 0x75, 0xb6, 0xa2, 0xf0, 0x4f, 0x33, 0x23, 0xb1, 0xd6,
+    0x85, 0x64, 0x48, 0x7a, 0xb9, 0xba, 0xee, 0xf5, 0xcf, 0xf7, 0xa4, 0x69, 0x53, 0xc7, 0x49, 0xab,
+    0x4f, 0xc1, 0x83, 0x6d, 0x7d, 0xb8, 0x9b, 0xa4, 0xce, 0xa8, 0x65, 0xc2, 0xac, 0x6a, 0x06, 0xc9,
+    0xde, 0xea, 0x3e, 0x44, 0x28, 0xae, 0x09, 0xe9, 0xfe, 0xe4, 0x25, 0xa7, 0x10, 0xc2, 0xae, 0x4c,
+    0x91, 0x3c, 0x7c, 0xb0, 0xdd, 0x9f, 0xec, 0x1e, 0xf6, 0x27, 0xe8, 0x70, 0x2a, 0x93, 0x88, 0xc5,
+    0x5e, 0xeb, 0xc2, 0xf0, 0x4b, 0x62, 0x7e, 0xb0, 0xe5, 0xaf, 0xbb, 0xea, 0x66, 0x12, 0x85, 0x7b,
+    0xff, 0x76, 0x39, 0xfc, 0x5b, 0xcf, 0xe2, 0xbf, 0x7b, 0x1e, 0x64, 0xc2, 0xae, 0x0a, 0x89, 0x8f,
+    0xdb, 0xd8, 0x2e, 0xf7, 0x9d, 0xd3, 0x06, 0xa0, 0x0f, 0xbe, 0x86, 0x84, 0xcb, 0x8f, 0x3d, 0x8c,
+    0x2c, 0xde, 0x21, 0xc6, 0x81, 0x53, 0xbe, 0xc2, 0x02, 0x5b, 0x0f, 0xdd, 0x04, 0xe9, 0x67, 0xb1,
+    0xa4, 0x67, 0x0b, 0xa8, 0x5b, 0x20, 0x15, 0x15, 0x4f, 0x75, 0x94, 0x61, 0x62, 0xd5, 0x35, 0x7d,
+    0x4c, 0x6f, 0x8e, 0x88, 0x0b, 0x35, 0xf6, 0xf2, 0xa7, 0x2b, 0x55, 0xe4, 0xdf, 0xf3, 0x71, 0x53,
+    0x3a, 0xfe, 0x4d, 0xf1, 0x12, 0x3f, 0x9d, 0xef, 0x31, 0x7c, 0x3b, 0x38, 0x04, 0xc1, 0x7e, 0xbf,
+    0x07, 0x21, 0x34, 0x92, 0x43, 0x10, 0x6f, 0xf9, 0xf8, 0x1e, 0x0c, 0xee, 0x41, 0x87, 0x10, 0xde,
+    0xe1, 0xe1, 0x3d, 0xfc, 0xa1, 0x79, 0xb5, 0x10, 0xa2, 0xdb, 0xbc, 0xb7, 0x0f, 0x02, 0xe4, 0x72,
+    0x26, 0x56, 0x85, 0xf3, 0xac, 0x74, 0xb1, 0x9a, 0x42, 0x46, 0x98, 0x32, 0x99, 0x34, 0x93, 0x77,
+    0x8c, 0x7d, 0xf6, 0x53, 0xa9, 0xd7, 0x65, 0x7d, 0xed, 0x5c, 0xe3, 0x7b, 0x18, 0xd9, 0x8d, 0xeb,
+    0xd9, 0xf5, 0x80, 0x02, 0x44, 0xe5, 0xcd, 0x03, 0x95, 0xef, 0x7a, 0x93, 0x20, 0xd7, 0x48, 0xb7,
+    0x32, 0x9c, 0x74, 0x14, 0x09, 0xac, 0xaa, 0xcf, 0x9b, 0x57, 0xca, 0xba, 0x54, 0xe4, 0x79, 0xd2,
+    0x0b, 0x6c, 0xbd, 0x3a, 0x41, 0x22, 0x0e, 0xc7, 0x66, 0x1f, 0xae, 0xa6, 0x1f, 0x71, 0xb2, 0x49,
+    0x91, 0x47, 0xcd, 0xcb, 0x84, 0x11, 0xf8, 0xa4, 0xae, 0x53, 0x81, 0xf0, 0x3c, 0xe2, 0xd3, 0x10,
+    0x88, 0x45, 0x2a, 0x56, 0x86, 0x97, 0x79, 0xc3, 0x39, 0x2a, 0xdf, 0x67, 0x3b, 0x57, 0x80, 0x5f,
+    0xf6, 0x27, 0xbf, 0x52, 0x4d, 0x0e, 0xb1, 0x18, 0xf3, 0x43, 0x54, 0x15, 0xba, 0xf3, 0xe9, 0x02,
+    0xaf, 0x85, 0x45, 0xd7, 0x31, 0x7d, 0x57, 0xc4, 0x71, 0xac, 0xfa, 0x5c, 0xc1, 0xf1, 0xe5, 0x4b,
+    0x4a, 0x09, 0x92, 0xb5, 0xca, 0x48, 0x74, 0xc6, 0x10, 0x0f, 0x7a, 0x91, 0x80, 0x82, 0x85, 0xae,
+    0x06, 0x59, 0x1b, 0x96, 0xf0, 0x10, 0x02, 0x97, 0x97, 0x58, 0x1e, 0x23, 0x21, 0xba, 0xf3, 0x19,
+    0x4d, 0x89, 0xe4, 0x5b, 0x9a, 0x90, 0xd1, 0xb7, 0x85, 0xca, 0x3e, 0x61, 0xf9, 0x4c, 0x62, 0xad,
+    0x6f, 0x95, 0xc5, 0xcb, 0xf4, 0x73, 0xe3, 0xa6, 0xeb, 0xb3, 0x8a, 0xfe, 0x06, 0xc9, 0xa0, 0x96,
+    0xe9, 0xed, 0x4c, 0x69, 0x58, 0xae, 0x96, 0xf3, 0xcf, 0x58, 0x8e, 0xa7, 0xe1, 0xa2, 0x97, 0xf3,
+    0xbb, 0x2d, 0xf7, 0x09, 0x1a, 0x49, 0x70, 0x2a, 0x68, 0xd8, 0x8c, 0x4f, 0xf1, 0x40, 0x14, 0x77,
+    0x3a, 0xa3, 0x79, 0xcf, 0xed, 0x68, 0xf2, 0x16, 0x86, 0x7a, 0xc2, 0x08, 0x7f, 0x86, 0xb7, 0x76,
+    0x7b, 0x8f, 0xa1, 0x8c, 0x96, 0xc7, 0x3a, 0x85, 0xa1, 0xe1, 0x32, 0x0c, 0x87, 0x2f, 0x09, 0x16,
+    0xfc, 0x72, 0xb7, 0xcb, 0x42, 0x45, 0x8a, 0x34, 0xf7, 0x35, 0x93, 0x86, 0x37, 0x43, 0x37, 0x41,
+    0x46, 0x1c, 0x6a, 0x7e, 0xc0, 0x39, 0xa0, 0xc0, 0x35, 0xc1, 0xaa, 0xdf, 0x71, 0x75, 0xc0, 0x45,
+    0x29, 0x57, 0xb3, 0x19, 0xce, 0x48, 0x33, 0x43, 0xf3, 0x5f, 0x9c, 0x90, 0x70, 0xef, 0x28, 0xfd,
+    0xc6, 0xe5, 0x87, 0x1f, 0xa6, 0x4e, 0x64, 0x3a, 0x4f, 0x41, 0x78, 0x9c, 0x6f, 0x1f, 0xdd, 0x7c,
+    0xfb, 0xd8, 0x13, 0xc7, 0x55, 0x0c, 0x77, 0x2a, 0x47, 0x13, 0xda, 0x0d, 0xfe, 0xf7, 0x79, 0x50,
+    0x44, 0x78, 0x79, 0x53, 0xa1, 0xc3, 0x71, 0x27, 0x6b, 0xb4, 0xad, 0x91, 0x6f, 0x3f, 0x1e, 0x68,
+    0xad, 0x4a, 0x9c, 0x1a, 0x35, 0x8a, 0x36, 0x6b, 0x85, 0x65, 0x4f, 0x91, 0xf0, 0xb3, 0xf1, 0x19,
+    0xcf, 0xfe, 0x5e, 0x23, 0xbd, 0x32, 0x59, 0xd0, 0x24, 0x6d, 0xf8, 0x93, 0x0d, 0x79, 0x1f, 0xfa,
+    0x60, 0xab, 0x4c, 0x5c, 0x86, 0xf6, 0x78, 0x89, 0x63, 0x98, 0xb1, 0xf2, 0x39, 0x0e, 0xa1, 0xae,
+    0x5d, 0x71, 0xd2, 0xd0, 0x54, 0xc7, 0x35, 0xe3, 0x7e, 0xf0, 0x3c, 0xef, 0xca, 0x78, 0x11, 0x3b,
+    0x67, 0x47, 0x48, 0xe8, 0xa8, 0x9f, 0x91, 0x12, 0x3b, 0x71, 0x47, 0x8c, 0x07, 0x6c, 0x5f, 0x65,
+    0xa3, 0xa1, 0x37, 0x4d, 0x8b, 0x7d, 0x7d, 0x4f, 0xd8, 0xec, 0xe3, 0x2d, 0x05, 0x3d, 0x29, 0xc4,
+    0xc2, 0xe6, 0x03, 0x06, 0x6b, 0xca, 0x4c, 0xcd, 0x31, 0x6b, 0xfc, 0x10, 0x14, 0x2d, 0xcb, 0xfc,
+    0xeb, 0x0b, 0xbf, 0x5d, 0xd4, 0x21, 0xde, 0x94, 0x3c, 0xe8, 0x98, 0xbf, 0x3b, 0xbf, 0x0b, 0xb9,
+    0x53, 0x5a, 0x3d, 0x6e, 0x4d, 0xf9, 0x01, 0x4b, 0xb4, 0x4f, 0x89, 0xe7, 0x64, 0x77, 0x82, 0x56,
+    0x0c, 0x02, 0xcd, 0xa0, 0xed, 0x12, 0xca, 0xeb, 0xd3, 0xbe, 0x57, 0xff, 0x60, 0x46, 0x93, 0x13,
+    0xfe, 0xec, 0x8c, 0x46, 0x19, 0x9c, 0xd1, 0xa8, 0x48, 0x57, 0x7b, 0xea, 0x0d, 0x0d, 0x6e, 0xd6,
+    0xfb, 0x25, 0xad, 0x05, 0xcd, 0x3c, 0xc7, 0xb5, 0x04, 0xfd, 0xb0, 0x3f, 0x83, 0xbf, 0xd4, 0x86,
+    0x86, 0x8d, 0x65, 0x7f, 0x0b, 0xb4, 0x98, 0x5c, 0xc0, 0x6b, 0xe1, 0x16, 0xe9, 0x0c, 0x57, 0x7c,
+    0x93, 0x34, 0xd8, 0x46, 0x5d, 0xb6, 0x7e, 0x8b, 0xcf, 0x36, 0x87, 0x01, 0x7a, 0x44, 0xff, 0x9d,
+    0xd5, 0x59, 0xfe, 0x36, 0x13, 0x85, 0xe4, 0xe4, 0x59, 0x2f, 0xb0, 0xf5, 0x87, 0x3c, 0xb5, 0x1a,
+    0xa4, 0xc0, 0xe1, 0xcb, 0x3b, 0xbc, 0x10, 0x65, 0x6e, 0x31, 0x3f, 0xd1, 0x2b, 0xc5, 0x06, 0x47,
+    0x67, 0x26, 0x0f, 0x57, 0x0e, 0x53, 0x7d, 0x43, 0x19, 0xec, 0xd1, 0xc4, 0xb5, 0x56, 0x48, 0x3a,
+    0x2d, 0xa4, 0xcc, 0xe9, 0x37, 0x10, 0xdc, 0x44, 0x34, 0x2e, 0x36, 0x18, 0x15, 0x53, 0x6d, 0xe8,
+    0x45, 0xd8, 0xb5, 0xd6, 0x0b, 0x59, 0xd6, 0x08, 0x5c, 0x32, 0xbe, 0xba, 0x68, 0x14, 0x90, 0x34,
+    0xf6, 0xee, 0x6e, 0xed, 0x7a, 0x4b, 0xa4, 0x1c, 0xcf, 0x1d, 0x93, 0xf7, 0x3f, 0x0d, 0xa5, 0x9d,
+    0x9c, 0xc0, 0xe1, 0x9b, 0xad, 0xbe, 0x45, 0xd0, 0x4c, 0x85, 0x03, 0xe2, 0x7e, 0xd2, 0x56, 0x85,
+    0x85, 0x61, 0x32, 0x24, 0x99, 0xc5, 0x67, 0xe4, 0x0c, 0x59, 0xd0, 0x3d, 0x72, 0xf6, 0xf5, 0xbf,
+    0x35, 0xd6, 0xfd, 0x1f, 0xab, 0x3f, 0xcf, 0x92, 0x91, 0xe2, 0x8b, 0x66, 0x85, 0x4e, 0x38, 0x1f,
+    0x1f, 0x8d, 0x4e, 0x4e, 0xe0, 0x47, 0x8c, 0x02, 0xba, 0xe6, 0x82, 0x4a, 0xfb, 0x0f, 0x57, 0xaf,
+    0x79, 0x14, 0xe2, 0xe9, 0x4e, 0xd4, 0x23, 0x20, 0xce, 0x79, 0xbe, 0xd2, 0xe3, 0x25, 0xd3, 0x0a,
+    0x8c, 0x47, 0x7f, 0x35, 0x39, 0xee, 0x3c, 0xc6, 0x6d, 0x68, 0x83, 0xa3, 0x1f, 0x92, 0xd0, 0x79,
+    0xca, 0xf5, 0x53, 0x5a, 0x09, 0x8f, 0xf0, 0xf9, 0x0d, 0xa2, 0x24, 0x2a, 0xf7, 0x06, 0x07, 0xc1,
+    0x8d, 0xe9, 0x0b, 0x4b, 0x43, 0x43, 0x07, 0xd4, 0x1c, 0xf3, 0x57, 0xc9, 0x32, 0xa3, 0xdf, 0x07,
+    0x70, 0x8e, 0x93, 0xc6, 0xb2, 0x0a, 0xa4, 0x18, 0x39, 0xd1, 0x0d, 0x69, 0x59, 0xc7, 0xc1, 0xd3,
+    0x7a, 0x01, 0x9e, 0xc8, 0xcf, 0x22, 0x0a, 0xb7, 0x48, 0x6c, 0x69, 0x4d, 0xd7, 0x36, 0x67, 0xeb,
+    0xa6, 0x3c, 0x2e, 0x23, 0x3c, 0xce, 0x81, 0x0f, 0x03, 0x9e, 0x32, 0xfc, 0x74, 0x41, 0xba, 0x78,
+    0xd8, 0xd0, 0xb0, 0x09, 0xf7, 0xee, 0x7c, 0x3e, 0x08, 0xdf, 0x29, 0xa4, 0xb7, 0x2a, 0xe3, 0x65,
+    0xda, 0x55, 0x04, 0xbe, 0xfe, 0x3a, 0xd0, 0xc7, 0x95, 0xea, 0x50, 0x81, 0xe1, 0xfa, 0xd8, 0xd0,
+    0xa7, 0xa5, 0x32, 0xc7, 0x18, 0x29, 0x4c, 0x71, 0xf0, 0xbf, 0x78, 0xa2, 0x1d, 0x3f, 0xf4, 0xc4,
+    0xf8, 0xbb, 0xe3, 0xff, 0x02, 0x8e, 0x0b, 0x58, 0x19, 0x90, 0x15, 0x00, 0x00,
+};
+static const char WS_API_CONTROL_PANEL_JS_ETAG[] PROGMEM = "\"3e3f5edb5ef724a6\"";
+
+}
@@ -0,0 +1,93 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// generated by gzip_frontend_files.py from Files/DALHAL_WebSocketAPI_index_html.h, do not edit
+
+#pragma once
+
+#include "stdint.h"
+#include <pgmspace.h>
+
+namespace DALHAL {
+
+// 2096 bytes uncompressed, 872 bytes gzip
+static const uint8_t WS_API_INDEX_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x56, 0xcd, 0x8e, 0xdb, 0x36,
+    0x10, 0xbe, 0xfb, 0x29, 0x18, 0x1e, 0xb2, 0x09, 0x50, 0x59, 0xc8, 0xad, 0x48, 0x2c, 0x03, 0xdb,
+    0xdd, 0x05, 0x12, 0x60, 0x83, 0x16, 0x88, 0x81, 0xa2, 0xa7, 0x82, 0x12, 0xc7, 0x12, 0x63, 0x8a,
+    0x14, 0xc8, 0xd1, 0x7a, 0x7d, 0xdb, 0x53, 0x4e, 0xbd, 0x04, 0xcd, 0xa5, 0xa7, 0xde, 0xfa, 0x0a,
+    0xbd, 0xf7, 0x51, 0xfc, 0x04, 0x7d, 0x84, 0x0e, 0xa9, 0x1f, 0xcb, 0x5e, 0x67, 0x1b, 0xc3, 0x00,
+    0x65, 0xce, 0x37, 0xc3, 0xe1, 0x37, 0xdf, 0x8c, 0x3c, 0x5b, 0x3c, 0xbb, 0xfe, 0xf1, 0x6a, 0xf5,
+    0xcb, 0x4f, 0x37, 0xac, 0xc2, 0x5a, 0x2f, 0x67, 0x8b, 0x61, 0x01, 0x21, 0x69, 0xa9, 0x01, 0x05,
+    0x2b, 0x2a, 0xe1, 0x3c, 0x60, 0xc6, 0x5b, 0x5c, 0x27, 0xdf, 0x73, 0xda, 0x46, 0x85, 0x1a, 0x96,
+    0xd7, 0x97, 0xb7, 0x6f, 0x2f, 0x6f, 0xd9, 0x0a, 0x5c, 0xad, 0x8c, 0xd0, 0x8b, 0xb4, 0xdb, 0x9e,
+    0x2d, 0xb4, 0x32, 0x1b, 0xe6, 0x40, 0x67, 0xdc, 0xe3, 0x4e, 0x83, 0xaf, 0x00, 0x90, 0xb3, 0xca,
+    0xc1, 0x3a, 0xe3, 0x85, 0xf7, 0x69, 0x2d, 0x94, 0x99, 0xd3, 0x03, 0xff, 0x06, 0xec, 0x56, 0xad,
+    0x55, 0x52, 0x58, 0xb3, 0x56, 0xe5, 0xb7, 0xba, 0xd4, 0x56, 0x0a, 0x3d, 0x80, 0xd3, 0xfe, 0x26,
+    0xb9, 0x95, 0x3b, 0x56, 0x68, 0xe1, 0x7d, 0xc6, 0xb5, 0x2a, 0x2b, 0x24, 0xe3, 0x6c, 0xe1, 0x0b,
+    0xa7, 0x1a, 0x64, 0xde, 0x15, 0x19, 0x8f, 0x59, 0x7d, 0x24, 0xa7, 0x45, 0xda, 0x6d, 0x2f, 0x8f,
+    0xed, 0xda, 0x96, 0x49, 0x05, 0xba, 0x01, 0xe7, 0x9f, 0x82, 0x89, 0x16, 0x6d, 0x61, 0xeb, 0x46,
+    0x03, 0xc2, 0x53, 0xb8, 0xe9, 0xc5, 0x9e, 0x80, 0x75, 0x97, 0x79, 0x02, 0x40, 0x21, 0xd0, 0x59,
+    0x9d, 0x34, 0xc2, 0xc0, 0x29, 0x70, 0xb6, 0x78, 0x96, 0x24, 0x6c, 0xff, 0xe5, 0x81, 0xbe, 0x6c,
+    0x65, 0xad, 0xce, 0x85, 0x1b, 0x7e, 0x26, 0x09, 0x05, 0x92, 0xea, 0x8e, 0x29, 0x99, 0x71, 0xec,
+    0x6c, 0xc4, 0x09, 0x63, 0xa7, 0x9b, 0x09, 0xda, 0x26, 0x1a, 0xc8, 0x54, 0xbd, 0x1a, 0xaa, 0xfe,
+    0x33, 0xe4, 0x1f, 0x6c, 0xb1, 0x01, 0x9c, 0xd4, 0x9f, 0xac, 0x1d, 0x2c, 0x6f, 0x11, 0xad, 0xe9,
+    0x82, 0x54, 0x50, 0x03, 0x85, 0x28, 0x4b, 0x0d, 0x9c, 0x59, 0x53, 0x68, 0x55, 0x6c, 0x42, 0xec,
+    0xb0, 0xb1, 0x0a, 0xc6, 0x17, 0x2f, 0xf9, 0xf2, 0xdf, 0x3f, 0x7f, 0xfb, 0x83, 0x49, 0xe1, 0x36,
+    0x8b, 0xb4, 0xf3, 0x8d, 0x89, 0xa4, 0x94, 0xc9, 0x98, 0x51, 0x5f, 0xbb, 0x1c, 0x4d, 0xe2, 0xec,
+    0x96, 0xc7, 0xe0, 0x70, 0x8f, 0x60, 0xbc, 0xb2, 0xc6, 0xff, 0x3a, 0xde, 0xe0, 0xd8, 0x2b, 0xa0,
+    0x82, 0x4b, 0x60, 0x89, 0xea, 0x0b, 0x07, 0x40, 0xbf, 0x1c, 0x51, 0xf4, 0x01, 0x05, 0xb6, 0x9e,
+    0x7d, 0x8d, 0x25, 0x1f, 0xcd, 0xc9, 0x48, 0x94, 0x27, 0xce, 0xa3, 0x61, 0xeb, 0x13, 0x65, 0xa4,
+    0x2a, 0x04, 0x5a, 0xc7, 0x87, 0x4c, 0xa5, 0xf2, 0x74, 0xaa, 0x81, 0x02, 0x41, 0xc6, 0xa2, 0x10,
+    0xfa, 0x91, 0x5b, 0x17, 0x92, 0x2f, 0xaf, 0x27, 0xe0, 0x01, 0x7a, 0x2e, 0xc3, 0xf7, 0x74, 0x09,
+    0x26, 0x1c, 0x88, 0xb3, 0x09, 0x06, 0x09, 0x07, 0x5d, 0xd3, 0x21, 0xc1, 0xe7, 0x72, 0x22, 0x45,
+    0x86, 0x7d, 0x99, 0xa2, 0xc7, 0xb4, 0xca, 0xfd, 0x7e, 0xb2, 0x75, 0x62, 0xac, 0xf3, 0x23, 0xa3,
+    0x16, 0x39, 0x68, 0xbe, 0x14, 0x67, 0x23, 0x3e, 0x37, 0xb9, 0x6f, 0xde, 0xfc, 0xf3, 0x77, 0xb7,
+    0x32, 0x09, 0x5a, 0xd5, 0x8a, 0xac, 0xaf, 0x59, 0x3a, 0x56, 0x63, 0x12, 0x74, 0x1a, 0x24, 0xb1,
+    0x2d, 0x36, 0x2d, 0xf6, 0xe7, 0x1e, 0x97, 0x9a, 0xfa, 0x1c, 0x92, 0x4a, 0x19, 0xb2, 0xae, 0x76,
+    0x0d, 0x30, 0xf2, 0xa9, 0x85, 0x91, 0x9e, 0x6d, 0x15, 0x56, 0x2c, 0x3d, 0x9c, 0xf3, 0x1d, 0x83,
+    0x79, 0x39, 0x67, 0x95, 0xd0, 0x29, 0x31, 0x23, 0x53, 0x8f, 0x4e, 0x99, 0x32, 0x95, 0x70, 0xa7,
+    0x0a, 0x78, 0x27, 0xe7, 0xec, 0xc6, 0x10, 0x8a, 0x79, 0x08, 0xce, 0x77, 0x4a, 0x1c, 0xc4, 0x3b,
+    0x9f, 0xe6, 0xf7, 0x7f, 0xa9, 0x06, 0xda, 0x8f, 0x13, 0x8d, 0xa2, 0x68, 0xcb, 0x12, 0x3c, 0x06,
+    0x11, 0x72, 0x46, 0x8d, 0x08, 0x21, 0x71, 0x8f, 0xb9, 0xbd, 0x9f, 0x68, 0xf1, 0x7c, 0x74, 0x65,
+    0xe8, 0xea, 0x51, 0xcd, 0x63, 0xd4, 0x51, 0x1b, 0x8d, 0xa3, 0x63, 0x31, 0xd1, 0x39, 0xb1, 0xfe,
+    0xbc, 0xc4, 0x37, 0x1d, 0xb7, 0x07, 0x15, 0x45, 0x74, 0x0c, 0x10, 0xe1, 0x45, 0x2d, 0x93, 0xf8,
+    0x8b, 0x33, 0x24, 0xae, 0x42, 0xe5, 0xee, 0xe9, 0x79, 0x9a, 0x7f, 0xc6, 0xed, 0x7a, 0xcd, 0x99,
+    0x6f, 0x40, 0xeb, 0xa2, 0x82, 0xd0, 0x85, 0x6b, 0xa1, 0x3d, 0xf0, 0x3e, 0x5a, 0xff, 0x69, 0xb4,
+    0x28, 0xa0, 0xb2, 0x5a, 0x82, 0xcb, 0xf8, 0x48, 0xe9, 0xfe, 0xe1, 0xaf, 0x13, 0x9c, 0x70, 0x4a,
+    0x74, 0xb2, 0xc8, 0xf8, 0x55, 0x57, 0x19, 0xd6, 0x67, 0x10, 0x4d, 0xc7, 0x47, 0x07, 0x4a, 0x7a,
+    0x43, 0x25, 0x7c, 0x63, 0x9b, 0xb6, 0x39, 0xf0, 0x94, 0x7e, 0x9d, 0xa2, 0x0d, 0xec, 0x06, 0x09,
+    0x88, 0x9c, 0xed, 0x1f, 0xbe, 0xb0, 0x51, 0x7e, 0x27, 0xaa, 0xdb, 0x7f, 0xfa, 0xbc, 0xff, 0xf4,
+    0x7b, 0x84, 0x78, 0xd0, 0xd4, 0x48, 0xa4, 0x90, 0x8a, 0x0e, 0xb0, 0x6e, 0x77, 0x0a, 0xbd, 0xf1,
+    0x45, 0xc4, 0x51, 0x87, 0xd6, 0xca, 0xfb, 0x47, 0xe6, 0xa8, 0x96, 0x2e, 0x90, 0x91, 0x87, 0x79,
+    0xd2, 0xb7, 0x63, 0xdf, 0x5c, 0xb7, 0xb6, 0x64, 0x61, 0xe6, 0x9e, 0xf6, 0x53, 0x78, 0x4d, 0x9c,
+    0x6b, 0xa5, 0xb0, 0xdf, 0x77, 0xd1, 0xb4, 0xd8, 0xcb, 0xc3, 0x20, 0x25, 0xc4, 0x49, 0x7d, 0xfb,
+    0x39, 0x3a, 0x4e, 0x4d, 0x69, 0x8b, 0xb6, 0x06, 0x83, 0xf3, 0x12, 0xf0, 0x46, 0x43, 0x78, 0xfc,
+    0x61, 0xf7, 0x4e, 0xbe, 0xb8, 0x20, 0xd7, 0x8b, 0x97, 0x73, 0x45, 0x03, 0xc4, 0xbd, 0x5d, 0xbd,
+    0xbf, 0xcd, 0x2e, 0x2e, 0xf8, 0xf2, 0x4a, 0x83, 0x70, 0xd3, 0x79, 0x7a, 0x9e, 0x61, 0x72, 0x9d,
+    0x0e, 0xcd, 0x61, 0xe6, 0x0c, 0x43, 0x32, 0xbc, 0x37, 0xe3, 0x6b, 0x34, 0xfe, 0x2f, 0xf8, 0x0f,
+    0xc1, 0x02, 0xe0, 0x5f, 0x30, 0x08, 0x00, 0x00,
+};
+static const char WS_API_INDEX_HTML_ETAG[] PROGMEM = "\"ba31aa366d89fcd7\"";
+
+}
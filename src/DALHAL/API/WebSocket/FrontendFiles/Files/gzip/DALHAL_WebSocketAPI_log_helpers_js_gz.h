@@ -0,0 +1,73 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// generated by gzip_frontend_files.py from Files/DALHAL_WebSocketAPI_log_helpers_js.h, do not edit
+
+#pragma once
+
+#include "stdint.h"
+#include <pgmspace.h>
+
+namespace DALHAL {
+
+// 1322 bytes uncompressed, 556 bytes gzip
+static const uint8_t WS_API_LOG_HELPERS_JS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x54, 0x6d, 0x6a, 0xdb, 0x40,
+    0x10, 0xfd, 0xef, 0x53, 0x0c, 0xa2, 0xe0, 0x15, 0x71, 0x94, 0xb4, 0xa5, 0x7f, 0x6a, 0x1c, 0xd3,
+    0x3a, 0x81, 0x7e, 0x98, 0x14, 0xea, 0x1c, 0x20, 0x1b, 0x69, 0x2c, 0x6d, 0x59, 0xef, 0x8a, 0xdd,
+    0x91, 0x5d, 0x13, 0x0c, 0x39, 0x44, 0xcf, 0xd0, 0x83, 0xe5, 0x24, 0x9d, 0xd5, 0x4a, 0x8d, 0xdd,
+    0x26, 0xa1, 0x7f, 0x0b, 0x42, 0x68, 0x67, 0xde, 0xbc, 0xa7, 0xf7, 0x56, 0xab, 0xc1, 0xc9, 0x09,
+    0xdc, 0xff, 0xb8, 0xe3, 0x0b, 0xe6, 0xb6, 0x84, 0x0a, 0x75, 0x8d, 0xce, 0x77, 0xa5, 0xff, 0xf4,
+    0x1a, 0xe4, 0xd6, 0x78, 0x02, 0xcd, 0x7e, 0x26, 0x50, 0xd8, 0xbc, 0x59, 0xa1, 0xa1, 0xac, 0x44,
+    0xba, 0xd0, 0x18, 0x1e, 0xdf, 0x6f, 0x3f, 0x16, 0x62, 0xc8, 0xed, 0x61, 0x3a, 0x1e, 0x0c, 0x96,
+    0x8d, 0xc9, 0x49, 0x59, 0x13, 0xf0, 0x57, 0xf8, 0x9d, 0x04, 0xf1, 0x2d, 0x85, 0xdb, 0x01, 0x40,
+    0xe4, 0x29, 0xd4, 0x7a, 0x9f, 0x27, 0x77, 0x28, 0x09, 0x3b, 0x2a, 0x31, 0xe4, 0x6e, 0xa0, 0x81,
+    0x00, 0xcb, 0x3c, 0x6d, 0x35, 0x66, 0x9b, 0x4a, 0x11, 0x2e, 0x6a, 0x99, 0x23, 0xcf, 0x0d, 0x6b,
+    0x87, 0xc7, 0x1b, 0x27, 0xeb, 0x61, 0x0f, 0x0a, 0xfc, 0x33, 0x6b, 0x88, 0xc7, 0xb9, 0x1f, 0x56,
+    0xa1, 0xc3, 0xea, 0x99, 0xac, 0x6b, 0x34, 0xc5, 0xac, 0x52, 0xba, 0x10, 0x8c, 0x4c, 0xfb, 0xba,
+    0xcf, 0x9d, 0xd5, 0xfa, 0xca, 0xd6, 0x8c, 0x7f, 0x58, 0x7f, 0x40, 0x55, 0x56, 0x3c, 0xbb, 0x3b,
+    0xf4, 0x30, 0xe3, 0x96, 0xac, 0xbd, 0xba, 0xd1, 0x28, 0xbe, 0x79, 0x6b, 0xce, 0x25, 0xc9, 0x11,
+    0x90, 0x22, 0x8d, 0x0b, 0x72, 0x07, 0xc6, 0x90, 0xa4, 0xd2, 0xfe, 0x69, 0x73, 0x49, 0x87, 0x48,
+    0x42, 0x4e, 0xfd, 0x94, 0x6f, 0x56, 0x2b, 0xe9, 0xb6, 0xcf, 0x4c, 0x75, 0x88, 0xa4, 0x7d, 0xff,
+    0x38, 0x64, 0x0d, 0xce, 0x95, 0x09, 0x79, 0x7c, 0x5a, 0x7c, 0xb9, 0xe4, 0x9c, 0x9c, 0x32, 0xa5,
+    0x5a, 0x6e, 0x7f, 0xbf, 0x61, 0x54, 0xe8, 0x26, 0x0f, 0x23, 0xe2, 0x3a, 0xc0, 0xf5, 0x8b, 0xdb,
+    0xde, 0x02, 0x4c, 0xa7, 0x90, 0x24, 0x3b, 0xb8, 0x86, 0xa3, 0xb6, 0x25, 0x3a, 0xf2, 0x4c, 0xa3,
+    0x29, 0xa9, 0x82, 0x33, 0x78, 0xf9, 0xe6, 0x14, 0xa6, 0xbd, 0x66, 0xe6, 0xb5, 0xca, 0x51, 0x9c,
+    0x8e, 0x42, 0xf9, 0xf8, 0x75, 0x0a, 0x47, 0x90, 0xdc, 0xdf, 0xfd, 0x4c, 0xe0, 0x6d, 0x8f, 0xd8,
+    0x77, 0xc7, 0xbb, 0xf5, 0x8c, 0x33, 0xee, 0x46, 0x57, 0xfc, 0xf0, 0xc7, 0x3e, 0x3e, 0xe1, 0x6b,
+    0x04, 0xa6, 0xd1, 0x7a, 0x04, 0xaf, 0xa2, 0x48, 0x17, 0xe8, 0xc1, 0x4e, 0x77, 0xa6, 0xe3, 0x47,
+    0xf4, 0x48, 0x9f, 0xb5, 0xe2, 0x70, 0x10, 0x95, 0x45, 0x71, 0xb1, 0x66, 0xc5, 0xb9, 0xf2, 0x2c,
+    0x8c, 0x4e, 0x24, 0x2b, 0xdb, 0x78, 0x2c, 0xec, 0xc6, 0x24, 0x23, 0x10, 0x98, 0xc2, 0xe4, 0xac,
+    0xdd, 0x62, 0x00, 0xb5, 0xe4, 0x75, 0x96, 0x93, 0xd3, 0x9f, 0x91, 0xb7, 0x6b, 0x02, 0x4b, 0xa9,
+    0x3d, 0x03, 0x6e, 0xc1, 0x21, 0x35, 0xce, 0x8c, 0x77, 0x2d, 0x0c, 0x33, 0xe6, 0x0d, 0x94, 0xe7,
+    0xb8, 0x94, 0x8d, 0x26, 0x91, 0x8e, 0x81, 0x7f, 0x0a, 0x9e, 0x6c, 0xed, 0xc1, 0x48, 0x52, 0x6b,
+    0x04, 0x8f, 0x1a, 0xe3, 0x07, 0x76, 0x83, 0x95, 0x5c, 0x2b, 0xeb, 0xda, 0xd1, 0x18, 0x99, 0x93,
+    0xa6, 0x7c, 0x24, 0xb4, 0xaf, 0xa1, 0x2c, 0x5a, 0x57, 0x10, 0x31, 0x59, 0xa4, 0xb9, 0xb4, 0x05,
+    0x76, 0xb9, 0xf9, 0xce, 0xdc, 0x03, 0x19, 0x43, 0x98, 0x6a, 0xa3, 0x0c, 0x3b, 0x0a, 0x47, 0x76,
+    0xd1, 0x2b, 0xf7, 0x4c, 0x0c, 0xc8, 0x1c, 0xae, 0xec, 0x1a, 0xdf, 0x69, 0xdd, 0x6a, 0xf8, 0xfd,
+    0x16, 0xe7, 0x13, 0x85, 0x5b, 0xc5, 0xb6, 0xb1, 0x8b, 0xe9, 0xfd, 0x75, 0xc0, 0x62, 0xd4, 0xff,
+    0x7c, 0xc8, 0x7e, 0x01, 0x3a, 0x63, 0x4c, 0x52, 0x2a, 0x05, 0x00, 0x00,
+};
+static const char WS_API_LOG_HELPERS_JS_ETAG[] PROGMEM = "\"43198e80011f743f\"";
+
+}
@@ -0,0 +1,148 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// generated by gzip_frontend_files.py from Files/DALHAL_WebSocketAPI_main.js.h, do not edit
+
+#pragma once
+
+#include "stdint.h"
+#include <pgmspace.h>
+
+namespace DALHAL {
+
+// 4946 bytes uncompressed, 1747 bytes gzip
+static const uint8_t WS_API_MAIN_JS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x57, 0xcd, 0x6e, 0x1b, 0x37,
+    0x10, 0xbe, 0xeb, 0x29, 0x58, 0xc3, 0xc8, 0x72, 0xe1, 0xf5, 0xca, 0xc9, 0x29, 0xb0, 0xea, 0x14,
+    0x89, 0x6d, 0xa0, 0x0d, 0x12, 0xdb, 0x88, 0x55, 0xe4, 0x90, 0x04, 0xf1, 0x6a, 0x97, 0x92, 0x18,
+    0xaf, 0x48, 0x81, 0xe4, 0x5a, 0x11, 0x1c, 0x01, 0x7e, 0x80, 0x02, 0xbd, 0xe4, 0xd0, 0x9e, 0x7a,
+    0xeb, 0x33, 0xf4, 0x79, 0xfc, 0x02, 0xed, 0x23, 0x74, 0x86, 0x3f, 0xfb, 0x23, 0xd9, 0x6e, 0xcf,
+    0x31, 0x0c, 0x68, 0x49, 0xce, 0xff, 0x7c, 0x33, 0x43, 0xf6, 0xfa, 0x7d, 0x72, 0xfb, 0xf5, 0x06,
+    0xfe, 0xc9, 0x70, 0xca, 0x66, 0xcc, 0x2f, 0xbe, 0x99, 0xff, 0x5e, 0xc9, 0x0c, 0xe1, 0xfa, 0x28,
+    0x53, 0x97, 0xe4, 0x80, 0x8c, 0xb3, 0x52, 0xb3, 0x41, 0x6f, 0x5c, 0x89, 0xdc, 0x70, 0x29, 0x88,
+    0x91, 0x93, 0x49, 0xc9, 0xac, 0xe3, 0x34, 0x26, 0xd7, 0x3d, 0xd2, 0x90, 0x7e, 0xe7, 0xbe, 0x06,
+    0xb0, 0x57, 0xc8, 0xbc, 0x9a, 0x31, 0x61, 0xd2, 0x91, 0x2c, 0x96, 0x69, 0x5e, 0x66, 0x5a, 0x9f,
+    0x64, 0x10, 0xaa, 0x83, 0x40, 0xfd, 0x03, 0x89, 0x0a, 0xf8, 0x8d, 0xc8, 0x3e, 0x89, 0x4a, 0x3e,
+    0x99, 0x9a, 0xa8, 0xc3, 0x36, 0x61, 0xe6, 0xb8, 0x64, 0xf8, 0xf9, 0x62, 0xf9, 0x53, 0x41, 0x23,
+    0x83, 0xfa, 0x76, 0x9d, 0xee, 0x28, 0x4e, 0x0d, 0xfb, 0x6c, 0x0e, 0xa5, 0x30, 0x70, 0xde, 0x11,
+    0x79, 0xfb, 0xdb, 0xcd, 0xdf, 0x7f, 0xfd, 0x4a, 0x9c, 0x40, 0x14, 0xfd, 0xcf, 0x1f, 0xbf, 0xfc,
+    0x4e, 0xac, 0xa2, 0x41, 0x6f, 0xd5, 0xeb, 0x35, 0x99, 0x7b, 0xcb, 0x46, 0xe7, 0x32, 0xbf, 0x04,
+    0x4f, 0xbf, 0x95, 0x8c, 0x2d, 0xf4, 0xa0, 0x97, 0x4b, 0xa1, 0x0d, 0x79, 0x73, 0x7c, 0x78, 0x7a,
+    0x72, 0x72, 0x7c, 0x38, 0xfc, 0xf8, 0xfa, 0x1c, 0xc2, 0xf3, 0x64, 0x6f, 0x6f, 0x6f, 0x60, 0x49,
+    0xf2, 0x69, 0x25, 0x2e, 0x35, 0x6c, 0xbd, 0xfb, 0x10, 0x68, 0x0b, 0x96, 0xcb, 0x82, 0x29, 0xd8,
+    0x13, 0x6c, 0x41, 0x86, 0x10, 0xd7, 0x23, 0xb7, 0x43, 0xa3, 0xca, 0x8c, 0x77, 0x9f, 0x46, 0x71,
+    0xa0, 0xcc, 0x2b, 0x6d, 0xe4, 0xec, 0x2c, 0x53, 0x9a, 0xa9, 0x20, 0xc3, 0x4a, 0x2d, 0x65, 0x9e,
+    0x21, 0x34, 0x3e, 0x4e, 0xa5, 0xc6, 0x74, 0x84, 0x75, 0x8a, 0xeb, 0x41, 0x8f, 0x8f, 0x09, 0xfd,
+    0xae, 0x43, 0x93, 0x32, 0x51, 0xe8, 0xb7, 0xdc, 0x4c, 0x69, 0xb4, 0xff, 0xf4, 0x49, 0x14, 0xc7,
+    0x6b, 0x22, 0x76, 0x0e, 0x88, 0x3d, 0x00, 0xf9, 0x35, 0xec, 0x34, 0x33, 0x6f, 0xf5, 0xb9, 0xc9,
+    0x4c, 0xa5, 0x29, 0xd8, 0x23, 0x58, 0x6e, 0x58, 0x91, 0x10, 0x04, 0x82, 0x43, 0xa1, 0x77, 0x47,
+    0xa2, 0x05, 0xf7, 0xc2, 0x68, 0xa1, 0x77, 0xb9, 0x28, 0x38, 0x28, 0x93, 0x0a, 0x3d, 0x43, 0xc4,
+    0x99, 0x0e, 0x3c, 0x6b, 0xd9, 0x08, 0xa7, 0x7a, 0x61, 0xb1, 0x54, 0x70, 0xdd, 0x6c, 0x3c, 0x88,
+    0x56, 0x50, 0xa3, 0xad, 0xa9, 0x1b, 0x50, 0xc5, 0x95, 0x45, 0x62, 0xed, 0x98, 0x17, 0xe9, 0x6b,
+    0x69, 0xa1, 0x7d, 0x26, 0x6a, 0x7c, 0xd2, 0x8b, 0x85, 0xde, 0xef, 0xf7, 0xb7, 0xaf, 0x3b, 0x31,
+    0x5a, 0xf5, 0x17, 0xfa, 0xc2, 0x3a, 0xb0, 0xd0, 0xe9, 0x88, 0x8b, 0x4c, 0x2d, 0x87, 0xcb, 0x39,
+    0x3a, 0x10, 0x65, 0x4a, 0x65, 0xcb, 0x51, 0x35, 0x1e, 0x33, 0x85, 0x11, 0xb4, 0x14, 0x52, 0xc8,
+    0x39, 0x13, 0x70, 0x0a, 0x6a, 0x0e, 0x9e, 0x59, 0x4d, 0xa4, 0x13, 0x52, 0xa3, 0x2a, 0x96, 0x90,
+    0x8b, 0xc3, 0xda, 0x7b, 0x23, 0xc9, 0xc3, 0x7a, 0x09, 0x24, 0x6d, 0x82, 0x78, 0xa1, 0x51, 0xcd,
+    0xf5, 0x5e, 0x44, 0xfe, 0x6c, 0xa1, 0xcf, 0x21, 0xc9, 0x34, 0x9a, 0xb2, 0x72, 0xee, 0xf6, 0x56,
+    0x8d, 0x2d, 0x33, 0xa6, 0x75, 0x36, 0x41, 0x63, 0x29, 0xbb, 0x32, 0x2d, 0x8b, 0x10, 0x2a, 0x06,
+    0xdc, 0x90, 0x63, 0x02, 0x07, 0x69, 0x91, 0x99, 0x8c, 0x1c, 0x1c, 0x80, 0x4f, 0xda, 0x28, 0x2e,
+    0x26, 0x51, 0xec, 0xe9, 0x40, 0x37, 0xe0, 0xee, 0x93, 0x96, 0xe2, 0x08, 0x48, 0x06, 0x7e, 0xcf,
+    0xa8, 0x65, 0x7d, 0x4e, 0xea, 0x53, 0xd0, 0xf2, 0xf2, 0xfc, 0xf4, 0x24, 0x9d, 0x23, 0x70, 0x69,
+    0x10, 0x1b, 0x0f, 0x6a, 0x42, 0x54, 0x1a, 0x88, 0x53, 0x63, 0x83, 0xe8, 0x54, 0x66, 0xca, 0x7c,
+    0xb4, 0x15, 0x03, 0xe9, 0x8e, 0x5b, 0x92, 0x49, 0xb7, 0x8e, 0xc2, 0xe6, 0x8a, 0x30, 0xe8, 0x94,
+    0xf7, 0x89, 0x83, 0x68, 0xdc, 0x27, 0xcc, 0x02, 0xd7, 0x48, 0x93, 0x95, 0x88, 0x3f, 0x2b, 0x3a,
+    0x55, 0xac, 0xa8, 0x72, 0x46, 0xa9, 0x4e, 0x48, 0x6e, 0x03, 0xa4, 0xc9, 0x0e, 0xc9, 0xd3, 0x92,
+    0x89, 0x89, 0x99, 0x26, 0x64, 0xaf, 0x65, 0x7f, 0x90, 0x30, 0x63, 0x6a, 0x02, 0x89, 0x73, 0xf0,
+    0xf9, 0x99, 0x0b, 0xf3, 0xf4, 0x39, 0x22, 0x81, 0x5a, 0xc9, 0x1d, 0x7a, 0x0c, 0x9e, 0x1c, 0x8f,
+    0x21, 0xff, 0x40, 0xbd, 0xd7, 0x3e, 0x19, 0x4b, 0x45, 0xa8, 0x2f, 0x77, 0x20, 0xf1, 0xd6, 0x80,
+    0xbd, 0x5e, 0x7a, 0x0a, 0x3c, 0x34, 0x4f, 0x3c, 0x77, 0x3c, 0x08, 0x62, 0xa0, 0x62, 0x83, 0x71,
+    0x03, 0xb2, 0xda, 0x74, 0x0e, 0x60, 0x82, 0x65, 0xe9, 0x3a, 0x4b, 0xea, 0x7e, 0xa9, 0x13, 0xd9,
+    0xb1, 0xac, 0x13, 0x3c, 0xcc, 0xd3, 0xb0, 0x0e, 0x20, 0x6e, 0xaf, 0x45, 0xce, 0xa7, 0x9c, 0x74,
+    0xb6, 0x9c, 0x7b, 0x36, 0xdb, 0xc5, 0x4b, 0xe0, 0xe9, 0xe6, 0xdf, 0xf6, 0x8b, 0xc1, 0x1a, 0x43,
+    0x37, 0x65, 0xd9, 0x84, 0xa0, 0x3e, 0x87, 0xdc, 0x35, 0x7d, 0xf8, 0x87, 0x07, 0x43, 0xc5, 0xd8,
+    0x5d, 0x82, 0x09, 0x0c, 0x98, 0x5c, 0xb1, 0xcc, 0x30, 0xf0, 0x7c, 0xbe, 0xec, 0x6d, 0x30, 0x2b,
+    0xc0, 0x01, 0x53, 0xcf, 0x2b, 0x23, 0x5f, 0x54, 0xc6, 0x40, 0x70, 0x68, 0x10, 0x97, 0xdc, 0xdf,
+    0x4e, 0x46, 0x46, 0xec, 0x42, 0x20, 0x4d, 0xc6, 0x05, 0xd4, 0x74, 0x9c, 0xf8, 0xea, 0xda, 0xf0,
+    0xc3, 0x23, 0x70, 0xd3, 0x64, 0x9b, 0x56, 0x3b, 0xd5, 0x0f, 0xf6, 0x06, 0xfc, 0xfb, 0x4e, 0x27,
+    0x0f, 0x69, 0xe3, 0x3b, 0x3b, 0x77, 0x79, 0xeb, 0xc3, 0xd3, 0x61, 0x79, 0xc7, 0x3f, 0x74, 0xe2,
+    0xe5, 0xdb, 0xf0, 0x3d, 0xec, 0x64, 0x04, 0x01, 0xb9, 0x1c, 0xdc, 0x75, 0xb4, 0xea, 0xfd, 0xd7,
+    0xce, 0xfa, 0x1a, 0x7a, 0xce, 0xa1, 0x2c, 0xcb, 0x6c, 0xae, 0xf9, 0xa8, 0x64, 0xb4, 0x49, 0x73,
+    0x42, 0xda, 0x16, 0xad, 0x85, 0x66, 0x45, 0xa0, 0x85, 0xe5, 0x53, 0xca, 0x10, 0xc9, 0x08, 0x49,
+    0x59, 0xb2, 0x14, 0x44, 0xc1, 0xc6, 0xa0, 0x69, 0x63, 0xd4, 0xa2, 0xdd, 0x41, 0x87, 0x30, 0xa5,
+    0xa4, 0x8a, 0xa1, 0xa1, 0x41, 0xdd, 0xf9, 0xdc, 0xb6, 0x6d, 0xb9, 0x33, 0xd4, 0x41, 0xd2, 0x06,
+    0xc8, 0x56, 0xbd, 0x07, 0xf8, 0xd6, 0x5c, 0x0a, 0x6e, 0xb4, 0x04, 0x04, 0xf6, 0xb6, 0x1b, 0xbd,
+    0x75, 0xa5, 0x1b, 0x9d, 0xcd, 0x71, 0xad, 0x29, 0xf4, 0xed, 0x65, 0x5e, 0xe9, 0x29, 0x5d, 0xeb,
+    0x13, 0xb5, 0x00, 0x2f, 0x61, 0xd5, 0x6d, 0xda, 0x79, 0x29, 0x35, 0x7b, 0x60, 0x82, 0xd8, 0x7b,
+    0x22, 0x8c, 0x90, 0xa3, 0xd6, 0x94, 0x24, 0xb7, 0x37, 0x5f, 0x01, 0xf2, 0x7e, 0x0d, 0x1d, 0x9c,
+    0x70, 0x41, 0xb6, 0xaf, 0xdb, 0xf7, 0x93, 0xfe, 0x63, 0xb8, 0x9d, 0xac, 0xf4, 0xed, 0xcd, 0x9f,
+    0x1b, 0x63, 0xa5, 0x2d, 0x29, 0xe9, 0x88, 0x01, 0xea, 0x66, 0xd4, 0x80, 0x11, 0x43, 0x3e, 0x63,
+    0xb2, 0x32, 0xe1, 0x62, 0x90, 0x74, 0x6e, 0x40, 0xeb, 0xd3, 0xc7, 0x66, 0xb6, 0x76, 0x04, 0xb6,
+    0xac, 0x67, 0x34, 0xee, 0x8e, 0x65, 0x3f, 0xc0, 0xf2, 0x59, 0xd1, 0xbe, 0x5e, 0xc0, 0x18, 0x9a,
+    0xcd, 0x6c, 0x93, 0x85, 0x83, 0x14, 0x57, 0x34, 0x86, 0x5e, 0x3d, 0x2f, 0x33, 0x68, 0xd6, 0xfd,
+    0xf7, 0xfd, 0xed, 0x7e, 0x42, 0x22, 0x67, 0x98, 0xbd, 0xf6, 0x78, 0xfa, 0x18, 0xac, 0x37, 0x95,
+    0x12, 0x61, 0x1f, 0xa6, 0xfc, 0xa3, 0x47, 0xa8, 0x1a, 0x2a, 0xa3, 0x58, 0x62, 0x00, 0x5d, 0x93,
+    0xab, 0x87, 0x7e, 0x7a, 0x7a, 0x76, 0x7c, 0x12, 0xb2, 0x0c, 0x74, 0x1a, 0x6d, 0x09, 0xc2, 0x9c,
+    0xdb, 0x86, 0xa9, 0xd9, 0x19, 0x4c, 0x45, 0xf3, 0x0a, 0xba, 0x02, 0x8d, 0x9e, 0x11, 0x8b, 0x54,
+    0x47, 0x92, 0xe0, 0x9d, 0x5a, 0xb0, 0xdd, 0xb9, 0x92, 0xb3, 0xb9, 0xf1, 0xf3, 0xb7, 0x0d, 0x84,
+    0x35, 0xe6, 0x13, 0xb8, 0x35, 0x35, 0x57, 0x9b, 0xc0, 0x0d, 0x81, 0xf2, 0xac, 0x18, 0x99, 0xce,
+    0x95, 0xa5, 0x2c, 0x81, 0xf4, 0x8d, 0x5c, 0x68, 0x2a, 0xa0, 0x93, 0x27, 0x50, 0x33, 0x66, 0x0a,
+    0xcd, 0xc1, 0xe8, 0x76, 0xb0, 0x94, 0x5c, 0x34, 0x33, 0xd2, 0x6d, 0x21, 0xc4, 0x21, 0x7f, 0xcd,
+    0x76, 0x7b, 0xe0, 0x4c, 0x79, 0x59, 0xe0, 0xd0, 0xb1, 0x32, 0x53, 0xbb, 0x84, 0x76, 0x49, 0xbe,
+    0x7c, 0x01, 0xda, 0xba, 0xb9, 0xb4, 0x68, 0xcf, 0x40, 0x29, 0x08, 0xaa, 0x75, 0xa7, 0x70, 0x06,
+    0x05, 0x42, 0xed, 0x61, 0x2a, 0xe0, 0x3e, 0xe7, 0x43, 0x65, 0x1b, 0x98, 0xdd, 0xcc, 0xa0, 0xf1,
+    0x4e, 0x98, 0x18, 0xd9, 0xde, 0xdb, 0x54, 0x51, 0x30, 0xcb, 0xd5, 0x45, 0x53, 0x5b, 0x28, 0x7a,
+    0xbf, 0x51, 0x96, 0x7e, 0x92, 0x5c, 0xd0, 0xa8, 0x0f, 0x2d, 0xb8, 0x26, 0x41, 0x35, 0x9e, 0xc4,
+    0xaa, 0x6c, 0x4e, 0x8a, 0x4c, 0x4c, 0x98, 0x0a, 0x67, 0x5e, 0xb3, 0xdb, 0x4c, 0x5a, 0x1a, 0xc0,
+    0x45, 0xb3, 0xdf, 0x38, 0xf1, 0xae, 0x71, 0xc7, 0x35, 0x66, 0xb2, 0x4b, 0x1e, 0x7f, 0xc0, 0x20,
+    0x88, 0xaa, 0x2c, 0x43, 0x69, 0xb7, 0x4a, 0x94, 0xd8, 0x38, 0x3b, 0xcb, 0xd3, 0x34, 0x6d, 0xe7,
+    0xc6, 0x6a, 0x4e, 0x1a, 0xfb, 0x63, 0x9f, 0x4d, 0x17, 0x91, 0xda, 0x69, 0xaf, 0xe7, 0x19, 0xdc,
+    0x2a, 0x7c, 0x44, 0xac, 0xc4, 0x4a, 0xe8, 0x29, 0x1f, 0x1b, 0x7a, 0x4d, 0x26, 0x4a, 0x56, 0xf3,
+    0xb3, 0xff, 0x6f, 0x69, 0xa4, 0xa4, 0x34, 0x00, 0x23, 0x17, 0x66, 0xbd, 0xdf, 0xa4, 0x7d, 0x55,
+    0x5b, 0xe0, 0x0a, 0xc2, 0x6a, 0xea, 0x16, 0xde, 0xe6, 0x84, 0x34, 0x76, 0x3a, 0xd6, 0x03, 0xb0,
+    0x1e, 0x7f, 0x01, 0x6a, 0x6e, 0x3b, 0xe5, 0x80, 0x5f, 0xf5, 0xe3, 0xf0, 0xf5, 0x2b, 0xbc, 0x04,
+    0x47, 0x83, 0x75, 0x18, 0xb6, 0x03, 0x83, 0x12, 0x53, 0x34, 0x32, 0x41, 0x68, 0xad, 0xe1, 0x10,
+    0xe8, 0x11, 0x85, 0xc8, 0xd6, 0x05, 0x5d, 0xc1, 0xaf, 0xda, 0x6f, 0x0b, 0x37, 0xe7, 0xfd, 0xa0,
+    0xa6, 0xf0, 0x3a, 0xb8, 0x0a, 0x1d, 0x09, 0x3e, 0x3b, 0x6f, 0x0a, 0x3b, 0xc0, 0x41, 0x5e, 0xe4,
+    0x8e, 0x5b, 0xba, 0xe0, 0xc0, 0xeb, 0x4a, 0x7d, 0xb0, 0x1a, 0x50, 0x7a, 0x8a, 0x07, 0x54, 0x3a,
+    0x96, 0xa8, 0xee, 0xf8, 0xa3, 0xae, 0x56, 0x68, 0x51, 0xbb, 0xa0, 0x00, 0xfb, 0x02, 0x85, 0xdf,
+    0xd4, 0x61, 0x0f, 0xdf, 0x35, 0x1e, 0x9b, 0xf6, 0x55, 0xd3, 0x66, 0xef, 0xbe, 0x55, 0x90, 0xc7,
+    0xe1, 0x13, 0x78, 0x2e, 0xb6, 0xaf, 0x9b, 0xf5, 0xaa, 0xef, 0x56, 0x08, 0xf8, 0xd5, 0x05, 0x48,
+    0x09, 0x8b, 0x96, 0x28, 0x6e, 0x4a, 0x56, 0x0b, 0xc1, 0x6b, 0x21, 0xde, 0x8d, 0xc6, 0x80, 0x61,
+    0x8b, 0x20, 0x92, 0x69, 0xb8, 0xf2, 0xca, 0xd2, 0xf0, 0x79, 0xcd, 0x82, 0x33, 0x86, 0xe7, 0x97,
+    0xad, 0xd6, 0x6c, 0x5b, 0x70, 0x90, 0x50, 0xdb, 0x89, 0xe1, 0xcd, 0xe6, 0xf0, 0x9e, 0x29, 0x0e,
+    0x11, 0xd9, 0x74, 0xd4, 0xa9, 0x86, 0x06, 0x10, 0x6d, 0x1a, 0xe0, 0x69, 0x5a, 0x99, 0x8b, 0x2c,
+    0xf8, 0xfa, 0x11, 0x4d, 0x18, 0x65, 0xea, 0x81, 0x27, 0xe3, 0x16, 0x90, 0x31, 0xa1, 0x01, 0x99,
+    0x3a, 0x50, 0x6f, 0x81, 0xa4, 0x1e, 0xfb, 0x3c, 0x97, 0xca, 0x90, 0x16, 0x6c, 0x27, 0x5c, 0x43,
+    0x5b, 0x1d, 0x3a, 0x1a, 0x87, 0x5d, 0x7b, 0x13, 0x80, 0xdb, 0xb2, 0x73, 0x2c, 0x21, 0x1c, 0x27,
+    0xc7, 0xd6, 0x56, 0x17, 0x56, 0x88, 0x81, 0x7b, 0x73, 0xbc, 0xe5, 0x72, 0x6c, 0x55, 0xda, 0x28,
+    0x41, 0x30, 0xee, 0x7a, 0x51, 0xd6, 0x7d, 0x8e, 0x17, 0x71, 0xdd, 0x5c, 0x90, 0xd8, 0xaa, 0xe4,
+    0x45, 0x8b, 0xbd, 0x09, 0xb3, 0xff, 0xf2, 0x67, 0xad, 0x78, 0x74, 0xc3, 0x6b, 0x44, 0xd0, 0xee,
+    0x8b, 0x16, 0x76, 0x6c, 0xcd, 0xd6, 0x36, 0x67, 0x45, 0x71, 0x7c, 0xc5, 0x70, 0x9a, 0x40, 0x08,
+    0x20, 0xf4, 0x74, 0xeb, 0xe8, 0xf4, 0xb5, 0x37, 0xf1, 0x95, 0xcc, 0x0a, 0x56, 0x6c, 0x25, 0xf5,
+    0xc5, 0xc1, 0x15, 0xa6, 0x7b, 0xf3, 0x82, 0x18, 0x94, 0xfd, 0x2f, 0xc7, 0xe9, 0xb8, 0xae, 0x52,
+    0x13, 0x00, 0x00,
+};
+static const char WS_API_MAIN_JS_ETAG[] PROGMEM = "\"bd9ab7bd99cbd312\"";
+
+}
@@ -0,0 +1,137 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// generated by gzip_frontend_files.py from Files/DALHAL_WebSocketAPI_main_css.h, do not edit
+
+#pragma once
+
+#include "stdint.h"
+#include <pgmspace.h>
+
+namespace DALHAL {
+
+// 6302 bytes uncompressed, 1584 bytes gzip
+static const uint8_t WS_API_MAIN_CSS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x58, 0xdd, 0x72, 0xa3, 0x36,
+    0x14, 0xbe, 0xcf, 0x53, 0x68, 0xc6, 0xd3, 0x49, 0xb3, 0x5d, 0xbc, 0xe0, 0x9f, 0xc4, 0x8b, 0xaf,
+    0x3a, 0xbd, 0x6d, 0x7b, 0xd3, 0xbe, 0x80, 0x40, 0x02, 0xd4, 0x08, 0xc4, 0x80, 0x88, 0x93, 0xcd,
+    0x64, 0xa6, 0x0f, 0xd1, 0x27, 0xec, 0x93, 0xf4, 0x1c, 0x09, 0x30, 0x60, 0xe1, 0xc4, 0xd9, 0xbd,
+    0xd8, 0x5a, 0x99, 0x18, 0xeb, 0x48, 0x47, 0xe7, 0xf7, 0x3b, 0x47, 0x5c, 0x7d, 0x20, 0xcf, 0x24,
+    0x52, 0x8f, 0x5e, 0x2d, 0xbe, 0x88, 0x22, 0x0d, 0xe1, 0xb9, 0x62, 0xbc, 0xf2, 0x60, 0x6a, 0x4f,
+    0x72, 0x5a, 0xa5, 0xa2, 0x08, 0x89, 0xbf, 0x27, 0x25, 0x65, 0xcc, 0xd0, 0xe1, 0xf9, 0xe5, 0xea,
+    0x2a, 0x52, 0xec, 0x89, 0x3c, 0x5f, 0x11, 0x92, 0xa8, 0x42, 0x7b, 0x09, 0xcd, 0x85, 0x7c, 0x0a,
+    0xc9, 0xf5, 0x2f, 0xaa, 0xa9, 0x04, 0xaf, 0xc8, 0xef, 0xfc, 0x70, 0xfd, 0x91, 0xe4, 0xaa, 0x50,
+    0x75, 0x49, 0x63, 0xbe, 0xef, 0x16, 0xc2, 0x21, 0x3c, 0x24, 0xc1, 0xba, 0x7c, 0xc4, 0xa9, 0x23,
+    0x7b, 0xf8, 0x91, 0x71, 0x91, 0x66, 0x1a, 0x88, 0xbe, 0xff, 0x90, 0xe1, 0x04, 0x13, 0x75, 0x29,
+    0x29, 0x70, 0x4d, 0x24, 0x37, 0xcb, 0xf1, 0xdb, 0x63, 0xa2, 0xe2, 0xb1, 0x16, 0x0a, 0xb6, 0xc5,
+    0x4a, 0x36, 0x79, 0x81, 0x94, 0x88, 0xc6, 0xf7, 0x69, 0xa5, 0x9a, 0x82, 0x85, 0xe4, 0x81, 0x56,
+    0x3f, 0x7a, 0x5e, 0x94, 0x7a, 0x25, 0x4d, 0xf9, 0x0d, 0x52, 0x61, 0x9d, 0xaa, 0x3a, 0x42, 0x92,
+    0xc2, 0x1c, 0x28, 0xf0, 0xe9, 0x03, 0xf9, 0xf7, 0x9f, 0xbf, 0xe1, 0x8f, 0xfc, 0x99, 0xf1, 0x9c,
+    0x23, 0x55, 0xd0, 0x48, 0xf2, 0xba, 0x9b, 0xfe, 0xf0, 0xc9, 0x28, 0xb9, 0x94, 0x28, 0x96, 0x51,
+    0xb5, 0xe7, 0x1a, 0x12, 0xf8, 0x2c, 0x92, 0x0d, 0x8e, 0xfd, 0x91, 0x50, 0x70, 0x19, 0x1a, 0x82,
+    0xf9, 0xf4, 0x04, 0x51, 0x94, 0x8d, 0xb6, 0x04, 0x1f, 0x47, 0x4f, 0xa8, 0x9b, 0xd4, 0x70, 0x3a,
+    0xd9, 0x01, 0x04, 0x2f, 0x53, 0x0f, 0x1c, 0x84, 0x5e, 0xf0, 0x1d, 0xec, 0x69, 0x49, 0x49, 0xbb,
+    0xde, 0xec, 0x09, 0x28, 0x8e, 0x8e, 0xe0, 0xe5, 0x8d, 0xe6, 0xcc, 0x9c, 0xb2, 0xd9, 0x6c, 0xfa,
+    0xd9, 0xba, 0x89, 0xb4, 0x44, 0x79, 0x17, 0xbb, 0xdd, 0xae, 0xe5, 0x6f, 0xfc, 0xdb, 0x1e, 0x1c,
+    0xc7, 0xf1, 0x70, 0x16, 0xac, 0x9b, 0xc3, 0x99, 0x8c, 0x31, 0x3b, 0x1b, 0x7b, 0x69, 0xc5, 0x79,
+    0x11, 0xb6, 0x07, 0xde, 0xd1, 0x0d, 0xed, 0x08, 0x91, 0x6c, 0x78, 0xd8, 0x49, 0xb2, 0x4d, 0xa8,
+    0xdf, 0x11, 0x2a, 0x2b, 0x86, 0xe1, 0xee, 0xaf, 0x3f, 0xaf, 0xa2, 0x7e, 0x87, 0x2e, 0x40, 0x39,
+    0x23, 0x22, 0xdf, 0xe1, 0x18, 0x12, 0xac, 0xba, 0x0b, 0xe6, 0xe3, 0x40, 0x07, 0x19, 0xdb, 0x33,
+    0x5a, 0xdd, 0xbb, 0x4c, 0x3f, 0xd4, 0x7d, 0x64, 0xfa, 0x20, 0x08, 0x1c, 0x76, 0x0f, 0x6e, 0x71,
+    0x38, 0xec, 0x1e, 0x70, 0x1c, 0x0e, 0xbb, 0x2f, 0x56, 0x14, 0x87, 0xc3, 0xec, 0x6c, 0x87, 0xc3,
+    0x61, 0x76, 0x4a, 0xa9, 0xc3, 0xec, 0xdb, 0xed, 0xd6, 0x61, 0xf6, 0xf5, 0x7a, 0xed, 0x30, 0xfb,
+    0x6a, 0xb5, 0x72, 0x98, 0x7d, 0x13, 0xd3, 0x64, 0xf7, 0xd9, 0x61, 0xf6, 0xbb, 0x88, 0x26, 0x6c,
+    0xe3, 0x30, 0x3b, 0x5f, 0xdd, 0x7e, 0xde, 0xb8, 0xcc, 0x3e, 0x54, 0x6a, 0x64, 0x76, 0x23, 0xcf,
+    0x38, 0x29, 0x54, 0x49, 0xb4, 0x52, 0x32, 0xa2, 0xd5, 0x20, 0x21, 0x16, 0xdd, 0xd4, 0x73, 0x9b,
+    0x8e, 0x90, 0xbb, 0x30, 0x68, 0xa3, 0x15, 0x72, 0xed, 0x31, 0x62, 0x57, 0x3e, 0x92, 0x60, 0x65,
+    0x93, 0x7c, 0x26, 0x37, 0xc1, 0x63, 0x26, 0x39, 0x7b, 0xb8, 0xd1, 0x5a, 0x81, 0x11, 0x02, 0xd8,
+    0x59, 0x2b, 0x29, 0x58, 0xb7, 0xd6, 0x90, 0x6f, 0x2e, 0xc4, 0x83, 0x94, 0x96, 0x21, 0xb9, 0xc5,
+    0xf3, 0x5f, 0xae, 0x16, 0xa8, 0x67, 0x0c, 0xe0, 0x43, 0x45, 0xc1, 0xff, 0x5f, 0x92, 0xb7, 0xd6,
+    0xf6, 0x34, 0x38, 0xe3, 0xd9, 0xc5, 0x87, 0x02, 0x38, 0x15, 0x9e, 0xd0, 0x3c, 0xaf, 0x81, 0x09,
+    0x2f, 0x34, 0xaf, 0x70, 0xfa, 0xaf, 0xa6, 0xd6, 0x22, 0x79, 0x32, 0x5a, 0xc3, 0x64, 0x48, 0x0c,
+    0x08, 0x7b, 0x11, 0xd7, 0x07, 0x08, 0xab, 0x13, 0xd6, 0x59, 0x00, 0x25, 0x60, 0x0a, 0xcf, 0x76,
+    0xe2, 0xd0, 0x82, 0x72, 0xa4, 0x24, 0xdb, 0x4f, 0x81, 0xd4, 0x06, 0xff, 0x0d, 0xd6, 0x83, 0x85,
+    0x46, 0x10, 0x05, 0x6e, 0x69, 0x2a, 0xf9, 0xfb, 0xeb, 0x42, 0x6b, 0xf8, 0xde, 0x1b, 0x6b, 0xf4,
+    0x86, 0xdf, 0x7a, 0xa3, 0x4d, 0xa0, 0x33, 0x76, 0x6e, 0x3d, 0x52, 0x51, 0x26, 0x1a, 0x30, 0xc8,
+    0xc6, 0x6e, 0x8c, 0x9b, 0xaa, 0x46, 0xb1, 0x4b, 0x25, 0x3a, 0x03, 0x9d, 0x7a, 0xb6, 0xcb, 0x93,
+    0xd9, 0x82, 0x31, 0xd2, 0x30, 0x34, 0x79, 0x83, 0x85, 0x73, 0x86, 0x91, 0xa1, 0x1b, 0xcb, 0x5c,
+    0x2d, 0xf1, 0x77, 0xa5, 0x0e, 0x6e, 0x0f, 0x9a, 0x48, 0x38, 0x54, 0xe8, 0x75, 0xfc, 0xdf, 0x87,
+    0xc0, 0xd6, 0x86, 0x40, 0xd4, 0x40, 0x70, 0x15, 0xcb, 0x38, 0x67, 0xc8, 0xf6, 0xdb, 0x19, 0x76,
+    0xf3, 0xbd, 0x18, 0x96, 0x90, 0x43, 0x06, 0xf1, 0xeb, 0x19, 0xa9, 0x43, 0x52, 0x28, 0x6b, 0x85,
+    0xa9, 0xe6, 0x17, 0x18, 0x7c, 0xbc, 0x11, 0x4a, 0x48, 0x91, 0x9a, 0x9d, 0xa3, 0xb3, 0x0d, 0x5e,
+    0xc2, 0xf2, 0x56, 0x31, 0x27, 0x6d, 0x84, 0x87, 0x7f, 0x68, 0xaa, 0x9b, 0x9a, 0x4c, 0xe0, 0xb0,
+    0x36, 0xb3, 0xde, 0x1b, 0x10, 0x71, 0x3d, 0xc0, 0x95, 0xa1, 0x63, 0x82, 0x33, 0x50, 0x63, 0x0a,
+    0xd8, 0x85, 0x50, 0x33, 0x4d, 0x51, 0x5b, 0x89, 0xdc, 0x28, 0x64, 0x02, 0xad, 0x13, 0xca, 0x09,
+    0x25, 0x10, 0xf6, 0x87, 0x1a, 0xe4, 0x60, 0x22, 0xa6, 0x5a, 0x59, 0x25, 0x0f, 0x82, 0xe9, 0xcc,
+    0x00, 0xe5, 0xbe, 0xef, 0xd9, 0x76, 0xc3, 0x48, 0xea, 0xc3, 0x64, 0xeb, 0xff, 0x30, 0xd5, 0xad,
+    0xab, 0x92, 0xbd, 0x2c, 0xa2, 0x90, 0x00, 0xcb, 0x50, 0xd6, 0x54, 0x7c, 0xdf, 0xe7, 0x43, 0x9d,
+    0x55, 0xa2, 0xb8, 0x37, 0x7d, 0xe1, 0x44, 0x82, 0x25, 0x40, 0x5a, 0x01, 0xa8, 0xc9, 0xd9, 0x24,
+    0x16, 0x16, 0x2b, 0x1e, 0xc7, 0x77, 0x81, 0xc1, 0xa2, 0xd1, 0x06, 0x38, 0x69, 0x76, 0x0f, 0xbf,
+    0xdb, 0xc4, 0xeb, 0x78, 0xe2, 0xe9, 0xdf, 0xa0, 0x4e, 0x10, 0x5a, 0x71, 0x1a, 0x12, 0xb0, 0x41,
+    0x2e, 0x0a, 0x2a, 0xc9, 0x4f, 0x44, 0xaa, 0x94, 0xd4, 0x82, 0x71, 0x12, 0x3d, 0xd9, 0xef, 0x41,
+    0x14, 0xe4, 0xb8, 0xe3, 0xe8, 0xff, 0x00, 0x86, 0xff, 0x26, 0xd8, 0x07, 0x54, 0x30, 0x6d, 0xb0,
+    0x80, 0xf8, 0x6d, 0x2d, 0xe9, 0xf7, 0x8e, 0xf1, 0x27, 0x15, 0xf9, 0x67, 0x08, 0xa9, 0x58, 0xe5,
+    0xa5, 0xe4, 0x9a, 0x1f, 0x25, 0x1b, 0xd6, 0xe6, 0x76, 0xce, 0xc0, 0xc9, 0x19, 0xb4, 0x71, 0xd6,
+    0x9d, 0xd6, 0xab, 0x9b, 0x55, 0x0b, 0x0a, 0x28, 0x53, 0x3b, 0xb7, 0xf6, 0xdb, 0xb9, 0xa9, 0x6f,
+    0x8e, 0x0e, 0x6f, 0x3b, 0xf7, 0x33, 0x00, 0x72, 0xae, 0x94, 0xbe, 0x0c, 0x64, 0x97, 0x34, 0xe2,
+    0xd2, 0x08, 0x3f, 0xc6, 0xaa, 0xf9, 0xd4, 0x39, 0x13, 0xf1, 0xdf, 0x22, 0xab, 0xb0, 0x37, 0xb3,
+    0x32, 0xd2, 0x81, 0x03, 0x3c, 0xd5, 0x68, 0x60, 0xe3, 0xf2, 0xba, 0xb3, 0x95, 0x40, 0x74, 0x4a,
+    0xa4, 0x3a, 0x78, 0xe0, 0x8c, 0x0e, 0x1b, 0x4c, 0xe0, 0xf7, 0xb7, 0x9e, 0xe5, 0xdd, 0x1b, 0x5a,
+    0x0e, 0x17, 0x7e, 0x4e, 0xa2, 0xe7, 0xe5, 0x6a, 0x69, 0x18, 0x97, 0x15, 0x88, 0xaa, 0x4f, 0x71,
+    0xcf, 0x74, 0x96, 0x37, 0xce, 0xf2, 0xde, 0x6d, 0x05, 0xdd, 0xb0, 0x8f, 0x7c, 0x3e, 0x53, 0xef,
+    0xed, 0x42, 0x5e, 0x55, 0x8e, 0x85, 0x47, 0xfc, 0xb4, 0xab, 0x44, 0x91, 0x28, 0xd7, 0x2a, 0x6c,
+    0x65, 0x07, 0xcb, 0x32, 0x28, 0x22, 0xce, 0x53, 0x3b, 0x87, 0x9e, 0x38, 0x1f, 0xf3, 0x76, 0xec,
+    0x15, 0x4c, 0x5b, 0xe0, 0x50, 0xaa, 0x5a, 0xb4, 0x19, 0xc6, 0x25, 0xd5, 0xe2, 0x81, 0x1b, 0x5c,
+    0x80, 0xf6, 0x3e, 0xe5, 0x35, 0x12, 0x6a, 0x1b, 0x61, 0xfd, 0x32, 0x1a, 0x81, 0xe3, 0x41, 0x39,
+    0x1b, 0x15, 0x6d, 0x38, 0xf8, 0x16, 0xbe, 0x24, 0x4f, 0x8c, 0x65, 0x49, 0x35, 0xc8, 0x50, 0xa7,
+    0x9f, 0x80, 0xff, 0xcd, 0x65, 0x05, 0xb5, 0x3b, 0xab, 0x50, 0x05, 0xb7, 0x17, 0xe2, 0xc7, 0xde,
+    0x97, 0xab, 0x2e, 0xed, 0x5c, 0xb1, 0xf3, 0x05, 0x11, 0x0e, 0xc3, 0x6e, 0x35, 0x46, 0x1a, 0xcb,
+    0x08, 0x4c, 0x0a, 0xb2, 0x8c, 0xb3, 0x68, 0x3b, 0x88, 0xc6, 0x99, 0x4a, 0xe0, 0x3b, 0x2a, 0x41,
+    0x44, 0x6b, 0x8e, 0xee, 0x71, 0xd6, 0x7b, 0x7b, 0x8e, 0xad, 0xcd, 0x1f, 0x09, 0x3e, 0x2f, 0x69,
+    0x8c, 0xe6, 0x76, 0x16, 0xea, 0xe1, 0x05, 0xcb, 0xfa, 0x1d, 0x7f, 0x16, 0x34, 0xc7, 0xe5, 0x03,
+    0xbc, 0x09, 0xd6, 0xbe, 0xe9, 0x3f, 0xc7, 0x68, 0x73, 0x1a, 0xfb, 0x43, 0x0e, 0xcb, 0x8c, 0xd6,
+    0x5e, 0x9c, 0x09, 0xc9, 0x2a, 0xb8, 0x37, 0x85, 0x34, 0xd1, 0x6d, 0xcd, 0x6f, 0x1b, 0xe0, 0x6b,
+    0xf2, 0xe9, 0x7a, 0x3f, 0x1f, 0x59, 0x96, 0x53, 0x27, 0xfc, 0x50, 0xae, 0x99, 0xec, 0x69, 0x8f,
+    0xce, 0xb8, 0x2c, 0x2f, 0x8a, 0xd8, 0xce, 0x97, 0x21, 0xc9, 0x04, 0x63, 0xd0, 0x8b, 0x03, 0x92,
+    0x3f, 0x6a, 0xef, 0x38, 0xcd, 0xa5, 0x14, 0x65, 0x2d, 0xea, 0xbd, 0xb3, 0x2f, 0x32, 0x11, 0x6f,
+    0x00, 0x6c, 0xbe, 0xa3, 0x9c, 0xb9, 0x13, 0xf4, 0x81, 0x70, 0x37, 0xbc, 0xe1, 0xd8, 0x30, 0x84,
+    0x4b, 0xc0, 0x2b, 0xf0, 0xf7, 0x2a, 0x96, 0x0e, 0x9b, 0xd6, 0x85, 0xc5, 0x1e, 0x4f, 0x46, 0x72,
+    0xde, 0x82, 0x33, 0xea, 0x2d, 0xb0, 0x6f, 0x33, 0x6c, 0x8d, 0x76, 0xc3, 0x53, 0x75, 0x45, 0x0b,
+    0x58, 0x0f, 0x0e, 0xd6, 0xc3, 0x2c, 0xeb, 0x72, 0x07, 0x50, 0x0b, 0x03, 0xf5, 0x38, 0xe1, 0x02,
+    0xcb, 0xaf, 0x79, 0x5b, 0xd5, 0xe2, 0xbc, 0x61, 0x0d, 0x52, 0x68, 0xcf, 0xad, 0x19, 0x1a, 0xe0,
+    0x9e, 0x3f, 0x59, 0x3c, 0x7b, 0xbe, 0xa0, 0x07, 0xfc, 0xea, 0x42, 0xf6, 0xba, 0x1b, 0x47, 0x0d,
+    0xc5, 0xaf, 0xd0, 0xd2, 0x60, 0x69, 0x19, 0xf6, 0x10, 0xd0, 0xe6, 0x1c, 0xdb, 0x87, 0x4b, 0xdb,
+    0x99, 0x63, 0x37, 0x31, 0xc8, 0x66, 0xff, 0x2d, 0xe5, 0x1f, 0x8f, 0xfd, 0x5e, 0x2b, 0xbf, 0x43,
+    0xf1, 0xd7, 0xee, 0xd7, 0xf3, 0xdd, 0xf4, 0x51, 0x51, 0x7b, 0x4d, 0x79, 0xff, 0x8d, 0x2e, 0x98,
+    0xdc, 0xe8, 0x50, 0x87, 0xdd, 0x7b, 0x2f, 0x74, 0xeb, 0x6f, 0x7a, 0x53, 0xc6, 0x5e, 0xd9, 0x11,
+    0x3f, 0xae, 0x3a, 0x76, 0xc9, 0x7b, 0x97, 0xd9, 0xb7, 0xb9, 0x27, 0xad, 0xd4, 0xad, 0xb3, 0xab,
+    0x1e, 0x21, 0x4e, 0x59, 0x71, 0xaf, 0xbb, 0x70, 0xbf, 0xff, 0x46, 0xdd, 0x2a, 0xcb, 0xb8, 0xa6,
+    0x42, 0xd6, 0x58, 0xc6, 0xcc, 0x1b, 0xed, 0x3e, 0xb0, 0x56, 0xb6, 0x4b, 0x31, 0x8b, 0xea, 0x26,
+    0x07, 0xaa, 0x7d, 0x69, 0xee, 0x30, 0xb4, 0xb3, 0x39, 0x7a, 0xe5, 0x16, 0x8f, 0x0e, 0xf6, 0x4f,
+    0xa4, 0x00, 0xd5, 0x4e, 0xb0, 0x73, 0x36, 0x07, 0x5e, 0x0d, 0xfe, 0xfe, 0xb0, 0xdb, 0xc1, 0x2b,
+    0x83, 0xee, 0xc5, 0x3d, 0x26, 0xa8, 0x6f, 0xd3, 0x74, 0x33, 0x9b, 0xa6, 0x53, 0xbb, 0x8f, 0x62,
+    0xe1, 0xf1, 0x18, 0x0b, 0xae, 0x58, 0xfa, 0x0f, 0x72, 0x40, 0xa6, 0xce, 0x9e, 0x18, 0x00, 0x00,
+};
+static const char WS_API_MAIN_CSS_ETAG[] PROGMEM = "\"341372d8ea3a4219\"";
+
+}
@@ -0,0 +1,126 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// generated by gzip_frontend_files.py from Files/DALHAL_WebSocketAPI_modal_css.h, do not edit
+
+#pragma once
+
+#include "stdint.h"
+#include <pgmspace.h>
+
+namespace DALHAL {
+
+// 4582 bytes uncompressed, 1406 bytes gzip
+static const uint8_t WS_API_MODAL_CSS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x57, 0xdb, 0x6e, 0xe3, 0x36,
+    0x10, 0x7d, 0xcf, 0x57, 0x10, 0xd8, 0x87, 0xc6, 0x8b, 0xd0, 0x2b, 0x5f, 0x13, 0xdb, 0x40, 0x5f,
+    0xb6, 0x40, 0x5f, 0xda, 0x8f, 0xa0, 0xc4, 0x91, 0xc5, 0x8d, 0x4c, 0x0a, 0x24, 0x15, 0x3b, 0x5b,
+    0x04, 0xe8, 0x47, 0xf4, 0x0b, 0xfb, 0x25, 0x1d, 0x92, 0xba, 0x50, 0x96, 0x9c, 0xec, 0xa2, 0x06,
+    0x2c, 0xd8, 0x9c, 0x0b, 0x67, 0xce, 0x5c, 0x75, 0xb7, 0xd7, 0x4a, 0x59, 0xf2, 0xd7, 0x1d, 0x21,
+    0x94, 0x9e, 0x14, 0x67, 0x25, 0x4d, 0x8f, 0x7b, 0xf2, 0x29, 0xf7, 0x9f, 0x43, 0x74, 0x9c, 0xbb,
+    0xe3, 0x05, 0x5b, 0x64, 0xcb, 0x24, 0x3e, 0x2e, 0x80, 0x71, 0xd0, 0x8d, 0xd0, 0x3a, 0xdf, 0xe4,
+    0x8f, 0x13, 0xd4, 0x1b, 0xb2, 0x39, 0x5e, 0xdd, 0xc9, 0xee, 0x72, 0x96, 0xa7, 0x31, 0x35, 0x55,
+    0x1a, 0x65, 0x91, 0xc4, 0x77, 0x3c, 0x83, 0x45, 0x4c, 0x32, 0x05, 0xe3, 0xea, 0xbc, 0x27, 0x09,
+    0x59, 0x2c, 0xab, 0x0b, 0x59, 0xb9, 0x87, 0x3e, 0xa6, 0xec, 0x7e, 0x99, 0x3c, 0x10, 0xf7, 0x5d,
+    0xe1, 0x37, 0x99, 0x2f, 0x9e, 0x66, 0x03, 0x85, 0x2c, 0x7b, 0xe6, 0x5a, 0x55, 0xfe, 0xc2, 0x09,
+    0xf6, 0xd5, 0x66, 0xc0, 0x9e, 0x95, 0xca, 0x00, 0x2d, 0xd4, 0x4b, 0x30, 0x22, 0x5b, 0x6e, 0x97,
+    0xdb, 0xc3, 0x9d, 0x67, 0x10, 0xb2, 0xaa, 0xed, 0x18, 0xa8, 0x70, 0x3c, 0x72, 0xb6, 0xe1, 0x6e,
+    0xdd, 0xc9, 0x38, 0x5f, 0xf2, 0x5d, 0x20, 0x95, 0x2c, 0x85, 0x06, 0xda, 0x6d, 0xfa, 0xb8, 0x7c,
+    0x4a, 0x9a, 0x0b, 0x52, 0x2b, 0xa9, 0x81, 0x4c, 0x49, 0xce, 0xf4, 0x6b, 0xb8, 0x08, 0x32, 0x80,
+    0xbc, 0x41, 0x61, 0x48, 0x1e, 0x5d, 0x38, 0x24, 0x7b, 0x0f, 0x82, 0x0e, 0x9e, 0xc3, 0x0a, 0x9e,
+    0x7a, 0xa6, 0x4a, 0x8b, 0x53, 0x77, 0xc1, 0x72, 0xb3, 0x5d, 0x41, 0x3a, 0x26, 0xe6, 0xd7, 0x6e,
+    0xc6, 0xc4, 0x48, 0xf9, 0x2a, 0x7d, 0xdc, 0x42, 0xde, 0x38, 0x60, 0x2c, 0xb3, 0xb5, 0xa1, 0xea,
+    0xd9, 0x99, 0xb6, 0x65, 0xab, 0x35, 0x3b, 0xc4, 0xe7, 0xa0, 0x63, 0x4c, 0x23, 0x82, 0x90, 0xb9,
+    0x8a, 0x6c, 0x79, 0xbb, 0xbb, 0x9b, 0xfb, 0x68, 0xf8, 0x0c, 0xad, 0x94, 0x11, 0x56, 0x28, 0xb9,
+    0x27, 0xb9, 0xb8, 0x00, 0x77, 0x82, 0xdf, 0x51, 0x82, 0xc3, 0x65, 0x4f, 0x16, 0x49, 0xe2, 0xbd,
+    0x77, 0x41, 0x3e, 0x6a, 0x55, 0x4b, 0xbe, 0x27, 0x2f, 0x4c, 0xdf, 0xf7, 0x59, 0xed, 0x83, 0x9b,
+    0xa9, 0x52, 0xe9, 0x21, 0x25, 0x0f, 0x94, 0x36, 0x3e, 0x0b, 0xcc, 0x25, 0xa3, 0x4a, 0xc1, 0x87,
+    0xe2, 0x9e, 0x1a, 0x31, 0x52, 0xcd, 0xb8, 0xa8, 0xcd, 0x9e, 0x3c, 0x55, 0x97, 0x70, 0x7a, 0xe9,
+    0xd2, 0x32, 0x16, 0x0c, 0x67, 0x5e, 0x90, 0x0b, 0x53, 0x95, 0xec, 0x75, 0x4f, 0xa4, 0x92, 0xe0,
+    0x0e, 0xf2, 0x12, 0x2e, 0x94, 0x0b, 0x0d, 0x59, 0xf0, 0x0a, 0x8d, 0xab, 0x4f, 0xd2, 0x51, 0x1c,
+    0xaa, 0x79, 0xe9, 0x74, 0x15, 0x82, 0x73, 0xf0, 0x67, 0x27, 0x76, 0xa1, 0x67, 0xc1, 0x6d, 0x81,
+    0x8c, 0xac, 0xcc, 0xee, 0xd1, 0xe3, 0x97, 0x33, 0xa1, 0x64, 0x9d, 0x54, 0x97, 0x59, 0xcb, 0x50,
+    0x80, 0x38, 0x16, 0x36, 0xe2, 0x28, 0x7a, 0x8e, 0x0e, 0xcc, 0xf0, 0xa4, 0x54, 0x55, 0x20, 0x3d,
+    0xb0, 0x9d, 0x65, 0xce, 0xa2, 0x88, 0x91, 0x52, 0xae, 0xd9, 0xf1, 0x28, 0xe4, 0xd1, 0xb3, 0xd5,
+    0x06, 0xfd, 0x36, 0x50, 0xa2, 0xbd, 0xad, 0x13, 0x3d, 0x6b, 0x28, 0x75, 0xcf, 0x77, 0x2b, 0x06,
+    0x5d, 0xaf, 0xb8, 0x15, 0x8a, 0xae, 0x5d, 0x78, 0x86, 0x8a, 0x71, 0x8e, 0x57, 0xbb, 0xd8, 0x62,
+    0x4c, 0x5c, 0xa5, 0x1f, 0xc6, 0xb6, 0x12, 0xc2, 0x4a, 0x71, 0x94, 0x54, 0x58, 0x38, 0x61, 0x34,
+    0x32, 0x90, 0xd8, 0x52, 0xdc, 0xf1, 0xb7, 0xda, 0x58, 0x91, 0xbf, 0x52, 0x2c, 0x03, 0x8b, 0x87,
+    0x7b, 0x62, 0x2a, 0x96, 0x01, 0x4d, 0xc1, 0x9e, 0x21, 0x00, 0x9a, 0xd5, 0xda, 0x38, 0x0b, 0x8e,
+    0x9a, 0xf9, 0xb4, 0xb7, 0xaa, 0xce, 0x0a, 0xca, 0x9a, 0x60, 0x74, 0x41, 0x42, 0x79, 0x9a, 0xb3,
+    0x93, 0x28, 0xf1, 0x4e, 0xc3, 0xa4, 0x41, 0x04, 0xb4, 0xc8, 0x3b, 0x92, 0x11, 0xdf, 0x01, 0x4d,
+    0xdc, 0x04, 0xeb, 0xfc, 0xd1, 0xb9, 0x09, 0xc2, 0xb6, 0x49, 0xc9, 0x90, 0x30, 0xa9, 0xb2, 0x56,
+    0x9d, 0x3e, 0x4c, 0xb0, 0x29, 0xf0, 0xc7, 0x10, 0xc7, 0xb6, 0xa7, 0xc8, 0x12, 0xcb, 0x59, 0x61,
+    0x4b, 0xf0, 0x5c, 0x53, 0x69, 0x64, 0xe1, 0x62, 0x69, 0x4f, 0x80, 0xb2, 0x14, 0x95, 0x11, 0xc6,
+    0x91, 0xce, 0x05, 0xa2, 0x48, 0x3d, 0x4e, 0xce, 0xff, 0xb3, 0x66, 0x55, 0xac, 0xd7, 0x37, 0xc4,
+    0x51, 0x80, 0xad, 0x46, 0x4c, 0x2a, 0xa6, 0x11, 0xe3, 0xb8, 0x8c, 0x5a, 0xf8, 0x3e, 0x8c, 0x72,
+    0x04, 0xe2, 0x32, 0x09, 0x20, 0x96, 0x42, 0x42, 0x97, 0xc9, 0x8b, 0x38, 0x54, 0x95, 0x12, 0x6d,
+    0x7c, 0xbb, 0xec, 0x48, 0xc8, 0xba, 0xba, 0x8c, 0xec, 0xdc, 0xfb, 0xce, 0x14, 0xb0, 0x1a, 0x9b,
+    0x10, 0xf5, 0xf6, 0x01, 0xe4, 0xa9, 0xe2, 0xaf, 0x57, 0xc8, 0xb1, 0xda, 0xaa, 0xc3, 0xa0, 0xf9,
+    0x68, 0x28, 0x99, 0x15, 0x2f, 0x83, 0xec, 0x0f, 0xa3, 0x6c, 0xaa, 0x98, 0x26, 0x32, 0xd1, 0xd7,
+    0x3d, 0x48, 0xdf, 0xc0, 0x8e, 0xac, 0xea, 0x7a, 0xc8, 0x74, 0xc2, 0x37, 0xe9, 0x63, 0x55, 0xf5,
+    0x23, 0xcd, 0xe9, 0x46, 0xe9, 0x75, 0xa3, 0x76, 0xe8, 0x6e, 0x33, 0x11, 0x6f, 0x75, 0x57, 0x21,
+    0x0d, 0xa0, 0xbd, 0xc9, 0xa0, 0xd3, 0xee, 0x76, 0xbb, 0x77, 0x1b, 0x6d, 0x3f, 0x65, 0xa7, 0xba,
+    0xde, 0xf8, 0xf2, 0xab, 0xbf, 0x53, 0x6d, 0x29, 0x2d, 0x55, 0xf6, 0x1c, 0x64, 0x35, 0x38, 0xb2,
+    0x9b, 0x41, 0x9e, 0x25, 0x2e, 0xc1, 0x6d, 0xc0, 0x0b, 0xe7, 0x12, 0x16, 0x4d, 0x9f, 0x4d, 0x57,
+    0xa8, 0x6e, 0x9b, 0x64, 0xf9, 0xf2, 0x19, 0xa7, 0x4e, 0xfb, 0x21, 0xbf, 0x83, 0xc4, 0xaa, 0xce,
+    0x50, 0x9f, 0x3e, 0x11, 0x37, 0xdc, 0x84, 0x8b, 0xb0, 0x79, 0x70, 0x07, 0x84, 0xc9, 0x57, 0x12,
+    0xa6, 0x90, 0x2d, 0x98, 0x25, 0x85, 0x32, 0xd6, 0x10, 0x16, 0x78, 0x23, 0x1d, 0x9f, 0xbf, 0xa0,
+    0x7d, 0xee, 0x90, 0x6a, 0x75, 0x9e, 0x4e, 0x85, 0xdb, 0x1d, 0xdf, 0xe7, 0xc1, 0x3a, 0xf6, 0xa0,
+    0x6f, 0x18, 0xeb, 0xa8, 0xb7, 0x4c, 0x75, 0xa2, 0xb7, 0xf6, 0x5e, 0xbf, 0x4e, 0x8c, 0x70, 0x59,
+    0x05, 0xf1, 0x41, 0x19, 0xb4, 0x8b, 0xc7, 0x2c, 0x92, 0x0e, 0x7b, 0x8a, 0xab, 0xfa, 0x69, 0xe3,
+    0xbd, 0x89, 0x2d, 0x7c, 0x23, 0x91, 0x30, 0x17, 0x1e, 0xc6, 0x04, 0xff, 0x33, 0x18, 0x55, 0xfa,
+    0x49, 0xed, 0x5d, 0x44, 0xff, 0x9a, 0x61, 0x96, 0x0c, 0x82, 0x84, 0xfa, 0xdb, 0x72, 0x88, 0x7d,
+    0x68, 0x20, 0x18, 0x27, 0x5d, 0xbb, 0x8a, 0x8d, 0x47, 0x4a, 0xbb, 0x8d, 0xbd, 0x3b, 0xdd, 0xe3,
+    0xdd, 0x6c, 0x6a, 0xba, 0xaf, 0x07, 0xee, 0x86, 0x25, 0xc5, 0xfb, 0xe2, 0x1c, 0xe8, 0x5a, 0xd4,
+    0x7c, 0x09, 0xa7, 0x9f, 0x98, 0x15, 0xab, 0x09, 0xa5, 0x73, 0xf5, 0x3c, 0x6e, 0x56, 0xdd, 0x16,
+    0x35, 0x1b, 0xf3, 0xe3, 0x0a, 0x75, 0x53, 0x00, 0x69, 0x13, 0x12, 0x6e, 0xb7, 0xba, 0x29, 0xe2,
+    0x88, 0x8d, 0xcc, 0xa0, 0xb6, 0x3e, 0xf6, 0x66, 0x7d, 0x55, 0x66, 0x2e, 0x82, 0x5d, 0xbc, 0x26,
+    0xd0, 0xfc, 0x89, 0x55, 0x6b, 0xd4, 0xf6, 0x1b, 0xf3, 0xfa, 0xed, 0xf6, 0xc6, 0xbe, 0x71, 0xbd,
+    0x3f, 0x8f, 0xb3, 0xe3, 0x7a, 0x85, 0x9e, 0x4d, 0x28, 0x8f, 0x66, 0xc8, 0x47, 0x57, 0xb4, 0x7b,
+    0x70, 0xa4, 0xa6, 0x59, 0x91, 0xdf, 0x11, 0xef, 0xd7, 0xef, 0x69, 0xfb, 0xfa, 0x0d, 0x3c, 0x4e,
+    0xcd, 0x9b, 0x6c, 0x53, 0xb7, 0x7f, 0xe8, 0xc2, 0xf5, 0x22, 0xdf, 0xab, 0xd8, 0x63, 0x03, 0x60,
+    0x69, 0x09, 0x3c, 0x0c, 0x44, 0xdc, 0x0a, 0x84, 0xc5, 0x44, 0x48, 0xe6, 0x9b, 0x38, 0x34, 0x1c,
+    0x72, 0x56, 0x97, 0xf6, 0x9d, 0x96, 0xea, 0xc6, 0x9e, 0x56, 0x25, 0x26, 0x88, 0xc4, 0xe6, 0x74,
+    0xdf, 0xfc, 0xa5, 0xfe, 0xef, 0xfc, 0x9b, 0x99, 0x8d, 0x5a, 0xe8, 0x80, 0xe3, 0x6a, 0x34, 0xf5,
+    0xb3, 0x37, 0x76, 0xa8, 0x49, 0xc5, 0xcc, 0xf9, 0x70, 0x45, 0xe9, 0x45, 0xdb, 0xd5, 0xf0, 0x6d,
+    0x74, 0xc5, 0xaf, 0xa4, 0x3d, 0xb8, 0xba, 0x8d, 0xa5, 0x98, 0x9e, 0xb5, 0x85, 0xa1, 0x50, 0x5b,
+    0x1f, 0x13, 0x4b, 0x49, 0x74, 0x71, 0x13, 0xa6, 0xf0, 0x9e, 0xb9, 0xd9, 0xe0, 0x8b, 0x66, 0xf7,
+    0xc0, 0x37, 0xd3, 0xd9, 0x81, 0x20, 0x5a, 0x42, 0xbe, 0x08, 0x23, 0x10, 0x63, 0x92, 0x62, 0x8b,
+    0xcc, 0x4a, 0x91, 0x3d, 0x3b, 0xc4, 0x1f, 0x70, 0x02, 0xd8, 0xac, 0x00, 0x43, 0xaa, 0xe2, 0xd5,
+    0x08, 0xdc, 0xe5, 0x09, 0x36, 0x62, 0x85, 0x2c, 0x88, 0x4f, 0x97, 0x27, 0x93, 0x9a, 0x67, 0xff,
+    0x6b, 0x45, 0xee, 0x49, 0x7e, 0x4b, 0xf4, 0x62, 0xd3, 0xc0, 0xb9, 0xfc, 0x98, 0x4a, 0xad, 0x0f,
+    0xdc, 0x7e, 0x9a, 0x0d, 0xd5, 0x60, 0xee, 0x1d, 0xa1, 0x01, 0xdd, 0x83, 0x48, 0xe1, 0x05, 0x6f,
+    0x33, 0xfd, 0xfe, 0x78, 0xe3, 0x9d, 0xa3, 0x55, 0x60, 0x30, 0x7f, 0xed, 0xf5, 0x52, 0x4a, 0x35,
+    0x54, 0xc0, 0x3c, 0x7f, 0xf3, 0xf3, 0x07, 0x34, 0x39, 0x8f, 0xbd, 0x1e, 0x8c, 0xcb, 0x9f, 0x0d,
+    0xfc, 0xb6, 0x80, 0x3e, 0x04, 0xb5, 0x14, 0xf6, 0x17, 0x43, 0xfe, 0xf8, 0xfa, 0x5b, 0x88, 0x80,
+    0x21, 0xf7, 0x06, 0x80, 0x7c, 0x2d, 0x98, 0x76, 0x67, 0x02, 0xc9, 0xf8, 0x40, 0x05, 0xf8, 0xd1,
+    0x70, 0x54, 0xb8, 0xfd, 0x47, 0x49, 0xae, 0x19, 0x2a, 0xd3, 0x6e, 0x81, 0x90, 0x5e, 0x2d, 0xab,
+    0x2a, 0x92, 0x15, 0x5a, 0x9d, 0xc0, 0xfd, 0xc5, 0x27, 0x4b, 0x11, 0x4e, 0xf2, 0xef, 0xdf, 0xff,
+    0x90, 0x12, 0x72, 0x1b, 0xd4, 0xa0, 0x6a, 0x9e, 0x29, 0x8e, 0x25, 0xa8, 0x24, 0xa9, 0x6a, 0x8d,
+    0x99, 0x09, 0xf3, 0x41, 0x12, 0x7c, 0xe2, 0x6b, 0xac, 0xc0, 0xf5, 0x68, 0xf8, 0x9c, 0x94, 0x54,
+    0x7e, 0x91, 0xf7, 0x4e, 0xfe, 0x07, 0xbb, 0x59, 0xb9, 0xb9, 0xe6, 0x11, 0x00, 0x00,
+};
+static const char WS_API_MODAL_CSS_ETAG[] PROGMEM = "\"725b4b902fdb20fb\"";
+
+}
@@ -0,0 +1,167 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// generated by gzip_frontend_files.py from Files/DALHAL_WebSocketAPI_modal_js.h, do not edit
+
+#pragma once
+
+#include "stdint.h"
+#include <pgmspace.h>
+
+namespace DALHAL {
+
+// 6336 bytes uncompressed, 2063 bytes gzip
+static const uint8_t WS_API_MODAL_JS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x18, 0xed, 0x4e, 0xe3, 0xc6,
+    0xf6, 0x77, 0x78, 0x8a, 0x53, 0xab, 0xaa, 0x6c, 0x6e, 0x30, 0xb9, 0xdb, 0xaa, 0x57, 0x17, 0xc4,
+    0x45, 0x0b, 0xcb, 0xf6, 0x22, 0xed, 0x76, 0x57, 0x14, 0xd4, 0xae, 0x74, 0xa5, 0xcd, 0x60, 0x4f,
+    0x9c, 0x29, 0xce, 0x8c, 0x65, 0x8f, 0x09, 0x16, 0x8d, 0xd4, 0x87, 0xe8, 0x13, 0xf6, 0x49, 0x7a,
+    0xce, 0x7c, 0x38, 0x8e, 0xe3, 0xc0, 0x52, 0xdd, 0x3f, 0x30, 0x99, 0xf3, 0xfd, 0x7d, 0xc6, 0x7b,
+    0x87, 0xfb, 0xfb, 0x7b, 0xb0, 0x0f, 0x0b, 0x95, 0xb2, 0x3c, 0xfe, 0xb5, 0x82, 0x3f, 0x7f, 0xff,
+    0x03, 0x32, 0x2e, 0x79, 0x29, 0x12, 0xbc, 0xbc, 0x67, 0xb7, 0x39, 0xb7, 0x40, 0x58, 0x0a, 0x99,
+    0xaa, 0x65, 0x8c, 0xd8, 0x44, 0x70, 0xae, 0x16, 0x45, 0xce, 0x35, 0xcf, 0x1b, 0x48, 0x79, 0xa2,
+    0x6a, 0xfc, 0x91, 0xc2, 0xac, 0x54, 0x0b, 0x58, 0xce, 0x99, 0x86, 0x4c, 0xf1, 0x0a, 0x84, 0xac,
+    0x44, 0xca, 0x41, 0xe8, 0x18, 0x7e, 0x10, 0xf7, 0x74, 0x00, 0x06, 0x5a, 0x68, 0x64, 0xc9, 0x64,
+    0x3a, 0x26, 0x36, 0xaa, 0xd0, 0x42, 0x49, 0x96, 0xe7, 0xcd, 0x18, 0x61, 0xb7, 0x2a, 0x6d, 0x40,
+    0x2a, 0xa4, 0x21, 0x35, 0x10, 0xfd, 0xd7, 0xba, 0xd2, 0x50, 0x94, 0xea, 0x1e, 0xf9, 0x54, 0x4e,
+    0x03, 0x48, 0xe6, 0x28, 0x86, 0xc7, 0x70, 0xc5, 0xeb, 0xca, 0x30, 0x9d, 0xa9, 0x92, 0x78, 0x31,
+    0xd9, 0xe8, 0xb9, 0x90, 0xd9, 0x11, 0xe8, 0x39, 0x87, 0xab, 0x8b, 0x1f, 0x3e, 0x7c, 0x3f, 0x99,
+    0x40, 0xc1, 0x24, 0xcf, 0x89, 0xf9, 0xcf, 0xe2, 0xad, 0x80, 0x8a, 0x6b, 0x8d, 0x28, 0x15, 0xd1,
+    0x2c, 0xe8, 0x36, 0x57, 0x19, 0xdc, 0x0b, 0xbe, 0xe4, 0xe5, 0x18, 0xb8, 0x4e, 0xbc, 0x79, 0xd7,
+    0x4b, 0xe5, 0xe4, 0x40, 0xa5, 0x9b, 0x9c, 0x57, 0x63, 0x54, 0x4e, 0xcf, 0xad, 0x85, 0xc4, 0xbe,
+    0x62, 0x08, 0x4a, 0x72, 0x56, 0x55, 0x47, 0x84, 0x0f, 0x70, 0x00, 0x6f, 0x4b, 0xce, 0x0f, 0x66,
+    0xb9, 0x62, 0x24, 0x01, 0xb4, 0x52, 0xde, 0x67, 0x10, 0xa6, 0x7c, 0xc6, 0xea, 0x5c, 0x47, 0x47,
+    0x90, 0x96, 0x2c, 0xcb, 0xc8, 0xab, 0x63, 0x34, 0x14, 0x6e, 0x59, 0x72, 0x97, 0x96, 0xaa, 0x18,
+    0x43, 0xc2, 0xa4, 0xe5, 0x03, 0x28, 0x90, 0x35, 0xe8, 0x18, 0x2e, 0x81, 0xe5, 0x0a, 0x75, 0x25,
+    0x1f, 0xa2, 0x6c, 0x5e, 0xc2, 0xcd, 0x65, 0x0c, 0x37, 0x15, 0x3a, 0xfa, 0xb6, 0xd9, 0xb6, 0x31,
+    0xf6, 0x7a, 0x9c, 0xe5, 0x2a, 0xb9, 0x23, 0x15, 0x52, 0x81, 0x0c, 0xd0, 0x1d, 0x53, 0x2f, 0x06,
+    0x3d, 0x53, 0xd6, 0x7c, 0x0a, 0x2c, 0x4d, 0x2b, 0xb4, 0x3d, 0x15, 0x8b, 0x05, 0x32, 0x53, 0xf7,
+    0xbc, 0xcc, 0x19, 0x06, 0x20, 0xc9, 0x45, 0x72, 0x77, 0xa0, 0x6a, 0x4d, 0x22, 0xbd, 0x36, 0x18,
+    0x29, 0xb8, 0xa8, 0x12, 0x56, 0x70, 0xeb, 0x81, 0x24, 0x57, 0xc6, 0xeb, 0x63, 0x03, 0xb1, 0x22,
+    0xe0, 0xf5, 0xd5, 0xe5, 0x6b, 0x60, 0x5a, 0x97, 0xe2, 0xb6, 0xd6, 0x18, 0x29, 0x56, 0x72, 0x72,
+    0x75, 0xcb, 0xa3, 0xd6, 0x6a, 0x81, 0x6e, 0x49, 0x28, 0xd0, 0x31, 0x5c, 0x37, 0x85, 0x3d, 0xa2,
+    0xe2, 0xa2, 0x44, 0x0d, 0x96, 0x02, 0x19, 0x4f, 0x5b, 0xd7, 0x1c, 0xc1, 0x8c, 0xe5, 0x15, 0x9f,
+    0xb6, 0xc6, 0x7a, 0x3e, 0x64, 0xb3, 0x0f, 0x63, 0x5d, 0x98, 0x18, 0xfa, 0x80, 0xdd, 0x54, 0x2c,
+    0xe3, 0x2e, 0x14, 0x89, 0x92, 0x98, 0x36, 0x36, 0x6b, 0x4f, 0x40, 0xf2, 0x25, 0xbc, 0xa7, 0x73,
+    0xf8, 0x68, 0x93, 0xef, 0x08, 0x02, 0xef, 0xb8, 0x73, 0x25, 0x75, 0x89, 0x71, 0xfa, 0x48, 0x0e,
+    0x0c, 0x60, 0x15, 0x1d, 0x5b, 0x0e, 0xb6, 0x1c, 0x50, 0xca, 0x19, 0x66, 0x64, 0x58, 0x61, 0x1a,
+    0x5c, 0xe4, 0x7c, 0xc1, 0xa5, 0xde, 0x42, 0x78, 0xab, 0x94, 0xe6, 0xa5, 0x41, 0x39, 0xab, 0xb5,
+    0x56, 0xf2, 0x4a, 0x2d, 0xa3, 0x63, 0x80, 0xc3, 0xc3, 0x36, 0xb7, 0xbb, 0x14, 0x0b, 0x55, 0x4b,
+    0x1d, 0x12, 0x02, 0x61, 0xa0, 0xc7, 0x58, 0x32, 0x47, 0x7f, 0x69, 0x05, 0xa9, 0x4a, 0x6a, 0x92,
+    0x10, 0x53, 0x11, 0x74, 0x49, 0x28, 0x13, 0x42, 0x23, 0xf7, 0x70, 0xcf, 0x24, 0x9c, 0xb5, 0x06,
+    0x1e, 0xf7, 0x46, 0xc6, 0xd0, 0xb2, 0x4e, 0xb4, 0x2a, 0x43, 0xfc, 0x39, 0x12, 0x58, 0x54, 0xa3,
+    0x91, 0xad, 0xb0, 0x13, 0x08, 0x02, 0xfa, 0xb5, 0x14, 0xa9, 0x9e, 0xd3, 0x61, 0xce, 0x45, 0x36,
+    0xd7, 0x74, 0x7a, 0xa0, 0x3f, 0x0d, 0xfd, 0xa1, 0x60, 0x9a, 0x12, 0x3f, 0x31, 0x99, 0x41, 0x57,
+    0x6d, 0x14, 0x3a, 0x77, 0x3e, 0x7f, 0xf0, 0xca, 0x44, 0xc6, 0x93, 0xf2, 0x0f, 0xf2, 0xcc, 0x81,
+    0xce, 0x29, 0x77, 0x3a, 0x24, 0x0e, 0xec, 0x32, 0xe7, 0x64, 0x9d, 0xe9, 0x08, 0x53, 0xf2, 0x9c,
+    0xa0, 0xf6, 0xf8, 0x01, 0xcd, 0xc3, 0xd3, 0x0a, 0x71, 0x1e, 0x57, 0x11, 0x59, 0x35, 0xc2, 0x2a,
+    0xae, 0x62, 0x91, 0xe2, 0x0d, 0xfe, 0xf9, 0xed, 0x37, 0x98, 0x1a, 0x47, 0x1c, 0x7c, 0xfd, 0xf8,
+    0x9e, 0xe9, 0x79, 0x5c, 0x62, 0xde, 0xa9, 0x45, 0x18, 0xc5, 0x5a, 0xfd, 0x84, 0x09, 0x27, 0xb3,
+    0xf0, 0xdb, 0xef, 0xa3, 0xb8, 0x42, 0xf9, 0x3c, 0x7c, 0x35, 0x86, 0x7f, 0x47, 0xab, 0xe9, 0xb1,
+    0x67, 0xe2, 0x24, 0x21, 0x27, 0x77, 0xea, 0x40, 0x48, 0xb0, 0x01, 0xd0, 0xa1, 0xbd, 0x9f, 0xb3,
+    0xea, 0x6c, 0x6d, 0xad, 0xd7, 0xfa, 0x78, 0xcf, 0xc3, 0x39, 0xa5, 0x54, 0x1b, 0xab, 0xa4, 0xe4,
+    0x4c, 0xfb, 0xdc, 0x08, 0x83, 0x54, 0xdc, 0x07, 0xd1, 0xf1, 0x1a, 0x35, 0x36, 0xf1, 0xfa, 0x91,
+    0x5a, 0x05, 0x86, 0xc3, 0x58, 0x11, 0x74, 0xc1, 0xc6, 0x46, 0x67, 0x2d, 0xdd, 0x8b, 0x19, 0x84,
+    0x26, 0x5e, 0x11, 0x78, 0x14, 0xd3, 0x7d, 0x62, 0x73, 0x89, 0xb8, 0xd3, 0xaf, 0x1f, 0xcd, 0x71,
+    0x55, 0x3c, 0x4c, 0x3d, 0x81, 0x8d, 0x6b, 0x9f, 0xc2, 0xde, 0x5a, 0x12, 0x7b, 0xb6, 0x34, 0xad,
+    0x9d, 0x9c, 0xa5, 0xbc, 0xbc, 0xf8, 0x72, 0x6b, 0x3c, 0xc1, 0x80, 0x4d, 0x07, 0x16, 0x16, 0xac,
+    0xb9, 0x9b, 0x14, 0x7c, 0x01, 0x73, 0x87, 0x3f, 0xc4, 0xdb, 0x80, 0x82, 0x2d, 0x4c, 0xe3, 0x3a,
+    0xb4, 0xcd, 0x79, 0x6f, 0x65, 0xf1, 0xa6, 0x5b, 0x78, 0x9a, 0x3f, 0x68, 0xaa, 0x72, 0x14, 0x4a,
+    0xbe, 0xa6, 0xdb, 0x6d, 0x93, 0x58, 0x81, 0x29, 0x90, 0x9e, 0xcf, 0x45, 0x9e, 0x86, 0x5d, 0xea,
+    0xc8, 0x58, 0x44, 0x4e, 0xf6, 0x89, 0x60, 0x13, 0xb4, 0x0d, 0x20, 0x36, 0x80, 0xd7, 0xbe, 0xeb,
+    0x85, 0x01, 0x76, 0x12, 0x1e, 0x8c, 0x21, 0xb0, 0x4d, 0xd1, 0x9a, 0xb7, 0x03, 0x95, 0x95, 0x82,
+    0x1d, 0xd8, 0x84, 0x40, 0x02, 0x2a, 0x9a, 0xe7, 0xd1, 0x73, 0x76, 0xcb, 0x73, 0x1c, 0xb3, 0xb7,
+    0x0d, 0xd2, 0xf4, 0x9c, 0x61, 0x88, 0x57, 0x5e, 0x5b, 0x5f, 0xd6, 0x5d, 0x6d, 0x4d, 0x41, 0x9e,
+    0x69, 0xf9, 0x44, 0x4c, 0x6e, 0x4d, 0x03, 0xeb, 0x2a, 0xe2, 0x89, 0x86, 0x02, 0x63, 0x60, 0xc1,
+    0x00, 0xae, 0x6e, 0x4c, 0xc5, 0x7b, 0x76, 0x03, 0x18, 0xbb, 0x8c, 0x23, 0x5f, 0x98, 0x32, 0x1d,
+    0xd4, 0x61, 0x33, 0x94, 0xc1, 0xff, 0xea, 0xc9, 0x24, 0xfd, 0xd7, 0x10, 0x7b, 0x1c, 0x6f, 0x17,
+    0xf7, 0x88, 0xf5, 0x4e, 0x54, 0x9a, 0x56, 0x99, 0x30, 0x30, 0x93, 0x0d, 0xb9, 0x87, 0x11, 0x9c,
+    0xfc, 0x07, 0xd6, 0xd8, 0x61, 0xd4, 0x11, 0xb4, 0x3b, 0x1d, 0x3c, 0xe7, 0xb5, 0x97, 0xcd, 0x35,
+    0x75, 0xea, 0x17, 0x24, 0xb9, 0x45, 0x1f, 0x72, 0x25, 0x41, 0x3a, 0xd5, 0x33, 0x33, 0x33, 0xe5,
+    0x05, 0x9c, 0x3d, 0xc1, 0x10, 0x6f, 0x0b, 0x0b, 0xb6, 0x71, 0x6d, 0x9f, 0x48, 0x45, 0x55, 0xe0,
+    0xf0, 0x27, 0x7c, 0xa9, 0x24, 0xc6, 0x93, 0xe6, 0xd2, 0x5c, 0xa4, 0x29, 0x36, 0x47, 0x1c, 0x55,
+    0x22, 0x87, 0xf5, 0x90, 0x8b, 0x40, 0x54, 0x80, 0x3b, 0x57, 0xda, 0xe9, 0x86, 0xdb, 0xce, 0xf2,
+    0x6e, 0xdc, 0x68, 0x84, 0x5b, 0x58, 0xd6, 0x19, 0x4f, 0xe3, 0x78, 0x55, 0x9f, 0x2e, 0x43, 0x7f,
+    0xf7, 0x65, 0xfe, 0xea, 0xd3, 0x0c, 0x86, 0xc3, 0x41, 0x83, 0x41, 0x82, 0x2d, 0x35, 0xb9, 0x35,
+    0xa3, 0xad, 0xbc, 0xfe, 0x54, 0x74, 0xca, 0x6e, 0x33, 0xda, 0x9d, 0xa6, 0xdc, 0xe4, 0xa9, 0x25,
+    0x33, 0x7c, 0x79, 0xac, 0x59, 0x99, 0x71, 0x4c, 0xfc, 0x13, 0x37, 0x31, 0xd6, 0x8c, 0xa2, 0x8d,
+    0x84, 0x36, 0xaa, 0x8c, 0x56, 0xf6, 0xff, 0xaa, 0xdf, 0x15, 0xda, 0x91, 0xdc, 0xf5, 0xe0, 0x67,
+    0xb5, 0x9e, 0xd3, 0x1b, 0xa2, 0xad, 0xe4, 0x3b, 0xde, 0x18, 0xb1, 0x81, 0x45, 0x0a, 0xe0, 0x9b,
+    0x6f, 0xdc, 0xd0, 0xaa, 0x3e, 0x98, 0xdd, 0x64, 0x40, 0x81, 0xd5, 0x46, 0x3f, 0x6a, 0x77, 0x0a,
+    0x87, 0xf9, 0x79, 0xc1, 0xee, 0xf8, 0x1b, 0x7f, 0xb9, 0x2b, 0x6d, 0x3e, 0x63, 0xe6, 0x5d, 0x4a,
+    0xa1, 0xb1, 0x9b, 0x7e, 0x54, 0x95, 0xa0, 0x65, 0x2a, 0x7c, 0x18, 0x43, 0x43, 0x18, 0xc4, 0x7a,
+    0x27, 0xdc, 0x68, 0x8f, 0x69, 0xfc, 0xc6, 0x6e, 0xdd, 0x47, 0x50, 0xaa, 0x3a, 0x9b, 0xe3, 0xba,
+    0x99, 0xa0, 0xb7, 0x39, 0x2e, 0x9c, 0x63, 0x50, 0xb3, 0x19, 0x52, 0x03, 0x6e, 0x0d, 0x38, 0x19,
+    0x11, 0x52, 0x29, 0x58, 0x20, 0xaa, 0x28, 0xfc, 0x73, 0xa7, 0xc2, 0x8d, 0x1c, 0xcd, 0x4d, 0x79,
+    0x4c, 0xcb, 0x8c, 0x59, 0x28, 0x73, 0x3e, 0xa3, 0xc6, 0xf3, 0x00, 0xa7, 0xa7, 0x60, 0x36, 0x91,
+    0x05, 0x7b, 0x08, 0x5f, 0x4d, 0xc6, 0x34, 0xb3, 0xcd, 0xd3, 0x48, 0x48, 0x8c, 0xe2, 0xcf, 0x66,
+    0x54, 0x1f, 0x40, 0x58, 0xb0, 0xb2, 0xe2, 0x97, 0x98, 0x7c, 0x03, 0xa3, 0x3c, 0xa2, 0xb5, 0xe6,
+    0xbb, 0xc9, 0x04, 0x5d, 0x77, 0x08, 0xaf, 0x8c, 0xc9, 0x56, 0x86, 0x36, 0x6b, 0x47, 0xb3, 0x25,
+    0xa2, 0x2b, 0xe1, 0xbf, 0x76, 0xb4, 0xef, 0xc3, 0x24, 0xfe, 0xe7, 0x46, 0x01, 0x59, 0x01, 0x4e,
+    0x4d, 0x9c, 0x8d, 0x74, 0xf2, 0x9b, 0xc2, 0x26, 0x8e, 0x15, 0x43, 0xe3, 0x53, 0x15, 0x0e, 0xc3,
+    0x78, 0x74, 0x33, 0x2e, 0x73, 0xdc, 0xb4, 0xfc, 0x10, 0xc1, 0xb7, 0x9e, 0x7d, 0xbb, 0xd0, 0xc3,
+    0xc2, 0xad, 0x81, 0xc7, 0xee, 0x1e, 0x1f, 0x2c, 0xa5, 0xfe, 0x65, 0x6c, 0xff, 0x7f, 0x72, 0xff,
+    0xdf, 0xa1, 0x70, 0x77, 0xbc, 0x76, 0x0b, 0x94, 0x35, 0x51, 0xc9, 0x8f, 0x4a, 0x50, 0x1c, 0xde,
+    0xa8, 0xa5, 0xec, 0x65, 0x1c, 0x06, 0xed, 0x32, 0x93, 0x0a, 0x5f, 0x0f, 0x24, 0xab, 0xb2, 0xe4,
+    0xf4, 0x44, 0x91, 0x66, 0xf7, 0xb7, 0x6f, 0x0f, 0x3b, 0x57, 0xe2, 0xbd, 0x5e, 0x69, 0xd8, 0xfc,
+    0xab, 0xb0, 0xd8, 0xe3, 0xee, 0x80, 0x42, 0x17, 0x97, 0xf8, 0x5a, 0x28, 0xcd, 0x8a, 0x37, 0xea,
+    0x98, 0x40, 0x43, 0xd7, 0xdc, 0x59, 0xb5, 0x4a, 0x9e, 0x68, 0xbf, 0x8d, 0xa1, 0x9f, 0x32, 0xda,
+    0xfd, 0x6b, 0x99, 0x22, 0x2e, 0x16, 0x31, 0xe6, 0xcd, 0x15, 0xc2, 0x5d, 0x72, 0x5b, 0x7b, 0x11,
+    0x99, 0xa3, 0x4c, 0x82, 0xfd, 0xb2, 0xbe, 0xfe, 0xd4, 0xb9, 0xfe, 0xb4, 0xbe, 0x7e, 0x67, 0x83,
+    0x42, 0x42, 0x4c, 0x80, 0xd6, 0x90, 0x6b, 0x13, 0x0a, 0x03, 0xd0, 0xe4, 0xa7, 0x51, 0x6f, 0x7b,
+    0xa4, 0xee, 0x40, 0xad, 0x22, 0x74, 0xcd, 0xe9, 0xc0, 0x9b, 0xe0, 0xfa, 0x99, 0x0d, 0x12, 0x8d,
+    0x54, 0xe7, 0xd6, 0x73, 0x56, 0xa0, 0xb9, 0x1c, 0xfd, 0x52, 0xd8, 0x8b, 0x4b, 0xb7, 0x1d, 0x0c,
+    0xc5, 0xe0, 0x3d, 0x3e, 0xfe, 0x7a, 0x31, 0x20, 0x9f, 0x7e, 0xe5, 0x85, 0x6c, 0x38, 0xcf, 0xd2,
+    0xa6, 0x0f, 0x5d, 0xcb, 0x31, 0xd3, 0xad, 0x3b, 0xba, 0x18, 0x4d, 0xd7, 0x09, 0x1e, 0xe3, 0x53,
+    0x07, 0x03, 0xd3, 0xda, 0x79, 0x64, 0xa8, 0x74, 0xbc, 0xfd, 0xb6, 0x48, 0xcd, 0xed, 0x26, 0xad,
+    0xf5, 0xd9, 0x40, 0x4d, 0xf4, 0x69, 0xed, 0x75, 0x87, 0xd8, 0x15, 0x87, 0xad, 0x2d, 0x21, 0xc3,
+    0xb6, 0xc8, 0x26, 0x9d, 0xb4, 0x85, 0x7f, 0xa0, 0x91, 0xd1, 0x18, 0xba, 0x40, 0xa7, 0xb1, 0xdb,
+    0x17, 0xba, 0xc5, 0xba, 0x9b, 0x17, 0xa9, 0x89, 0xac, 0x9a, 0x6d, 0x56, 0x08, 0x89, 0x7a, 0xfb,
+    0xde, 0x13, 0xb5, 0xfb, 0x7c, 0xf1, 0x0e, 0x07, 0xf7, 0xa6, 0xe8, 0x85, 0x76, 0xa8, 0x80, 0x07,
+    0xb2, 0xad, 0xe4, 0x0b, 0x4c, 0x8b, 0x5d, 0x09, 0xa7, 0xcb, 0x06, 0x1e, 0xc1, 0xa5, 0x5d, 0xc9,
+    0x73, 0xce, 0x2a, 0xfe, 0x54, 0xea, 0xc1, 0x0a, 0x5b, 0xa9, 0x4e, 0xe6, 0x10, 0x7e, 0xc6, 0x56,
+    0xb2, 0x6a, 0x95, 0x75, 0x1c, 0xb6, 0xa7, 0xa0, 0xa3, 0xc5, 0xd8, 0x4a, 0x9c, 0x85, 0x1b, 0xed,
+    0xc2, 0x68, 0xf0, 0x1c, 0x21, 0x29, 0xdf, 0x25, 0xa4, 0x1c, 0xff, 0x22, 0xc2, 0xba, 0xe8, 0x92,
+    0xdd, 0x14, 0x5f, 0x44, 0x94, 0x30, 0x99, 0x98, 0xcd, 0xb5, 0x47, 0x48, 0xfd, 0xf4, 0x70, 0x7f,
+    0x1f, 0xae, 0x38, 0xee, 0x57, 0x09, 0x37, 0xfd, 0xcb, 0x7e, 0x92, 0x30, 0x5f, 0xb9, 0xcc, 0x27,
+    0x0f, 0xba, 0xcb, 0x04, 0xb2, 0x35, 0x1f, 0xbd, 0x62, 0x7a, 0xe1, 0x8f, 0xfc, 0x47, 0x07, 0xba,
+    0xe9, 0x3c, 0x87, 0xdd, 0xf2, 0x68, 0x93, 0xfd, 0xfa, 0xfd, 0x3b, 0xf3, 0xbe, 0xef, 0xaf, 0x96,
+    0xdd, 0xd5, 0xc4, 0xd0, 0x13, 0x82, 0x2d, 0x60, 0x53, 0x18, 0x4f, 0xaa, 0x65, 0xb7, 0xad, 0x21,
+    0xc5, 0xa8, 0xc7, 0x66, 0x31, 0x30, 0x38, 0x37, 0xb6, 0x1e, 0xfe, 0x84, 0x42, 0x5c, 0x17, 0xc6,
+    0xd1, 0xba, 0x8c, 0x5a, 0xc5, 0xdd, 0x9e, 0xd8, 0x53, 0xbd, 0xdd, 0x38, 0x77, 0x28, 0xdf, 0xc2,
+    0x07, 0xd5, 0x7f, 0x66, 0x69, 0x0d, 0x86, 0x4d, 0x44, 0x65, 0xae, 0xe9, 0x71, 0x14, 0x9a, 0x27,
+    0x52, 0x47, 0x99, 0x67, 0xde, 0x85, 0xdb, 0x9c, 0xec, 0x17, 0x1b, 0x1c, 0xe6, 0x16, 0x73, 0xe3,
+    0x33, 0x8d, 0xe5, 0x6b, 0x61, 0x03, 0x8b, 0x70, 0xe7, 0x53, 0xc2, 0x69, 0x7f, 0x69, 0x83, 0x23,
+    0xe8, 0x2e, 0x8f, 0xdb, 0x72, 0xfd, 0x72, 0x65, 0x44, 0x74, 0xc0, 0x9b, 0xa5, 0x8a, 0x15, 0xaf,
+    0x99, 0x90, 0x55, 0x5b, 0xac, 0xf4, 0xb5, 0x28, 0xf0, 0xf9, 0xa7, 0xd6, 0x1c, 0x9e, 0x9e, 0x29,
+    0x2d, 0x95, 0xe9, 0xfe, 0x7d, 0xed, 0x23, 0x18, 0x5c, 0x9a, 0xfb, 0x5c, 0x3c, 0x7c, 0x90, 0x5d,
+    0xbb, 0x63, 0x46, 0x6b, 0x17, 0x6e, 0xd7, 0x14, 0xae, 0x9a, 0xae, 0xec, 0x7b, 0x44, 0xbd, 0xef,
+    0x36, 0xa7, 0xb1, 0xe1, 0xba, 0xc3, 0x75, 0x6e, 0x11, 0xdd, 0x61, 0x77, 0xaf, 0xbb, 0xfd, 0x7d,
+    0xd3, 0x37, 0x19, 0xbd, 0xd8, 0x7a, 0x4b, 0xfe, 0x37, 0x1c, 0x60, 0x5e, 0xc8, 0x4f, 0x7b, 0x40,
+    0xab, 0x2c, 0xcb, 0x37, 0x5c, 0xd0, 0xa6, 0xd3, 0xe9, 0xc6, 0xb2, 0xee, 0xd3, 0xd0, 0x7f, 0x64,
+    0x1c, 0x62, 0x96, 0xe2, 0x52, 0x55, 0xaa, 0xc6, 0x71, 0xfb, 0x3f, 0xdb, 0xf4, 0xb2, 0x52, 0xf1,
+    0x3e, 0xb7, 0x09, 0x8e, 0xca, 0xfd, 0x05, 0x7d, 0x4a, 0x44, 0x2e, 0xc0, 0x18, 0x00, 0x00,
+};
+static const char WS_API_MODAL_JS_ETAG[] PROGMEM = "\"dab2dfc7ba229a16\"";
+
+}
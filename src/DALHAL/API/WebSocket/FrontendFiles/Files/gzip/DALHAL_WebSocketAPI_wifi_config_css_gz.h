@@ -0,0 +1,104 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// generated by gzip_frontend_files.py from Files/DALHAL_WebSocketAPI_wifi_config_css.h, do not edit
+
+#pragma once
+
+#include "stdint.h"
+#include <pgmspace.h>
+
+namespace DALHAL {
+
+// 3057 bytes uncompressed, 1054 bytes gzip
+static const uint8_t WS_API_WIFI_CONFIG_CSS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x56, 0x4d, 0x8f, 0xdb, 0x36,
+    0x10, 0xbd, 0xfb, 0x57, 0x10, 0xbb, 0x08, 0x90, 0x04, 0x91, 0x23, 0xdb, 0x92, 0xe3, 0x95, 0x91,
+    0x4b, 0x50, 0x14, 0x3d, 0x16, 0xc8, 0xa9, 0x28, 0x72, 0xa0, 0x44, 0xca, 0x62, 0x56, 0x26, 0x05,
+    0x92, 0x5a, 0x79, 0x63, 0xec, 0x7f, 0xef, 0x0c, 0x45, 0xc9, 0xfa, 0xda, 0xa6, 0xed, 0xa1, 0x20,
+    0x60, 0xaf, 0x87, 0x43, 0x72, 0xde, 0x9b, 0x37, 0x33, 0xbb, 0x5a, 0x7d, 0x7c, 0x4f, 0xbe, 0xd0,
+    0xec, 0x91, 0x69, 0x55, 0x91, 0xf7, 0x1f, 0x57, 0xf7, 0x8d, 0xc8, 0x45, 0x70, 0x56, 0x8c, 0x96,
+    0x41, 0xda, 0xd9, 0xaf, 0x2b, 0x42, 0x98, 0x30, 0x55, 0x49, 0x9f, 0x13, 0x22, 0x95, 0xe4, 0x47,
+    0x30, 0x54, 0xca, 0x08, 0x2b, 0x94, 0x4c, 0x48, 0x2e, 0x2e, 0x9c, 0xa1, 0x49, 0x48, 0xc3, 0x6d,
+    0x42, 0x42, 0xfc, 0x1b, 0x0f, 0x9f, 0xb4, 0xaa, 0x25, 0x4b, 0x88, 0x3e, 0xa5, 0xf4, 0x6d, 0xf8,
+    0x01, 0xd7, 0x3a, 0x8a, 0xdf, 0xe1, 0xf6, 0x8f, 0x40, 0x48, 0xc6, 0x2f, 0x09, 0xd9, 0x84, 0xa1,
+    0xf3, 0xa7, 0xa5, 0x38, 0xc9, 0x40, 0x58, 0x7e, 0x36, 0x09, 0xc9, 0xb8, 0xb4, 0x5c, 0xa3, 0xf9,
+    0x7b, 0x6d, 0xac, 0xc8, 0x9f, 0x83, 0x4c, 0x81, 0x45, 0xda, 0xdb, 0xd6, 0xcb, 0x62, 0xa8, 0x6b,
+    0x55, 0x71, 0x49, 0xae, 0xb7, 0x68, 0xf3, 0x92, 0x5f, 0x8e, 0xe4, 0x65, 0x85, 0x38, 0x7f, 0x11,
+    0xb4, 0x54, 0x27, 0x92, 0xaa, 0xcb, 0x04, 0xa9, 0x03, 0x38, 0x0c, 0xf8, 0x3e, 0xcf, 0x73, 0x07,
+    0x42, 0x69, 0xc6, 0x75, 0xa0, 0x29, 0x13, 0xb5, 0xc1, 0x58, 0xab, 0x4b, 0x6b, 0xbe, 0x04, 0xa6,
+    0xa0, 0x4c, 0x35, 0x00, 0x96, 0x1c, 0xaa, 0x0b, 0xd9, 0x6d, 0xe1, 0x63, 0x08, 0x73, 0xbb, 0x75,
+    0x30, 0x1b, 0xc1, 0x6c, 0x91, 0x90, 0x68, 0xeb, 0x4f, 0x9e, 0xe9, 0x25, 0xf0, 0xb6, 0x87, 0xf8,
+    0xa9, 0x39, 0x0e, 0x89, 0x75, 0xa1, 0x82, 0x01, 0xbf, 0x03, 0x26, 0x34, 0xcf, 0x5a, 0x7a, 0x33,
+    0x55, 0xd6, 0x67, 0x89, 0x3b, 0xea, 0x89, 0xeb, 0xbc, 0xc4, 0x57, 0x0b, 0xc1, 0x18, 0x77, 0xb6,
+    0x1c, 0x88, 0x09, 0x72, 0x7a, 0x16, 0x25, 0x5c, 0x61, 0xa8, 0x34, 0x81, 0xe1, 0x5a, 0xe4, 0xfd,
+    0x96, 0x11, 0x3f, 0x38, 0x44, 0x1e, 0xe1, 0xfb, 0x2d, 0x0d, 0xbf, 0x71, 0x0a, 0xa0, 0xa6, 0xc9,
+    0x2e, 0x5a, 0xeb, 0x75, 0x29, 0xa2, 0x7f, 0x9a, 0x1b, 0x53, 0xd1, 0x8c, 0x07, 0x29, 0xb7, 0x0d,
+    0x6f, 0x83, 0xab, 0x28, 0x63, 0x42, 0x9e, 0xda, 0xf7, 0xc9, 0x06, 0x99, 0xda, 0x6c, 0x3b, 0x0e,
+    0x1d, 0xb5, 0xa9, 0xb2, 0x56, 0x9d, 0xc1, 0x01, 0xb6, 0x8c, 0x2a, 0x05, 0x23, 0xf7, 0x3c, 0xc4,
+    0x35, 0xcd, 0xb0, 0x8f, 0xaf, 0xd8, 0x42, 0x76, 0x87, 0xc0, 0x62, 0xb8, 0xae, 0x35, 0x34, 0x5c,
+    0x9c, 0x0a, 0x88, 0x62, 0x0f, 0x82, 0x42, 0xd2, 0x94, 0x86, 0x44, 0x6e, 0x28, 0x2e, 0x54, 0xc0,
+    0xf0, 0xb2, 0xac, 0x54, 0x86, 0xcf, 0xb2, 0xee, 0x94, 0xed, 0x03, 0xeb, 0x7e, 0x0d, 0x9e, 0xea,
+    0x72, 0x98, 0xd5, 0xda, 0xe0, 0xdd, 0x95, 0x12, 0x8e, 0x89, 0xfe, 0xad, 0xc3, 0xe1, 0x70, 0x24,
+    0xa5, 0x90, 0x1c, 0x82, 0x6d, 0x43, 0xd9, 0x4c, 0x51, 0xb8, 0x87, 0x93, 0x02, 0x13, 0x09, 0x38,
+    0xba, 0x83, 0xbb, 0xdd, 0xae, 0xd3, 0xe8, 0x17, 0xc5, 0x9e, 0x67, 0x75, 0x88, 0xb6, 0xeb, 0x80,
+    0xcc, 0xbd, 0x27, 0xf3, 0x38, 0xd5, 0xf9, 0x2b, 0xd2, 0x21, 0x27, 0x5a, 0x25, 0x2d, 0xf3, 0xf8,
+    0xcc, 0xba, 0x39, 0x07, 0x5a, 0x35, 0xf3, 0x32, 0xf9, 0xdb, 0xe3, 0x51, 0x7b, 0x1a, 0x0f, 0x97,
+    0x34, 0xe5, 0xe5, 0x24, 0x0f, 0xee, 0xf2, 0x0e, 0x50, 0x1c, 0xc7, 0x93, 0xa4, 0xc4, 0x98, 0x94,
+    0xc1, 0xdb, 0x86, 0x97, 0xf0, 0xca, 0x87, 0xfe, 0xb7, 0x90, 0x55, 0x6d, 0xff, 0xb4, 0xcf, 0x15,
+    0xff, 0x7c, 0x57, 0x51, 0x63, 0x1a, 0xc8, 0xc2, 0xdd, 0xb7, 0xe5, 0x7d, 0xcb, 0x2f, 0xf6, 0xee,
+    0x9b, 0x4b, 0x9f, 0xaf, 0x25, 0x68, 0x22, 0x6f, 0x46, 0x7a, 0x73, 0x4a, 0x0b, 0x87, 0x4a, 0x1b,
+    0x49, 0x2c, 0xcb, 0xb2, 0x85, 0xf2, 0xde, 0xb7, 0xfe, 0x43, 0x54, 0xbb, 0x81, 0xa9, 0x2b, 0x32,
+    0x21, 0x0b, 0xa8, 0x30, 0x7b, 0x9c, 0xf5, 0x0c, 0x8a, 0xcb, 0x29, 0x64, 0x2c, 0xbe, 0xd5, 0xcb,
+    0x04, 0x76, 0x92, 0xab, 0xac, 0x36, 0x13, 0x70, 0xad, 0x11, 0x58, 0x55, 0xb5, 0x45, 0x11, 0x81,
+    0xe0, 0x6e, 0x01, 0x47, 0xf4, 0x21, 0x64, 0x0f, 0x9d, 0x38, 0x03, 0xff, 0x80, 0xd5, 0x50, 0xef,
+    0x15, 0xd5, 0x50, 0x7c, 0xc7, 0x79, 0xff, 0xf2, 0x8a, 0xfa, 0xdd, 0xb3, 0x49, 0xf0, 0xa5, 0x46,
+    0xd8, 0x82, 0x58, 0x75, 0x3a, 0x95, 0x1c, 0x55, 0x86, 0x01, 0x54, 0x4d, 0xd0, 0x68, 0x5a, 0xa1,
+    0xc0, 0xfa, 0x8e, 0xae, 0x79, 0x49, 0xad, 0x78, 0xe2, 0x5d, 0xc2, 0x3b, 0x1f, 0x17, 0xe8, 0x4d,
+    0x8a, 0x81, 0x6e, 0x93, 0xbb, 0x3b, 0xdc, 0xb4, 0x01, 0xae, 0xfe, 0xfe, 0xeb, 0x68, 0x48, 0xd0,
+    0x14, 0xa0, 0xd4, 0xd6, 0x8d, 0x0e, 0x7f, 0xcc, 0x9d, 0xb2, 0xaa, 0x42, 0x75, 0xb8, 0xf4, 0x39,
+    0x3c, 0xb9, 0xd2, 0x67, 0x0f, 0x0d, 0x82, 0xe0, 0x7f, 0xbc, 0x0d, 0x60, 0xf7, 0xdd, 0xf1, 0xe7,
+    0xb5, 0x3a, 0x49, 0xdd, 0xde, 0x09, 0x72, 0x52, 0xab, 0xe0, 0x33, 0x2f, 0x50, 0x64, 0xe9, 0x6b,
+    0x46, 0x25, 0x49, 0x6b, 0x68, 0x46, 0x12, 0x50, 0xa2, 0x4f, 0xcb, 0x55, 0x9b, 0xb0, 0x8e, 0x2b,
+    0x03, 0x5e, 0xcb, 0xa5, 0xe3, 0x4a, 0xc4, 0x01, 0x1a, 0x35, 0x4b, 0x57, 0x51, 0x5c, 0xb2, 0x8e,
+    0x9d, 0xfe, 0x02, 0x7f, 0xef, 0xd5, 0x79, 0x60, 0x1c, 0x43, 0x87, 0xd4, 0x4a, 0xc7, 0x9e, 0x3b,
+    0x6d, 0x0a, 0x2d, 0xe4, 0xa3, 0x9f, 0xaa, 0x63, 0x81, 0x47, 0xaf, 0x0a, 0x76, 0x41, 0xf3, 0x69,
+    0x9a, 0xbe, 0xae, 0xf9, 0x05, 0x9e, 0xc6, 0x7a, 0x0a, 0x71, 0xb9, 0x89, 0x56, 0x00, 0xb4, 0xc0,
+    0x75, 0x7a, 0xe4, 0x1d, 0x65, 0xd1, 0x09, 0xbc, 0x8b, 0xbd, 0xef, 0x6f, 0xa3, 0x2b, 0x7c, 0x5b,
+    0x9f, 0xe0, 0x4c, 0x80, 0x47, 0x9a, 0x96, 0x9c, 0xa1, 0xf0, 0xe1, 0x52, 0x61, 0x81, 0xd2, 0x75,
+    0x7c, 0xcb, 0x1c, 0xe3, 0x39, 0xad, 0x4b, 0xdb, 0xa9, 0xf9, 0xab, 0xa5, 0x16, 0xaa, 0xc4, 0x25,
+    0xc8, 0xb5, 0x49, 0xb8, 0xaa, 0x35, 0x5d, 0x27, 0x4c, 0xf8, 0x39, 0x73, 0x16, 0xf2, 0x96, 0xed,
+    0x83, 0x47, 0x3b, 0x68, 0x53, 0x43, 0x52, 0x43, 0xb2, 0x6d, 0xc7, 0xe4, 0xed, 0xda, 0x35, 0xd7,
+    0x9a, 0x0c, 0x5a, 0x75, 0x16, 0xee, 0x1e, 0xb6, 0x69, 0x3b, 0x4f, 0x7a, 0x1f, 0xf5, 0x48, 0x86,
+    0x3e, 0x1b, 0xfa, 0x89, 0x46, 0x74, 0xe2, 0x23, 0x64, 0xae, 0x46, 0x3e, 0x71, 0x4e, 0xc3, 0x0e,
+    0xd5, 0xaf, 0x4a, 0xd9, 0xf9, 0x48, 0xce, 0x5b, 0xeb, 0x75, 0x34, 0x48, 0xb7, 0xfd, 0x20, 0xdd,
+    0x8f, 0x06, 0xa9, 0xab, 0xa3, 0x85, 0x29, 0xba, 0x30, 0xce, 0x67, 0x73, 0xbb, 0x57, 0x29, 0x6c,
+    0xf6, 0x42, 0xf6, 0x49, 0x85, 0x1c, 0x05, 0x90, 0xab, 0x8c, 0x97, 0xe3, 0x40, 0x86, 0x21, 0xfc,
+    0x1f, 0x02, 0x8c, 0x70, 0xcd, 0x83, 0x7a, 0x45, 0x6b, 0x07, 0x5c, 0x9d, 0xd6, 0xd0, 0xdb, 0x00,
+    0xbc, 0x05, 0x00, 0x87, 0x9f, 0x02, 0xe8, 0x5a, 0xcb, 0x7f, 0x0b, 0xdb, 0xa7, 0x79, 0xa0, 0x39,
+    0xff, 0x9f, 0xe5, 0x6c, 0x38, 0xae, 0xc6, 0xb1, 0x2e, 0xe3, 0xda, 0xc4, 0x11, 0x3b, 0x44, 0x53,
+    0x5c, 0xff, 0xa6, 0x86, 0xfe, 0x02, 0x19, 0x77, 0xc1, 0x1b, 0xf1, 0x0b, 0x00, 0x00,
+};
+static const char WS_API_WIFI_CONFIG_CSS_ETAG[] PROGMEM = "\"3c2abfc093984dd4\"";
+
+}
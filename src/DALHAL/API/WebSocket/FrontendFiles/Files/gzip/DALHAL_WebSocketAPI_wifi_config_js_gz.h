@@ -0,0 +1,191 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// generated by gzip_frontend_files.py from Files/DALHAL_WebSocketAPI_wifi_config_js.h, do not edit
+
+#pragma once
+
+#include "stdint.h"
+#include <pgmspace.h>
+
+namespace DALHAL {
+
+// 6538 bytes uncompressed, 2448 bytes gzip
+static const uint8_t WS_API_WIFI_CONFIG_JS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x58, 0xdd, 0x6e, 0x1b, 0xb9,
+    0x15, 0xbe, 0x96, 0x9e, 0x82, 0x9d, 0x66, 0xeb, 0x51, 0x2c, 0x8d, 0x5c, 0xac, 0x11, 0x2c, 0xec,
+    0x38, 0x8b, 0x75, 0xe2, 0x20, 0x29, 0x36, 0x4e, 0x90, 0xb8, 0xc8, 0x45, 0x53, 0x38, 0xd4, 0x90,
+    0x23, 0x71, 0x4d, 0x0d, 0x67, 0x39, 0x1c, 0x2b, 0x5a, 0x43, 0x40, 0xde, 0xa1, 0x7b, 0xdf, 0xbb,
+    0x3e, 0x42, 0x1f, 0x28, 0x4f, 0xd0, 0x47, 0xe8, 0x39, 0x87, 0x9c, 0x3f, 0x4b, 0xce, 0x3a, 0x46,
+    0xe0, 0x78, 0xc8, 0xc3, 0xc3, 0xf3, 0xf3, 0xf1, 0xfc, 0x0d, 0xa7, 0x0f, 0x1f, 0x0e, 0xd9, 0x43,
+    0xb6, 0x52, 0x99, 0x9a, 0x2c, 0x8d, 0xe0, 0x3a, 0xf9, 0xa5, 0x64, 0x5f, 0x3e, 0xff, 0xce, 0xde,
+    0xab, 0xe7, 0x8a, 0x95, 0xd2, 0x55, 0x05, 0x13, 0x8a, 0x6b, 0x33, 0x1f, 0xb3, 0x59, 0xa5, 0xb4,
+    0x63, 0x26, 0x67, 0x6e, 0x21, 0x59, 0xb9, 0xe0, 0x56, 0x0a, 0xf6, 0x0a, 0xcf, 0xb0, 0xd4, 0x2c,
+    0x0b, 0x93, 0xcb, 0xdc, 0x25, 0xc0, 0x0c, 0xf9, 0x5d, 0x00, 0x45, 0x51, 0xcd, 0xb4, 0x4a, 0xd9,
+    0x4f, 0x6f, 0x5e, 0xb2, 0x18, 0x18, 0xbd, 0x93, 0xb9, 0x78, 0x9e, 0x8f, 0x99, 0x95, 0xa9, 0x54,
+    0xd7, 0x72, 0xcc, 0x4c, 0x21, 0xe1, 0x33, 0xd5, 0xa6, 0x84, 0x8f, 0x32, 0xe5, 0xf0, 0x51, 0x02,
+    0xcd, 0x98, 0x5d, 0x3a, 0x33, 0x9f, 0x6b, 0xf9, 0x66, 0x35, 0x42, 0x56, 0xaa, 0x64, 0x55, 0x9e,
+    0x2e, 0x78, 0x3e, 0x87, 0xeb, 0x32, 0x6b, 0x96, 0x74, 0xbd, 0xb1, 0x6a, 0xae, 0x72, 0xb8, 0x1a,
+    0x36, 0xc4, 0xc4, 0x1a, 0xad, 0x61, 0xf7, 0x5a, 0xda, 0x52, 0x81, 0x7c, 0x28, 0x3f, 0xcf, 0xd7,
+    0x6e, 0xa1, 0xf2, 0x39, 0x50, 0x73, 0x87, 0x7c, 0xb8, 0xb6, 0x92, 0x8b, 0x35, 0x4b, 0xb9, 0xd6,
+    0x25, 0xa8, 0x97, 0x29, 0x92, 0x3d, 0x79, 0xc8, 0xae, 0xa4, 0x2c, 0x4a, 0xb6, 0x32, 0xf6, 0x0a,
+    0xe8, 0x13, 0xf6, 0x1e, 0x0e, 0xb0, 0xfa, 0x42, 0xb8, 0x1d, 0xaf, 0x4b, 0x17, 0x70, 0xb1, 0x3c,
+    0x42, 0x3e, 0x33, 0x9e, 0x5e, 0x09, 0x6b, 0x8a, 0x31, 0x5b, 0x00, 0x3f, 0x69, 0x83, 0x0a, 0x60,
+    0x1d, 0xe7, 0x0c, 0xe8, 0x70, 0x06, 0xaa, 0x14, 0x72, 0xe2, 0xcc, 0x24, 0xa8, 0x06, 0x02, 0x02,
+    0x89, 0x4a, 0xaf, 0x26, 0xa6, 0x72, 0xa5, 0x12, 0xed, 0x9e, 0x17, 0x4b, 0xb3, 0xdc, 0xac, 0xd0,
+    0x84, 0xd2, 0xab, 0xe7, 0x4d, 0xaa, 0xf2, 0xd2, 0x01, 0x7f, 0x66, 0x32, 0xc6, 0x99, 0x90, 0x42,
+    0xa5, 0xdc, 0x81, 0x3c, 0x7f, 0x6e, 0x3d, 0x35, 0xa9, 0x25, 0x61, 0x33, 0x6d, 0xd2, 0x2b, 0xb2,
+    0x95, 0xf7, 0xcd, 0x8b, 0x8b, 0x57, 0x3f, 0x27, 0xe8, 0x03, 0x2b, 0xf7, 0x4a, 0xe0, 0xee, 0x0d,
+    0xa1, 0x65, 0xe6, 0x98, 0x33, 0xac, 0xe0, 0xc0, 0x19, 0x48, 0xe1, 0x4f, 0x95, 0x0b, 0xf9, 0x29,
+    0x59, 0xb8, 0xa5, 0x66, 0x99, 0xb1, 0x70, 0x16, 0xd4, 0x25, 0xde, 0xc8, 0x0c, 0xad, 0x88, 0xdc,
+    0x9e, 0xbd, 0x7e, 0x85, 0x66, 0xf0, 0xde, 0x47, 0x9e, 0x63, 0x0f, 0x00, 0x0e, 0x02, 0xaf, 0xf8,
+    0x1a, 0x1c, 0x3a, 0x37, 0x8f, 0x0e, 0x0e, 0x26, 0x05, 0xcf, 0x25, 0xc1, 0x07, 0x29, 0x45, 0xc9,
+    0x94, 0x2b, 0x99, 0x5f, 0x03, 0x6e, 0xd3, 0x61, 0x6a, 0x40, 0xa3, 0xd6, 0xee, 0xec, 0x84, 0xc5,
+    0xf1, 0x88, 0x9d, 0x3c, 0x61, 0x37, 0xc3, 0x81, 0x96, 0x8e, 0x5d, 0x96, 0x04, 0x10, 0x58, 0xcf,
+    0x2b, 0xad, 0x8f, 0xc3, 0xa2, 0xca, 0xdf, 0x01, 0x32, 0x60, 0x31, 0xe3, 0xba, 0x94, 0x61, 0x75,
+    0x19, 0x18, 0x04, 0x42, 0xcf, 0x59, 0x80, 0xe9, 0x4e, 0xd8, 0xcd, 0xe6, 0x98, 0x4d, 0xa7, 0xac,
+    0x30, 0x45, 0xa5, 0xc9, 0x60, 0x26, 0x4f, 0x41, 0x60, 0x30, 0xcc, 0x25, 0x89, 0x75, 0x6a, 0xc4,
+    0x3a, 0x1e, 0x4d, 0xfd, 0xc7, 0x73, 0x63, 0x9c, 0xb4, 0xf1, 0x68, 0x38, 0x1c, 0xc0, 0x99, 0x2f,
+    0xbf, 0x7f, 0x86, 0x7f, 0x4c, 0xe6, 0xa9, 0x11, 0x68, 0xaf, 0x85, 0xd4, 0x05, 0x00, 0x8a, 0xc5,
+    0x0d, 0xfc, 0x46, 0x81, 0x66, 0x38, 0xc8, 0x60, 0xcd, 0x21, 0xd4, 0x66, 0x8f, 0x0e, 0x2b, 0xab,
+    0xcf, 0xf0, 0x8c, 0x8c, 0x4b, 0x67, 0x47, 0xa8, 0xce, 0xc0, 0xc2, 0xbb, 0xb1, 0xb0, 0xe9, 0x0c,
+    0x87, 0xd3, 0x92, 0x10, 0x11, 0x13, 0x63, 0xf9, 0xf7, 0xb7, 0x2f, 0x9f, 0xd6, 0xaf, 0x85, 0x0e,
+    0x8c, 0x46, 0x70, 0x60, 0x90, 0x58, 0x59, 0x68, 0x9e, 0xca, 0x78, 0xfa, 0x61, 0x7f, 0x0a, 0x6f,
+    0x2d, 0x9a, 0x44, 0xa3, 0xce, 0xda, 0x94, 0xd6, 0x2e, 0xbb, 0x6b, 0x27, 0xfb, 0x0f, 0xa6, 0xb0,
+    0x16, 0x8d, 0xc0, 0x02, 0x9b, 0x2d, 0x89, 0x9e, 0xc9, 0xbe, 0x44, 0xf0, 0x07, 0x58, 0x07, 0x7e,
+    0xb7, 0x0c, 0x26, 0xc4, 0x73, 0xbf, 0xcb, 0xf3, 0x92, 0x96, 0xa6, 0xc4, 0x73, 0xb0, 0x5a, 0x28,
+    0x2d, 0x19, 0xb2, 0x48, 0xb4, 0xcc, 0xe7, 0x6e, 0xc1, 0xbe, 0x63, 0x87, 0x23, 0xe4, 0xc1, 0xf6,
+    0x4f, 0x58, 0x74, 0x12, 0x1d, 0xb7, 0x9a, 0x0a, 0xb9, 0xa5, 0x5b, 0xd0, 0x9a, 0x3b, 0x33, 0x0b,
+    0x7a, 0x92, 0xa0, 0x1d, 0x49, 0x31, 0x28, 0x38, 0xee, 0xaa, 0x32, 0x5e, 0x96, 0x70, 0xaf, 0x5b,
+    0x17, 0x12, 0x64, 0x04, 0x8d, 0x48, 0x62, 0xf0, 0x67, 0x52, 0xd2, 0x76, 0xe2, 0xe4, 0x27, 0xf7,
+    0xd4, 0xe4, 0x0e, 0xd8, 0x02, 0x01, 0x10, 0x1f, 0xf7, 0xf7, 0x53, 0xcd, 0xcb, 0xf2, 0x1c, 0xf1,
+    0x78, 0xc2, 0x3e, 0x02, 0x90, 0x97, 0x13, 0xbf, 0xc1, 0x1e, 0xdc, 0x20, 0xd3, 0xcd, 0xc7, 0xc4,
+    0x59, 0xb5, 0x8c, 0x77, 0x08, 0x90, 0x8b, 0x38, 0x5d, 0x0a, 0x7f, 0xa1, 0xca, 0x58, 0xfc, 0xa7,
+    0x80, 0x42, 0xbf, 0x32, 0x68, 0x25, 0x8c, 0xce, 0x0d, 0x73, 0x96, 0xe7, 0x65, 0x61, 0xac, 0x43,
+    0xc9, 0xe9, 0x79, 0x60, 0x2c, 0xe9, 0x84, 0x92, 0x26, 0xca, 0xc5, 0xa3, 0x08, 0xec, 0x28, 0xad,
+    0xf5, 0x96, 0xac, 0xad, 0x54, 0x63, 0x18, 0xfd, 0x35, 0x08, 0x37, 0xd1, 0xfd, 0x1d, 0x4b, 0x3a,
+    0x5b, 0xc9, 0xdb, 0x72, 0xa2, 0x4a, 0x6f, 0xcd, 0x2a, 0xd6, 0x7c, 0x26, 0xf5, 0x05, 0x18, 0x03,
+    0x62, 0x8e, 0x37, 0xc7, 0x39, 0x58, 0xdd, 0xcb, 0xea, 0x1f, 0x81, 0x85, 0x48, 0x72, 0x02, 0x4f,
+    0x21, 0xad, 0x96, 0x18, 0x8d, 0x53, 0x08, 0x79, 0x4e, 0x9e, 0x69, 0x89, 0x5f, 0x71, 0x24, 0xd4,
+    0xb5, 0x17, 0x08, 0xc8, 0x7a, 0x46, 0x8b, 0xc8, 0x68, 0xb0, 0x4a, 0x3e, 0xf5, 0xac, 0xe8, 0xb2,
+    0xaf, 0x30, 0xa3, 0x7d, 0xcf, 0x8e, 0xfe, 0xdc, 0xc1, 0xd0, 0x93, 0xb4, 0x14, 0x7d, 0x3f, 0x36,
+    0xda, 0xd4, 0x12, 0xf1, 0xa2, 0x40, 0x87, 0xd0, 0x7a, 0x5f, 0xc3, 0x8e, 0x7d, 0x80, 0xf0, 0xb6,
+    0x79, 0x3a, 0x0f, 0xbb, 0x63, 0x8a, 0x19, 0x2c, 0xfc, 0xb1, 0x2d, 0x80, 0x1c, 0x9e, 0xfe, 0xb9,
+    0x74, 0x18, 0xfe, 0xc1, 0xaf, 0x5a, 0xa6, 0x8e, 0xed, 0x33, 0x0c, 0x3a, 0x0d, 0x27, 0xcc, 0x4d,
+    0x6f, 0xef, 0x67, 0xd8, 0x40, 0xba, 0xc3, 0x16, 0x2a, 0x2f, 0x2a, 0x37, 0x59, 0x59, 0x5e, 0x44,
+    0x0d, 0x7a, 0x21, 0x19, 0x7c, 0x85, 0xa9, 0x17, 0xc6, 0xf3, 0xad, 0xc9, 0x13, 0x95, 0xe7, 0xd2,
+    0x62, 0x7c, 0x87, 0x83, 0x7b, 0x8f, 0x4d, 0x41, 0x06, 0xb8, 0xe6, 0xba, 0x92, 0x27, 0x51, 0xf4,
+    0x04, 0x31, 0x59, 0x58, 0x59, 0x96, 0xa4, 0x00, 0x42, 0xf4, 0xf1, 0xd4, 0xd3, 0x3c, 0xd9, 0x6b,
+    0xd8, 0xc0, 0xce, 0xa9, 0xcb, 0xbf, 0x72, 0xb1, 0xcf, 0x64, 0x9d, 0x8b, 0xfd, 0x89, 0xa4, 0x7e,
+    0xa0, 0x61, 0xff, 0xf6, 0x76, 0x4f, 0xe7, 0x99, 0xc3, 0xf0, 0x97, 0x4f, 0x4a, 0x08, 0x0c, 0xb9,
+    0xe0, 0x76, 0xbd, 0x45, 0xde, 0x07, 0x43, 0xf4, 0xa1, 0x12, 0x3f, 0x7c, 0x2f, 0xe0, 0xb7, 0x38,
+    0x10, 0x24, 0xfd, 0xd6, 0x01, 0x2e, 0xc4, 0xd9, 0x35, 0x50, 0xff, 0xac, 0x20, 0x7f, 0x81, 0x15,
+    0xe2, 0x88, 0xb2, 0x2a, 0xbc, 0x34, 0x9f, 0x47, 0x3a, 0xef, 0x10, 0x4e, 0xc4, 0xa3, 0x9e, 0x43,
+    0x02, 0xb6, 0x6a, 0x3b, 0x8e, 0x59, 0x87, 0x33, 0x11, 0x22, 0x5c, 0x02, 0xd5, 0x53, 0x08, 0x7c,
+    0x22, 0xae, 0x1f, 0x5d, 0x14, 0xc0, 0x11, 0x8d, 0x6b, 0x20, 0x8c, 0x1a, 0xdc, 0xbc, 0x01, 0x8d,
+    0x61, 0x4f, 0x00, 0x62, 0xae, 0x55, 0xa9, 0x66, 0x4a, 0x2b, 0xb7, 0x66, 0xbe, 0x7c, 0x69, 0xe0,
+    0x53, 0xac, 0xee, 0x09, 0x1e, 0x22, 0xbc, 0x1f, 0x74, 0x8a, 0xfa, 0xe2, 0xbb, 0xd9, 0xd2, 0xa9,
+    0xd6, 0x89, 0xf5, 0x89, 0xc6, 0x8b, 0xf5, 0xc2, 0x16, 0xcf, 0x84, 0x92, 0xc1, 0xc2, 0x68, 0x28,
+    0x6e, 0x90, 0xf0, 0x0c, 0x7c, 0x64, 0xd9, 0xdd, 0xe4, 0xbc, 0x72, 0x06, 0x0b, 0x40, 0xc8, 0xcc,
+    0xc4, 0x38, 0xad, 0xac, 0x05, 0x09, 0x26, 0xdb, 0x27, 0x56, 0x17, 0x64, 0x99, 0x6f, 0x80, 0x5e,
+    0x7d, 0xe4, 0x2e, 0xec, 0x35, 0xfb, 0xf7, 0x04, 0x5f, 0x43, 0x0f, 0xa1, 0xfa, 0x27, 0x07, 0x59,
+    0x01, 0xf8, 0xc9, 0x38, 0xe2, 0x56, 0xf1, 0x10, 0xad, 0x20, 0x6e, 0x07, 0x29, 0x1b, 0x1b, 0xb7,
+    0xae, 0xdd, 0x25, 0xd8, 0x1d, 0x30, 0x4e, 0x0f, 0xff, 0xfa, 0xa1, 0xca, 0xe4, 0x41, 0xb6, 0x7d,
+    0xf7, 0xfd, 0x81, 0xdc, 0x54, 0xc2, 0x01, 0xcd, 0x1e, 0x21, 0x1d, 0x2c, 0xd7, 0x32, 0x7a, 0x3c,
+    0xd7, 0x37, 0xfc, 0x01, 0xa0, 0x6b, 0xd4, 0xc2, 0x85, 0xc4, 0xb0, 0xc5, 0xb3, 0x4f, 0x76, 0x4c,
+    0xab, 0x5c, 0xf6, 0x32, 0xec, 0x7d, 0xd0, 0x7b, 0x47, 0x3e, 0x8e, 0x3a, 0xf9, 0x38, 0xda, 0x29,
+    0x57, 0x7b, 0xd0, 0xcb, 0x51, 0x17, 0x4f, 0x40, 0xb7, 0x33, 0xd2, 0xd7, 0x55, 0x5b, 0x27, 0xd6,
+    0x67, 0xb4, 0x74, 0xaf, 0x68, 0xef, 0x0f, 0xc0, 0x43, 0x4e, 0xa5, 0xbe, 0x7f, 0x18, 0x6c, 0xe8,
+    0x77, 0x01, 0xb1, 0xdd, 0xbc, 0x07, 0x0a, 0x3b, 0x9c, 0xfa, 0xc8, 0x79, 0x4a, 0x1b, 0xb7, 0x68,
+    0xee, 0x0f, 0x15, 0x6a, 0x28, 0xe2, 0xe0, 0x4a, 0x32, 0x29, 0x18, 0xf8, 0x1b, 0xe3, 0xbc, 0x3f,
+    0x71, 0x67, 0x9c, 0x0f, 0xdb, 0x3b, 0x95, 0x2c, 0xa0, 0xc0, 0xea, 0x45, 0xf9, 0x9a, 0x57, 0x5f,
+    0x49, 0x2c, 0x8f, 0xd8, 0x5f, 0xd8, 0x5b, 0x09, 0x0e, 0xb7, 0x6e, 0x8b, 0xfa, 0x1b, 0x42, 0x3c,
+    0xbe, 0x80, 0xa0, 0xad, 0xf7, 0x7e, 0xfd, 0x2c, 0x1a, 0xe3, 0x85, 0x18, 0xef, 0x59, 0x77, 0x4b,
+    0x08, 0x4f, 0x1f, 0xb0, 0x05, 0x0d, 0x30, 0x3b, 0x45, 0x58, 0x51, 0x53, 0xe3, 0x5b, 0x93, 0x7d,
+    0xea, 0x79, 0x34, 0xff, 0x4d, 0xe9, 0xf5, 0x18, 0x1b, 0xde, 0x4c, 0x59, 0x00, 0x0d, 0x36, 0xac,
+    0x20, 0x07, 0x26, 0xd9, 0xdc, 0x30, 0x50, 0xf7, 0x0a, 0x9a, 0xe3, 0x5c, 0x4a, 0x81, 0x7d, 0x62,
+    0xde, 0x69, 0xa6, 0x12, 0xec, 0x77, 0x5a, 0xd4, 0xca, 0xbc, 0xac, 0xac, 0x24, 0xd6, 0x71, 0x5b,
+    0x6a, 0x52, 0x13, 0x33, 0x62, 0x41, 0x26, 0xfa, 0x42, 0x19, 0x9b, 0xde, 0x46, 0xae, 0xbc, 0x34,
+    0x31, 0x55, 0xa2, 0x4a, 0x1c, 0xb1, 0xa8, 0xed, 0xfd, 0xa2, 0x31, 0x2e, 0x3a, 0xe5, 0xb4, 0x3c,
+    0xea, 0x06, 0x9d, 0xec, 0x91, 0x6f, 0xdc, 0xdf, 0x61, 0xe3, 0xee, 0x89, 0x56, 0x4a, 0xb8, 0xc5,
+    0x11, 0xfb, 0xfe, 0xd1, 0x01, 0x7d, 0xd6, 0x4d, 0xe3, 0x11, 0x55, 0x9a, 0x63, 0x6c, 0x96, 0x84,
+    0x5a, 0x2e, 0xb1, 0x53, 0x82, 0xf6, 0x59, 0xf3, 0xf5, 0xb8, 0xdf, 0xac, 0x82, 0x31, 0x7c, 0x47,
+    0x1b, 0xda, 0x5c, 0xe5, 0x90, 0x8b, 0xb0, 0x7c, 0x3e, 0xe7, 0x33, 0xbc, 0x9d, 0x8a, 0x5a, 0xe2,
+    0xa3, 0x1c, 0x74, 0x9b, 0x1c, 0xec, 0x25, 0x27, 0xe5, 0xc2, 0x50, 0x95, 0xec, 0xa0, 0x91, 0x2a,
+    0x9b, 0x01, 0x02, 0x74, 0xa2, 0xb0, 0xef, 0x8c, 0xd1, 0x6c, 0x05, 0xd6, 0x32, 0x2b, 0x2c, 0x85,
+    0x47, 0x8d, 0xd6, 0x18, 0x94, 0xa9, 0x8c, 0xeb, 0x14, 0x74, 0xfd, 0xdd, 0xf0, 0xf4, 0x7b, 0x61,
+    0xa0, 0x43, 0xb1, 0x34, 0x15, 0xe0, 0xba, 0xeb, 0xea, 0xda, 0xac, 0x9b, 0x5e, 0x8b, 0xd7, 0x9d,
+    0x4c, 0xb4, 0xb3, 0x85, 0x72, 0x01, 0x5a, 0xb6, 0x2d, 0x5e, 0xe0, 0x80, 0xd6, 0x47, 0x8c, 0xbc,
+    0x95, 0x73, 0x04, 0xa5, 0x25, 0x98, 0x34, 0x9d, 0x40, 0xc2, 0x32, 0xaa, 0xe0, 0x8f, 0xb0, 0x2d,
+    0x02, 0x5d, 0x3d, 0x3a, 0x84, 0x61, 0xe7, 0xaf, 0x2f, 0x18, 0xa0, 0x99, 0x7d, 0x00, 0x18, 0x7a,
+    0x97, 0xe2, 0xa0, 0x42, 0x4b, 0x6c, 0x8b, 0x19, 0xb8, 0x3f, 0xc0, 0x06, 0x71, 0x32, 0x68, 0xdb,
+    0x86, 0xac, 0x6e, 0x3c, 0xda, 0x66, 0x38, 0xcb, 0xa9, 0x61, 0x18, 0x0f, 0x83, 0x1c, 0xcf, 0x25,
+    0x8a, 0x8a, 0xd5, 0x1d, 0xd4, 0x79, 0x95, 0x86, 0x1e, 0x9b, 0x3a, 0x79, 0x94, 0xca, 0xdf, 0x13,
+    0x53, 0x53, 0x42, 0xad, 0x3c, 0x8d, 0x13, 0xd6, 0xa6, 0xb2, 0xcc, 0x7e, 0x0a, 0xf7, 0x43, 0x3b,
+    0x48, 0x77, 0x86, 0x29, 0x4c, 0xfc, 0x4b, 0x69, 0xf2, 0x67, 0xdc, 0xf1, 0x70, 0x6f, 0x0f, 0xaa,
+    0xd4, 0xba, 0xe0, 0x5c, 0x20, 0xc6, 0xa6, 0x5b, 0x81, 0x30, 0x07, 0xc7, 0xf0, 0xdf, 0x63, 0x56,
+    0x1f, 0x0a, 0x7d, 0x21, 0x2c, 0xee, 0xef, 0x07, 0x06, 0x21, 0xbe, 0x22, 0xc5, 0x4b, 0x27, 0xb1,
+    0x23, 0xaf, 0x89, 0xff, 0xa1, 0xfe, 0x49, 0x0c, 0xa9, 0x83, 0xc7, 0x1a, 0xcc, 0xb7, 0xa8, 0xc2,
+    0x2f, 0x3a, 0xbb, 0x66, 0x37, 0xdd, 0x65, 0x38, 0xd9, 0xeb, 0x64, 0x6b, 0x8e, 0x54, 0xbe, 0x8d,
+    0x8e, 0xd9, 0x06, 0x62, 0xb8, 0x4b, 0x17, 0x5b, 0x87, 0x7a, 0x74, 0x40, 0xd6, 0x11, 0x0a, 0x2a,
+    0xe1, 0xaf, 0x44, 0x43, 0x5f, 0x27, 0x87, 0x86, 0x6d, 0x00, 0x5f, 0x09, 0x95, 0xd5, 0x5b, 0x2c,
+    0x9b, 0xed, 0x7e, 0x68, 0xfb, 0xf8, 0xe0, 0xa6, 0x23, 0xc8, 0x06, 0xdc, 0xb0, 0x78, 0x70, 0xd3,
+    0x9c, 0x4c, 0x17, 0x9b, 0x31, 0xeb, 0x7c, 0x67, 0x56, 0xfe, 0xba, 0x79, 0xf5, 0xe2, 0xb7, 0xde,
+    0xa2, 0x05, 0x06, 0x1b, 0x71, 0xba, 0xec, 0x2d, 0xca, 0x3c, 0xb5, 0x6b, 0x12, 0x6d, 0x33, 0xfa,
+    0xe8, 0x2f, 0x6f, 0x9a, 0x81, 0x6e, 0x16, 0x05, 0x89, 0xbc, 0xe8, 0x9b, 0x06, 0x2e, 0x21, 0x5e,
+    0xdd, 0xe1, 0xd8, 0x5e, 0x0d, 0x57, 0xab, 0x1a, 0x51, 0x48, 0xee, 0xf6, 0xbd, 0x51, 0x4b, 0x5d,
+    0x47, 0x69, 0xa1, 0x4a, 0x7c, 0xfa, 0xa2, 0x33, 0x95, 0xe9, 0x57, 0xea, 0x3b, 0x09, 0xfc, 0x13,
+    0xf5, 0x32, 0x6d, 0x0b, 0x90, 0x81, 0x57, 0x4a, 0xbf, 0xe1, 0x85, 0x0f, 0xf9, 0xcc, 0x4b, 0x4f,
+    0x67, 0x7f, 0xac, 0x73, 0x1c, 0x9d, 0xde, 0x9e, 0x0c, 0x85, 0x83, 0xbe, 0xf8, 0xdf, 0xea, 0xdf,
+    0xf1, 0x85, 0xe1, 0x54, 0x27, 0x3c, 0x9d, 0x5f, 0x2b, 0x48, 0x41, 0x5f, 0x3e, 0xff, 0x07, 0xeb,
+    0x3d, 0x95, 0x67, 0x26, 0xa8, 0x49, 0x69, 0x85, 0xe2, 0xec, 0x14, 0x09, 0xa3, 0x8e, 0x40, 0x3e,
+    0xe3, 0x78, 0xbe, 0xa1, 0x2f, 0x04, 0x1f, 0x9c, 0x3e, 0x3a, 0x24, 0x4c, 0x05, 0x8f, 0x90, 0x1d,
+    0x89, 0x13, 0x4d, 0x13, 0x02, 0x45, 0xfd, 0x36, 0x7a, 0xe2, 0x50, 0xa7, 0xc9, 0x21, 0x10, 0xf8,
+    0xd6, 0x93, 0x52, 0x4c, 0xd2, 0x1f, 0x1b, 0x84, 0x18, 0xd4, 0xb8, 0xb5, 0x6e, 0x28, 0xc0, 0x68,
+    0xe1, 0xd2, 0xbe, 0x03, 0x8f, 0xfb, 0x34, 0x5e, 0xb6, 0xde, 0x84, 0x0a, 0x97, 0x47, 0x1d, 0x32,
+    0x08, 0x5d, 0x88, 0x5d, 0xaf, 0xb0, 0x74, 0x97, 0x40, 0x3c, 0xf5, 0x40, 0x86, 0xc3, 0x9b, 0xa3,
+    0x07, 0x37, 0x81, 0xcf, 0xe6, 0x63, 0xa3, 0x54, 0x33, 0x34, 0xd9, 0xa1, 0x15, 0x3c, 0x87, 0x4c,
+    0xcd, 0x71, 0xae, 0xe2, 0xe7, 0x23, 0x42, 0x5e, 0xab, 0x54, 0x42, 0xb0, 0x87, 0x88, 0x64, 0x7d,
+    0xce, 0x27, 0x15, 0xcd, 0x55, 0xad, 0xe1, 0x1d, 0xb8, 0x0a, 0x53, 0x90, 0x2e, 0x9a, 0x3b, 0xb5,
+    0x70, 0xd7, 0x09, 0xaa, 0x7c, 0xa1, 0x84, 0x90, 0xf9, 0x6d, 0x83, 0xf8, 0x22, 0xe6, 0xe4, 0x76,
+    0xa3, 0xb3, 0xb3, 0x17, 0x6a, 0x78, 0xfc, 0xc8, 0x22, 0x7c, 0xd5, 0x11, 0x3b, 0xda, 0x79, 0x6c,
+    0x77, 0xcd, 0xdf, 0x3d, 0xdd, 0x64, 0x62, 0x79, 0xf8, 0x03, 0x71, 0xb9, 0xa3, 0x1f, 0x00, 0x95,
+    0x06, 0x9b, 0xe3, 0xe1, 0x66, 0x84, 0x68, 0x1e, 0x42, 0x66, 0x3a, 0xad, 0x67, 0xb9, 0x3e, 0xf9,
+    0xd6, 0x13, 0x62, 0x1a, 0x1e, 0xdf, 0x9a, 0x28, 0x33, 0x6e, 0x25, 0x8d, 0x8c, 0x7d, 0x44, 0x17,
+    0x6c, 0xb6, 0xae, 0x67, 0xc6, 0xae, 0x94, 0x3a, 0x43, 0x76, 0xf1, 0xed, 0x34, 0x4f, 0x27, 0x5f,
+    0xe7, 0x21, 0x95, 0x0b, 0x99, 0x71, 0xca, 0x1d, 0x98, 0x39, 0x60, 0x9f, 0xad, 0x16, 0x20, 0x7f,
+    0x33, 0x4f, 0xc6, 0xa1, 0x37, 0xac, 0x52, 0x32, 0x43, 0x6e, 0xf5, 0x04, 0x19, 0xa8, 0x57, 0x0a,
+    0x2e, 0x87, 0xb2, 0x07, 0xe7, 0xc0, 0xc9, 0x70, 0xb8, 0x6b, 0xf6, 0xe5, 0x27, 0x6a, 0x50, 0xad,
+    0xad, 0xca, 0xa4, 0x05, 0x0b, 0x8d, 0x65, 0xdf, 0xcb, 0xd9, 0x3b, 0x93, 0x5e, 0x41, 0x02, 0x68,
+    0x32, 0xe8, 0x10, 0xde, 0xbd, 0x33, 0xcb, 0x37, 0xdc, 0x96, 0xd2, 0x96, 0x49, 0x51, 0x95, 0x8b,
+    0x38, 0x76, 0x1c, 0xe7, 0x81, 0x60, 0xe5, 0x30, 0x20, 0x66, 0xf0, 0x83, 0xd8, 0x83, 0xf5, 0x84,
+    0x50, 0x54, 0xbe, 0x57, 0x6e, 0x11, 0xef, 0x21, 0x6e, 0xf7, 0x08, 0x88, 0x8c, 0x7e, 0x5a, 0x71,
+    0xea, 0xfc, 0xf6, 0xb7, 0x77, 0xaf, 0xcf, 0xc1, 0xdf, 0xc0, 0x3c, 0x26, 0x7e, 0x60, 0x6e, 0x4f,
+    0xda, 0x1b, 0xb7, 0xe1, 0xc2, 0x66, 0xd8, 0x59, 0x0e, 0x31, 0x05, 0x8b, 0x13, 0x1b, 0x12, 0xff,
+    0x05, 0x94, 0x2d, 0x33, 0x6e, 0x4f, 0xa9, 0x28, 0x8e, 0x89, 0x38, 0xfa, 0xdf, 0xbf, 0xff, 0xf5,
+    0xdf, 0x7e, 0xc1, 0x85, 0xcb, 0xb7, 0x6b, 0x55, 0x1f, 0xf3, 0xfc, 0x5e, 0x84, 0x1f, 0x93, 0xee,
+    0x10, 0xdf, 0xe5, 0xd1, 0x10, 0xae, 0xf9, 0x3f, 0xdb, 0x57, 0x1f, 0x80, 0x8a, 0x19, 0x00, 0x00,
+};
+static const char WS_API_WIFI_CONFIG_JS_ETAG[] PROGMEM = "\"b594c46b50a8e09e\"";
+
+}
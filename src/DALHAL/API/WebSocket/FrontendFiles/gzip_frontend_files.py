@@ -0,0 +1,132 @@
+#
+#  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+#
+#  Copyright (C) 2026 Jannik Svensson
+#  Licensed under the GNU General Public License v3 or later, see LICENSE.
+#
+#  Generates the precompressed frontend headers in Files/gzip/ from the
+#  rawliteral sources in Files/ that are included by DALHAL_FileList.cpp.
+#
+#  Each generated header contains
+#    <NAME>_GZ[]   PROGMEM gzip data (deterministic, mtime = 0)
+#    <NAME>_ETAG[] PROGMEM strong ETag derived from the uncompressed content
+#
+#  Runs as a PlatformIO pre script (see [env] in platformio.ini) and can also
+#  be run standalone:  python gzip_frontend_files.py
+#  Headers are only rewritten when their content changes so incremental
+#  builds are not triggered needlessly.
+#
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+try:
+    Import("env")  # noqa: F821 (defined when run by PlatformIO/SCons)
+    BASE_DIR = os.path.join(env.subst("$PROJECT_DIR"), "src", "DALHAL", "API", "WebSocket", "FrontendFiles")  # noqa: F821
+except NameError:
+    BASE_DIR = os.path.dirname(os.path.abspath(__file__))
+
+FILES_DIR = os.path.join(BASE_DIR, "Files")
+OUT_DIR = os.path.join(FILES_DIR, "gzip")
+FILE_LIST_CPP = os.path.join(BASE_DIR, "DALHAL_FileList.cpp")
+
+INCLUDE_RE = re.compile(r'^\s*#include\s+"Files/([^"/]+\.h)"', re.MULTILINE)
+RAWLITERAL_RE = re.compile(
+    r'static\s+const\s+uint8_t\s+(\w+)\[\]\s+PROGMEM\s*=\s*R"rawliteral\((.*?)\)rawliteral"\s*;',
+    re.DOTALL)
+
+HEADER = """/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// generated by gzip_frontend_files.py from Files/{source}, do not edit
+
+#pragma once
+
+#include "stdint.h"
+#include <pgmspace.h>
+
+namespace DALHAL {{
+
+// {plainSize} bytes uncompressed, {gzSize} bytes gzip
+static const uint8_t {name}_GZ[] PROGMEM = {{
+{data}
+}};
+static const char {name}_ETAG[] PROGMEM = "\\"{etag}\\"";
+
+}}
+"""
+
+
+def source_files():
+    with open(FILE_LIST_CPP, "r", encoding="utf-8") as f:
+        return INCLUDE_RE.findall(f.read())
+
+
+def format_bytes(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def generate(source):
+    with open(os.path.join(FILES_DIR, source), "r", encoding="utf-8") as f:
+        text = f.read()
+    match = RAWLITERAL_RE.search(text)
+    if match is None:
+        print("gzip_frontend_files: no rawliteral found in %s, skipped" % source)
+        return None
+    name = match.group(1)
+    # the compiler sees the raw literal with normalized line endings
+    plain = match.group(2).replace("\r\n", "\n").encode("utf-8")
+    gz = gzip.compress(plain, compresslevel=9, mtime=0)
+    etag = hashlib.sha1(plain).hexdigest()[:16]
+
+    out = HEADER.format(source=source, name=name, plainSize=len(plain), gzSize=len(gz),
+                        data=format_bytes(gz), etag=etag)
+    outName = os.path.splitext(source)[0] + "_gz.h"
+    outPath = os.path.join(OUT_DIR, outName)
+    if os.path.exists(outPath):
+        with open(outPath, "r", encoding="utf-8") as f:
+            if f.read() == out:
+                return outName
+    with open(outPath, "w", encoding="utf-8", newline="\n") as f:
+        f.write(out)
+    print("gzip_frontend_files: %s %d -> %d bytes" % (outName, len(plain), len(gz)))
+    return outName
+
+
+def main():
+    os.makedirs(OUT_DIR, exist_ok=True)
+    for source in source_files():
+        generate(source)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
+else:
+    main()
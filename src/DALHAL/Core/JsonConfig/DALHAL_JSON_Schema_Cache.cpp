@@ -0,0 +1,198 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DALHAL_JSON_Schema_Cache.h"
+#include "DALHAL_JSON_Schema_ToJsonString.h"
+
+#include <DALHAL/API/DALHAL_StringBuilderStreamer.h>
+#include <DALHAL/Support/DALHAL_Logger.h>
+#include <DALHAL/Support/DALHAL_GzipWriter.h>
+
+#if defined(ESP32) || defined(ESP8266)
+#include <Support/LittleFS_ext.h>
+#else
+#include <LittleFS_ext.h>
+#endif
+
+#include <BUILD_INFO.h>
+
+#include <cstring>
+#include <cstdio>
+
+#define DALHAL_JSON_SCHEMA_CACHE_READ_CHUNK_SIZE 256
+
+namespace DALHAL {
+
+    namespace JsonSchema {
+
+        namespace Cache {
+
+            static char etag[12] = {0}; // "xxxxxxxx" + null
+            static char gzipEtag[15] = {0}; // "xxxxxxxx-gz" + null
+            static bool ready = false;
+            /** true when the gz file is the compressed form of the cached file */
+            static bool gzipValid = false;
+
+            static uint32_t fnv1a(uint32_t hash, const char* str) {
+                while (*str) {
+                    hash ^= (uint8_t)*str++;
+                    hash *= 16777619UL;
+                }
+                return hash;
+            }
+
+            const char* GetETag() {
+                if (etag[0] != '\0') return etag;
+
+                uint32_t hash = fnv1a(2166136261UL, BUILD_VER_STR);
+#if defined(ESP32) || defined(ESP8266)
+                // md5 of the running image, the only id that is guaranteed to change with every build
+                hash = fnv1a(hash, ESP.getSketchMD5().c_str());
+#else
+                hash = fnv1a(hash, __DATE__ " " __TIME__);
+#endif
+                snprintf(etag, sizeof(etag), "\"%08lx\"", (unsigned long)hash);
+                return etag;
+            }
+
+            static bool IdFileMatches() {
+                char* stored = nullptr;
+                size_t size = 0;
+                if (LittleFS_ext::load_text_file(DALHAL_JSON_SCHEMA_CACHE_ID_FILE, &stored, &size) != LittleFS_ext::FileResult::Success) {
+                    return false;
+                }
+                const char* id = GetETag();
+                const size_t idLen = strlen(id);
+                const bool match = strncmp(stored, id, idLen) == 0 && (stored[idLen] == '\0' || stored[idLen] == ' ');
+                gzipValid = match && strcmp(stored + idLen, " gz") == 0;
+                delete[] stored;
+                return match;
+            }
+
+            static bool Render(const Registry::DeviceRegistry& reg) {
+                LittleFS_ext::FileWriter writer;
+                if (writer.open(DALHAL_JSON_SCHEMA_CACHE_FILE ".part") != LittleFS_ext::FileResult::Success) {
+                    GlobalLogger.Error(F("schema cache - could not create:"), DALHAL_JSON_SCHEMA_CACHE_FILE ".part");
+                    return false;
+                }
+                // compressed in the same pass, a failure there only means the schema is served uncompressed
+                LittleFS_ext::FileWriter gzWriter;
+                GzipWriter gzip;
+                bool gzOk = gzWriter.open(DALHAL_JSON_SCHEMA_CACHE_GZ_FILE ".part") == LittleFS_ext::FileResult::Success &&
+                            gzip.begin([&gzWriter](const uint8_t* data, size_t len) -> bool { return gzWriter.write(data, len); });
+                bool ok = true;
+                {
+                    StringBuilderStreamer sbs(nullptr, [&writer, &ok, &gzip, &gzOk](const char* buf, size_t len) -> bool {
+                        if (ok) ok = writer.write((const uint8_t*)buf, len);
+                        if (gzOk) gzOk = gzip.write((const uint8_t*)buf, len);
+                        return ok;
+                    });
+                    ToJsonString::buildCompleteJsonSchemasStartingFrom(reg, sbs);
+                    sbs.flush();
+                }
+                writer.close();
+                if (gzOk) gzOk = gzip.finish();
+                gzWriter.close();
+
+                if (ok == false || LittleFS_ext::rename_file(DALHAL_JSON_SCHEMA_CACHE_FILE ".part", DALHAL_JSON_SCHEMA_CACHE_FILE) == false) {
+                    GlobalLogger.Error(F("schema cache - could not write:"), DALHAL_JSON_SCHEMA_CACHE_FILE);
+                    LittleFS_ext::remove_file(DALHAL_JSON_SCHEMA_CACHE_FILE ".part");
+                    LittleFS_ext::remove_file(DALHAL_JSON_SCHEMA_CACHE_GZ_FILE ".part");
+                    return false;
+                }
+                gzipValid = gzOk && LittleFS_ext::rename_file(DALHAL_JSON_SCHEMA_CACHE_GZ_FILE ".part", DALHAL_JSON_SCHEMA_CACHE_GZ_FILE);
+                if (gzipValid == false) {
+                    GlobalLogger.Warn(F("schema cache - could not compress, serving uncompressed"));
+                    LittleFS_ext::remove_file(DALHAL_JSON_SCHEMA_CACHE_GZ_FILE ".part");
+                    LittleFS_ext::remove_file(DALHAL_JSON_SCHEMA_CACHE_GZ_FILE);
+                }
+                // the id is written last so that a interrupted render is never taken as valid
+                if (writer.open(DALHAL_JSON_SCHEMA_CACHE_ID_FILE) != LittleFS_ext::FileResult::Success ||
+                    writer.write((const uint8_t*)GetETag(), strlen(GetETag())) == false ||
+                    (gzipValid && writer.write((const uint8_t*)" gz", 3) == false)) {
+                    GlobalLogger.Error(F("schema cache - could not write:"), DALHAL_JSON_SCHEMA_CACHE_ID_FILE);
+                    return false;
+                }
+                writer.close();
+                return true;
+            }
+
+            bool Ensure(const Registry::DeviceRegistry& reg) {
+#if DALHAL_JSON_SCHEMA_CACHE
+                if (ready) return true;
+                if (IdFileMatches() && LittleFS_ext::getFileSize(DALHAL_JSON_SCHEMA_CACHE_FILE) > 0) {
+                    if (gzipValid && LittleFS_ext::getFileSize(DALHAL_JSON_SCHEMA_CACHE_GZ_FILE) <= 0) gzipValid = false;
+                    ready = true;
+                    return true;
+                }
+                ready = Render(reg);
+                return ready;
+#else
+                (void)reg;
+                return false;
+#endif
+            }
+
+            bool IsReady() {
+                return ready;
+            }
+
+            bool StreamTo(StringBuilderStreamer& sbs) {
+                LittleFS_ext::TextFileReader reader;
+                if (reader.open(DALHAL_JSON_SCHEMA_CACHE_FILE) != LittleFS_ext::FileResult::Success) {
+                    // someone removed it behind our back
+                    ready = false;
+                    return false;
+                }
+                char buf[DALHAL_JSON_SCHEMA_CACHE_READ_CHUNK_SIZE];
+                size_t count;
+                while ((count = reader.read(buf, sizeof(buf))) > 0) {
+                    sbs.write(buf, count);
+                }
+                return true;
+            }
+
+            bool HasGzip() {
+                return ready && gzipValid;
+            }
+
+            const char* GetGzipETag() {
+                if (gzipEtag[0] != '\0') return gzipEtag;
+                // same build id, a different representation needs a different strong ETag
+                const char* id = GetETag();
+                snprintf(gzipEtag, sizeof(gzipEtag), "%.*s-gz\"", (int)strlen(id) - 1, id);
+                return gzipEtag;
+            }
+
+            void Invalidate() {
+                ready = false;
+                gzipValid = false;
+                LittleFS_ext::remove_file(DALHAL_JSON_SCHEMA_CACHE_ID_FILE);
+                LittleFS_ext::remove_file(DALHAL_JSON_SCHEMA_CACHE_FILE);
+                LittleFS_ext::remove_file(DALHAL_JSON_SCHEMA_CACHE_GZ_FILE);
+            }
+
+        }
+
+    }
+}
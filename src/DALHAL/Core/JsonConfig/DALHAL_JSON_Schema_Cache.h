@@ -0,0 +1,90 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <DALHAL/Core/Types/DALHAL_Registry.h>
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef DALHAL_JSON_SCHEMA_CACHE
+#if defined(ESP8266) || defined(ESP32)
+/** render the config json schema once per firmware build into LittleFS, 0 = always render live (development) */
+#define DALHAL_JSON_SCHEMA_CACHE 1
+#else
+#define DALHAL_JSON_SCHEMA_CACHE 0
+#endif
+#endif
+
+#if defined(_WIN32) || defined(__linux__) || defined(__APPLE__)
+// no leading / as the program runs from the folder that acts as the fs root
+#define DALHAL_JSON_SCHEMA_CACHE_FILE      "cfgschema.cache.json"
+#define DALHAL_JSON_SCHEMA_CACHE_GZ_FILE   "cfgschema.cache.json.gz"
+#define DALHAL_JSON_SCHEMA_CACHE_ID_FILE   "cfgschema.cache.id"
+#else
+#define DALHAL_JSON_SCHEMA_CACHE_FILE      "/cfgschema.cache.json"
+/** the same schema compressed while it was rendered */
+#define DALHAL_JSON_SCHEMA_CACHE_GZ_FILE   "/cfgschema.cache.json.gz"
+/** holds the ETag of the build that rendered DALHAL_JSON_SCHEMA_CACHE_FILE, followed by " gz" when DALHAL_JSON_SCHEMA_CACHE_GZ_FILE was written too */
+#define DALHAL_JSON_SCHEMA_CACHE_ID_FILE   "/cfgschema.cache.id"
+#endif
+
+namespace DALHAL {
+
+    class StringBuilderStreamer;
+
+    namespace JsonSchema {
+
+        /**
+         * The complete config json schema only depends on the firmware,
+         * so it's rendered once into LittleFS and then streamed from there.
+         * The cache is keyed by the firmware build id and the same key is used as ETag.
+         */
+        namespace Cache {
+
+            /** quoted strong ETag derived from the firmware build id, valid also when the cache is disabled */
+            const char* GetETag();
+
+            /** true when the cache file belongs to this build, renders it first when needed */
+            bool Ensure(const Registry::DeviceRegistry& reg);
+
+            /** true when a previous Ensure succeeded, cheap enough to call from any context */
+            bool IsReady();
+
+            /** streams the cached schema, returns false if the cache could not be read */
+            bool StreamTo(StringBuilderStreamer& sbs);
+
+            /** true when DALHAL_JSON_SCHEMA_CACHE_GZ_FILE holds the gzip of the cached schema */
+            bool HasGzip();
+
+            /** quoted strong ETag of the gzip variant */
+            const char* GetGzipETag();
+
+            /** removes the cache files, the next Ensure renders them again */
+            void Invalidate();
+
+        }
+
+    }
+}
@@ -111,6 +111,10 @@ namespace DALHAL {
                 GlobalLogger.Error(F("schema error - could not find schema type @ GetValue"));
                 return 0;
             }
+            if (regDefItem.define->GetValue == nullptr) {
+                GlobalLogger.Error(F("schema error - schema type do not support GetValue @ "), stb.name);
+                return 0;
+            }
             return regDefItem.define->GetValue(stb, jsonObj);
         }
 
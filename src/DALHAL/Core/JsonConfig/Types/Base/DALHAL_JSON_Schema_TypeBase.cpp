@@ -36,10 +36,60 @@ namespace DALHAL {
 
     namespace JsonSchema {
 
+        const SchemaTypeBase* SchemaTypeBase::knownPresent = nullptr;
+
         HALValue SchemaTypeBase::ExtractViaRegistryFrom(const JsonVariant& jsonObj) const {
             return JsonSchema::GetValue(*this, jsonObj);
         }
 
+        void SchemaTypeBase::ApplyToStruct(const SchemaTypeBase& fieldSchema, const HALValue& val, void* outStruct) {
+            if (fieldSchema.HasStructOffset() == false) {
+                return; // extracted by a hand written extractor
+            }
+            uint8_t* base = static_cast<uint8_t*>(outStruct);
+            void* target = base + fieldSchema.structOffset;
+
+            // write the declared member type, the field constructors only accept
+            // a StructMember of that type so the width always matches the member
+            const HALValue::Type valType = val.getType();
+            const bool isNumber = valType == HALValue::Type::UINT || valType == HALValue::Type::INT ||
+                                  valType == HALValue::Type::FLOAT || valType == HALValue::Type::BOOL;
+            switch (fieldSchema.structMemberType) {
+                case StructMemberType::UInt32:
+                    if (isNumber == false) break;
+                    *static_cast<uint32_t*>(target) = val.toUInt();
+                    return;
+
+                case StructMemberType::Int32:
+                    if (isNumber == false) break;
+                    *static_cast<int32_t*>(target) = val.toInt();
+                    return;
+
+                case StructMemberType::Float:
+                    if (isNumber == false) break;
+                    *static_cast<float*>(target) = val.toFloat();
+                    return;
+
+                case StructMemberType::Bool:
+                    if (isNumber == false) break;
+                    *static_cast<bool*>(target) = val.toBool();
+                    return;
+
+                case StructMemberType::CString:
+                    if (valType != HALValue::Type::CSTRING) break;
+                    *static_cast<const char**>(target) = val.asRawConstChar();
+                    return;
+
+                case StructMemberType::Value:
+                    *static_cast<HALValue*>(target) = val;
+                    return;
+
+                default:
+                    break;
+            }
+            GlobalLogger.Error(F("value not convertible to the struct member type in ApplyToStruct @ "), fieldSchema.name);
+        }
+
         bool SchemaTypeBase::ValidateSchemaNameNotNull(const SchemaTypeBase& fieldSchema, const char* sourceObjTypeName) {
             if (fieldSchema.name == nullptr) {
                 GlobalLogger.Error(F("invalid schema field - name cannot be nullptr @ "), sourceObjTypeName);
@@ -48,15 +98,22 @@ namespace DALHAL {
             return true;
         }
 
+        void SchemaTypeBase::ReportRequiredFieldMissing(const SchemaTypeBase& fieldSchema, const char* sourceObjTypeName, const JsonVariant& jsonObj) {
+            std::string errMsg = fieldSchema.name; 
+            errMsg += " @ "; errMsg += '['; errMsg += sourceObjTypeName; errMsg += ']';
+            errMsg += ' ';
+            serializeCollapsed(jsonObj, errMsg);
+            GlobalLogger.Error(F("Required field missing: "), errMsg.c_str());
+        }
+
         ValidatorResult SchemaTypeBase::ValidateFieldPresenceAndPolicy(const SchemaTypeBase& fieldSchema, const char* sourceObjTypeName, const JsonVariant& jsonObj, bool& anyError) {
+            if (knownPresent == &fieldSchema) {
+                knownPresent = nullptr;
+                return ValidatorResult::Success;
+            }
             bool exists = jsonObj.containsKey(fieldSchema.name);
             if ((exists == false) && (fieldSchema.policy == FieldPolicy::Required)) {
-                std::string errMsg = fieldSchema.name; 
-                errMsg += " @ "; errMsg += '['; errMsg += sourceObjTypeName; errMsg += ']';
-                errMsg += ' ';
-                serializeCollapsed(jsonObj, errMsg);
-                GlobalLogger.Error(F("Required field missing: "), errMsg.c_str());
-                
+                ReportRequiredFieldMissing(fieldSchema, sourceObjTypeName, jsonObj);
                 anyError = true;
                 return ValidatorResult::RequiredFieldMissing;
             }
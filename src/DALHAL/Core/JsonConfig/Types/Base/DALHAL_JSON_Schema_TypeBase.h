@@ -23,9 +23,11 @@
 
 #pragma once
 
+#include <cstddef> // offsetof
 #include <cstdint>
 #include <cstring>
 #include <string>
+#include <type_traits>
 
 #include <ArduinoJson.h>
 
@@ -47,33 +49,91 @@ namespace DALHAL {
             ByReference
         };
 
+        struct JsonObjectSchema; // forward declaration
+
+        /** the member type a field is written as by JsonObjectSchema::ExtractToStruct */
+        enum class StructMemberType : uint8_t {
+            None,
+            UInt32,
+            Int32,
+            Float,
+            Bool,
+            CString,
+            /** the converted HALValue as is */
+            Value,
+            /** a nested struct, only used by groups, the offsets of the group fields are relative to it */
+            Struct
+        };
+
+        template<typename T> struct StructMemberTypeOf {
+            static_assert(std::is_class<T>::value, "unsupported struct member type, use uint32_t, int32_t, float, bool, const char*, HALValue or a nested struct");
+            static constexpr StructMemberType value = StructMemberType::Struct;
+        };
+        template<> struct StructMemberTypeOf<uint32_t> { static constexpr StructMemberType value = StructMemberType::UInt32; };
+        template<> struct StructMemberTypeOf<int32_t> { static constexpr StructMemberType value = StructMemberType::Int32; };
+        template<> struct StructMemberTypeOf<float> { static constexpr StructMemberType value = StructMemberType::Float; };
+        template<> struct StructMemberTypeOf<bool> { static constexpr StructMemberType value = StructMemberType::Bool; };
+        template<> struct StructMemberTypeOf<const char*> { static constexpr StructMemberType value = StructMemberType::CString; };
+        template<> struct StructMemberTypeOf<HALValue> { static constexpr StructMemberType value = StructMemberType::Value; };
+
+        /**
+         * typed struct member target of a field, create it with DALHAL_JSON_SCHEMA_MEMBER,
+         * each field type only takes the member type it writes (SchemaUInt a uint32_t and so on)
+         * so a mismatching member is a compile error instead of a write of the wrong width
+         */
+        template<typename T>
+        struct StructMember {
+            size_t offset;
+        };
+
+/** struct member target for the field constructors, i.e. DALHAL_JSON_SCHEMA_MEMBER(Config, debounceMs) */
+#define DALHAL_JSON_SCHEMA_MEMBER(StructType, member) \
+    ::DALHAL::JsonSchema::StructMember<decltype(StructType::member)>{ offsetof(StructType, member) }
+
         struct SchemaTypeBase {
+            friend struct JsonObjectSchema; // uses the presence helpers for the fields it already looked up
+
+            /** structOffset value of fields that are not extracted by JsonObjectSchema::ExtractToStruct */
+            static constexpr size_t NoStructOffset = static_cast<size_t>(-1);
+
             const char* name;
             FieldType type;
             FieldPolicy policy;
             FieldGuiFlagsType guiFlags;
             size_t structOffset;
+            StructMemberType structMemberType;
 
         protected:
             static bool ValidateSchemaNameNotNull(const SchemaTypeBase& fieldSchema, const char* sourceObjTypeName); 
             static ValidatorResult ValidateFieldPresenceAndPolicy(const SchemaTypeBase& fieldSchema, const char* sourceObjTypeName, const JsonVariant& jsonObj, bool& anyError);
+            static void ReportRequiredFieldMissing(const SchemaTypeBase& fieldSchema, const char* sourceObjTypeName, const JsonVariant& jsonObj);
+            /**
+             * set by JsonObjectSchema::ValidateJson right before validating a field it already knows is present,
+             * ValidateFieldPresenceAndPolicy then skips its own lookup (and clears it)
+             */
+            static const SchemaTypeBase* knownPresent;
             static void SchemaToJson(const SchemaTypeBase& fieldSchema, StringBuilderStreamer& sbs, SchemaEmitMode mode);
         public:
             /** special note about using this, it do internally dispatch to the correct type using the JsonSchema type registry */
             HALValue ExtractViaRegistryFrom(const JsonVariant& jsonObj) const;
+            /** converts val to the declared member type and writes it to outStruct + structOffset */
+            static void ApplyToStruct(const SchemaTypeBase& fieldSchema, const HALValue& val, void* outStruct);
+            constexpr bool HasStructOffset() const { return structOffset != NoStructOffset; }
         
         protected:
             constexpr SchemaTypeBase(const char* n, FieldType t, FieldPolicy policy)
-                : name(n), type(t), policy(policy), guiFlags(Gui::None), structOffset(0) {}
+                : name(n), type(t), policy(policy), guiFlags(Gui::None), structOffset(NoStructOffset), structMemberType(StructMemberType::None) {}
 
             constexpr SchemaTypeBase(const char* n, FieldType t, FieldPolicy policy, FieldGuiFlagsType guiFlags)
-                : name(n), type(t), policy(policy), guiFlags(guiFlags), structOffset(0) {}
+                : name(n), type(t), policy(policy), guiFlags(guiFlags), structOffset(NoStructOffset), structMemberType(StructMemberType::None) {}
 
-            constexpr SchemaTypeBase(const char* n, FieldType t, FieldPolicy policy, size_t structOffset)
-                : name(n), type(t), policy(policy), guiFlags(Gui::None), structOffset(structOffset) {}
+            template<typename T>
+            constexpr SchemaTypeBase(const char* n, FieldType t, FieldPolicy policy, StructMember<T> member)
+                : name(n), type(t), policy(policy), guiFlags(Gui::None), structOffset(member.offset), structMemberType(StructMemberTypeOf<T>::value) {}
 
-            constexpr SchemaTypeBase(const char* n, FieldType t, FieldPolicy policy, FieldGuiFlagsType guiFlags, size_t structOffset)
-                : name(n), type(t), policy(policy), guiFlags(guiFlags), structOffset(structOffset) {}
+            template<typename T>
+            constexpr SchemaTypeBase(const char* n, FieldType t, FieldPolicy policy, FieldGuiFlagsType guiFlags, StructMember<T> member)
+                : name(n), type(t), policy(policy), guiFlags(guiFlags), structOffset(member.offset), structMemberType(StructMemberTypeOf<T>::value) {}
         };
 
     }
@@ -57,8 +57,8 @@ namespace DALHAL {
             constexpr SchemaHardwarePin(const char* name, FieldPolicy policy, DALHAL_GPIO_MGR_PINFUNC_TYPE mode)
                 : SchemaTypeBase(name, FieldType::HardwarePin, policy), mode(mode) {}
 
-            constexpr SchemaHardwarePin(const char* name, FieldPolicy policy, DALHAL_GPIO_MGR_PINFUNC_TYPE mode, size_t structOffset)
-                : SchemaTypeBase(name, FieldType::HardwarePin, policy, structOffset), mode(mode) {}
+            constexpr SchemaHardwarePin(const char* name, FieldPolicy policy, DALHAL_GPIO_MGR_PINFUNC_TYPE mode, StructMember<int32_t> member)
+                : SchemaTypeBase(name, FieldType::HardwarePin, policy, member), mode(mode) {}
                 
         };
 
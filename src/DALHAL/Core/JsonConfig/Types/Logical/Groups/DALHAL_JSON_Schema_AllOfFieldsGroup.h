@@ -55,6 +55,10 @@ namespace DALHAL {
                 : SchemaFieldsGroup(outputName, FieldType::AllOfFieldsGroup, policy, fields) {}
             constexpr SchemaAllOfFieldsGroup(const char* outputName, FieldPolicy policy, FieldGuiFlagsType guiFlags, const SchemaTypeBase* const* fields)
                 : SchemaFieldsGroup(outputName, FieldType::AllOfFieldsGroup, policy, fields, guiFlags) {}
+            /** the offsets of the group fields are relative to the nested struct member */
+            template<typename T>
+            constexpr SchemaAllOfFieldsGroup(const char* outputName, FieldPolicy policy, const SchemaTypeBase* const* fields, StructMember<T> member)
+                : SchemaFieldsGroup(outputName, FieldType::AllOfFieldsGroup, policy, fields, member) {}
         };
 
     } // namespace JsonSchema
@@ -64,12 +64,21 @@ namespace DALHAL {
             constexpr SchemaFieldsGroup(const char* n, FieldType t, FieldPolicy policy, const SchemaTypeBase* const* fields, FieldGuiFlagsType guiFlags/*, size_t fieldsCount*/)
                 : SchemaTypeBase(n, t, policy, guiFlags), fields(fields)/*, fieldsCount(fieldsCount)*/ {}
 
+            template<typename T>
+            constexpr SchemaFieldsGroup(const char* n, FieldType t, FieldPolicy policy, const SchemaTypeBase* const* fields, StructMember<T> member)
+                : SchemaTypeBase(n, t, policy, member), fields(fields) {}
+
         public:
             constexpr SchemaFieldsGroup(const char* n, const SchemaTypeBase* const* fields/*, size_t fieldsCount*/)
                 : SchemaTypeBase(n, FieldType::FieldsGroup, FieldPolicy::FieldsGroup), fields(fields)/*, fieldsCount(fieldsCount)*/ {}
 
             constexpr SchemaFieldsGroup(const char* n, const SchemaTypeBase* const* fields, FieldGuiFlagsType guiFlags/*, size_t fieldsCount*/)
                 : SchemaTypeBase(n, FieldType::FieldsGroup, FieldPolicy::FieldsGroup, guiFlags), fields(fields)/*, fieldsCount(fieldsCount)*/ {}
+
+            /** the offsets of the group fields are relative to the nested struct member */
+            template<typename T>
+            constexpr SchemaFieldsGroup(const char* n, const SchemaTypeBase* const* fields, StructMember<T> member)
+                : SchemaTypeBase(n, FieldType::FieldsGroup, FieldPolicy::FieldsGroup, member), fields(fields) {}
         };
 
     } // namespace JsonSchema
@@ -67,6 +67,14 @@ namespace DALHAL {
                 : SchemaFieldsGroup(outputName, FieldType::OneOfFieldsGroup, policy, fields), defaultValueField(defaultValueField) {}
             constexpr SchemaOneOfFieldsGroup(const char* outputName, FieldPolicy policy, FieldGuiFlagsType guiFlags, const SchemaTypeBase* const* fields, const SchemaTypeBase* defaultValueField)
                 : SchemaFieldsGroup(outputName, FieldType::OneOfFieldsGroup, policy, fields, guiFlags), defaultValueField(defaultValueField) {}
+
+            /** 
+             * a struct typed member makes the present alternative be written relative to it,
+             * any other member type gets the value returned by GetValue
+             */
+            template<typename T>
+            constexpr SchemaOneOfFieldsGroup(const char* outputName, FieldPolicy policy, const SchemaTypeBase* const* fields, StructMember<T> member)
+                : SchemaFieldsGroup(outputName, FieldType::OneOfFieldsGroup, policy, fields, member), defaultValueField(nullptr) {}
         };
 
     } // namespace JsonSchema
@@ -70,8 +70,8 @@ namespace DALHAL {
             constexpr SchemaBool(const char* name, FieldPolicy policy, bool defaultValue)
                 : SchemaTypeBase(name, FieldType::Bool, policy), defaultValue(defaultValue) {}
 
-            constexpr SchemaBool(const char* name, FieldPolicy policy, bool defaultValue, size_t structOffset)
-                : SchemaTypeBase(name, FieldType::Bool, policy, structOffset), defaultValue(defaultValue) {}
+            constexpr SchemaBool(const char* name, FieldPolicy policy, bool defaultValue, StructMember<bool> member)
+                : SchemaTypeBase(name, FieldType::Bool, policy, member), defaultValue(defaultValue) {}
 
             
         };
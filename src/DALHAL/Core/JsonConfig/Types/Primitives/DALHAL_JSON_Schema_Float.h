@@ -58,8 +58,8 @@ namespace DALHAL {
             // used to define when minValue/maxValue are not defined
             
         protected:
-            constexpr SchemaFloat(const char* name, FieldType type, FieldPolicy policy, float minValue, float maxValue, float defaultValue, float conversionFactor, size_t structOffset)
-                : SchemaNumericBase(name, type, policy, conversionFactor, structOffset), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
+            constexpr SchemaFloat(const char* name, FieldType type, FieldPolicy policy, float minValue, float maxValue, float defaultValue, float conversionFactor, StructMember<float> member)
+                : SchemaNumericBase(name, type, policy, conversionFactor, member), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
         
         public:
             constexpr SchemaFloat(const char* name, FieldPolicy policy, float minValue, float maxValue, float defaultValue)
@@ -68,11 +68,11 @@ namespace DALHAL {
             constexpr SchemaFloat(const char* name, FieldPolicy policy, float defaultValue) 
                 : SchemaNumericBase(name, FieldType::Float, policy, 1.0f), minValue(NAN), maxValue(NAN), defaultValue(defaultValue) {}
 
-            constexpr SchemaFloat(const char* name, FieldPolicy policy, float minValue, float maxValue, float defaultValue, size_t structOffset)
-                : SchemaNumericBase(name, FieldType::Float, policy, 1.0f, structOffset), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
+            constexpr SchemaFloat(const char* name, FieldPolicy policy, float minValue, float maxValue, float defaultValue, StructMember<float> member)
+                : SchemaNumericBase(name, FieldType::Float, policy, 1.0f, member), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
 
-            constexpr SchemaFloat(const char* name, FieldPolicy policy, float defaultValue, size_t structOffset) 
-                : SchemaNumericBase(name, FieldType::Float, policy, 1.0f, structOffset), minValue(NAN), maxValue(NAN), defaultValue(defaultValue) {}  
+            constexpr SchemaFloat(const char* name, FieldPolicy policy, float defaultValue, StructMember<float> member) 
+                : SchemaNumericBase(name, FieldType::Float, policy, 1.0f, member), minValue(NAN), maxValue(NAN), defaultValue(defaultValue) {}  
             // using conversionFactor
             constexpr SchemaFloat(const char* name, FieldPolicy policy, float minValue, float maxValue, float defaultValue, float conversionFactor)
                 : SchemaNumericBase(name, FieldType::Float, policy, conversionFactor), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
@@ -80,11 +80,11 @@ namespace DALHAL {
             constexpr SchemaFloat(const char* name, FieldPolicy policy, float defaultValue, float conversionFactor) 
                 : SchemaNumericBase(name, FieldType::Float, policy, conversionFactor), minValue(NAN), maxValue(NAN), defaultValue(defaultValue) {}
 
-            constexpr SchemaFloat(const char* name, FieldPolicy policy, float minValue, float maxValue, float defaultValue, float conversionFactor, size_t structOffset)
-                : SchemaNumericBase(name, FieldType::Float, policy, conversionFactor, structOffset), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
+            constexpr SchemaFloat(const char* name, FieldPolicy policy, float minValue, float maxValue, float defaultValue, float conversionFactor, StructMember<float> member)
+                : SchemaNumericBase(name, FieldType::Float, policy, conversionFactor, member), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
 
-            constexpr SchemaFloat(const char* name, FieldPolicy policy, float defaultValue, float conversionFactor, size_t structOffset) 
-                : SchemaNumericBase(name, FieldType::Float, policy, conversionFactor, structOffset), minValue(NAN), maxValue(NAN), defaultValue(defaultValue) {}
+            constexpr SchemaFloat(const char* name, FieldPolicy policy, float defaultValue, float conversionFactor, StructMember<float> member) 
+                : SchemaNumericBase(name, FieldType::Float, policy, conversionFactor, member), minValue(NAN), maxValue(NAN), defaultValue(defaultValue) {}
         
         };
 
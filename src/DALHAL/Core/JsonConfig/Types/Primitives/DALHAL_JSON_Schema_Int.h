@@ -57,8 +57,8 @@ namespace DALHAL {
             int32_t defaultValue;
 
         protected:
-            constexpr SchemaInt(const char* name, FieldType type, FieldPolicy policy, int32_t minValue, int32_t maxValue, int32_t defaultValue, float conversionFactor, size_t structOffset)
-                : SchemaNumericBase(name, type, policy, conversionFactor, structOffset), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
+            constexpr SchemaInt(const char* name, FieldType type, FieldPolicy policy, int32_t minValue, int32_t maxValue, int32_t defaultValue, float conversionFactor, StructMember<int32_t> member)
+                : SchemaNumericBase(name, type, policy, conversionFactor, member), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
         
         public:
             constexpr SchemaInt(const char* name, FieldPolicy policy, int32_t defaultValue) 
@@ -66,10 +66,10 @@ namespace DALHAL {
             constexpr SchemaInt(const char* name, FieldPolicy policy, int32_t minValue, int32_t maxValue, int32_t defaultValue)
                 : SchemaNumericBase(name, FieldType::Int, policy, 1.0f), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
 
-            constexpr SchemaInt(const char* name, FieldPolicy policy, int32_t defaultValue, size_t structOffset) 
-                : SchemaNumericBase(name, FieldType::Int, policy, 1.0f, structOffset), minValue(-2147483648), maxValue(0), defaultValue(defaultValue) {}
-            constexpr SchemaInt(const char* name, FieldPolicy policy, int32_t minValue, int32_t maxValue, int32_t defaultValue, size_t structOffset)
-                : SchemaNumericBase(name, FieldType::Int, policy, 1.0f, structOffset), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
+            constexpr SchemaInt(const char* name, FieldPolicy policy, int32_t defaultValue, StructMember<int32_t> member) 
+                : SchemaNumericBase(name, FieldType::Int, policy, 1.0f, member), minValue(-2147483648), maxValue(0), defaultValue(defaultValue) {}
+            constexpr SchemaInt(const char* name, FieldPolicy policy, int32_t minValue, int32_t maxValue, int32_t defaultValue, StructMember<int32_t> member)
+                : SchemaNumericBase(name, FieldType::Int, policy, 1.0f, member), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
             
             // using conversionFactor
             constexpr SchemaInt(const char* name, FieldPolicy policy, int32_t defaultValue, float conversionFactor) 
@@ -77,10 +77,10 @@ namespace DALHAL {
             constexpr SchemaInt(const char* name, FieldPolicy policy, int32_t minValue, int32_t maxValue, int32_t defaultValue, float conversionFactor)
                 : SchemaNumericBase(name, FieldType::Int, policy, conversionFactor), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
 
-            constexpr SchemaInt(const char* name, FieldPolicy policy, int32_t defaultValue, float conversionFactor, size_t structOffset) 
-                : SchemaNumericBase(name, FieldType::Int, policy, conversionFactor, structOffset), minValue(-2147483648), maxValue(0), defaultValue(defaultValue) {}
-            constexpr SchemaInt(const char* name, FieldPolicy policy, int32_t minValue, int32_t maxValue, int32_t defaultValue, float conversionFactor, size_t structOffset)
-                : SchemaNumericBase(name, FieldType::Int, policy, conversionFactor, structOffset), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
+            constexpr SchemaInt(const char* name, FieldPolicy policy, int32_t defaultValue, float conversionFactor, StructMember<int32_t> member) 
+                : SchemaNumericBase(name, FieldType::Int, policy, conversionFactor, member), minValue(-2147483648), maxValue(0), defaultValue(defaultValue) {}
+            constexpr SchemaInt(const char* name, FieldPolicy policy, int32_t minValue, int32_t maxValue, int32_t defaultValue, float conversionFactor, StructMember<int32_t> member)
+                : SchemaNumericBase(name, FieldType::Int, policy, conversionFactor, member), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
         
         };
 
@@ -59,11 +59,11 @@ namespace DALHAL {
             constexpr SchemaNumber(const char* name, FieldPolicy policy, uint8_t primitiveTypeFlags) 
                 : SchemaTypeBase(name, FieldType::Number, policy), primitiveTypeFlags(primitiveTypeFlags) {}
 
-            constexpr SchemaNumber(const char* name, FieldPolicy policy, size_t structOffset) 
-                : SchemaTypeBase(name, FieldType::Number, policy, structOffset), primitiveTypeFlags(PrimitiveTypeFlags::AllowNumbers) {}
+            constexpr SchemaNumber(const char* name, FieldPolicy policy, StructMember<HALValue> member) 
+                : SchemaTypeBase(name, FieldType::Number, policy, member), primitiveTypeFlags(PrimitiveTypeFlags::AllowNumbers) {}
 
-            constexpr SchemaNumber(const char* name, FieldPolicy policy, uint8_t primitiveTypeFlags, size_t structOffset) 
-                : SchemaTypeBase(name, FieldType::Number, policy, structOffset), primitiveTypeFlags(primitiveTypeFlags) {}
+            constexpr SchemaNumber(const char* name, FieldPolicy policy, uint8_t primitiveTypeFlags, StructMember<HALValue> member) 
+                : SchemaTypeBase(name, FieldType::Number, policy, member), primitiveTypeFlags(primitiveTypeFlags) {}
                 
         };
 
@@ -47,8 +47,9 @@ namespace DALHAL {
         protected:
             constexpr SchemaNumericBase(const char* name, FieldType type, FieldPolicy policy, float conversionFactor)
                 : SchemaTypeBase(name, type, policy), conversionFactor(conversionFactor) {}
-            constexpr SchemaNumericBase(const char* name, FieldType type, FieldPolicy policy, float conversionFactor, size_t structOffset)
-                : SchemaTypeBase(name, type, policy, structOffset), conversionFactor(conversionFactor) {}
+            template<typename T>
+            constexpr SchemaNumericBase(const char* name, FieldType type, FieldPolicy policy, float conversionFactor, StructMember<T> member)
+                : SchemaTypeBase(name, type, policy, member), conversionFactor(conversionFactor) {}
         };
 
     }
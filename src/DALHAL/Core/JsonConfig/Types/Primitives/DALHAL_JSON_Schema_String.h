@@ -69,6 +69,9 @@ namespace DALHAL {
             constexpr SchemaString(const char* n, FieldPolicy pol, const char* defVal) 
                 : SchemaTypeBase(n, FieldType::String, pol), defaultValue(defVal) {}
 
+            constexpr SchemaString(const char* n, FieldPolicy pol, const char* defVal, StructMember<const char*> member) 
+                : SchemaTypeBase(n, FieldType::String, pol, member), defaultValue(defVal) {}
+
             constexpr SchemaString(const char* n, FieldPolicy pol, FieldGuiFlagsType guiFlags, const char* defVal) 
                 : SchemaTypeBase(n, FieldType::String, pol, guiFlags), defaultValue(defVal) {}
 
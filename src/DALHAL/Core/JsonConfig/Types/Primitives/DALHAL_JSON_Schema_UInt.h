@@ -57,8 +57,8 @@ namespace DALHAL {
             uint32_t defaultValue;
 
         protected:
-            constexpr SchemaUInt(const char* name, FieldType type, FieldPolicy policy, uint32_t minValue, uint32_t maxValue, uint32_t defaultValue, float conversionFactor, size_t structOffset)
-                : SchemaNumericBase(name, type, policy, conversionFactor, structOffset), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
+            constexpr SchemaUInt(const char* name, FieldType type, FieldPolicy policy, uint32_t minValue, uint32_t maxValue, uint32_t defaultValue, float conversionFactor, StructMember<uint32_t> member)
+                : SchemaNumericBase(name, type, policy, conversionFactor, member), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
         
         public:
             constexpr SchemaUInt(const char* name, FieldPolicy policy, uint32_t defaultValue) 
@@ -67,11 +67,11 @@ namespace DALHAL {
             constexpr SchemaUInt(const char* name, FieldPolicy policy, uint32_t minValue, uint32_t maxValue, uint32_t defaultValue)
                 : SchemaNumericBase(name, FieldType::UInt, policy, 1.0f), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
 
-            constexpr SchemaUInt(const char* name, FieldPolicy policy, uint32_t defaultValue, size_t structOffset) 
-                : SchemaNumericBase(name, FieldType::UInt, policy, 1.0f, structOffset), minValue(0), maxValue(0), defaultValue(defaultValue) {}
+            constexpr SchemaUInt(const char* name, FieldPolicy policy, uint32_t defaultValue, StructMember<uint32_t> member) 
+                : SchemaNumericBase(name, FieldType::UInt, policy, 1.0f, member), minValue(0), maxValue(0), defaultValue(defaultValue) {}
 
-            constexpr SchemaUInt(const char* name, FieldPolicy policy, uint32_t minValue, uint32_t maxValue, uint32_t defaultValue, size_t structOffset)
-                : SchemaNumericBase(name, FieldType::UInt, policy, 1.0f, structOffset), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
+            constexpr SchemaUInt(const char* name, FieldPolicy policy, uint32_t minValue, uint32_t maxValue, uint32_t defaultValue, StructMember<uint32_t> member)
+                : SchemaNumericBase(name, FieldType::UInt, policy, 1.0f, member), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
 
             // using conversionFactor
             constexpr SchemaUInt(const char* name, FieldPolicy policy, uint32_t defaultValue, float conversionFactor) 
@@ -80,11 +80,11 @@ namespace DALHAL {
             constexpr SchemaUInt(const char* name, FieldPolicy policy, uint32_t minValue, uint32_t maxValue, uint32_t defaultValue, float conversionFactor)
                 : SchemaNumericBase(name, FieldType::UInt, policy, conversionFactor), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
 
-            constexpr SchemaUInt(const char* name, FieldPolicy policy, uint32_t defaultValue, float conversionFactor, size_t structOffset) 
-                : SchemaNumericBase(name, FieldType::UInt, policy, conversionFactor, structOffset), minValue(0), maxValue(0), defaultValue(defaultValue) {}
+            constexpr SchemaUInt(const char* name, FieldPolicy policy, uint32_t defaultValue, float conversionFactor, StructMember<uint32_t> member) 
+                : SchemaNumericBase(name, FieldType::UInt, policy, conversionFactor, member), minValue(0), maxValue(0), defaultValue(defaultValue) {}
 
-            constexpr SchemaUInt(const char* name, FieldPolicy policy, uint32_t minValue, uint32_t maxValue, uint32_t defaultValue, float conversionFactor, size_t structOffset)
-                : SchemaNumericBase(name, FieldType::UInt, policy, conversionFactor, structOffset), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
+            constexpr SchemaUInt(const char* name, FieldPolicy policy, uint32_t minValue, uint32_t maxValue, uint32_t defaultValue, float conversionFactor, StructMember<uint32_t> member)
+                : SchemaNumericBase(name, FieldType::UInt, policy, conversionFactor, member), minValue(minValue), maxValue(maxValue), defaultValue(defaultValue) {}
         
         };
 
@@ -0,0 +1,165 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DALHAL_JSON_Schema_FieldIndex.h"
+
+#include <string.h>
+#include <algorithm>
+
+#include <DALHAL/Support/DALHAL_Logger.h>
+
+#include <DALHAL/Core/JsonConfig/Types/Root/DALHAL_JSON_Schema_JsonObjectSchema.h>
+#include <DALHAL/Core/JsonConfig/Types/Logical/Groups/DALHAL_JSON_Schema_FieldsGroup.h>
+
+namespace DALHAL {
+
+    namespace JsonSchema {
+
+        FieldIndex* FieldIndex::slots[DALHAL_JSON_SCHEMA_FIELD_INDEX_SLOTS] = {nullptr};
+
+        static bool IsGroup(const SchemaTypeBase* f) {
+            return f->type == FieldType::FieldsGroup || f->type == FieldType::AllOfFieldsGroup || f->type == FieldType::OneOfFieldsGroup;
+        }
+
+        /** AllOf/OneOf groups derive from SchemaFieldsGroup so all groups share the fields member */
+        static uint16_t CountFields(const SchemaTypeBase* const* fields) {
+            uint16_t count = 0;
+            for (int i = 0; fields[i] != nullptr; i++) {
+                const SchemaTypeBase* f = fields[i];
+                if (IsGroup(f)) {
+                    count += CountFields(static_cast<const SchemaFieldsGroup*>(f)->fields);
+                } else if (f->name != nullptr) {
+                    count++;
+                }
+            }
+            return count;
+        }
+
+        static void AddFields(const SchemaTypeBase* const* fields, bool topLevel, const char* typeName, FieldIndex::Entry* entries, uint16_t& count) {
+            for (int i = 0; fields[i] != nullptr; i++) {
+                const SchemaTypeBase* f = fields[i];
+                if (IsGroup(f)) {
+                    AddFields(static_cast<const SchemaFieldsGroup*>(f)->fields, false, typeName, entries, count);
+                    continue;
+                }
+                if (f->name == nullptr) {
+                    GlobalLogger.Warn(F("FieldIndex - field name == nullptr @ "), typeName);
+                    continue;
+                }
+                FieldIndex::Entry& e = entries[count++];
+                e.hash = FieldIndex::Hash(f->name);
+                e.name = f->name;
+                e.topLevel = (topLevel && i < 64) ? (uint8_t)i : FieldIndex::NotTopLevel;
+            }
+        }
+
+        uint32_t FieldIndex::Hash(const char* key) {
+            uint32_t hash = 2166136261UL; // FNV-1a
+            while (*key) {
+                hash ^= (uint8_t)*key++;
+                hash *= 16777619UL;
+            }
+            return hash;
+        }
+
+        FieldIndex::~FieldIndex() {
+            delete[] entries;
+        }
+
+        FieldIndex* FieldIndex::Compile(const JsonObjectSchema* schema) {
+            FieldIndex* index = new FieldIndex();
+            if (index == nullptr) return nullptr;
+            index->schema = schema;
+
+            const uint16_t count = CountFields(schema->fields);
+            if (count > 0) {
+                index->entries = new Entry[count];
+                if (index->entries == nullptr) {
+                    delete index;
+                    return nullptr;
+                }
+                const char* typeName = (schema->typeName != nullptr) ? schema->typeName : "nullptr";
+                AddFields(schema->fields, true, typeName, index->entries, index->count);
+                std::sort(index->entries, index->entries + index->count, [](const Entry& a, const Entry& b) { return a.hash < b.hash; });
+            }
+            for (int i = 0; i < 64 && schema->fields[i] != nullptr; i++) {
+                const SchemaTypeBase* f = schema->fields[i];
+                if (IsGroup(f) || f->name == nullptr) continue;
+                index->indexedMask |= (uint64_t)1 << i;
+                if (f->policy == FieldPolicy::Required) index->requiredMask |= (uint64_t)1 << i;
+            }
+            return index;
+        }
+
+        const FieldIndex* FieldIndex::Get(const JsonObjectSchema* schema) {
+            if (schema == nullptr || schema->fields == nullptr) return nullptr;
+
+            // open addressing on the schema address, schemas are static so the address is a stable key
+            size_t slot = (size_t)(((uintptr_t)schema >> 2) % DALHAL_JSON_SCHEMA_FIELD_INDEX_SLOTS);
+            for (size_t probe = 0; probe < DALHAL_JSON_SCHEMA_FIELD_INDEX_SLOTS; probe++) {
+                FieldIndex*& entry = slots[slot];
+                if (entry == nullptr) {
+                    entry = Compile(schema);
+                    return entry;
+                }
+                if (entry->schema == schema) {
+                    return entry;
+                }
+                slot = (slot + 1) % DALHAL_JSON_SCHEMA_FIELD_INDEX_SLOTS;
+            }
+            return nullptr;
+        }
+
+        void FieldIndex::Clear() {
+            for (size_t i = 0; i < DALHAL_JSON_SCHEMA_FIELD_INDEX_SLOTS; i++) {
+                delete slots[i];
+                slots[i] = nullptr;
+            }
+        }
+
+        const FieldIndex::Entry* FieldIndex::Find(const char* key) const {
+            const uint32_t hash = Hash(key);
+            const Entry* it = std::lower_bound(entries, entries + count, hash, [](const Entry& e, uint32_t h) { return e.hash < h; });
+            for (; it != entries + count && it->hash == hash; ++it) {
+                if (strcmp(it->name, key) == 0) return it;
+            }
+            return nullptr;
+        }
+
+        uint64_t FieldIndex::TopLevelMask(const char* key, bool& known) const {
+            uint64_t mask = 0;
+            known = false;
+            const Entry* it = Find(key);
+            if (it == nullptr) return 0;
+            const uint32_t hash = it->hash;
+            for (; it != entries + count && it->hash == hash; ++it) {
+                if (strcmp(it->name, key) != 0) continue;
+                known = true;
+                if (it->topLevel != NotTopLevel) mask |= (uint64_t)1 << it->topLevel;
+            }
+            return mask;
+        }
+
+    }
+
+}
@@ -0,0 +1,97 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef DALHAL_JSON_SCHEMA_FIELD_INDEX_SLOTS
+/** max number of JsonObjectSchema that can have a compiled index at the same time, the rest use the linear lookup */
+#define DALHAL_JSON_SCHEMA_FIELD_INDEX_SLOTS 64
+#endif
+
+namespace DALHAL {
+
+    namespace JsonSchema {
+
+        struct JsonObjectSchema;
+
+        /**
+         * Flattened (groups included) and hash sorted field names of a JsonObjectSchema,
+         * so that each key of a json object is resolved by a binary search instead of
+         * walking all fields and groups with strcmp.
+         *
+         * Compiled on first use and kept until Clear() is called,
+         * which should be done when the config validation is done.
+         */
+        class FieldIndex {
+        public:
+            /** entry.topLevel when the field is inside a group or the top level index does not fit the presence mask */
+            static constexpr uint8_t NotTopLevel = 0xFF;
+
+            struct Entry {
+                uint32_t hash;
+                const char* name;
+                /** index in schema->fields of the plain (non group) field, or NotTopLevel */
+                uint8_t topLevel;
+            };
+
+            /** nullptr when the index could not be compiled (out of slots or memory) */
+            static const FieldIndex* Get(const JsonObjectSchema* schema);
+            static void Clear();
+
+            static uint32_t Hash(const char* key);
+
+            /** nullptr when key is not a field of the schema */
+            const Entry* Find(const char* key) const;
+            /**
+             * returns the presence bits (1 << topLevel) of all fields named key,
+             * a name can be used by more than one field (in different groups)
+             * known is set to false when key is not a field of the schema
+             */
+            uint64_t TopLevelMask(const char* key, bool& known) const;
+
+            /** bit n set = schema->fields[n] is a plain field that has a presence bit in TopLevelMask */
+            uint64_t indexedMask = 0;
+            /** the part of indexedMask that has FieldPolicy::Required */
+            uint64_t requiredMask = 0;
+
+        private:
+            const JsonObjectSchema* schema = nullptr;
+            Entry* entries = nullptr;
+            uint16_t count = 0;
+
+            FieldIndex() = default;
+            ~FieldIndex();
+            FieldIndex(const FieldIndex&) = delete;
+            FieldIndex& operator=(const FieldIndex&) = delete;
+
+            static FieldIndex* Compile(const JsonObjectSchema* schema);
+
+            static FieldIndex* slots[DALHAL_JSON_SCHEMA_FIELD_INDEX_SLOTS];
+        };
+
+    }
+
+}
@@ -33,6 +33,7 @@
 #include <DALHAL/Core/JsonConfig/Types/Base/DALHAL_JSON_Schema_TypeBase.h>
 #include <DALHAL/Core/JsonConfig/Types/Root/DALHAL_JSON_Schema_ModeSelector.h>
 #include <DALHAL/Core/JsonConfig/Types/Root/DALHAL_JSON_Schema_FieldConstraint.h>
+#include <DALHAL/Core/JsonConfig/Types/Root/DALHAL_JSON_Schema_FieldIndex.h>
 #include <DALHAL/Core/JsonConfig/Types/Logical/Groups/DALHAL_JSON_Schema_AllOfFieldsGroup.h>
 #include <DALHAL/Core/JsonConfig/Types/Logical/Groups/DALHAL_JSON_Schema_FieldsGroup.h>
 #include <DALHAL/Core/JsonConfig/Types/Logical/Groups/DALHAL_JSON_Schema_OneOfFieldsGroup.h>
@@ -139,7 +140,12 @@ namespace DALHAL {
                 return ValidatorResult::Success;
             }
             
-            // 1. Check unknown fields
+            // compiled once per schema, nullptr falls back to the linear lookup below
+            const FieldIndex* fieldIndex = FieldIndex::Get(jsonObjectSchema);
+            // bit n set = top level (non group) field n is present in jsonObj
+            uint64_t presentMask = 0;
+
+            // 1. Single pass over the members, checks unknown fields and collects the presence bits
             for (const JsonPair& kv : jsonObj.as<JsonObject>()) {
                 const char* key = kv.key().c_str();
                 if (key == nullptr) {
@@ -151,7 +157,15 @@ namespace DALHAL {
                     continue;
                 }
 
-                if (isUnknownField2(key, jsonObjectSchema->fields)) {
+                bool unknown;
+                if (fieldIndex != nullptr) {
+                    bool known;
+                    presentMask |= fieldIndex->TopLevelMask(key, known);
+                    unknown = !known;
+                } else {
+                    unknown = isUnknownField2(key, jsonObjectSchema->fields);
+                }
+                if (unknown) {
                     if (jsonObjectSchema->unknownFieldPolicy == UnknownFieldPolicy::Ignore) {
                         continue;
                     } else if (jsonObjectSchema->unknownFieldPolicy == UnknownFieldPolicy::Warn) {
@@ -180,10 +194,29 @@ namespace DALHAL {
                 sourceObjTypeName = "nullptr error";
             }
             // 2. Validate each field
+            // the presence of every indexed field is already known from the pass above,
+            // missing ones are reported/skipped here and present ones skip the validators own lookup
+            const uint64_t indexedMask = (fieldIndex != nullptr) ? fieldIndex->indexedMask : 0;
+            if (fieldIndex != nullptr && (fieldIndex->requiredMask & ~presentMask) != 0) {
+                anyError = true;
+            }
             for (int i = 0; jsonObjectSchema->fields[i] != nullptr; ++i) {
-                //const SchemaTypeBase& f = *jsonObjectSchema->fields[i];
+                const SchemaTypeBase& f = *jsonObjectSchema->fields[i];
+                const uint64_t bit = (i < 64) ? ((uint64_t)1 << i) : 0;
+                if ((indexedMask & bit) != 0) {
+                    if ((presentMask & bit) == 0) {
+                        if ((fieldIndex->requiredMask & bit) != 0) {
+                            SchemaTypeBase::ReportRequiredFieldMissing(f, sourceObjTypeName, jsonObj);
+                        }
+                        continue;
+                    }
+                    SchemaTypeBase::knownPresent = &f;
+                } else {
+                    SchemaTypeBase::knownPresent = nullptr;
+                }
 
-                JsonSchema::ValidateJson(*jsonObjectSchema->fields[i], sourceObjTypeName, jsonObj, anyError);
+                JsonSchema::ValidateJson(f, sourceObjTypeName, jsonObj, anyError);
+                SchemaTypeBase::knownPresent = nullptr;
                 //const FieldTypeRegistryItem& regDefItem = GetFieldTypeRegistryItem(f->type);
                 //regDefItem.define.ValidateJson(*f, sourceObjTypeName, jsonObj, anyError);
             }
@@ -212,6 +245,37 @@ namespace DALHAL {
             return ValidatorResult::Success;
         }
 
+        /** onlyPresent is set inside OneOf groups so that the defaults of the alternatives not used do not overwrite the one used */
+        static void ExtractFields(const SchemaTypeBase* const* fields, const JsonVariant& jsonObj, uint8_t* outStruct, bool onlyPresent) {
+            for (int i = 0; fields[i] != nullptr; i++) {
+                const SchemaTypeBase* f = fields[i];
+                // fields and groups without a struct member (i.e. the shared base groups) are never walked
+                if (f->HasStructOffset() == false) continue;
+                if (onlyPresent && jsonObj.containsKey(f->name) == false) continue;
+
+                if (f->structMemberType == StructMemberType::Struct) {
+                    if (f->type == FieldType::FieldsGroup || f->type == FieldType::AllOfFieldsGroup) {
+                        ExtractFields(static_cast<const SchemaFieldsGroup*>(f)->fields, jsonObj, outStruct + f->structOffset, false);
+                    } else if (f->type == FieldType::OneOfFieldsGroup) {
+                        ExtractFields(static_cast<const SchemaFieldsGroup*>(f)->fields, jsonObj, outStruct + f->structOffset, true);
+                    } else {
+                        GlobalLogger.Error(F("schema error - struct member on a non group field @ ExtractToStruct "), f->name);
+                    }
+                    continue;
+                }
+                HALValue val = GetValue(*f, jsonObj); // this return default values if the field themselves are missing
+                SchemaTypeBase::ApplyToStruct(*f, val, outStruct);
+            }
+        }
+
+        void JsonObjectSchema::ExtractToStruct(const JsonObjectSchema* schema, const JsonVariant& jsonObj, void* outStruct) {
+            if (schema == nullptr || schema->fields == nullptr) {
+                GlobalLogger.Error(F("schema error - schema == nullptr @ JsonObjectSchema::ExtractToStruct"));
+                return;
+            }
+            ExtractFields(schema->fields, jsonObj, static_cast<uint8_t*>(outStruct), false);
+        }
+
         void JsonObjectSchema::SchemaToJson(const JsonObjectSchema* schema, StringBuilderStreamer& sbs, SchemaEmitMode mode) {
 
             sbs.write_json_object_begin();
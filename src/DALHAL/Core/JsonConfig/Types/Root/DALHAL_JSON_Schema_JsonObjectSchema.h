@@ -44,6 +44,12 @@ namespace DALHAL {
             static ValidatorResult ValidateJson(const JsonObjectSchema* fieldSchema, const char* sourceObjTypeName, const JsonVariant& jsonObj, bool& anyError);
             static void SchemaToJson(const JsonObjectSchema* fieldSchema, StringBuilderStreamer& sbs, SchemaEmitMode mode);
             static const char* GetJavaScriptValidator();
+            /**
+             * separate pass after ValidateJson, writes all fields that declare a struct member into outStruct,
+             * groups are only walked when they declare a nested struct member,
+             * missing optional fields get their default value, should only be used on validated json
+             */
+            static void ExtractToStruct(const JsonObjectSchema* schema, const JsonVariant& jsonObj, void* outStruct);
 
             const char* typeName;
             const SchemaTypeBase* const* fields;
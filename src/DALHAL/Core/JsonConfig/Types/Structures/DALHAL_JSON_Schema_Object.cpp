@@ -101,58 +101,16 @@ namespace DALHAL {
             )rawliteral";
         }
 
-        void ApplyToStruct(size_t structOffset, const HALValue& val, void* outStruct)
-        {
-            uint8_t* base = static_cast<uint8_t*>(outStruct);
-            void* target = base + structOffset;
-
-            // as we do actually check the halvalue type explicit
-            // we can use the raw getters
-            switch (val.getType()) {
-                case HALValue::Type::UINT:
-                    *static_cast<uint32_t*>(target) = val.asRawUInt();
-                    break;
-
-                case HALValue::Type::INT:
-                    *static_cast<int32_t*>(target) = val.asRawInt();
-                    break;
-
-                case HALValue::Type::BOOL:
-                    *static_cast<bool*>(target) = val.asRawBool();
-                    break;
-
-                case HALValue::Type::FLOAT:
-                    *static_cast<float*>(target) = val.asRawFloat();
-                    break;
-
-                case HALValue::Type::CSTRING:
-                    *static_cast<const char**>(target) = val.asRawConstChar();
-                    break;
-
-                default:
-                    GlobalLogger.Error(F("Unsupported HALValue type in ApplyToStruct"));
-                    break;
-            }
-        }
-
         bool SchemaObject::ExtractValues(const SchemaObject& schemaField, const JsonVariant& jsonObj, void* outStruct)
         {
             if (schemaField.subtype == nullptr) {
                 GlobalLogger.Error(F("schema error - schemaField.subtype == nullptr @ SchemaObject::ExtractValues"));
                 return false; // should never happend
             }
-            const JsonObjectSchema& jsonObjSchema = *schemaField.subtype;
             if (jsonObj.containsKey(schemaField.name) == false) {
                 return false; // optional field, as required fields fail on prevalidation
             }
-            const JsonVariant& jsonSubObject = jsonObj[schemaField.name];
-            for (int i = 0; jsonObjSchema.fields[i] != nullptr; ++i) {
-                const SchemaTypeBase& field = *jsonObjSchema.fields[i];
-
-                HALValue val = GetValue(field, jsonSubObject); // this return default values if the field themselves are missing
-
-                ApplyToStruct(field.structOffset, val, outStruct);
-            }
+            JsonObjectSchema::ExtractToStruct(schemaField.subtype, jsonObj[schemaField.name], outStruct);
             return true;
         }
 
@@ -0,0 +1,104 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DALHAL_DeviceArena.h"
+
+#include <string.h>
+#include <string>
+
+#include <DALHAL/Support/DALHAL_Logger.h>
+
+namespace DALHAL {
+
+    Arena DeviceArena::arena;
+    uint32_t DeviceArena::heapFreeBefore = 0;
+    uint32_t DeviceArena::heapFreeAfter = 0;
+    uint8_t DeviceArena::fragBefore = 0;
+    uint8_t DeviceArena::fragAfter = 0;
+
+    static inline uint32_t FreeHeap() {
+#if defined(ESP8266) || defined(ESP32)
+        return ESP.getFreeHeap();
+#else
+        return 0;
+#endif
+    }
+
+    uint8_t DeviceArena::HeapFragmentation() {
+#if defined(ESP8266)
+        return ESP.getHeapFragmentation();
+#elif defined(ESP32)
+        uint32_t freeHeap = ESP.getFreeHeap();
+        if (freeHeap == 0) return 0;
+        return (uint8_t)(100 - (uint32_t)(((uint64_t)ESP.getMaxAllocHeap() * 100) / freeHeap));
+#else
+        return 0;
+#endif
+    }
+
+    bool DeviceArena::Begin(size_t estimatedSize) {
+        heapFreeBefore = FreeHeap();
+        fragBefore = HeapFragmentation();
+        if (arena.Begin(estimatedSize) == false) {
+            std::string sizeStr = std::to_string(estimatedSize);
+            GlobalLogger.Warn(F("DeviceArena - could not allocate, using heap: "), sizeStr.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    void DeviceArena::End() {
+        arena.End();
+        heapFreeAfter = FreeHeap();
+        fragAfter = HeapFragmentation();
+        if (arena.FallbackBytes() != 0) {
+            std::string bytesStr = std::to_string(arena.FallbackBytes());
+            GlobalLogger.Warn(F("DeviceArena - bytes overflowed to heap: "), bytesStr.c_str());
+        }
+    }
+
+    void DeviceArena::Release() {
+        arena.Release();
+    }
+
+    Device** DeviceArena::NewDeviceArray(size_t count) {
+        Device** arr = static_cast<Device**>(Arena::Allocate(sizeof(Device*) * count));
+        if (arr != nullptr) { memset(arr, 0, sizeof(Device*) * count); }
+        return arr;
+    }
+
+    void DeviceArena::DeleteDeviceArray(Device** arr) {
+        Arena::Free(arr);
+    }
+
+    void DeviceArena::PrintTo(StringBuilderStreamer& sbs) {
+        sbs.write_json_object_begin();
+        arena.PrintTo(sbs);
+        sbs.write_json_value_separator(); sbs.write_jsonNumber(F("free before load"), heapFreeBefore);
+        sbs.write_json_value_separator(); sbs.write_jsonNumber(F("free after load"), heapFreeAfter);
+        sbs.write_json_value_separator(); sbs.write_jsonNumber(F("frag before load"), (uint32_t)fragBefore);
+        sbs.write_json_value_separator(); sbs.write_jsonNumber(F("frag after load"), (uint32_t)fragAfter);
+        sbs.write_json_object_end();
+    }
+
+}
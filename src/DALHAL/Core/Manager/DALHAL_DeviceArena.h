@@ -0,0 +1,76 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <DALHAL/Support/DALHAL_Arena.h>
+#include <DALHAL/API/DALHAL_StringBuilderStreamer.h>
+
+/** estimated arena bytes per json object in the cfg, used by the counting pass before a load */
+#ifndef DALHAL_DEVICE_ARENA_BYTES_PER_OBJECT
+#define DALHAL_DEVICE_ARENA_BYTES_PER_OBJECT    96
+#endif
+/** extra bytes added to every estimate */
+#ifndef DALHAL_DEVICE_ARENA_SLACK
+#define DALHAL_DEVICE_ARENA_SLACK               256
+#endif
+
+namespace DALHAL {
+
+    class Device; // forward declaration
+
+    /**
+     * The Arena that the device tree of one cfg generation is allocated from,
+     * open during DeviceManager::ParseJSON and released by DeviceManager::CleanUp
+     * after all device destructors have run.
+     */
+    class DeviceArena {
+    private:
+        static Arena arena;
+        // heap state around the last load
+        static uint32_t heapFreeBefore;
+        static uint32_t heapFreeAfter;
+        static uint8_t fragBefore;
+        static uint8_t fragAfter;
+
+    public:
+        static bool Begin(size_t estimatedSize);
+        static void End();
+        /** must only be called when no device of the generation is alive */
+        static void Release();
+
+        /** zero initialized array of device pointers, free with DeleteDeviceArray */
+        static Device** NewDeviceArray(size_t count);
+        static void DeleteDeviceArray(Device** arr);
+
+        /** heap fragmentation in percent (0 when not available on the platform) */
+        static uint8_t HeapFragmentation();
+
+        static void PrintTo(StringBuilderStreamer& sbs);
+    };
+
+}
@@ -33,18 +33,25 @@
 
 //#include <DALHAL/Core/JsonConfig/DALHAL_JSON_Schema_Validator.h>
 #include <DALHAL/Core/JsonConfig/Types/Structures/DALHAL_JSON_Schema_ArrayOfRegistryItems.h>
+#include <DALHAL/Core/JsonConfig/Types/Root/DALHAL_JSON_Schema_FieldIndex.h>
 
 #include <DALHAL/ScriptEngine/Parser/DALHAL_SCRIPT_ENGINE_Parser_Triggers.h>
+#include <DALHAL/Core/Manager/DALHAL_DeviceArena.h>
 
 namespace DALHAL {
 
     Device** DeviceManager::devices = nullptr;
     int DeviceManager::deviceCount = 0;
+    uint32_t DeviceManager::loadGeneration = 1;
     
     int DeviceManager::DeviceCount() {
         return deviceCount;
     }
 
+    uint32_t DeviceManager::LoadGeneration() {
+        return loadGeneration;
+    }
+
     bool DeviceManager::init() {
         if (DeviceManager::ReadJSON() == false) {
             //GlobalLogger.printAllLogs(Serial, false);
@@ -92,6 +99,22 @@ namespace DALHAL {
         return regItem.def->Create_Function(createContext);
     }
 
+    /** counting pass over the validated cfg, every object/array item is one possible allocation */
+    static size_t EstimateArenaSize(const JsonVariant& json) {
+        size_t size = 0;
+        if (json.is<JsonObject>()) {
+            size += DALHAL_DEVICE_ARENA_BYTES_PER_OBJECT;
+            for (JsonPair kv : json.as<JsonObject>()) {
+                size += EstimateArenaSize(kv.value());
+            }
+        } else if (json.is<JsonArray>()) {
+            for (JsonVariant item : json.as<JsonArray>()) {
+                size += sizeof(Device*) + EstimateArenaSize(item);
+            }
+        }
+        return size;
+    }
+
     void DeviceManager::CleanUp() {
         //printf("\n&&&&&&&&&&&&&&&&&&&&&&&& CLEANUP OF LOADED DEVICES &&&&&&&&&&&&&&&&&&&&&&\n");
         // cleanup of prev device list if existent
@@ -102,10 +125,12 @@ namespace DALHAL {
                     devices[i] = nullptr;
                 }
             }
-            delete[] devices;
+            DeviceArena::DeleteDeviceArray(devices);
             devices = nullptr;
         }
+        DeviceArena::Release(); // all devices of the generation are destructed by now
         DALHAL::DeviceManager::deviceCount = 0;
+        if (++loadGeneration == 0) { loadGeneration = 1; }
     }
 
     bool DeviceManager::ParseJSON(const JsonVariant &jsonArray) {
@@ -124,6 +149,7 @@ namespace DALHAL {
 
         bool anyError = false;
         JsonSchema::SchemaArrayOfRegistryItems::ValidateArrayOfRegistryItems(RootDevicesRegistry, jsonArray, "root", anyError);
+        JsonSchema::FieldIndex::Clear(); // the compiled field lookups are only needed during validation
         //JsonSchema::validateFromRegister(jsonArray, RootDevicesRegistry, anyError);
         if (anyError) {
             GlobalLogger.Error(F("The loaded JSON cfg contains errors"));
@@ -133,10 +159,12 @@ namespace DALHAL {
 
         // First pass: count enabled/(non comment) entries
         uint32_t deviceCount = 0;
+        size_t arenaSize = DALHAL_DEVICE_ARENA_SLACK;
         
         for (int i=0;i<arraySize;i++) {
             if (Device::DisabledOrCommentItem(jsonArray[i]) == true) { continue; } // disabled
             deviceCount++;
+            arenaSize += sizeof(Device*) + EstimateArenaSize(jsonArray[i]);
         }
         
         if (deviceCount == 0) {
@@ -148,11 +176,13 @@ namespace DALHAL {
         // delete/cleanup prev configuration if any
         CleanUp();
         //printf("\nTrying to allocate for %d devices\n", deviceCount);
+        DeviceArena::Begin(arenaSize); // falls back to the heap if the block cannot be allocated
         
         // Allocate space for all devices
-        devices = new Device*[deviceCount]();
+        devices = DeviceArena::NewDeviceArray(deviceCount);
         
         if (devices == nullptr) {
+            DeviceArena::End();
             GlobalLogger.Error(F("Failed to allocate device array"));
             return false;
         }
@@ -167,6 +197,7 @@ namespace DALHAL {
             if (Device::DisabledOrCommentItem(jsonItem) == true) { continue; } // disabled
             devices[index++] = CreateDeviceFromJSON(jsonItem);
         }
+        DeviceArena::End();
         std::string devCountStr = std::to_string(deviceCount);
         GlobalLogger.Info(F("Created devices: "), devCountStr.c_str());
         return true;
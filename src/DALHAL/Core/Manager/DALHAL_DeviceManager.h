@@ -58,6 +58,7 @@ namespace DALHAL {
     private:
         static Device** devices;
         static int deviceCount;
+        static uint32_t loadGeneration;
 
     public:
         static Device* CreateDeviceFromJSON(const JsonVariant& json);
@@ -65,6 +66,8 @@ namespace DALHAL {
 
         // getters
         static int DeviceCount();
+        /** changed every time the loaded devices are destroyed, cached Device* must be resolved again when this differ (never 0) */
+        static uint32_t LoadGeneration();
         // init
         /** calls the begin function on all loaded hal devices */
         
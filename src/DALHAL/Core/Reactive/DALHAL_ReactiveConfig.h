@@ -110,7 +110,7 @@
 // General Inputs
 #define DALHAL_REACTIVE_CFG_ANALOG_INPUT          (DALHAL_REACTIVE_FEATURE_VALUE_CHANGE | DALHAL_REACTIVE_FEATURE_READ) /* implemented */
 #define DALHAL_REACTIVE_CFG_BUTTON_INPUT          (DALHAL_REACTIVE_FEATURE_STATE_CHANGE | DALHAL_REACTIVE_FEATURE_CUSTOM) /* implemented */
-#define DALHAL_REACTIVE_CFG_DIGITAL_INPUT         (DALHAL_REACTIVE_FEATURE_READ) /* implemented */
+#define DALHAL_REACTIVE_CFG_DIGITAL_INPUT         (DALHAL_REACTIVE_FEATURE_VALUE_CHANGE | DALHAL_REACTIVE_FEATURE_STATE_CHANGE | DALHAL_REACTIVE_FEATURE_READ | DALHAL_REACTIVE_FEATURE_EXEC) /* implemented */
 // General Outputs
 #define DALHAL_REACTIVE_CFG_DIGITAL_OUTPUT        (DALHAL_REACTIVE_FEATURE_VALUE_CHANGE | DALHAL_REACTIVE_FEATURE_WRITE) /* implemented */
 //#define DALHAL_REACTIVE_CFG_PWM_ANALOG_WRITE      (DALHAL_REACTIVE_FEATURE_WRITE) OBSOLETE TO BE REMOVED
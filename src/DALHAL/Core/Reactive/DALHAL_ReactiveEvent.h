@@ -26,6 +26,7 @@
 #include <cstdint>
 #include <cstddef>
 #include <DALHAL/Support/DALHAL_DeleterTemplate.h>
+#include <DALHAL/Support/DALHAL_Arena.h>
 #include <DALHAL/DALHAL_BuildFlags.h>
 #include <DALHAL/Support/DALHAL_Logger.h>
 
@@ -34,6 +35,7 @@ namespace  DALHAL
     /** used by consumers */
     class ReactiveEvent {
     public:
+        DALHAL_ARENA_ALLOCATED // created while loading scripts/devices
         using CheckFn  = bool (*)(void*);
         struct SimpleContext {
             uint32_t lastSeen;
@@ -31,11 +31,14 @@
 
 #include <DALHAL/Core/Types/DALHAL_Device.h>
 #include <DALHAL/Core/Types/DALHAL_Value.h>
+#include <DALHAL/Support/DALHAL_Arena.h>
 #include <DALHAL/Core/Types/DALHAL_ZeroCopyString.h>
 
 namespace DALHAL {
 
     class CachedDeviceAccess {
+    public:
+        DALHAL_ARENA_ALLOCATED // created while loading scripts
     private:
         Device* device;
         /** 
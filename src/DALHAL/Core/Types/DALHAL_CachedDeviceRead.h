@@ -31,6 +31,7 @@
 
 #include <DALHAL/Core/Types/DALHAL_Device.h>
 #include <DALHAL/Core/Types/DALHAL_Value.h>
+#include <DALHAL/Support/DALHAL_Arena.h>
 #include <DALHAL/Core/Types/DALHAL_ZeroCopyString.h>
 
 namespace DALHAL {
@@ -57,6 +58,9 @@ namespace DALHAL {
 
         ~CachedDeviceRead();
 
+        /** allocated from the device or script arena when created during a load */
+        DALHAL_ARENA_ALLOCATED
+
     private:
         // Handlers
         static HALOperationResult Handler_Invalid(void* ctx, HALValue& val);
@@ -33,6 +33,7 @@
 
 #include <ArduinoJson.h>
 #include <DALHAL/Core/Types/DALHAL_Value.h>
+#include <DALHAL/Support/DALHAL_Arena.h>
 #include <DALHAL/Core/Types/DALHAL_UID_Path.h>
 #include <DALHAL/Core/Types/DALHAL_OperationResult.h>
 #include <DALHAL/Support/DALHAL_DeleterTemplate.h>
@@ -69,6 +70,9 @@ namespace DALHAL {
         Device(const char* const type);
         virtual ~Device();
 
+        /** devices created during a cfg load are allocated from the DeviceArena of that generation */
+        DALHAL_ARENA_ALLOCATED
+
         HAL_UID uid;
 
         virtual const Registry::DefineBase* GetRegistryDefine() = 0;
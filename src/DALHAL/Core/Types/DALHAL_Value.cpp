@@ -23,7 +23,15 @@
 
 #include "DALHAL_Value.h"
 
+#include <DALHAL/Support/DALHAL_NumberCodec.h>
+
 namespace DALHAL {
+
+    static const char* SkipSpaces(const char* p) {
+        while (*p == ' ' || *p == '\t') p++;
+        return p;
+    }
+
     HALValue::HALValue() : type(Type::UNSET) {}
     HALValue::HALValue(Type type) : type(type) {}
 
@@ -113,7 +121,11 @@ namespace DALHAL {
                 return bval ? 1 : 0;
             case Type::CSTRING:
                 // Try to parse string as int, return 0 if fail
-                return (cStr != nullptr) ? atoi(cStr) : 0;
+                if (cStr != nullptr) {
+                    int32_t v;
+                    if (NumberCodec::ParseInt32(SkipSpaces(cStr), nullptr, v) != nullptr) return v;
+                }
+                return 0;
             default:
                 return 0;
         }
@@ -131,7 +143,13 @@ namespace DALHAL {
                 return bval ? 1U : 0U;
             case Type::CSTRING:
                 // Try to parse string as uint, return 0 if fail
-                return (cStr != nullptr) ? static_cast<uint32_t>(strtoul(cStr, nullptr, 10)) : 0U;
+                if (cStr != nullptr) {
+                    const char* p = SkipSpaces(cStr);
+                    if (*p == '+') p++;
+                    uint32_t v;
+                    if (NumberCodec::ParseUInt32(p, nullptr, v) != nullptr) return v;
+                }
+                return 0U;
             default:
                 return 0U;
         }
@@ -149,7 +167,11 @@ namespace DALHAL {
                 return bval ? 1.0f : 0.0f;
             case Type::CSTRING:
                 // Try to parse string as float, return 0 if fail
-                return (cStr != nullptr) ? strtof(cStr, nullptr) : 0.0f;
+                if (cStr != nullptr) {
+                    float v;
+                    if (NumberCodec::ParseFloat(SkipSpaces(cStr), nullptr, v) != nullptr) return v;
+                }
+                return 0.0f;
             default:
                 return 0.0f;
         }
@@ -229,32 +251,28 @@ namespace DALHAL {
     // ============================================================================
 
     void HALValue::appendToString(std::string& target) const {
-        char buf[20]; // allocated on the stack
+        char buf[DALHAL_NUMBER_CODEC_FLOAT_BUFFER_SIZE]; // allocated on the stack, fits all number types
         switch (type) {
             case Type::INT:
-                snprintf(buf, sizeof(buf), "%d", ival);
+                target.append(buf, NumberCodec::WriteInt32(buf, ival));
                 break;
             case Type::UINT:
-                snprintf(buf, sizeof(buf), "%u", uval);
+                target.append(buf, NumberCodec::WriteUInt32(buf, uval));
                 break;
             case Type::FLOAT:
-                snprintf(buf, sizeof(buf), "%f", fval);
+                target.append(buf, NumberCodec::WriteFloat(buf, fval));
                 break;
             case Type::BOOL:
-                snprintf(buf, sizeof(buf), "%s", bval ? "true" : "false");
+                target += bval ? "true" : "false";
                 break;
             case Type::CSTRING:
                 if (cStr != nullptr) {
-                    snprintf(buf, sizeof(buf), "%s", cStr);
-                } else {
-                    buf[0] = '\0';
+                    target += cStr;
                 }
                 break;
             default:
-                buf[0] = '\0';
                 break;
         }
-        target += buf;
     }
 
     // ============================================================================
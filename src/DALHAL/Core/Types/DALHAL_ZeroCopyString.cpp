@@ -22,6 +22,9 @@
 */
 
 #include "DALHAL_ZeroCopyString.h"
+#include "DALHAL_ZeroCopyString_Kernels.h"
+
+#include <DALHAL/Support/DALHAL_NumberCodec.h>
 
 #include <WString.h> // F() macro
 
@@ -84,19 +87,15 @@ namespace DALHAL {
         return true;
     }
     const char* ZeroCopyString::FindChar(char ch) const {
-        return static_cast<const char*>(memchr(start, ch, Length()));
+        if (IsEmpty()) return nullptr;
+        return ZeroCopyStringKernels::FindChar(start, Length(), ch);
     }
     const char* ZeroCopyString::FindCharReverse(char ch) const {
         if (IsEmpty()) return nullptr;
-        const char* ptr = end-1;
-        while (ptr >= start) {
-            if (*ptr == ch) return ptr;
-            ptr--;
-        }
-        return nullptr;
+        return ZeroCopyStringKernels::FindCharReverse(start, Length(), ch);
     }
     bool ZeroCopyString::ContainsChar(char ch) const {
-        return static_cast<const char*>(memchr(start, ch, Length())) != nullptr;
+        return FindChar(ch) != nullptr;
     }
     const char* ZeroCopyString::FindChar(char ch, const char* _start) const {
         // Make sure _start is inside [start, end)
@@ -105,7 +104,7 @@ namespace DALHAL {
         // Number of bytes left to search
         size_t remaining = end - _start;
 
-        return static_cast<const char*>(memchr(_start, ch, remaining));
+        return ZeroCopyStringKernels::FindChar(_start, remaining, ch);
     }
     const char* ZeroCopyString::FindString(const char* str, const char* _start) const {
         if (!str || !start || !end || (end <= start)) return nullptr;
@@ -114,24 +113,25 @@ namespace DALHAL {
         const char* searchStart = (_start && _start >= start && _start < end) ? _start : start;
         size_t remaining = end - searchStart;
 
-        size_t needleLen = std::strlen(str);
-        if (needleLen == 0 || needleLen > remaining) return nullptr;
-
-        for (const char* p = searchStart; p <= end - needleLen; ++p) {
-            if (std::strncmp(p, str, needleLen) == 0) {
-                return p;
-            }
-        }
-        return nullptr;
+        return ZeroCopyStringKernels::FindString(searchStart, remaining, str, std::strlen(str));
     }
     const char* ZeroCopyString::FindAnyString(const char* const* candidates, const char* _start, const char** matchedCandidate) const {
         if (matchedCandidate) *matchedCandidate = nullptr;
         const char* earliestMatch = nullptr;
         const char* earliestKeyword = nullptr;
   
+        if (!start || !end || (end <= start)) return nullptr;
+        const char* searchStart = (_start && _start >= start && _start < end) ? _start : start;
+
         for (int i = 0; candidates[i] != nullptr; ++i) {
-            const char* found = FindString(candidates[i], _start);
-            if (found && (!earliestMatch || found < earliestMatch)) {
+            // a later candidate only wins if it starts before the current earliest match,
+            // so its search window can be cut down to end there
+            size_t needleLen = std::strlen(candidates[i]);
+            const char* windowEnd = earliestMatch ? (earliestMatch - 1 + needleLen) : end;
+            if (windowEnd > end) windowEnd = end;
+            if (windowEnd <= searchStart) continue;
+            const char* found = ZeroCopyStringKernels::FindString(searchStart, windowEnd - searchStart, candidates[i], needleLen);
+            if (found) {
                 earliestMatch = found;
                 earliestKeyword = candidates[i];
             }
@@ -178,14 +178,7 @@ namespace DALHAL {
 
     uint32_t ZeroCopyString::CountChar(char ch) const {
         if (Length() == 0) return 0;
-        uint32_t count = 0;
-        const char* p = start;
-        const char* const _end = end;
-        while (p < _end) {
-            if (*p == ch) count++;
-            p++;
-        }
-        return count;
+        return ZeroCopyStringKernels::CountChar(start, Length(), ch);
     }
 
     uint32_t ZeroCopyString::CountString(const char* str) const {
@@ -449,21 +442,8 @@ namespace DALHAL {
         int otherLen = other.Length();
         //if (otherLen == 0) return false;
         if (thisLen != otherLen) return false;
-        const char* a = start;
-        const char* endA = end;
-        const char* b = other.start;
-        const char* endB = other.end;
-        while (a < endA && b < endB) {
-            //const char aLC = (*a >= 'A' && *a < 'Z')?(*a+' '):*a;
-            //const char bLC = (*b >= 'A' && *b < 'Z')?(*b+' '):*b;
-            //if (aLC != bLC) return false;
-            if (std::tolower(*a) != std::tolower(*b)) {
-                return false;
-            }
-            a++;
-            b++;
-        }
-        return true; // lengths already checked, all characters matched
+        if (thisLen == 0) return true;
+        return ZeroCopyStringKernels::EqualsIC(start, other.start, thisLen);
     }
     bool ZeroCopyString::EqualsIC(const char* cstr) const {
         if (!cstr) return false;
@@ -475,20 +455,8 @@ namespace DALHAL {
         //if (cstrLen == 0) return false;
 
         if (thisLen != cstrLen) return false;
-        const char* a = start;
-        const char* endA = end;
-
-        while (a < endA && *cstr != '\0') {
-            //const char aLC = (*a >= 'A' && *a < 'Z')?(*a+' '):*a;
-            //const char bLC = (*cstr >= 'A' && *cstr < 'Z')?(*cstr+' '):*cstr;
-            //if (aLC != bLC) return false;
-            if (std::tolower(*a) != std::tolower(*cstr)) {
-                return false;
-            }
-            a++;
-            cstr++;
-        }
-        return true; // lengths already checked, all characters matched
+        if (thisLen == 0) return true;
+        return ZeroCopyStringKernels::EqualsIC(start, cstr, thisLen);
     }
 #if !(defined(_WIN32) || defined(__linux__) || defined(__APPLE__))
     bool ZeroCopyString::EqualsIC(const __FlashStringHelper* fstr) const {
@@ -647,17 +615,8 @@ namespace DALHAL {
         if ((_end - p) > 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
             p += 2;
             uint32_t value = 0;
-            for (; p < _end; ++p) {
-                char ch = *p;
-                if (ch >= '0' && ch <= '9')
-                    value = (value << 4) | (ch - '0');
-                else if (ch >= 'a' && ch <= 'f')
-                    value = (value << 4) | (10 + (ch - 'a'));
-                else if (ch >= 'A' && ch <= 'F')
-                    value = (value << 4) | (10 + (ch - 'A'));
-                else
-                    return false;
-            }
+            // all remaining chars must be hex digits, max 8
+            if (NumberCodec::ParseHex32(p, _end, value) != _end) return false;
             outValue = value;
             return true;
         }
@@ -672,25 +631,13 @@ namespace DALHAL {
         }
 
         uint32_t value = 0;
-        while (p < _end) {
+        p = NumberCodec::ParseUInt32(p, _end, value);
+        if (p == nullptr) return false; // no digits or overflow
+        if (p < _end) {
             char ch = *p;
-            if (ch >= '0' && ch <= '9') {
-                value = value * 10 + (ch - '0');
-            } else if (ch == ',') {
-                // allow comma as thousands separator comment the following
-                break;
-            } else if (ch == '.') {
-                // Allways Stop at decimal separator
-                return false;
-                //break;
-            } else if (ch == ' ') {
-                // Allow spaces inside? optional.
-                // Skip or break depending on policy, comment the following if should be allowed
-                break;
-            } else {
-                return false; // Invalid character
-            }
-            p++;
+            // a comma (thousands separator) or space ends the number,
+            // anything else (including the decimal separator) makes it invalid
+            if (ch != ',' && ch != ' ') return false;
         }
 
         outValue = value;
@@ -727,9 +674,11 @@ namespace DALHAL {
             p++;
         }
 
-        float value = 0.0;
+        // the digits are collected as an integer and scaled once by NumberCodec,
+        // summing up 0.1 factors loses precision on every fraction digit
+        uint64_t mantissa = 0;
+        int32_t exp10 = 0;
         bool decimalSeen = false;
-        float decimalFactor = 0.1;
         bool digitSeen = false;
 
         while (p < _end) {
@@ -737,11 +686,11 @@ namespace DALHAL {
 
             if (ch >= '0' && ch <= '9') {
                 digitSeen = true;
-                if (!decimalSeen) {
-                    value = value * 10.0 + (ch - '0');
-                } else {
-                    value += (ch - '0') * decimalFactor;
-                    decimalFactor *= 0.1;
+                if (mantissa < 100000000000000000ULL) {
+                    mantissa = mantissa * 10 + (ch - '0');
+                    if (decimalSeen) exp10--;
+                } else if (!decimalSeen) {
+                    exp10++;
                 }
             } else if ((ch == '.' || ch == ',') && !decimalSeen) {
                 // First decimal point (treat both '.' and ',' as decimal separator here)
@@ -757,7 +706,7 @@ namespace DALHAL {
 
         if (!digitSeen) return false;
 
-        outValue = negative ? -value : value;
+        outValue = NumberCodec::ComposeFloat(mantissa, exp10, negative);
         return true;
     }
 
@@ -0,0 +1,334 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/*
+ * Scanning kernels used by ZeroCopyString, selected at compile time:
+ *   SSE2  - x86/x64 pc builds
+ *   NEON  - aarch64 pc builds (i.e. Apple silicon)
+ *   SWAR  - word-at-a-time on everything else (ESP32/ESP8266)
+ * define DALHAL_ZCS_KERNELS_FORCE_SCALAR or DALHAL_ZCS_KERNELS_FORCE_SWAR to override.
+ * The Scalar namespace is the original byte-by-byte implementation, kept as a reference
+ * for the microbenchmark (pc_simulation/bench) and as the final fallback.
+ */
+#if defined(DALHAL_ZCS_KERNELS_FORCE_SCALAR) || !defined(__BYTE_ORDER__) || (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+#define DALHAL_ZCS_KERNELS_SCALAR
+#define DALHAL_ZCS_KERNELS_NAME "scalar"
+#elif !defined(DALHAL_ZCS_KERNELS_FORCE_SWAR) && defined(__SSE2__)
+#define DALHAL_ZCS_KERNELS_SSE2
+#define DALHAL_ZCS_KERNELS_NAME "sse2"
+#include <emmintrin.h>
+#elif !defined(DALHAL_ZCS_KERNELS_FORCE_SWAR) && defined(__ARM_NEON) && defined(__aarch64__)
+#define DALHAL_ZCS_KERNELS_NEON
+#define DALHAL_ZCS_KERNELS_NAME "neon"
+#include <arm_neon.h>
+#else
+#define DALHAL_ZCS_KERNELS_SWAR
+#define DALHAL_ZCS_KERNELS_NAME "swar"
+#endif
+
+namespace DALHAL {
+
+    namespace ZeroCopyStringKernels {
+
+        /** ascii only fold, same result as std::tolower in the "C" locale but without the table lookup */
+        inline char FoldAscii(char c) {
+            return ((unsigned char)(c - 'A') < 26) ? (char)(c | 0x20) : c;
+        }
+
+        namespace Scalar {
+
+            inline const char* FindChar(const char* p, size_t n, char ch) {
+                for (const char* const e = p + n; p < e; ++p) {
+                    if (*p == ch) return p;
+                }
+                return nullptr;
+            }
+            inline const char* FindCharReverse(const char* p, size_t n, char ch) {
+                for (const char* q = p + n; q > p; ) {
+                    if (*--q == ch) return q;
+                }
+                return nullptr;
+            }
+            inline uint32_t CountChar(const char* p, size_t n, char ch) {
+                uint32_t count = 0;
+                for (const char* const e = p + n; p < e; ++p) {
+                    if (*p == ch) count++;
+                }
+                return count;
+            }
+            inline bool EqualsIC(const char* a, const char* b, size_t n) {
+                for (size_t i = 0; i < n; ++i) {
+                    if (std::tolower(a[i]) != std::tolower(b[i])) return false;
+                }
+                return true;
+            }
+            inline const char* FindString(const char* p, size_t n, const char* needle, size_t needleLen) {
+                if (needleLen == 0 || needleLen > n) return nullptr;
+                for (const char* q = p; q <= p + n - needleLen; ++q) {
+                    if (std::strncmp(q, needle, needleLen) == 0) return q;
+                }
+                return nullptr;
+            }
+
+        }
+
+#if defined(DALHAL_ZCS_KERNELS_SWAR)
+        namespace Swar {
+            // native register width, 32 bit on the MCU:s
+            typedef uintptr_t Word;
+            constexpr size_t W = sizeof(Word);
+            constexpr Word ONES = ~(Word)0 / 0xFF; // 0x0101..01
+            constexpr Word LOW7 = ONES * 0x7F;
+            constexpr Word HIGH = ONES * 0x80;
+
+            inline Word Load(const char* p) {
+                Word w;
+                std::memcpy(&w, p, W);
+                return w;
+            }
+            inline Word LoadAligned(const char* p) {
+                Word w;
+                std::memcpy(&w, __builtin_assume_aligned(p, W), W);
+                return w;
+            }
+            /** high bit set in every byte that is zero, exact (no borrow false positives) */
+            inline Word ZeroBytes(Word x) {
+                return ~(((x & LOW7) + LOW7) | x | LOW7);
+            }
+            inline unsigned LowestByte(Word m) {
+                return (sizeof(Word) == 8) ? (unsigned)(__builtin_ctzll((unsigned long long)m) >> 3) : (unsigned)(__builtin_ctz((unsigned)m) >> 3);
+            }
+            inline unsigned HighestByte(Word m) {
+                return (sizeof(Word) == 8) ? (unsigned)((63 - __builtin_clzll((unsigned long long)m)) >> 3) : (unsigned)((31 - __builtin_clz((unsigned)m)) >> 3);
+            }
+            inline unsigned PopCount(Word m) {
+                return (sizeof(Word) == 8) ? (unsigned)__builtin_popcountll((unsigned long long)m) : (unsigned)__builtin_popcount((unsigned)m);
+            }
+            /** lower case of every ascii letter in the word */
+            inline Word Fold(Word x) {
+                const Word heptets = x & LOW7;
+                const Word gtZ = heptets + ONES * (0x7F - 'Z'); // high bit set when > 'Z'
+                const Word geA = heptets + ONES * (0x80 - 'A'); // high bit set when >= 'A'
+                const Word upper = (geA ^ gtZ) & ~x & HIGH;     // ascii and in A..Z
+                return x | (upper >> 2);                        // 0x80 >> 2 == 0x20
+            }
+        }
+#endif
+
+        inline const char* FindChar(const char* p, size_t n, char ch) {
+#if defined(DALHAL_ZCS_KERNELS_SSE2)
+            const __m128i pat = _mm_set1_epi8(ch);
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                int m = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p + i)), pat));
+                if (m) return p + i + __builtin_ctz((unsigned)m);
+            }
+            return Scalar::FindChar(p + i, n - i, ch);
+#elif defined(DALHAL_ZCS_KERNELS_NEON)
+            const uint8x16_t pat = vdupq_n_u8((uint8_t)ch);
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                uint8x16_t eq = vceqq_u8(vld1q_u8((const uint8_t*)(p + i)), pat);
+                uint64_t m = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+                if (m) return p + i + (__builtin_ctzll(m) >> 2);
+            }
+            return Scalar::FindChar(p + i, n - i, ch);
+#elif defined(DALHAL_ZCS_KERNELS_SWAR)
+            using namespace Swar;
+            const char* const e = p + n;
+            // byte steps until aligned so the word loads are single instructions on the MCU:s
+            while (p < e && ((uintptr_t)p & (W - 1))) {
+                if (*p == ch) return p;
+                ++p;
+            }
+            const Word pat = ONES * (uint8_t)ch;
+            for (; p + W <= e; p += W) {
+                Word m = ZeroBytes(LoadAligned(p) ^ pat);
+                if (m) return p + LowestByte(m);
+            }
+            return Scalar::FindChar(p, e - p, ch);
+#else
+            return Scalar::FindChar(p, n, ch);
+#endif
+        }
+
+        inline const char* FindCharReverse(const char* p, size_t n, char ch) {
+#if defined(DALHAL_ZCS_KERNELS_SSE2)
+            const __m128i pat = _mm_set1_epi8(ch);
+            size_t i = n;
+            for (; i >= 16; i -= 16) {
+                int m = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p + i - 16)), pat));
+                if (m) return p + i - 16 + (31 - __builtin_clz((unsigned)m));
+            }
+            return Scalar::FindCharReverse(p, i, ch);
+#elif defined(DALHAL_ZCS_KERNELS_NEON)
+            const uint8x16_t pat = vdupq_n_u8((uint8_t)ch);
+            size_t i = n;
+            for (; i >= 16; i -= 16) {
+                uint8x16_t eq = vceqq_u8(vld1q_u8((const uint8_t*)(p + i - 16)), pat);
+                uint64_t m = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+                if (m) return p + i - 16 + ((63 - __builtin_clzll(m)) >> 2);
+            }
+            return Scalar::FindCharReverse(p, i, ch);
+#elif defined(DALHAL_ZCS_KERNELS_SWAR)
+            using namespace Swar;
+            const char* e = p + n;
+            while (e > p && ((uintptr_t)e & (W - 1))) {
+                if (*--e == ch) return e;
+            }
+            const Word pat = ONES * (uint8_t)ch;
+            for (; e >= p + W; e -= W) {
+                Word m = ZeroBytes(LoadAligned(e - W) ^ pat);
+                if (m) return e - W + HighestByte(m);
+            }
+            return Scalar::FindCharReverse(p, e - p, ch);
+#else
+            return Scalar::FindCharReverse(p, n, ch);
+#endif
+        }
+
+        inline uint32_t CountChar(const char* p, size_t n, char ch) {
+#if defined(DALHAL_ZCS_KERNELS_SSE2)
+            const __m128i pat = _mm_set1_epi8(ch);
+            uint32_t count = 0;
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                count += __builtin_popcount((unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p + i)), pat)));
+            }
+            return count + Scalar::CountChar(p + i, n - i, ch);
+#elif defined(DALHAL_ZCS_KERNELS_NEON)
+            const uint8x16_t pat = vdupq_n_u8((uint8_t)ch);
+            uint32_t count = 0;
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                count += vaddvq_u8(vshrq_n_u8(vceqq_u8(vld1q_u8((const uint8_t*)(p + i)), pat), 7));
+            }
+            return count + Scalar::CountChar(p + i, n - i, ch);
+#elif defined(DALHAL_ZCS_KERNELS_SWAR)
+            using namespace Swar;
+            const char* const e = p + n;
+            uint32_t count = 0;
+            while (p < e && ((uintptr_t)p & (W - 1))) {
+                if (*p == ch) count++;
+                ++p;
+            }
+            const Word pat = ONES * (uint8_t)ch;
+            for (; p + W <= e; p += W) {
+                count += PopCount(ZeroBytes(LoadAligned(p) ^ pat));
+            }
+            return count + Scalar::CountChar(p, e - p, ch);
+#else
+            return Scalar::CountChar(p, n, ch);
+#endif
+        }
+
+        /** case insensitive (ascii) compare of n bytes */
+        inline bool EqualsIC(const char* a, const char* b, size_t n) {
+#if defined(DALHAL_ZCS_KERNELS_SSE2)
+            const __m128i A1 = _mm_set1_epi8('A' - 1);
+            const __m128i Z1 = _mm_set1_epi8('Z' + 1);
+            const __m128i bit = _mm_set1_epi8(0x20);
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+                __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+                // signed compares, so bytes >= 0x80 are never folded
+                __m128i ux = _mm_and_si128(_mm_cmpgt_epi8(x, A1), _mm_cmplt_epi8(x, Z1));
+                __m128i uy = _mm_and_si128(_mm_cmpgt_epi8(y, A1), _mm_cmplt_epi8(y, Z1));
+                x = _mm_or_si128(x, _mm_and_si128(ux, bit));
+                y = _mm_or_si128(y, _mm_and_si128(uy, bit));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) != 0xFFFF) return false;
+            }
+            for (; i < n; ++i) {
+                if (FoldAscii(a[i]) != FoldAscii(b[i])) return false;
+            }
+            return true;
+#elif defined(DALHAL_ZCS_KERNELS_NEON)
+            const uint8x16_t A = vdupq_n_u8('A');
+            const uint8x16_t Z = vdupq_n_u8('Z');
+            const uint8x16_t bit = vdupq_n_u8(0x20);
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                uint8x16_t x = vld1q_u8((const uint8_t*)(a + i));
+                uint8x16_t y = vld1q_u8((const uint8_t*)(b + i));
+                x = vorrq_u8(x, vandq_u8(vandq_u8(vcgeq_u8(x, A), vcleq_u8(x, Z)), bit));
+                y = vorrq_u8(y, vandq_u8(vandq_u8(vcgeq_u8(y, A), vcleq_u8(y, Z)), bit));
+                if (vminvq_u8(vceqq_u8(x, y)) != 0xFF) return false;
+            }
+            for (; i < n; ++i) {
+                if (FoldAscii(a[i]) != FoldAscii(b[i])) return false;
+            }
+            return true;
+#elif defined(DALHAL_ZCS_KERNELS_SWAR)
+            using namespace Swar;
+            size_t i = 0;
+            if ((((uintptr_t)a ^ (uintptr_t)b) & (W - 1)) == 0) {
+                // same alignment, byte steps until both are aligned then full words
+                for (; i < n && ((uintptr_t)(a + i) & (W - 1)); ++i) {
+                    if (FoldAscii(a[i]) != FoldAscii(b[i])) return false;
+                }
+                for (; i + W <= n; i += W) {
+                    if (Fold(LoadAligned(a + i)) != Fold(LoadAligned(b + i))) return false;
+                }
+            } else {
+                for (; i + W <= n; i += W) {
+                    if (Fold(Load(a + i)) != Fold(Load(b + i))) return false;
+                }
+            }
+            for (; i < n; ++i) {
+                if (FoldAscii(a[i]) != FoldAscii(b[i])) return false;
+            }
+            return true;
+#else
+            return Scalar::EqualsIC(a, b, n);
+#endif
+        }
+
+        /** first char is located by the FindChar kernel, the rest verified with memcmp */
+        inline const char* FindString(const char* p, size_t n, const char* needle, size_t needleLen) {
+#if defined(DALHAL_ZCS_KERNELS_SCALAR)
+            return Scalar::FindString(p, n, needle, needleLen);
+#else
+            if (needleLen == 0 || needleLen > n) return nullptr;
+            const char first = needle[0];
+            const char* const last = p + n - needleLen; // last possible start
+            while (p <= last) {
+                const char* hit = FindChar(p, (size_t)(last - p) + 1, first);
+                if (hit == nullptr) return nullptr;
+                if (std::memcmp(hit + 1, needle + 1, needleLen - 1) == 0) return hit;
+                p = hit + 1;
+            }
+            return nullptr;
+#endif
+        }
+
+    }
+
+}
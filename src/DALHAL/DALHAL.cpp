@@ -72,6 +72,10 @@ namespace DALHAL {
             CommandExecutor::g_pending.pop();
             CommandExecutor_UNLOCK_QUEUE();
 
+            if (pr.binary) {
+                BinaryCommand::Execute(pr.command, pr.clientId, pr.cb);
+                continue;
+            }
             ZeroCopyString zcCmd(pr.command.c_str());
             /*bool ok = */CommandExecutor::execute(zcCmd, pr.cb);
         }
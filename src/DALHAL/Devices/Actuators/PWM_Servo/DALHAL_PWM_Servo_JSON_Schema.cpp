@@ -23,11 +23,14 @@
 
 #include "DALHAL_PWM_Servo_JSON_Schema.h"
 
+#include <stddef.h>
+
 #include <DALHAL/Core/Manager/DALHAL_GPIO_Manager.h>
 
 #include <DALHAL/Core/JsonConfig/Types/Base/DALHAL_JSON_Schema_TypeBase.h>
 #include <DALHAL/Core/JsonConfig/Types/Root/DALHAL_JSON_Schema_ModeSelector.h>
 #include <DALHAL/Core/JsonConfig/Types/Root/DALHAL_JSON_Schema_FieldConstraint.h>
+#include <DALHAL/Core/JsonConfig/Types/Root/DALHAL_JSON_Schema_JsonObjectSchema.h>
 #include <DALHAL/Core/JsonConfig/Types/Primitives/DALHAL_JSON_Schema_UInt.h>
 #include <DALHAL/Core/JsonConfig/Types/Logical/DALHAL_JSON_Schema_HardwarePin.h>
 #include <DALHAL/Core/JsonConfig/Types/Primitives/DALHAL_JSON_Schema_Float.h>
@@ -45,14 +48,26 @@ namespace DALHAL {
 
             //constexpr SchemaHardwarePin pinField = { DALHAL_COMMON_CFG_NAME_PIN, FieldPolicy::Required, (GPIO_manager::PinFunc::OUT)};
 
-            constexpr SchemaUInt chField = {"ch", FieldPolicy::Required, (unsigned int)0, (unsigned int)7, (unsigned int)0};
+            /** staging struct filled by JsonObjectSchema::ExtractToStruct */
+            struct Config {
+                int32_t pin; // CommonPins::OutputPinField extracts to offsetof(PinConfig, pin)
+                uint32_t ch;
+                uint32_t minPulseLength;
+                uint32_t maxPulseLength;
+                uint32_t startPulseLength;
+                uint32_t autoOffAfterMs;
+                uint32_t pulseLengthOffset;
+            };
+            static_assert(offsetof(Config, pin) == offsetof(PinConfig, pin), "Config::pin must match PinConfig::pin");
+
+            constexpr SchemaUInt chField = {"ch", FieldPolicy::Required, (unsigned int)0, (unsigned int)7, (unsigned int)0, DALHAL_JSON_SCHEMA_MEMBER(Config, ch)};
 
-            constexpr SchemaUInt minPulseLengthField = {"minPulseLength", FieldPolicy::Optional, (unsigned int)100, (unsigned int)20000, (unsigned int)1000};
-            constexpr SchemaUInt maxPulseLengthField = {"maxPulseLength", FieldPolicy::Optional, (unsigned int)100, (unsigned int)20000, (unsigned int)2000};
-            constexpr SchemaUInt startPulseLengthField = {"startPulseLength", FieldPolicy::Optional, (unsigned int)100, (unsigned int)20000, (unsigned int)1500};
+            constexpr SchemaUInt minPulseLengthField = {"minPulseLength", FieldPolicy::Optional, (unsigned int)100, (unsigned int)20000, (unsigned int)1000, DALHAL_JSON_SCHEMA_MEMBER(Config, minPulseLength)};
+            constexpr SchemaUInt maxPulseLengthField = {"maxPulseLength", FieldPolicy::Optional, (unsigned int)100, (unsigned int)20000, (unsigned int)2000, DALHAL_JSON_SCHEMA_MEMBER(Config, maxPulseLength)};
+            constexpr SchemaUInt startPulseLengthField = {"startPulseLength", FieldPolicy::Optional, (unsigned int)100, (unsigned int)20000, (unsigned int)1500, DALHAL_JSON_SCHEMA_MEMBER(Config, startPulseLength)};
 
-            constexpr SchemaUInt autoOffAfterMsField = {"autoOffAfterMs", FieldPolicy::Optional, (unsigned int)0, (unsigned int)0, (unsigned int)0};
-            constexpr SchemaUInt pulseLengthOffsetField = {"pulseLengthOffset", FieldPolicy::Optional, (unsigned int)0, (unsigned int)0, (unsigned int)0};
+            constexpr SchemaUInt autoOffAfterMsField = {"autoOffAfterMs", FieldPolicy::Optional, (unsigned int)0, (unsigned int)0, (unsigned int)0, DALHAL_JSON_SCHEMA_MEMBER(Config, autoOffAfterMs)};
+            constexpr SchemaUInt pulseLengthOffsetField = {"pulseLengthOffset", FieldPolicy::Optional, (unsigned int)0, (unsigned int)0, (unsigned int)0, DALHAL_JSON_SCHEMA_MEMBER(Config, pulseLengthOffset)};
 
             constexpr SchemaFloat minValField = {"minVal", FieldPolicy::ModeDefine, (unsigned int)0};
             constexpr SchemaFloat maxValField = {"maxVal", FieldPolicy::ModeDefine, (unsigned int)100};
@@ -126,14 +141,16 @@ namespace DALHAL {
 
             void Extractors::Apply(const DALHAL::DeviceCreateContext& context, DALHAL::PWM_Servo* out) {
                 out->uid = encodeUID(JsonSchema::CommonBase::uidFieldRequired.ExtractFrom(*(context.jsonObjItem)));
-                out->pin = JsonSchema::CommonPins::OutputPinField.ExtractFrom(*(context.jsonObjItem));
-                out->pwmChannel = (ledc_channel_t)JsonSchema::PWM_Servo::chField.ExtractFrom(*(context.jsonObjItem));
-
-                out->minPulseLength = JsonSchema::PWM_Servo::minPulseLengthField.ExtractFrom(*(context.jsonObjItem));
-                out->maxPulseLength = JsonSchema::PWM_Servo::maxPulseLengthField.ExtractFrom(*(context.jsonObjItem));
-                out->startPulseLength = JsonSchema::PWM_Servo::startPulseLengthField.ExtractFrom(*(context.jsonObjItem));
-                out->autoOffAfterMs = JsonSchema::PWM_Servo::autoOffAfterMsField.ExtractFrom(*(context.jsonObjItem));
-                out->pulseLengthOffset = JsonSchema::PWM_Servo::pulseLengthOffsetField.ExtractFrom(*(context.jsonObjItem));
+
+                Config cfg;
+                JsonSchema::JsonObjectSchema::ExtractToStruct(&JsonSchema::PWM_Servo::Root, *(context.jsonObjItem), &cfg);
+                out->pin = cfg.pin;
+                out->pwmChannel = (ledc_channel_t)cfg.ch;
+                out->minPulseLength = cfg.minPulseLength;
+                out->maxPulseLength = cfg.maxPulseLength;
+                out->startPulseLength = cfg.startPulseLength;
+                out->autoOffAfterMs = cfg.autoOffAfterMs;
+                out->pulseLengthOffset = cfg.pulseLengthOffset;
 
                 JsonSchema::ModeSelector::Apply(JsonSchema::PWM_Servo::Root.modes, context, out);
             }
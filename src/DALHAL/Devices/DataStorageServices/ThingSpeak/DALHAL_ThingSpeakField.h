@@ -26,6 +26,7 @@
 #include <DALHAL/Core/Types/DALHAL_CachedDeviceRead.h>
 #include <DALHAL/Core/Types/DALHAL_ZeroCopyString.h>
 #include <DALHAL/Core/Reactive/DALHAL_ReactiveEvent.h>
+#include <DALHAL/Support/DALHAL_Arena.h>
 
 namespace DALHAL {
 
@@ -39,6 +40,9 @@ namespace DALHAL {
         ThingSpeakField();
         ~ThingSpeakField();
 
+        /** the field array is allocated from the DeviceArena when created during a cfg load */
+        DALHAL_ARENA_ALLOCATED
+
         void Set(int index, const char* uidPath_cStr, bool _sendAllInSync = false);
 
         inline bool DataReady() {
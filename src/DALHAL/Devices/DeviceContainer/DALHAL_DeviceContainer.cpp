@@ -26,6 +26,7 @@
 #include <DALHAL/Support/DALHAL_Logger.h>
 
 #include "DALHAL_DeviceContainer_JSON_Schema.h"
+#include <DALHAL/Core/Manager/DALHAL_DeviceArena.h>
 
 namespace DALHAL {
 
@@ -45,7 +46,7 @@ namespace DALHAL {
             for (int i = 0; i < deviceCount; ++i) {
                 delete devices[i];
             }
-            delete[] devices;
+            DeviceArena::DeleteDeviceArray(devices);
         }
     }
 
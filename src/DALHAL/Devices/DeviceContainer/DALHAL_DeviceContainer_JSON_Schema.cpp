@@ -32,6 +32,7 @@
 
 #include "DALHAL_DeviceContainer.h"
 #include <DALHAL/Core/Manager/DALHAL_DeviceManager.h>
+#include <DALHAL/Core/Manager/DALHAL_DeviceArena.h>
 
 namespace DALHAL {
 
@@ -80,7 +81,7 @@ namespace DALHAL {
                 }
 
                 // Allocate space for all devices
-                out->devices = new Device*[out->deviceCount]();
+                out->devices = DeviceArena::NewDeviceArray(out->deviceCount);
 
                 if (out->devices == nullptr) {
                     out->deviceCount = 0;
@@ -29,6 +29,7 @@
 #include <DALHAL/Support/DALHAL_Logger.h>
 
 #include "DALHAL_Display_SSD1306_JSON_Schema.h"
+#include <DALHAL/Core/Manager/DALHAL_DeviceArena.h>
 
 namespace DALHAL {
 
@@ -96,7 +97,7 @@ namespace DALHAL {
                 delete elements[i];
                 elements[i] = nullptr;
             }
-            delete[] elements;
+            DeviceArena::DeleteDeviceArray(elements);
             elements = nullptr;
             elementCount = 0;
         }
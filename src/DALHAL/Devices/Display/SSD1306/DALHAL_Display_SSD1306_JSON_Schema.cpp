@@ -45,6 +45,7 @@
 #include "DALHAL_Display_SSD1306_Element.h"
 
 #include "DALHAL_Display_SSD1306_Element_JSON_Schema.h"
+#include <DALHAL/Core/Manager/DALHAL_DeviceArena.h>
 
 namespace DALHAL {
 
@@ -110,7 +111,7 @@ namespace DALHAL {
                     out->elementCount++;
                 }
                 // second pass actually create the devices
-                out->elements = new Device*[out->elementCount]();
+                out->elements = DeviceArena::NewDeviceArray(out->elementCount);
                 int index = 0;
                 DeviceCreateContext createContext;
                 createContext.deviceType = "Display_SSD1306_Element";
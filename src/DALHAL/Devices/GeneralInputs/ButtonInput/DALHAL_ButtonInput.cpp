@@ -70,6 +70,7 @@ namespace DALHAL {
     }
 
     ButtonInput::~ButtonInput() {
+        capture.end();
         if (toggleTarget != nullptr) {
             delete toggleTarget;
             toggleTarget = nullptr;
@@ -80,72 +81,101 @@ namespace DALHAL {
     ButtonInput::ButtonInput(DeviceCreateContext& context) : ButtonInput_DeviceBase(context.deviceType)
     {
         JsonSchema::ButtonInput::Extractors::Apply(context, this);
-        pinMode(pin, INPUT);
 
         // Initial states
-        stableState = digitalRead(pin);
+        if (isr) {
+            stableState = capture.begin(pin, INPUT);
+            lastChange = micros();
+        } else {
+            pinMode(pin, INPUT);
+            stableState = digitalRead(pin);
+            lastChange = millis();
+        }
         lastRaw = stableState;
-        lastChangeMs = millis();
     }
 
     // Loop: call from main scheduler
     void ButtonInput::loop() {
+        if (isr) {
+            const uint32_t stableTimeUs = debounceMs * 1000;
+            EdgeCapture::Edge edge;
+            while (capture.pop(edge)) {
+                // the previous raw level could have been stable long enough before this edge arrived
+                debounce(lastRaw, edge.timeUs, stableTimeUs);
+                if (edge.level != lastRaw) {
+                    lastRaw = edge.level;
+                    lastChange = edge.timeUs;
+                }
+            }
+            debounce(lastRaw, micros(), stableTimeUs);
+            return;
+        }
+
         bool raw = digitalRead(pin);
         uint32_t now = millis();
 
         // Detect raw changes
         if (raw != lastRaw) {
             lastRaw = raw;
-            lastChangeMs = now;
+            lastChange = now;
         }
+        debounce(raw, now, debounceMs);
+    }
 
+    void ButtonInput::debounce(bool raw, uint32_t now, uint32_t stableTime) {
         // If stable long enough and state changed
-        if ((now - lastChangeMs) >= debounceMs && raw != stableState) {
+        if ((now - lastChange) >= stableTime && raw != stableState) {
             stableState = raw;
+            onStableStateChange();
+        }
+    }
 
-            bool pressed = activeLevel ? stableState : !stableState;
+    void ButtonInput::onStableStateChange() {
+        bool pressed = activeLevel ? stableState : !stableState;
 
-            if (pressed) {
+        if (pressed) {
 #if HAS_REACTIVE_CUSTOM(BUTTON_INPUT)
-                triggerPress();
+            triggerPress();
 #endif
-                // Optional: call external device/action directly
-                if (toggleTarget != nullptr) {
-                    HALValue currValue;
-                    HALOperationResult res = toggleTarget->ReadSimple(currValue);
-                    if (res != HALOperationResult::Success) {
-
-                        DALHAL::BlockStreamer bs(DALHAL::WebSocketAPI::BroadcastCb, "log entry", DALHAL::BlockStreamer::DataType::PlainText);
-                        bs.writer().write(F("[ButtonInput] pressed, toggleState could not execute: "));
-                        decodeUID(uid, bs.writer());
-                        
-                        return;
-                    } 
-                    HALValue newVal = currValue.toBool() ? false : true;
-                    toggleTarget->WriteSimple(newVal);
-
-                    DALHAL::BlockStreamer bs(DALHAL::WebSocketAPI::BroadcastCb, "log entry", DALHAL::BlockStreamer::DataType::PlainText);
-                    bs.writer().write(F("[ButtonInput] pressed, toggleState="));
-                    bs.writer().write(newVal);
-                    //newVal.toString(bs.writer());
-                
-                } else {
+            // Optional: call external device/action directly
+            if (toggleTarget != nullptr) {
+                HALValue currValue;
+                HALOperationResult res = toggleTarget->ReadSimple(currValue);
+                if (res != HALOperationResult::Success) {
 
                     DALHAL::BlockStreamer bs(DALHAL::WebSocketAPI::BroadcastCb, "log entry", DALHAL::BlockStreamer::DataType::PlainText);
-                    bs.writer().write(F("[ButtonInput] pressed, toggleState could not execute because no targetdevice"));
+                    bs.writer().write(F("[ButtonInput] pressed, toggleState could not execute: "));
                     decodeUID(uid, bs.writer());
                     
-                }
-
+                    return;
+                } 
+                HALValue newVal = currValue.toBool() ? false : true;
+                toggleTarget->WriteSimple(newVal);
+
+                DALHAL::BlockStreamer bs(DALHAL::WebSocketAPI::BroadcastCb, "log entry", DALHAL::BlockStreamer::DataType::PlainText);
+                bs.writer().write(F("[ButtonInput] pressed, toggleState="));
+                bs.writer().write(newVal);
+                //newVal.toString(bs.writer());
+            
             } else {
+
+                DALHAL::BlockStreamer bs(DALHAL::WebSocketAPI::BroadcastCb, "log entry", DALHAL::BlockStreamer::DataType::PlainText);
+                bs.writer().write(F("[ButtonInput] pressed, toggleState could not execute because no targetdevice"));
+                decodeUID(uid, bs.writer());
+                
+            }
+
+        } else {
 #if HAS_REACTIVE_CUSTOM(BUTTON_INPUT)
-                triggerRelease();
+            triggerRelease();
+#endif
+        }
+#if HAS_REACTIVE_VALUE_CHANGE(BUTTON_INPUT)
+        triggerValueChange();
 #endif
-            }
 #if HAS_REACTIVE_STATE_CHANGE(BUTTON_INPUT)
-            triggerStateChange();
+        triggerStateChange();
 #endif
-        }
     }
 
     // Read: returns the toggle state
@@ -166,6 +196,10 @@ namespace DALHAL {
         sbs.write_jsonNumber(F("activeLevel"), activeLevel);
         sbs.write_json_value_separator();
         sbs.write_jsonNumber(F("debounceMs"), debounceMs);
+        if (isr) {
+            sbs.write_json_value_separator();
+            sbs.write_jsonNumber(F("overflows"), capture.getOverflowCount());
+        }
 
     }
 
@@ -32,6 +32,8 @@
 
 #include <DALHAL/Core/Types/DALHAL_DeviceFunctionTable.h>
 
+#include <DALHAL/Drivers/DALHAL_EdgeCapture.h>
+
 #include <DALHAL/Core/Reactive/DALHAL_ReactiveConfig.h>
 #if USING_REACTIVE(BUTTON_INPUT)
 #include "DALHAL_ButtonInput_Reactive.h"
@@ -61,12 +63,19 @@ namespace DALHAL {
         uint8_t pin;
         uint32_t debounceMs;
         uint8_t activeLevel;
+        /** when true edges are captured by a pin change interrupt and debounced from the capture ring */
+        bool isr = false;
 
         bool stableState;       // debounced button state
         bool lastRaw;           // last raw read
-        uint32_t lastChangeMs;  // last change timestamp
+        uint32_t lastChange;    // last change timestamp (ms when polling, us in isr mode)
+
+        CachedDeviceAccess* toggleTarget = nullptr; // optional external action
+
+        EdgeCapture capture;
 
-        CachedDeviceAccess* toggleTarget; // optional external action
+        void debounce(bool raw, uint32_t now, uint32_t stableTime);
+        void onStableStateChange();
 
     public:
         ButtonInput(DeviceCreateContext& context);
@@ -74,7 +83,7 @@ namespace DALHAL {
 
         const Registry::DefineBase* GetRegistryDefine() override;
 
-        void loop();
+        void loop() override;
         
         void PrintTo(StringBuilderStreamer& sbs) override;
 
@@ -23,10 +23,14 @@
 
 #include "DALHAL_ButtonInput_JSON_Schema.h"
 
+#include <stddef.h>
+
 #include <DALHAL/Core/Manager/DALHAL_GPIO_Manager.h>
 
 #include <DALHAL/Core/JsonConfig/Types/Base/DALHAL_JSON_Schema_TypeBase.h>
 #include <DALHAL/Core/JsonConfig/Types/Primitives/DALHAL_JSON_Schema_UInt.h>
+#include <DALHAL/Core/JsonConfig/Types/Primitives/DALHAL_JSON_Schema_Bool.h>
+#include <DALHAL/Core/JsonConfig/Types/Primitives/DALHAL_JSON_Schema_String.h>
 #include <DALHAL/Core/JsonConfig/Types/Logical/DALHAL_JSON_Schema_HardwarePin.h>
 #include <DALHAL/Core/JsonConfig/Types/Logical/String/DALHAL_JSON_Schema_StringAnyOfArrayConstrained.h> // also ByArrayConstraints
 #include <DALHAL/Core/JsonConfig/Types/Root/DALHAL_JSON_Schema_JsonObjectSchema.h>
@@ -42,20 +46,33 @@ namespace DALHAL {
 
         namespace ButtonInput {
 
-            constexpr SchemaHardwarePin pinField = { DALHAL_COMMON_CFG_NAME_PIN, FieldPolicy::Required, (GPIO_manager::PinFunc::IN) };
-            constexpr SchemaUInt debounceMsField = { "debounceMs", FieldPolicy::Optional, (unsigned int)1, (unsigned int)0, (unsigned int)30};
+            /** staging struct filled by JsonObjectSchema::ExtractToStruct */
+            struct Config {
+                int32_t pin;
+                uint32_t debounceMs;
+                uint32_t activeLevel;
+                bool isr;
+                const char* on_press;
+            };
+
+            constexpr SchemaHardwarePin pinField = { DALHAL_COMMON_CFG_NAME_PIN, FieldPolicy::Required, (GPIO_manager::PinFunc::IN), DALHAL_JSON_SCHEMA_MEMBER(Config, pin) };
+            constexpr SchemaUInt debounceMsField = { "debounceMs", FieldPolicy::Optional, (unsigned int)1, (unsigned int)0, (unsigned int)30, DALHAL_JSON_SCHEMA_MEMBER(Config, debounceMs)};
 
             //constexpr ByArrayConstraints activeLevelConstraints = {CommonPins::activeLevelStrings, ByArrayConstraints::Policy::IgnoreCase};
             //constexpr SchemaStringAnyOfArrayConstrained activeLevelField = { "activeLevel", FieldPolicy::Optional, "high", &activeLevelConstraints};
-            constexpr SchemaUInt activeLevelField = {"activeLevel", FieldPolicy::Optional, (unsigned int)0, (unsigned int)1, (unsigned int)0}; 
+            constexpr SchemaUInt activeLevelField = {"activeLevel", FieldPolicy::Optional, (unsigned int)0, (unsigned int)1, (unsigned int)0, DALHAL_JSON_SCHEMA_MEMBER(Config, activeLevel)}; 
             
-            constexpr SchemaString on_pressField = { "on_press", FieldPolicy::Optional};
+            /** capture edges with a pin change interrupt so presses are not missed while the loop is blocked */
+            constexpr SchemaBool isrField = { "isr", FieldPolicy::Optional, false, DALHAL_JSON_SCHEMA_MEMBER(Config, isr) };
+            
+            constexpr SchemaString on_pressField = { "on_press", FieldPolicy::Optional, "", DALHAL_JSON_SCHEMA_MEMBER(Config, on_press)};
 
             constexpr const SchemaTypeBase* fields[] = {
                 &CommonBase::disabled_type_uidreq_note_group, // DALHAL_CommonSchemas_Base
                 &pinField,
                 &debounceMsField,
                 &activeLevelField,
+                &isrField,
                 &on_pressField,
                 nullptr,
             };
@@ -71,14 +88,18 @@ namespace DALHAL {
 
             void Extractors::Apply(const DALHAL::DeviceCreateContext& context, DALHAL::ButtonInput* out) {
                 out->uid = encodeUID(JsonSchema::CommonBase::uidFieldRequired.ExtractFrom(*(context.jsonObjItem)));
-                out->pin = JsonSchema::ButtonInput::pinField.ExtractFrom(*(context.jsonObjItem));
-                out->debounceMs = JsonSchema::ButtonInput::debounceMsField.ExtractFrom(*(context.jsonObjItem));
-                out->activeLevel = JsonSchema::ButtonInput::activeLevelField.ExtractFrom(*(context.jsonObjItem));
+
+                Config cfg;
+                JsonSchema::JsonObjectSchema::ExtractToStruct(&JsonSchema::ButtonInput::Root, *(context.jsonObjItem), &cfg);
+                out->pin = cfg.pin;
+                out->debounceMs = cfg.debounceMs;
+                out->activeLevel = cfg.activeLevel;
+                out->isr = cfg.isr;
 
                 // Optional external action target
                 // todo can also use react events
                 // but this allow direct actions
-                const char* on_press_cStr = JsonSchema::ButtonInput::on_pressField.ExtractFrom(*(context.jsonObjItem));
+                const char* on_press_cStr = cfg.on_press;
                 if (on_press_cStr != nullptr) {
                     out->toggleTarget = new CachedDeviceAccess();
                     if (out->toggleTarget->Set(on_press_cStr) == false) {
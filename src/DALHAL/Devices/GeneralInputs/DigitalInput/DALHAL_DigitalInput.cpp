@@ -44,13 +44,19 @@ namespace DALHAL {
         return &RegistryDefine;
     }
 
+    constexpr FunctionEntry<FunctionTypes::Exec> DigitalInput::execFunctions[] = {
+        DALHAL_FUNCTION_ENTRY("resetCount", exec_resetCount, "reset the pulse counter (isr mode)")
+    };
+
     constexpr FunctionEntry<FunctionTypes::ReadToHALValue> DigitalInput::readValueFunctions[] = {
-        DALHAL_PRIMARY_FUNCTION_ENTRY(HALValue_primary_read, "read digital value")
+        DALHAL_PRIMARY_FUNCTION_ENTRY(HALValue_primary_read, "read digital value"),
+        DALHAL_FUNCTION_ENTRY("count", HALValue_count_read, "read number of rising edges (isr mode)"),
+        DALHAL_FUNCTION_ENTRY("freq", HALValue_freq_read, "read rising edge frequency in Hz (isr mode)")
     };
 
     __attribute__((used, externally_visible))
     constexpr DeviceFunctionTable DigitalInput::FunctionTable = {
-        EmptyFunctionTable<FunctionTypes::Exec>,
+        DALHAL_FUNCTION_TABLE_ENTRY(execFunctions),
         DALHAL_FUNCTION_TABLE_ENTRY(readValueFunctions),
         EmptyFunctionTable<FunctionTypes::WriteHALValue>,
         EmptyFunctionTable<FunctionTypes::BracketOpRead>,
@@ -65,27 +71,84 @@ namespace DALHAL {
 
     DigitalInput::DigitalInput(DeviceCreateContext& context) : DigitalInput_DeviceBase(context.deviceType) {
         JsonSchema::DigitalInput::Extractors::Apply(context, this);
-        pinMode(pin, INPUT);
+        if (isr) {
+            state = capture.begin(pin, INPUT);
+        } else {
+            pinMode(pin, INPUT);
+        }
+    }
+
+    void DigitalInput::loop() {
+        if (isr == false) return;
+
+        EdgeCapture::Edge edge;
+        while (capture.pop(edge)) {
+            if (edge.level == state) continue;
+            state = edge.level;
+#if HAS_REACTIVE_VALUE_CHANGE(DIGITAL_INPUT)
+            triggerValueChange();
+#endif
+#if HAS_REACTIVE_STATE_CHANGE(DIGITAL_INPUT)
+            triggerStateChange();
+#endif
+        }
     }
 
     /* static */
     HALOperationResult DigitalInput::HALValue_primary_read(Device* device, HALValue& val) {
         DigitalInput& self = static_cast<DigitalInput&>(*device);
 
-        val = (uint32_t)digitalRead(self.pin);
+        if (self.isr) {
+            val = (uint32_t)self.state;
+        } else {
+            val = (uint32_t)digitalRead(self.pin);
+        }
 #if HAS_REACTIVE_READ(DIGITAL_INPUT)
         self.triggerRead();
 #endif
         return HALOperationResult::Success;
     }
 
+    /* static */
+    HALOperationResult DigitalInput::HALValue_count_read(Device* device, HALValue& val) {
+        DigitalInput& self = static_cast<DigitalInput&>(*device);
+        if (self.isr == false) return HALOperationResult::UnsupportedOperation;
+        val = self.capture.getPulseCount();
+        return HALOperationResult::Success;
+    }
+
+    /* static */
+    HALOperationResult DigitalInput::HALValue_freq_read(Device* device, HALValue& val) {
+        DigitalInput& self = static_cast<DigitalInput&>(*device);
+        if (self.isr == false) return HALOperationResult::UnsupportedOperation;
+        val = self.capture.getFrequency();
+        return HALOperationResult::Success;
+    }
+
+    /* static */
+    HALOperationResult DigitalInput::exec_resetCount(Device* device) {
+        DigitalInput& self = static_cast<DigitalInput&>(*device);
+        if (self.isr == false) return HALOperationResult::UnsupportedOperation;
+        self.capture.resetPulseCount();
+#if HAS_REACTIVE_EXEC(DIGITAL_INPUT)
+        self.triggerExec();
+#endif
+        return HALOperationResult::Success;
+    }
+
     void DigitalInput::PrintTo(StringBuilderStreamer& sbs) {
         Device::PrintTo(sbs);
 
         sbs.write_json_value_separator();
         sbs.write_jsonNumber(F("pin"), pin);
         sbs.write_json_value_separator();
-        sbs.write_jsonNumber(F("value"), digitalRead(pin));
+        sbs.write_jsonNumber(F("value"), isr ? state : digitalRead(pin));
+        if (isr) {
+            sbs.write_json_value_separator();
+            sbs.write_jsonNumber(F("count"), capture.getPulseCount());
+            sbs.write_json_value_separator();
+            sbs.write_jsonNumber(F("overflows"), capture.getOverflowCount());
+        }
     }
 	
 }
\ No newline at end of file
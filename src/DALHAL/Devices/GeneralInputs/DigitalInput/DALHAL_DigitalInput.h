@@ -32,6 +32,8 @@
 
 #include <DALHAL/Core/Types/DALHAL_DeviceFunctionTable.h>
 
+#include <DALHAL/Drivers/DALHAL_EdgeCapture.h>
+
 #include <DALHAL/Core/Reactive/DALHAL_ReactiveConfig.h>
 #if USING_REACTIVE(DIGITAL_INPUT)
 #include "DALHAL_DigitalInput_Reactive.h"
@@ -53,18 +55,30 @@ namespace DALHAL {
 
     private:
         static const DeviceFunctionTable FunctionTable;
+        static const FunctionEntry<FunctionTypes::Exec> execFunctions[];
         static const FunctionEntry<FunctionTypes::ReadToHALValue> readValueFunctions[];
 
         static HALOperationResult HALValue_primary_read(Device* device, HALValue &val);
+        static HALOperationResult HALValue_count_read(Device* device, HALValue &val);
+        static HALOperationResult HALValue_freq_read(Device* device, HALValue &val);
+        static HALOperationResult exec_resetCount(Device* device);
 
     private:
         uint8_t pin = 0;
+        /** when true the pin is captured by a pin change interrupt instead of read on demand */
+        bool isr = false;
+        /** last state seen in the capture ring, only used in isr mode */
+        uint8_t state = 0;
+
+        EdgeCapture capture;
 
     public:
         DigitalInput(DeviceCreateContext& context);
         ~DigitalInput() override = default;
 
         const Registry::DefineBase* GetRegistryDefine() override;
+
+        void loop() override;
         
         void PrintTo(StringBuilderStreamer& sbs) override;
         
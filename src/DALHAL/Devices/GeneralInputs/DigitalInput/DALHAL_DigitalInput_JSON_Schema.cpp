@@ -23,9 +23,12 @@
 
 #include "DALHAL_DigitalInput_JSON_Schema.h"
 
+#include <stddef.h>
+
 #include <DALHAL/Core/Manager/DALHAL_GPIO_Manager.h>
 
 #include <DALHAL/Core/JsonConfig/Types/Base/DALHAL_JSON_Schema_TypeBase.h>
+#include <DALHAL/Core/JsonConfig/Types/Primitives/DALHAL_JSON_Schema_Bool.h>
 #include <DALHAL/Core/JsonConfig/Types/Logical/DALHAL_JSON_Schema_HardwarePin.h>
 #include <DALHAL/Core/JsonConfig/Types/Root/DALHAL_JSON_Schema_JsonObjectSchema.h>
 
@@ -40,11 +43,20 @@ namespace DALHAL {
 
         namespace DigitalInput {
 
-            constexpr SchemaHardwarePin pinField = { DALHAL_COMMON_CFG_NAME_PIN, FieldPolicy::Required, (GPIO_manager::PinFunc::IN) };
+            /** staging struct filled by JsonObjectSchema::ExtractToStruct */
+            struct Config {
+                int32_t pin;
+                bool isr;
+            };
+
+            constexpr SchemaHardwarePin pinField = { DALHAL_COMMON_CFG_NAME_PIN, FieldPolicy::Required, (GPIO_manager::PinFunc::IN), DALHAL_JSON_SCHEMA_MEMBER(Config, pin) };
+            /** capture edges with a pin change interrupt, enables pulse counting/frequency readout */
+            constexpr SchemaBool isrField = { "isr", FieldPolicy::Optional, false, DALHAL_JSON_SCHEMA_MEMBER(Config, isr) };
 
             constexpr const SchemaTypeBase* fields[] = {
                 &CommonBase::disabled_type_uidreq_note_group, // DALHAL_CommonSchemas_Base
                 &pinField,
+                &isrField,
                 nullptr,
             };
 
@@ -59,7 +71,11 @@ namespace DALHAL {
 
             void Extractors::Apply(const DALHAL::DeviceCreateContext& context, DALHAL::DigitalInput* out) {
                 out->uid = encodeUID(JsonSchema::CommonBase::uidFieldRequired.ExtractFrom(*(context.jsonObjItem)));
-                out->pin = JsonSchema::DigitalInput::pinField.ExtractFrom(*(context.jsonObjItem));
+
+                Config cfg;
+                JsonSchema::JsonObjectSchema::ExtractToStruct(&JsonSchema::DigitalInput::Root, *(context.jsonObjItem), &cfg);
+                out->pin = cfg.pin;
+                out->isr = cfg.isr;
             }
 
         }
@@ -23,6 +23,8 @@
 
 #include "DALHAL_SinglePulseOutput_JSON_Schema.h"
 
+#include <stddef.h>
+
 #include <DALHAL/Core/Manager/DALHAL_GPIO_Manager.h>
 
 #include <DALHAL/Core/JsonConfig/Types/Base/DALHAL_JSON_Schema_TypeBase.h>
@@ -44,12 +46,19 @@ namespace DALHAL {
 
         namespace SinglePulseOutput {
 
-            constexpr SchemaHardwarePin pinField = { DALHAL_COMMON_CFG_NAME_PIN, FieldPolicy::Required, (GPIO_manager::PinFunc::IN) };
-            constexpr SchemaUInt pulseLengthField = { DALHAL_KEYNAME_SINGLE_PULSE_OUTPUT_DEFAULT_PULSE_LENGHT, FieldPolicy::Optional, (unsigned int)1, (unsigned int)0, (unsigned int)500};
+            /** staging struct filled by JsonObjectSchema::ExtractToStruct */
+            struct Config {
+                int32_t pin;
+                uint32_t pulseLength;
+                uint32_t activeLevel;
+            };
+
+            constexpr SchemaHardwarePin pinField = { DALHAL_COMMON_CFG_NAME_PIN, FieldPolicy::Required, (GPIO_manager::PinFunc::IN), DALHAL_JSON_SCHEMA_MEMBER(Config, pin) };
+            constexpr SchemaUInt pulseLengthField = { DALHAL_KEYNAME_SINGLE_PULSE_OUTPUT_DEFAULT_PULSE_LENGHT, FieldPolicy::Optional, (unsigned int)1, (unsigned int)0, (unsigned int)500, DALHAL_JSON_SCHEMA_MEMBER(Config, pulseLength)};
             
             //constexpr ByArrayConstraints activeLevelConstraints = {CommonPins::activeLevelStrings, ByArrayConstraints::Policy::IgnoreCase};
             //constexpr SchemaStringAnyOfArrayConstrained activeLevelField = { "activeLevel", FieldPolicy::Optional, DALHAL_COMMON_CFG_VALUE_PIN_LEVEL_HIGH, &activeLevelConstraints};
-            constexpr SchemaUInt activeLevelField = {"activeLevel", FieldPolicy::Optional, (unsigned int)0, (unsigned int)1, (unsigned int)0}; 
+            constexpr SchemaUInt activeLevelField = {"activeLevel", FieldPolicy::Optional, (unsigned int)0, (unsigned int)1, (unsigned int)0, DALHAL_JSON_SCHEMA_MEMBER(Config, activeLevel)}; 
 
             constexpr const SchemaTypeBase* fields[] = {
                 &CommonBase::disabled_type_uidreq_note_group, // DALHAL_CommonSchemas_Base
@@ -70,10 +79,12 @@ namespace DALHAL {
 
             void Extractors::Apply(const DALHAL::DeviceCreateContext& context, DALHAL::SinglePulseOutput* out) {
                 out->uid = encodeUID(JsonSchema::CommonBase::uidFieldRequired.ExtractFrom(*(context.jsonObjItem)));
-                out->pin = JsonSchema::SinglePulseOutput::pinField.ExtractFrom(*(context.jsonObjItem));
-                out->activeLevel = JsonSchema::SinglePulseOutput::activeLevelField.ExtractFrom(*(context.jsonObjItem));
-                out->pulseLength = JsonSchema::SinglePulseOutput::pulseLengthField.ExtractFrom(*(context.jsonObjItem));
-        
+
+                Config cfg;
+                JsonSchema::JsonObjectSchema::ExtractToStruct(&JsonSchema::SinglePulseOutput::Root, *(context.jsonObjItem), &cfg);
+                out->pin = cfg.pin;
+                out->activeLevel = cfg.activeLevel;
+                out->pulseLength = cfg.pulseLength;
             }
 
         }
@@ -0,0 +1,39 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DALHAL_HA_CapturingPubSubClient.h"
+
+namespace DALHAL
+{
+    CapturingPubSubClient::CapturingPubSubClient(std::string& out) : out(out) { }
+
+    size_t CapturingPubSubClient::write(uint8_t b) {
+        out.push_back((char)b);
+        return 1;
+    }
+
+    size_t CapturingPubSubClient::write(const uint8_t* buffer, size_t size) {
+        out.append((const char*)buffer, size);
+        return size;
+    }
+}
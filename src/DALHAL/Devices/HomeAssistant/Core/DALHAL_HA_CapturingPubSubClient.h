@@ -0,0 +1,42 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <PubSubClient.h>
+#include <string>
+
+namespace DALHAL
+{
+    /** captures everything written into a std::string, used to render a payload once so it can be resent without the source json */
+    class CapturingPubSubClient : public PubSubClient {
+    public:
+        std::string& out;
+        CapturingPubSubClient(std::string& out);
+        
+        virtual size_t write(uint8_t b) override;
+
+        virtual size_t write(const uint8_t* buffer, size_t size) override;
+    };
+}
@@ -29,4 +29,8 @@ namespace DALHAL {
     
     HA_DeviceEntity* HA_Device::findHassDevice(const ZeroCopyString& zcHassUid) { return nullptr; }
 
+    void HA_Device::collectEntities(HA_EntityIndex& index) { }
+
+    void HA_Device::flushState(uint32_t now) { }
+
 }
\ No newline at end of file
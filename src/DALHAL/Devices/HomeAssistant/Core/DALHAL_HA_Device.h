@@ -31,10 +31,15 @@
 namespace DALHAL {
 
     class HA_DeviceEntity; // forward declaration
+    class HA_EntityIndex; // forward declaration
 
     class HA_Device : public Device {
     public:
         virtual HA_DeviceEntity* findHassDevice(const ZeroCopyString& zcHassUid);
+        /** adds every entity of this (sub)tree to the index, called once at begin() */
+        virtual void collectEntities(HA_EntityIndex& index);
+        /** publishes any dirty entity state, called for all devices once per mqtt loop after every device loop() */
+        virtual void flushState(uint32_t now);
 
         HA_Device(HA_CreateFunctionContext& context);
     };
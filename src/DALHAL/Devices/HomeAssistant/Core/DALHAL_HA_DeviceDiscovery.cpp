@@ -29,6 +29,8 @@
 
 #include <DALHAL/Devices/HomeAssistant/Core/DALHAL_HA_Constants.h>
 #include <DALHAL/Devices/HomeAssistant/Core/DALHAL_HA_CountingPubSubClient.h>
+#include <DALHAL/Devices/HomeAssistant/Core/DALHAL_HA_CapturingPubSubClient.h>
+#include <DALHAL/Devices/HomeAssistant/Core/DALHAL_HA_DiscoveryQueue.h>
 
 #include <DALHAL/Core/Types/DALHAL_ZeroCopyString.h>
 #include <DALHAL/Core/JsonConfig/DALHAL_ArduinoJSON_ext.h>
@@ -65,48 +67,17 @@ namespace DALHAL
         psc.write('}'); // end of json object
     }
 
-    void HA_DeviceDiscovery::SendDiscovery(PubSubClient& mqtt, const HA_DD_Context& ctx, HADiscoveryWriteFn entityWriter) {
-        if (ctx.cStr_hass_prev_uid != nullptr &&
-            ctx.cStr_hass_prev_uid[0] != '\0' &&
-            (strcmp(ctx.cStr_hass_prev_uid, ctx.cStr_hass_uid) != 0)) {
-            RemoveCfgTopic(mqtt, ctx.cStr_type, ctx.cStr_hass_prev_uid);
-            delay(250);
-        }
-        // first dry run to calculate payload size
+    void HA_DeviceDiscovery::QueueDiscovery(HA_DiscoveryQueue& queue, const HA_DD_Context& ctx, HADiscoveryWriteFn entityWriter, HA_PublishPolicy* statePolicy) {
+        // only the optional discovery items come from the cfg json which only exist while loading,
+        // they are rendered here, the complete payload is rendered by the queue when it's published
         CountingPubSubClient dryRunPSC;
         SendDiscoveryPayload(dryRunPSC, ctx, entityWriter);
 
-        // second real send 
-        /*Serial.printf("\r\nHASS DD - prepare to send (payloadsize=%d):" DALHAL_DEV_HOME_ASSISTANT_DD_CONFIG_TOPIC_FMT "\r\n",
-            dryRunPSC.count, ctx.cStr_type, unitDeviceUID_MSB, unitDeviceUID_LSB, ctx.cStr_deviceId, ctx.cStr_entity_uid
-        );*/
-
-        if (mqtt.connected() == false) {
-            GlobalLogger.Error(F("could NOT Begin Publish discovery because of disconnected"));
-            return; // no point of continue here
-        }
-        bool couldBeginPublish = mqtt.beginPublish_fmt(
-            dryRunPSC.count, /*retained*/true,
-            DALHAL_DEV_HOME_ASSISTANT_DD_CONFIG_TOPIC_FMT, 
-            ctx.cStr_type, DeviceUID::Get(), ctx.cStr_hass_uid
-        );
-        
-        const char* cfgTopicOut_cStrStart = mqtt.lastTxTopic();
-        const char* cfgTopicOut_cStrEnd = cfgTopicOut_cStrStart + mqtt.lastTxTopicLength();
-        ZeroCopyString zcCfgTopic(cfgTopicOut_cStrStart, cfgTopicOut_cStrEnd);
+        std::string discoveryItems;
+        CapturingPubSubClient capturePSC(discoveryItems);
+        PSC_JsonWriter::SendAllItems(capturePSC, ctx.jsonObj_discovery);
 
-        if (couldBeginPublish == false) {
-            GlobalLogger.Error(F("could NOT Begin Publish discovery:"), zcCfgTopic);
-            return; // no point of continue here
-        }
-        SendDiscoveryPayload(mqtt, ctx, entityWriter);
-        
-        if (mqtt.endPublish()) {
-            GlobalLogger.Info(F("sent discovery: "), zcCfgTopic);
-        } else {
-            GlobalLogger.Error(F("could NOT send discovery: "), zcCfgTopic);
-        }
-        
+        queue.Add(ctx, entityWriter, statePolicy, discoveryItems, dryRunPSC.count);
     }
 
     void HA_DeviceDiscovery::SendStateTopicCfg(PubSubClient& mqtt, const HA_DD_Context& ctx) {
@@ -127,7 +98,13 @@ namespace DALHAL
     void HA_DeviceDiscovery::SendBaseData(PubSubClient& mqtt, const HA_DD_Context& ctx) {
 
         // optional parameters
-        if (ctx.jsonObj_discovery.size() != 0) {
+        if (ctx.cStr_discoveryItems != nullptr) {
+            if (ctx.cStr_discoveryItems[0] != '\0') {
+                mqtt.write((const uint8_t*)ctx.cStr_discoveryItems, strlen(ctx.cStr_discoveryItems));
+                mqtt.write(',');
+                mqtt.write('\n');
+            }
+        } else if (ctx.jsonObj_discovery.size() != 0) {
             PSC_JsonWriter::SendAllItems(mqtt, ctx.jsonObj_discovery);
             mqtt.write(',');
             mqtt.write('\n');
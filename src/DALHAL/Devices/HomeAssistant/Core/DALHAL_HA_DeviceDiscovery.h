@@ -32,6 +32,8 @@
 
 namespace DALHAL
 {
+    class HA_DiscoveryQueue; // forward declaration
+    class HA_PublishPolicy; // forward declaration
     
 
     struct HA_DD_Context {
@@ -50,6 +52,8 @@ namespace DALHAL
         const char* cStr_groupName = nullptr;
         /** the resolved/extracted discovery object */
         const JsonObject& jsonObj_discovery;
+        /** the discovery object already rendered as json members, used instead of jsonObj_discovery when set */
+        const char* cStr_discoveryItems = nullptr;
 
         HA_DD_Context(
             /** the UID used to generate the hass unique_id */
@@ -87,7 +91,11 @@ namespace DALHAL
     public:
         /** used by both the dry run counter and the real send */
         static void SendDiscoveryPayload(PubSubClient& mqtt, const HA_DD_Context& ctx, HADiscoveryWriteFn entityWriter);
-        static void SendDiscovery(PubSubClient& mqtt, const HA_DD_Context& ctx, HADiscoveryWriteFn entityWriter);
+        /**
+         * hands the entity over to the queue which renders and publishes the payload from loop(),
+         * statePolicy (if any) is forced to republish the state each time the discovery has been sent
+         */
+        static void QueueDiscovery(HA_DiscoveryQueue& queue, const HA_DD_Context& ctx, HADiscoveryWriteFn entityWriter, HA_PublishPolicy* statePolicy = nullptr);
         static void SendAvailabilityTopicCfg(PubSubClient& mqtt, const HA_DD_Context& ctx);
         static void SendStateTopicCfg(PubSubClient& mqtt, const HA_DD_Context& ctx);
         static void SendCommandTopicCfg(PubSubClient& mqtt, const HA_DD_Context& ctx);
@@ -22,6 +22,7 @@
 */
 
 #include "DALHAL_HA_DeviceEntity.h"
+#include "DALHAL_HA_EntityIndex.h"
 
 namespace DALHAL {
 
@@ -34,6 +35,10 @@ namespace DALHAL {
         return nullptr;
     }
 
+    void HA_DeviceEntity::collectEntities(HA_EntityIndex& index) {
+        index.Add(this);
+    }
+
     HALOperationResult HA_DeviceEntity::ha_apply(const ZeroCopyString& zcVal) {
         return HALOperationResult::UnsupportedOperation;
     }
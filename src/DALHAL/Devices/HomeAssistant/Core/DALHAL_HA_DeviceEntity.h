@@ -42,6 +42,7 @@ namespace DALHAL {
         virtual HALOperationResult ha_apply(const ZeroCopyString& zcVal);
 
         HA_DeviceEntity* findHassDevice(const ZeroCopyString& zcHassUid) override;
+        void collectEntities(HA_EntityIndex& index) override;
     };
 
 }
\ No newline at end of file
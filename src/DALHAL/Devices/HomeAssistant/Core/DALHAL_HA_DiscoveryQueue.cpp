@@ -0,0 +1,202 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DALHAL_HA_DiscoveryQueue.h"
+#include "DALHAL_HA_DeviceDiscovery.h"
+#include "DALHAL_HA_CapturingPubSubClient.h"
+
+#include <DALHAL/Devices/HomeAssistant/Core/DALHAL_HA_Constants.h>
+#include <DALHAL/Core/Types/DALHAL_ZeroCopyString.h>
+#include <DALHAL/Support/DALHAL_Logger.h>
+
+#include <System/DeviceUID.h> // getDeviceUID
+
+namespace DALHAL
+{
+    HA_DiscoveryQueue::~HA_DiscoveryQueue() {
+        Entry* e = head;
+        while (e != nullptr) {
+            Entry* next = e->next;
+            delete e;
+            e = next;
+        }
+        Group* g = groups;
+        while (g != nullptr) {
+            Group* next = g->next;
+            delete g;
+            g = next;
+        }
+    }
+
+    static const char* OrEmpty(const char* str) {
+        return (str != nullptr) ? str : "";
+    }
+
+    const HA_DiscoveryQueue::Group* HA_DiscoveryQueue::GetGroup(const char* id, const char* name) {
+        id = OrEmpty(id);
+        name = OrEmpty(name);
+        if (groups != nullptr && groups->id == id && groups->name == name) return groups;
+        Group* g = new Group();
+        g->id = id;
+        g->name = name;
+        g->next = groups;
+        groups = g;
+        contextBytes += sizeof(Group) + g->id.capacity() + g->name.capacity();
+        return g;
+    }
+
+    void HA_DiscoveryQueue::Add(const HA_DD_Context& ctx, HADiscoveryWriteFn entityWriter, HA_PublishPolicy* statePolicy, std::string& discoveryItems, uint32_t payloadLength) {
+        Entry* e = new Entry();
+        e->type = OrEmpty(ctx.cStr_type);
+        e->hass_uid = OrEmpty(ctx.cStr_hass_uid);
+        if (ctx.cStr_hass_prev_uid != nullptr && ctx.cStr_hass_prev_uid[0] != '\0') {
+            e->prev_uid = ctx.cStr_hass_prev_uid;
+            e->removePrev = e->prev_uid != e->hass_uid;
+        }
+        e->name = OrEmpty(ctx.cStr_name);
+        e->group = GetGroup(ctx.cStr_groupID, ctx.cStr_groupName);
+        e->discoveryItems.swap(discoveryItems);
+        e->entityWriter = entityWriter;
+        e->statePolicy = statePolicy;
+        e->payloadLength = payloadLength;
+        payloadBytes += payloadLength;
+        contextBytes += sizeof(Entry) + e->type.capacity() + e->hass_uid.capacity() + e->prev_uid.capacity() +
+                        e->name.capacity() + e->discoveryItems.capacity();
+
+        if (tail == nullptr) head = e;
+        else tail->next = e;
+        tail = e;
+        if (cursor == nullptr) cursor = e;
+
+        entryCount++;
+        pendingCount++;
+        announcing = true;
+    }
+
+    void HA_DiscoveryQueue::OnConnected(uint32_t now) {
+        announceStartMs = now;
+        if (head == nullptr) return;
+        pendingCount = 0;
+        for (Entry* e = head; e != nullptr; e = e->next) {
+            e->pending = true;
+            pendingCount++;
+        }
+        cursor = head;
+        waitingAfterRemove = false;
+        announcing = true;
+    }
+
+    bool HA_DiscoveryQueue::Publish(PubSubClient& mqtt, const Entry& entry) {
+        // rendered here and freed on return, the cfg json is not needed as the discovery items were rendered at load
+        std::string payload;
+        payload.reserve(entry.payloadLength);
+        {
+            JsonObject noDiscoveryObj;
+            HA_DD_Context ctx(entry.hass_uid.c_str(), entry.prev_uid.c_str(), entry.type.c_str(), entry.name.c_str(),
+                              entry.group->id.c_str(), entry.group->name.c_str(), noDiscoveryObj);
+            ctx.cStr_discoveryItems = entry.discoveryItems.c_str();
+            CapturingPubSubClient capturePSC(payload);
+            HA_DeviceDiscovery::SendDiscoveryPayload(capturePSC, ctx, entry.entityWriter);
+        }
+
+        bool couldBeginPublish = mqtt.beginPublish_fmt(
+            payload.length(), /*retained*/true,
+            DALHAL_DEV_HOME_ASSISTANT_DD_CONFIG_TOPIC_FMT, 
+            entry.type.c_str(), DeviceUID::Get(), entry.hass_uid.c_str()
+        );
+        const char* cfgTopicOut_cStrStart = mqtt.lastTxTopic();
+        const char* cfgTopicOut_cStrEnd = cfgTopicOut_cStrStart + mqtt.lastTxTopicLength();
+        ZeroCopyString zcCfgTopic(cfgTopicOut_cStrStart, cfgTopicOut_cStrEnd);
+
+        if (couldBeginPublish == false) {
+            GlobalLogger.Error(F("could NOT Begin Publish discovery:"), zcCfgTopic);
+            return false;
+        }
+        mqtt.write((const uint8_t*)payload.c_str(), payload.length());
+        
+        if (mqtt.endPublish() == false) {
+            GlobalLogger.Error(F("could NOT send discovery: "), zcCfgTopic);
+            return false;
+        }
+        GlobalLogger.Info(F("sent discovery: "), zcCfgTopic);
+        return true;
+    }
+
+    void HA_DiscoveryQueue::loop(PubSubClient& mqtt) {
+        if (cursor == nullptr) return;
+        if (mqtt.connected() == false) return;
+
+        uint32_t start = millis();
+        do {
+            Entry& entry = *cursor;
+            if (entry.pending) {
+                if (waitingAfterRemove) {
+                    // replaces the old blocking delay, HA needs a moment to remove the old entity
+                    if (millis() - removeSentMs < DALHAL_HA_DISCOVERY_REMOVE_WAIT_MS) return;
+                    waitingAfterRemove = false;
+                } else if (entry.removePrev) {
+                    HA_DeviceDiscovery::RemoveCfgTopic(mqtt, entry.type.c_str(), entry.prev_uid.c_str());
+                    entry.removePrev = false; // only needs to be done once
+                    waitingAfterRemove = true;
+                    removeSentMs = millis();
+                    return;
+                }
+                if (Publish(mqtt, entry) == false) {
+                    failCount++;
+                    return; // retry next tick
+                }
+                entry.pending = false;
+                pendingCount--;
+                sentCount++;
+                // a state sent before HA knew the entity is lost, so it's sent again
+                if (entry.statePolicy != nullptr) entry.statePolicy->ForcePublish();
+            }
+            cursor = cursor->next;
+        } while (cursor != nullptr && (millis() - start) < DALHAL_HA_DISCOVERY_TICK_BUDGET_MS);
+
+        if (cursor == nullptr && announcing) {
+            announcing = false;
+            lastAnnounceTimeMs = millis() - announceStartMs;
+            GlobalLogger.Info(F("HASS - all discovery sent"));
+        }
+    }
+
+    void HA_DiscoveryQueue::PrintTo(StringBuilderStreamer& sbs) {
+        sbs.write_jsonMemberStart(F("discovery"));
+        sbs.write_json_object_begin();
+        sbs.write_jsonNumber(F("entities"), entryCount);
+        sbs.write_json_value_separator();
+        sbs.write_jsonNumber(F("pending"), pendingCount);
+        sbs.write_json_value_separator();
+        sbs.write_jsonNumber(F("sent"), sentCount);
+        sbs.write_json_value_separator();
+        sbs.write_jsonNumber(F("failed"), failCount);
+        sbs.write_json_value_separator();
+        sbs.write_jsonNumber(F("payloadBytes"), payloadBytes);
+        sbs.write_json_value_separator();
+        sbs.write_jsonNumber(F("contextBytes"), contextBytes);
+        sbs.write_json_value_separator();
+        sbs.write_jsonNumber(F("announceTimeMs"), lastAnnounceTimeMs);
+        sbs.write_json_object_end();
+    }
+}
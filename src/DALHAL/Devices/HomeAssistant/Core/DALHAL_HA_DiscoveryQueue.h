@@ -0,0 +1,115 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <PubSubClient.h>
+#include <string>
+
+#include <DALHAL/API/DALHAL_StringBuilderStreamer.h>
+#include "DALHAL_HA_DeviceDiscovery.h"
+#include "DALHAL_HA_PublishPolicy.h"
+
+/** time to wait after removing a previous unique_id before the new config is published */
+#define DALHAL_HA_DISCOVERY_REMOVE_WAIT_MS 250
+/** max time spent publishing discovery payloads in one loop tick, at least one is always sent */
+#define DALHAL_HA_DISCOVERY_TICK_BUDGET_MS 10
+
+namespace DALHAL
+{
+    /**
+     * paced discovery publisher
+     * only what a payload needs besides the cfg json is kept per entity (the user discovery items are
+     * rendered once when the cfg is loaded as the cfg json only exist at that time),
+     * each payload is then rendered just before it's published from loop() within a small time budget per tick,
+     * so at most one rendered payload is alive at any time
+     */
+    class HA_DiscoveryQueue {
+    private:
+        /** entities of a group are added after each other, so consecutive entries share one */
+        struct Group {
+            std::string id;
+            std::string name;
+            Group* next = nullptr;
+        };
+        struct Entry {
+            std::string type;
+            std::string hass_uid;
+            /** empty when there is no previous unique_id */
+            std::string prev_uid;
+            std::string name;
+            const Group* group = nullptr;
+            /** the optional discovery object of the cfg, already rendered as json members */
+            std::string discoveryItems;
+            HADiscoveryWriteFn entityWriter = nullptr;
+            /** told to republish the state every time the discovery has been sent, nullptr when the entity has no state */
+            HA_PublishPolicy* statePolicy = nullptr;
+            uint32_t payloadLength = 0;
+            /** the previous unique_id is removed once before the first publish */
+            bool removePrev = false;
+            bool pending = true;
+            Entry* next = nullptr;
+        };
+
+        Group* groups = nullptr;
+        Entry* head = nullptr;
+        Entry* tail = nullptr;
+        /** next entry to check, nullptr when everything have been announced */
+        Entry* cursor = nullptr;
+
+        bool waitingAfterRemove = false;
+        uint32_t removeSentMs = 0;
+
+        bool announcing = false;
+        uint32_t announceStartMs = 0;
+        uint32_t lastAnnounceTimeMs = 0;
+
+        uint32_t entryCount = 0;
+        uint32_t pendingCount = 0;
+        uint32_t sentCount = 0;
+        uint32_t failCount = 0;
+        uint32_t payloadBytes = 0;
+        uint32_t contextBytes = 0;
+
+        const Group* GetGroup(const char* id, const char* name);
+        bool Publish(PubSubClient& mqtt, const Entry& entry);
+
+    public:
+        HA_DiscoveryQueue() = default;
+        ~HA_DiscoveryQueue();
+        HA_DiscoveryQueue(const HA_DiscoveryQueue&) = delete;
+        HA_DiscoveryQueue& operator=(const HA_DiscoveryQueue&) = delete;
+
+        /** takes over the rendered discovery items, payloadLength is the size of the complete payload */
+        void Add(const HA_DD_Context& ctx, HADiscoveryWriteFn entityWriter, HA_PublishPolicy* statePolicy, std::string& discoveryItems, uint32_t payloadLength);
+        /** should be called after every successful connect, starts the announce time measurement 
+         * and re-queues all entities */
+        void OnConnected(uint32_t now);
+        void loop(PubSubClient& mqtt);
+
+        bool Done() const { return cursor == nullptr; }
+
+        void PrintTo(StringBuilderStreamer& sbs);
+    };
+}
@@ -0,0 +1,133 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DALHAL_HA_EntityIndex.h"
+
+#include <string.h>
+
+#include "DALHAL_HA_Device.h"
+#include "DALHAL_HA_DeviceEntity.h"
+
+namespace DALHAL
+{
+    HA_EntityIndex::~HA_EntityIndex() {
+        Clear();
+    }
+
+    void HA_EntityIndex::Clear() {
+        delete[] slots;
+        slots = nullptr;
+        mask = 0;
+        count = 0;
+        duplicateCount = 0;
+    }
+
+    uint32_t HA_EntityIndex::Hash(const char* str, size_t length) {
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < length; ++i) {
+            hash ^= (uint8_t)str[i];
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    void HA_EntityIndex::Build(Device** devices, int deviceCount) {
+        Clear();
+        if (devices == nullptr || deviceCount == 0) { return; }
+
+        counting = true;
+        for (int i=0;i<deviceCount;++i) {
+            static_cast<HA_Device*>(devices[i])->collectEntities(*this);
+        }
+        counting = false;
+        if (count == 0) { return; }
+
+        uint32_t capacity = 4;
+        while (capacity < count * 2) { capacity <<= 1; }
+        slots = new Slot[capacity];
+        for (uint32_t i = 0; i < capacity; ++i) {
+            slots[i].hash = 0;
+            slots[i].entity = nullptr;
+        }
+        mask = capacity - 1;
+        count = 0;
+
+        for (int i=0;i<deviceCount;++i) {
+            static_cast<HA_Device*>(devices[i])->collectEntities(*this);
+        }
+    }
+
+    void HA_EntityIndex::Add(HA_DeviceEntity* entity) {
+        if (counting) { count++; return; }
+        if (slots == nullptr) { return; }
+
+        const std::string& uid = entity->hass_uid;
+        uint32_t hash = Hash(uid.c_str(), uid.length());
+        uint32_t i = hash & mask;
+        while (slots[i].entity != nullptr) {
+            if (slots[i].hash == hash && slots[i].entity->hass_uid == uid) {
+                duplicateCount++;
+                return;
+            }
+            i = (i + 1) & mask;
+        }
+        slots[i].hash = hash;
+        slots[i].entity = entity;
+        count++;
+    }
+
+    HA_DeviceEntity* HA_EntityIndex::Find(const ZeroCopyString& zcHassUid) {
+        if (slots == nullptr) { return nullptr; }
+        lookupCount++;
+
+        size_t length = zcHassUid.Length();
+        uint32_t hash = Hash(zcHassUid.start, length);
+        uint32_t i = hash & mask;
+        while (slots[i].entity != nullptr) {
+            probeCount++;
+            if (slots[i].hash == hash) {
+                const std::string& uid = slots[i].entity->hass_uid;
+                if (uid.length() == length && memcmp(uid.c_str(), zcHassUid.start, length) == 0) {
+                    return slots[i].entity;
+                }
+            }
+            i = (i + 1) & mask;
+        }
+        return nullptr;
+    }
+
+    void HA_EntityIndex::PrintTo(StringBuilderStreamer& sbs) {
+        sbs.write_jsonMemberStart(F("entityIndex"));
+        sbs.write_json_object_begin();
+        sbs.write_jsonNumber(F("entities"), count);
+        sbs.write_json_value_separator();
+        sbs.write_jsonNumber(F("capacity"), slots ? (mask + 1) : (uint32_t)0);
+        sbs.write_json_value_separator();
+        sbs.write_jsonNumber(F("duplicates"), duplicateCount);
+        sbs.write_json_value_separator();
+        sbs.write_jsonNumber(F("lookups"), lookupCount);
+        sbs.write_json_value_separator();
+        sbs.write_jsonNumber(F("probes"), probeCount);
+        sbs.write_json_object_end();
+    }
+}
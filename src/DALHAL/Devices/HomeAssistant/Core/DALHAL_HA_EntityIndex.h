@@ -0,0 +1,82 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <DALHAL/API/DALHAL_StringBuilderStreamer.h>
+#include <DALHAL/Core/Types/DALHAL_ZeroCopyString.h>
+
+namespace DALHAL
+{
+    class HA_Device; // forward declaration
+    class HA_DeviceEntity; // forward declaration
+    class Device; // forward declaration
+
+    /**
+     * hass_uid -> HA_DeviceEntity* lookup used to route inbound command topics
+     * open addressing (linear probing) with a power of two capacity kept at most half full,
+     * built once at begin() as the entity tree never change after the cfg is loaded
+     */
+    class HA_EntityIndex {
+    private:
+        struct Slot {
+            uint32_t hash;
+            /** nullptr marks a free slot */
+            HA_DeviceEntity* entity;
+        };
+
+        Slot* slots = nullptr;
+        uint32_t mask = 0;
+        uint32_t count = 0;
+        /** first collect pass only counts the entities so that the table can be allocated in one go */
+        bool counting = false;
+
+        uint32_t lookupCount = 0;
+        uint32_t probeCount = 0;
+        uint32_t duplicateCount = 0;
+
+        void Clear();
+
+    public:
+        HA_EntityIndex() = default;
+        ~HA_EntityIndex();
+        HA_EntityIndex(const HA_EntityIndex&) = delete;
+        HA_EntityIndex& operator=(const HA_EntityIndex&) = delete;
+
+        /** FNV-1a */
+        static uint32_t Hash(const char* str, size_t length);
+
+        /** (re)builds the index from the given HA devices */
+        void Build(Device** devices, int deviceCount);
+        /** called by HA_Device::collectEntities, the first entity with a given hass_uid wins (same as the linear search did) */
+        void Add(HA_DeviceEntity* entity);
+
+        bool Built() const { return slots != nullptr; }
+        HA_DeviceEntity* Find(const ZeroCopyString& zcHassUid);
+
+        void PrintTo(StringBuilderStreamer& sbs);
+    };
+}
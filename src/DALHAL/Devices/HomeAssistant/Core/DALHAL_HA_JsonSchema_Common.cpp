@@ -24,8 +24,13 @@
 #include "DALHAL_HA_JsonSchema_Common.h"
 
 #include <DALHAL/Core/JsonConfig/Types/Primitives/DALHAL_JSON_Schema_String.h>
+#include <DALHAL/Core/JsonConfig/Types/Primitives/DALHAL_JSON_Schema_Float.h>
+#include <DALHAL/Core/JsonConfig/Types/Primitives/DALHAL_JSON_Schema_UInt.h>
+#include <DALHAL/Core/JsonConfig/Types/Primitives/DALHAL_JSON_Schema_Bool.h>
 #include <DALHAL/Core/JsonConfig/Types/Logical/Groups/DALHAL_JSON_Schema_FieldsGroup.h>
 
+#include "DALHAL_HA_PublishPolicy.h"
+
 namespace DALHAL {
 
     namespace JsonSchema {
@@ -49,6 +54,35 @@ namespace DALHAL {
                 Gui::UseInline,
                 /*sizeof(disabled_uidreq_note_group_items)/sizeof(disabled_uidreq_note_group_items[0])*/ // future implementation
             };
+
+            constexpr SchemaFloat deadbandField = {"deadband", FieldPolicy::Optional, 0.0f};
+            constexpr SchemaFloat deadbandPctField = {"deadbandPct", FieldPolicy::Optional, 0.0f};
+            constexpr SchemaUInt minPublishMsField = {"minPublishMs", FieldPolicy::Optional, (unsigned int)0, (unsigned int)0, (unsigned int)0};
+            constexpr SchemaUInt heartbeatMsField = {"heartbeatMs", FieldPolicy::Optional, (unsigned int)0, (unsigned int)0, (unsigned int)0};
+            constexpr SchemaBool suppressIdenticalField = {"suppressIdentical", FieldPolicy::Optional, true};
+
+            constexpr const SchemaTypeBase* publish_policy_items[] = { 
+                &deadbandField,
+                &deadbandPctField,
+                &minPublishMsField,
+                &heartbeatMsField,
+                &suppressIdenticalField,
+                nullptr
+            };
+
+            constexpr SchemaFieldsGroup publish_policy_fields = {
+                "hass_publish_policy",
+                publish_policy_items,
+                Gui::UseInline,
+            };
+
+            void ExtractPublishPolicy(const JsonVariant& jsonObj, HA_PublishPolicy& out) {
+                out.deadbandAbs = deadbandField.ExtractFrom(jsonObj);
+                out.deadbandPct = deadbandPctField.ExtractFrom(jsonObj);
+                out.minIntervalMs = minPublishMsField.ExtractFrom(jsonObj);
+                out.heartbeatMs = heartbeatMsField.ExtractFrom(jsonObj);
+                out.suppressIdentical = suppressIdenticalField.ExtractFrom(jsonObj);
+            }
             
         }
 
@@ -23,13 +23,20 @@
 
 #pragma once
 
+#include <ArduinoJson.h>
+
 namespace DALHAL {
 
+    class HA_PublishPolicy; // forward declaration
+
     namespace JsonSchema {
 
         // forward declaration
         struct SchemaFieldsGroup;
         struct SchemaString;
+        struct SchemaFloat;
+        struct SchemaUInt;
+        struct SchemaBool;
 
         namespace HomeAssistant {
 
@@ -38,6 +45,16 @@ namespace DALHAL {
             extern const SchemaString hass_prev_uidField;
 
             extern const SchemaFieldsGroup common_fields;
+
+            extern const SchemaFloat deadbandField;
+            extern const SchemaFloat deadbandPctField;
+            extern const SchemaUInt minPublishMsField;
+            extern const SchemaUInt heartbeatMsField;
+            extern const SchemaBool suppressIdenticalField;
+
+            extern const SchemaFieldsGroup publish_policy_fields;
+
+            void ExtractPublishPolicy(const JsonVariant& jsonObj, HA_PublishPolicy& out);
             
         }
 
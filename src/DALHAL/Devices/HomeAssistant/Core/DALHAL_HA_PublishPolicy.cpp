@@ -0,0 +1,96 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DALHAL_HA_PublishPolicy.h"
+
+#include <math.h>
+
+namespace DALHAL {
+
+    bool HA_PublishPolicy::IsSignificantChange(const HALValue& val) const {
+        if (published == false) return true;
+        if (suppressIdentical == false) return true;
+
+        if ((deadbandAbs > 0.0f || deadbandPct > 0.0f) && val.isNumber() && lastPublished.isNumber()) {
+            float last = lastPublished.toFloat();
+            float band = deadbandAbs;
+            float relBand = fabsf(last) * deadbandPct * 0.01f;
+            if (relBand > band) band = relBand;
+            return fabsf(val.toFloat() - last) > band;
+        }
+        return val != lastPublished;
+    }
+
+    void HA_PublishPolicy::Offer(const HALValue& val) {
+        if (IsSignificantChange(val)) {
+            pending = val;
+            dirty = true;
+        } else {
+            // also drops any pending value that has returned within the deadband
+            dirty = false;
+            suppressedCount++;
+        }
+    }
+
+    bool HA_PublishPolicy::TakeDue(uint32_t now, HALValue& out) {
+        if (forced && (dirty || published)) {
+            out = dirty ? pending : lastPublished;
+            return true;
+        }
+        if (dirty) {
+            if (published && (now - lastPublishMs) < minIntervalMs) return false;
+            out = pending;
+            return true;
+        }
+        if (published && heartbeatMs != 0 && (now - lastPublishMs) >= heartbeatMs) {
+            out = lastPublished;
+            return true;
+        }
+        return false;
+    }
+
+    void HA_PublishPolicy::OnPublished(const HALValue& val, uint32_t now) {
+        lastPublished = val;
+        lastPublishMs = now;
+        published = true;
+        dirty = false;
+        forced = false;
+        publishCount++;
+    }
+
+    void HA_PublishPolicy::Invalidate() {
+        published = false;
+    }
+
+    void HA_PublishPolicy::ForcePublish() {
+        // when nothing has been sampled yet the first offered value is published anyway
+        forced = true;
+    }
+
+    void HA_PublishPolicy::PrintTo(StringBuilderStreamer& sbs) {
+        sbs.write_jsonNumber(F("published"), publishCount);
+        sbs.write_json_value_separator();
+        sbs.write_jsonNumber(F("suppressed"), suppressedCount);
+    }
+
+}
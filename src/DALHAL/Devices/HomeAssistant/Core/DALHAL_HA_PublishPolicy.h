@@ -0,0 +1,82 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <DALHAL/Core/Types/DALHAL_Value.h>
+#include <DALHAL/API/DALHAL_StringBuilderStreamer.h>
+
+namespace DALHAL {
+
+    /**
+     * decides when a HA entity state needs to be published
+     * sampled values are offered, a value is only marked dirty when it differs enough from the last published one,
+     * dirty values are then taken by the flush pass when the min interval allows,
+     * a heartbeat republishes the last value when nothing has been sent for heartbeatMs
+     */
+    class HA_PublishPolicy {
+    public: // config
+        /** absolute deadband, 0 = not used */
+        float deadbandAbs = 0.0f;
+        /** relative deadband in percent of the last published value, 0 = not used */
+        float deadbandPct = 0.0f;
+        uint32_t minIntervalMs = 0;
+        /** 0 = no heartbeat */
+        uint32_t heartbeatMs = 0;
+        bool suppressIdentical = true;
+
+    public: // stats
+        uint32_t publishCount = 0;
+        uint32_t suppressedCount = 0;
+
+    private:
+        HALValue lastPublished;
+        HALValue pending;
+        uint32_t lastPublishMs = 0;
+        bool published = false;
+        bool dirty = false;
+        bool forced = false;
+
+        bool IsSignificantChange(const HALValue& val) const;
+
+    public:
+        /** offer a newly sampled value */
+        void Offer(const HALValue& val);
+        /** returns true when a value should be published now, the value is then set in out */
+        bool TakeDue(uint32_t now, HALValue& out);
+        /** must be called after a successful publish, also used by direct writes */
+        void OnPublished(const HALValue& val, uint32_t now);
+        /** force the next offered value to be published, i.e. after a reconnect */
+        void Invalidate();
+        /**
+         * publish the current state on the next flush even when it's unchanged,
+         * used when the discovery has been sent as HA drops states of entities it doesn't know yet
+         */
+        void ForcePublish();
+
+        void PrintTo(StringBuilderStreamer& sbs);
+    };
+
+}
@@ -0,0 +1,91 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DALHAL_HA_TopicMatcher.h"
+
+#include <string.h>
+
+#include "DALHAL_HA_Constants.h"
+
+#define DALHAL_HA_CMD_SUFFIX     "/" DALHAL_DEV_HOME_ASSISTANT_DD_COMMAND_TOPIC_TAIL
+#define DALHAL_HA_CFG_PREFIX     DALHAL_DEV_HOME_ASSISTANT_DD_CONFIG_TOPIC_HEAD "/"
+#define DALHAL_HA_CFG_SUFFIX     "/" DALHAL_DEV_HOME_ASSISTANT_DD_CONFIG_TOPIC_TAIL
+#define DALHAL_HA_CFG_DEV_PREFIX DALHAL_DEV_HOME_ASSISTANT_DD_BASENAME "_"
+
+namespace DALHAL
+{
+    static constexpr size_t CmdSuffixLength = sizeof(DALHAL_HA_CMD_SUFFIX) - 1;
+    static constexpr size_t CfgPrefixLength = sizeof(DALHAL_HA_CFG_PREFIX) - 1;
+    static constexpr size_t CfgSuffixLength = sizeof(DALHAL_HA_CFG_SUFFIX) - 1;
+    static constexpr size_t CfgDevPrefixLength = sizeof(DALHAL_HA_CFG_DEV_PREFIX) - 1;
+
+    void HA_TopicMatcher::Init(const char* deviceUID) {
+        commandPrefix = DALHAL_DEV_HOME_ASSISTANT_DD_BASENAME "/";
+        commandPrefix += deviceUID;
+        commandPrefix += '/';
+    }
+
+    HA_TopicMatcher::Kind HA_TopicMatcher::Match(const char* topic, uint16_t topicLength, Result& out) const {
+        const char* end = topic + topicLength;
+
+        // dalhal/<deviceUID>/<hass_uid>/command
+        const size_t cmdPrefixLength = commandPrefix.length();
+        if (cmdPrefixLength != 0 && topicLength > cmdPrefixLength + CmdSuffixLength &&
+            memcmp(topic, commandPrefix.c_str(), cmdPrefixLength) == 0 &&
+            memcmp(end - CmdSuffixLength, DALHAL_HA_CMD_SUFFIX, CmdSuffixLength) == 0)
+        {
+            const char* idStart = topic + cmdPrefixLength;
+            const char* idEnd = end - CmdSuffixLength;
+            if (memchr(idStart, '/', idEnd - idStart) != nullptr) { return Kind::None; }
+            out.entityID = ZeroCopyString(idStart, idEnd);
+            return Kind::Command;
+        }
+
+        // homeassistant/<type>/dalhal_<deviceUID>/<hass_uid>/config
+        if (topicLength > CfgPrefixLength + CfgSuffixLength &&
+            memcmp(topic, DALHAL_HA_CFG_PREFIX, CfgPrefixLength) == 0 &&
+            memcmp(end - CfgSuffixLength, DALHAL_HA_CFG_SUFFIX, CfgSuffixLength) == 0)
+        {
+            const char* p = topic + CfgPrefixLength;
+            const char* midEnd = end - CfgSuffixLength;
+
+            const char* typeEnd = (const char*)memchr(p, '/', midEnd - p);
+            if (typeEnd == nullptr) { return Kind::None; }
+            out.type = ZeroCopyString(p, typeEnd);
+            p = typeEnd + 1;
+
+            if ((size_t)(midEnd - p) <= CfgDevPrefixLength || memcmp(p, DALHAL_HA_CFG_DEV_PREFIX, CfgDevPrefixLength) != 0) { return Kind::None; }
+            p += CfgDevPrefixLength;
+
+            const char* devEnd = (const char*)memchr(p, '/', midEnd - p);
+            if (devEnd == nullptr) { return Kind::None; }
+            out.deviceUID = ZeroCopyString(p, devEnd);
+            p = devEnd + 1;
+
+            if (memchr(p, '/', midEnd - p) != nullptr) { return Kind::None; }
+            out.entityID = ZeroCopyString(p, midEnd);
+            return Kind::Config;
+        }
+        return Kind::None;
+    }
+}
@@ -0,0 +1,64 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+
+#include <DALHAL/Core/Types/DALHAL_ZeroCopyString.h>
+
+namespace DALHAL
+{
+    /**
+     * single pass matcher for the two inbound topic families:
+     *   command: dalhal/<deviceUID>/<hass_uid>/command
+     *   cleanup: homeassistant/<type>/dalhal_<deviceUID>/<hass_uid>/config
+     * the fixed parts are compared with memcmp against precomputed prefix/suffix
+     * and the variable parts are returned as views into the topic
+     */
+    class HA_TopicMatcher {
+    public:
+        enum class Kind : uint8_t {
+            None,
+            Command,
+            Config
+        };
+        struct Result {
+            ZeroCopyString entityID;
+            /** only set for Config */
+            ZeroCopyString type;
+            /** only set for Config */
+            ZeroCopyString deviceUID;
+        };
+
+    private:
+        /** dalhal/<deviceUID>/ */
+        std::string commandPrefix;
+
+    public:
+        /** must be called before any topic is matched, and again if the device uid is changed */
+        void Init(const char* deviceUID);
+        Kind Match(const char* topic, uint16_t topicLength, Result& out) const;
+    };
+}
@@ -29,18 +29,22 @@
 #include <DALHAL/Core/Types/DALHAL_DeviceCreateContext.h>
 #include <System/DeviceUID.h>
 
+#include <DALHAL/Devices/HomeAssistant/Core/DALHAL_HA_DiscoveryQueue.h>
+
 namespace DALHAL {
 
     struct HA_CreateFunctionContext : DeviceCreateContext {
 
         PubSubClient& mqttClient;
+        HA_DiscoveryQueue& discoveryQueue;
         
         const char* groupID_cStr;
         const char* groupName_cStr;
 
-        HA_CreateFunctionContext(PubSubClient& mqttClient) 
+        HA_CreateFunctionContext(PubSubClient& mqttClient, HA_DiscoveryQueue& discoveryQueue) 
             : DeviceCreateContext(), 
               mqttClient(mqttClient),
+              discoveryQueue(discoveryQueue),
               groupID_cStr(nullptr),
               groupName_cStr(nullptr)
               {}
@@ -23,6 +23,8 @@
 
 #include "DALHAL_HA_DeviceContainer.h"
 
+#include <DALHAL/Devices/HomeAssistant/Core/DALHAL_HA_EntityIndex.h>
+
 #include "DALHAL_HA_CreateFunctionContext.h"
 
 #include <DALHAL/Core/Types/DALHAL_Device.h>
@@ -34,6 +36,7 @@
 #include <DALHAL/Devices/HomeAssistant/DALHAL_HA_CreateFunctionContext.h>
 
 #include "DALHAL_HA_DeviceContainer_JSON_Schema.h"
+#include <DALHAL/Core/Manager/DALHAL_DeviceArena.h>
 
 
 namespace DALHAL {
@@ -62,7 +65,7 @@ namespace DALHAL {
             for (int i = 0; i < deviceCount; ++i) {
                 delete devices[i];
             }
-            delete[] devices;
+            DeviceArena::DeleteDeviceArray(devices);
         }
     }
 
@@ -82,6 +85,14 @@ namespace DALHAL {
         }
     }
 
+    void HA_DeviceContainer::flushState(uint32_t now) {
+        if (devices == nullptr || deviceCount == 0) return;
+        for (int i=0;i<deviceCount;i++)
+        {
+            static_cast<HA_Device*>(devices[i])->flushState(now);
+        }
+    }
+
     DeviceFindResult HA_DeviceContainer::findDevice(UIDPath& path, Device*& outDevice) {
         return Device::findInArray(devices, deviceCount, path, this, outDevice);
     }
@@ -97,6 +108,13 @@ namespace DALHAL {
         return nullptr;
     }
 
+    void HA_DeviceContainer::collectEntities(HA_EntityIndex& index) {
+        if (devices == nullptr) { return; }
+        for (int i=0;i<deviceCount;++i) {
+            static_cast<HA_Device*>(devices[i])->collectEntities(index);
+        }
+    }
+
     void HA_DeviceContainer::PrintTo(StringBuilderStreamer& sbs) {
         Device::PrintTo(sbs);
 
@@ -61,10 +61,12 @@ namespace DALHAL {
 
         void begin() override;
         void loop() override;
+        void flushState(uint32_t now) override;
 
         DeviceFindResult findDevice(UIDPath& path, Device*& outDevice) override;
 
         HA_DeviceEntity* findHassDevice(const ZeroCopyString& zcHassUid) override;
+        void collectEntities(HA_EntityIndex& index) override;
 
         
         void PrintTo(StringBuilderStreamer& sbs) override;
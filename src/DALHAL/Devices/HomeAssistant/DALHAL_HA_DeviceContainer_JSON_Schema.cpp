@@ -33,6 +33,7 @@
 #include <DALHAL/Devices/HomeAssistant/DALHAL_HA_CreateFunctionContext.h>
 
 #include "DALHAL_HA_DeviceContainer.h"
+#include <DALHAL/Core/Manager/DALHAL_DeviceArena.h>
 
 namespace DALHAL {
 
@@ -78,7 +79,7 @@ namespace DALHAL {
                 }
 
                 // Allocate space for all devices
-                out->devices = new Device*[out->deviceCount]();
+                out->devices = DeviceArena::NewDeviceArray(out->deviceCount);
 
 
                 if (out->devices == nullptr) {
@@ -46,6 +46,7 @@
 #include <System/DeviceUID.h> // getDeviceUID
 
 #include "DALHAL_HomeAssistant_JSON_Schema.h"
+#include <DALHAL/Core/Manager/DALHAL_DeviceArena.h>
 
 namespace DALHAL {
 
@@ -100,26 +101,21 @@ namespace DALHAL {
         }
         if (mqttClient.connected()) {
             GlobalLogger.Info(F("HASS MQTT - connected to brooker"));
-            
+            discoveryQueue.OnConnected(millis());
         }
     }
 
     void HomeAssistant::MqttOnPubishCompleteCallback(void* context, char* topic, uint16_t topicLength, uint8_t* payloadData, uint32_t payload_len) {
-        //HomeAssistant& self = *static_cast<HomeAssistant*>(context);
-        ZeroCopyString zcTopic(topic, topic + topicLength);
-        // preserve original topic view for later logging
-        ZeroCopyString zcTmp = zcTopic;
-        ZeroCopyString zcHead = zcTmp.SplitOffHead('/');
-        ZeroCopyString zcTail = zcTmp.SplitOffTail('/');
-        if (zcHead.Equals(F(DALHAL_DEV_HOME_ASSISTANT_DD_BASENAME)) && 
-            zcTail.Equals(F(DALHAL_DEV_HOME_ASSISTANT_DD_COMMAND_TOPIC_TAIL)))
-        {
-            ZeroCopyString zcEntityID = zcTmp.SplitOffTail('/');
+        HomeAssistant& self = *static_cast<HomeAssistant*>(context);
+        HA_TopicMatcher::Result match;
+        HA_TopicMatcher::Kind kind = self.topicMatcher.Match(topic, topicLength, match);
 
-            HA_DeviceEntity* item = static_cast<HomeAssistant*>(context)->findHassDevice(zcEntityID);
+        if (kind == HA_TopicMatcher::Kind::Command)
+        {
+            HA_DeviceEntity* item = self.findHassDevice(match.entityID);
 
             if (item == nullptr) {
-                GlobalLogger.Warn(F("PSCP Complete CB - could not find device with hass_uid on HA MQTT topic: "), zcTopic);
+                GlobalLogger.Warn(F("PSCP Complete CB - could not find device with hass_uid on HA MQTT topic: "), ZeroCopyString(topic, topic + topicLength));
                 return;
             }
             const ZeroCopyString zcPayload((const char*)payloadData, (const char*)payloadData+payload_len);
@@ -132,89 +128,72 @@ namespace DALHAL {
                 GlobalLogger.Error(F("PSCP Complete CB - item->exec fail:"), String(HALOperationResultToString(res)).c_str() );
             }
 
-        } else if (zcHead.Equals(F(DALHAL_DEV_HOME_ASSISTANT_DD_CONFIG_TOPIC_HEAD)) &&
-                   zcTail.Equals(F(DALHAL_DEV_HOME_ASSISTANT_DD_CONFIG_TOPIC_TAIL)))
+        } else if (kind == HA_TopicMatcher::Kind::Config)
         {
-            ZeroCopyString zcEntityID = zcTmp.SplitOffTail('/');
-            
             Serial.print(F("PSCP Complete CB - rx cleanup check for:"));
-            Serial.write((const char*)zcEntityID.start, zcEntityID.Length());
+            Serial.write((const char*)match.entityID.start, match.entityID.Length());
             Serial.println();
 
         } else {
             // failsafe warning, this will likely never happend
-            GlobalLogger.Warn(F("PSCP Complete CB - ignoring message of HA MQTT topic: "), zcTopic);
+            GlobalLogger.Warn(F("PSCP Complete CB - ignoring message of HA MQTT topic: "), ZeroCopyString(topic, topic + topicLength));
         }
     }
 
     PubSubClientPacketReceiver HomeAssistant::MqttOnPublishHeaderCallback(void* context, char* topic, uint16_t topicLength, uint32_t payloadLength, PSC_PublishFlags flags) {
-        //Serial.println(F("PubSubClientPacketReceiver HomeAssistant::MqttOnPublishHeaderCallback"));
         //Serial.printf("\r\nPSC HEAD CB - topic= %.*s retain=%d\r\n", topicLength, topic, flags.RETAIN());
         HomeAssistant& self = *static_cast<HomeAssistant*>(context);
         // topic length is already provided by the MQTT protocol
-        ZeroCopyString zcTopic(topic, topic + topicLength);
-        // preserve original topic view for later logging
-        ZeroCopyString zcTmp = zcTopic;
-        ZeroCopyString zcHead = zcTmp.SplitOffHead('/');
-        ZeroCopyString zcTail = zcTmp.SplitOffTail('/');
-        //Serial.printf("PSCPRx CB topic head: >>>%.*s<<<\r\n", zcHead.Length(), zcHead.start);
-        //Serial.printf("PSCPRx CB topic tail: >>>%.*s<<<\r\n", zcTail.Length(), zcTail.start);
-        if (zcHead.Equals(F(DALHAL_DEV_HOME_ASSISTANT_DD_BASENAME)) && 
-            zcTail.Equals(F(DALHAL_DEV_HOME_ASSISTANT_DD_COMMAND_TOPIC_TAIL)))
+        HA_TopicMatcher::Result match;
+        HA_TopicMatcher::Kind kind = self.topicMatcher.Match(topic, topicLength, match);
+
+        if (kind == HA_TopicMatcher::Kind::Command)
         {
             // first check if payload can fit into internal buffer
             // if it can not fit the payload is discarded
             // this can be fixed in the future if needed by providing a external buffer
             // however with the current implementation it's almost unlikely to happend
             if (self.mqttClient.getBufferSize() < (MQTT_MAX_HEADER_SIZE + topicLength + payloadLength)) {
-                GlobalLogger.Error(F("PSCP HEAD CB - the internal buffersize can not fit the command payload"), zcTopic);
+                GlobalLogger.Error(F("PSCP HEAD CB - the internal buffersize can not fit the command payload"), ZeroCopyString(topic, topic + topicLength));
                 return PubSubClientPacketReceiver(PubSubClientPayloadSink::Discard, nullptr);
             }
             return PubSubClientPacketReceiver(PubSubClientPayloadSink::Buffer, MqttOnPubishCompleteCallback);
 
-        } else if (zcHead.Equals(F(DALHAL_DEV_HOME_ASSISTANT_DD_CONFIG_TOPIC_HEAD)) &&
-                   zcTail.Equals(F(DALHAL_DEV_HOME_ASSISTANT_DD_CONFIG_TOPIC_TAIL)))
+        } else if (kind == HA_TopicMatcher::Kind::Config)
         {
             if (flags.RETAIN() == false) {
-                GlobalLogger.Warn(F("PSCP HEAD CB - 'cleanup' topic did not have RETAIN FLAG SET: "), zcTopic);
+                GlobalLogger.Warn(F("PSCP HEAD CB - 'cleanup' topic did not have RETAIN FLAG SET: "), ZeroCopyString(topic, topic + topicLength));
             }
             if (payloadLength == 0) {
                 // cleanup allready done
                 return PubSubClientPacketReceiver(PubSubClientPayloadSink::Discard, nullptr);
             }
-            // Expected topic format:
-            // <homeassistant_const_string>/<type>/dalhal_<deviceID>/<entityID>/config
             // Subscribed topic:
             // <homeassistant_const_string>/+/dalhal_<deviceID>/+/config
             // 
             // The structure of <deviceID> is defined by DALHAL_HA_DeviceDiscovery 
-            ZeroCopyString zcEntityID = zcTmp.SplitOffTail('/');
-            ZeroCopyString zcType = zcTmp.SplitOffHead('/');
-
             bool overriddenRemove = false;
             if (DeviceUID::Overridden()) {
-                zcTmp.SplitOffHead('_'); // just discard dalhal fixed string
-                ZeroCopyString zcDeviceUID = zcTmp.SplitOffTail('/');
-                if (zcDeviceUID.Equals(DeviceUID::Get()) == false) {
+                if (match.deviceUID.Equals(DeviceUID::Get()) == false) {
                     // this mean that the deviceID is overriden
                     // and this topic need to be 'removed'
                     overriddenRemove = true;
                 }
             }
             Serial1.print(F("PSCP HEAD CB - rx cleanup check for: "));
-            Serial1.write(zcEntityID.start, zcEntityID.Length());
+            Serial1.write(match.entityID.start, match.entityID.Length());
             Serial1.print(F(" type:"));
-            Serial1.write(zcType.start, zcType.Length());
+            Serial1.write(match.type.start, match.type.Length());
             Serial1.println();
             
 
             const HA_DeviceEntity* item = nullptr;
             if (!overriddenRemove) {
-                item = self.findHassDevice(zcEntityID);
+                item = self.findHassDevice(match.entityID);
             }
             if (item == nullptr) {
                 
-                bool success = HA_DeviceDiscovery::RemoveCfgTopic(self.mqttClient, zcType, zcEntityID);
+                bool success = HA_DeviceDiscovery::RemoveCfgTopic(self.mqttClient, match.type, match.entityID);
                 if (success) {
                     Serial1.println(F("PSCP HEAD CB - cleanup executed"));
                 } else {
@@ -224,7 +203,7 @@ namespace DALHAL {
 
         } else {
             // failsafe warning, this will likely never happend
-            GlobalLogger.Warn(F("PSCP HEAD CB - ignoring message of HA MQTT topic: "), zcTopic);
+            GlobalLogger.Warn(F("PSCP HEAD CB - ignoring message of HA MQTT topic: "), ZeroCopyString(topic, topic + topicLength));
         }
         // default if not specified above
         return PubSubClientPacketReceiver(PubSubClientPayloadSink::Discard, nullptr);
@@ -247,13 +226,17 @@ namespace DALHAL {
             for (int i=0;i<deviceCount;i++) {
                 delete devices[i];
             }
-            delete[] devices;
+            DeviceArena::DeleteDeviceArray(devices);
         }
     }
 
     void HomeAssistant::PrintTo(StringBuilderStreamer& sbs) {
         Device::PrintTo(sbs);
 
+        sbs.write_json_value_separator();
+        discoveryQueue.PrintTo(sbs);
+        sbs.write_json_value_separator();
+        entityIndex.PrintTo(sbs);
         sbs.write_json_value_separator();
         sbs.write_jsonMemberStart(F("items"));
         sbs.write_json_array_begin();
@@ -283,10 +266,16 @@ namespace DALHAL {
             return;
         }
         mqttClient.loop();
+        discoveryQueue.loop(mqttClient);
 
+        // first sample all entities, then publish everything that became dirty in one go
         for (int i=0;i<deviceCount;i++) {
             devices[i]->loop();
         }
+        uint32_t now = millis();
+        for (int i=0;i<deviceCount;i++) {
+            static_cast<HA_Device*>(devices[i])->flushState(now);
+        }
 
     }
 
@@ -295,6 +284,9 @@ namespace DALHAL {
         for (int i=0;i<deviceCount;i++) {
             devices[i]->begin();
         }
+        // the entity tree is fixed from here on, so the topic routing can be prepared once
+        topicMatcher.Init(DeviceUID::Get());
+        entityIndex.Build(devices, deviceCount);
         if (mqttClient.connected()) {
             HA_DeviceDiscovery::SubscribeToCommandTopic(mqttClient);
             HA_DeviceDiscovery::SubscribeToCleanupTopic(mqttClient);
@@ -308,7 +300,9 @@ namespace DALHAL {
 
     HA_DeviceEntity* HomeAssistant::findHassDevice(const ZeroCopyString& zcHassUid) {
         if (devices == nullptr || deviceCount == 0) { return nullptr; }
-        
+        if (entityIndex.Built()) { return entityIndex.Find(zcHassUid); }
+
+        // fallback used before begin()
         for (int i=0;i<deviceCount;++i) {
             HA_DeviceEntity* item = static_cast<HA_Device*>(devices[i])->findHassDevice(zcHassUid);
             //const HA_DeviceEntity* item = devices[i]->findHassDevice(zcHassUid);
@@ -327,7 +321,7 @@ namespace DALHAL {
             root["device_class"] = "temperature";
 
             HA_DD_Context ha_dd_ctx = {"uid", "deviceId", "sensor", "deviceName", "groupID", "groupName", root};  
-            DALHAL::HA_DeviceDiscovery::SendDiscovery(static_cast<HomeAssistant*>(device)->mqttClient, ha_dd_ctx, nullptr);
+            DALHAL::HA_DeviceDiscovery::QueueDiscovery(static_cast<HomeAssistant*>(device)->discoveryQueue, ha_dd_ctx, nullptr);
             return HALOperationResult::Success;
         //}
         //return HALOperationResult::UnsupportedCommand;
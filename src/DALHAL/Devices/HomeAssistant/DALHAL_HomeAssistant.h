@@ -36,6 +36,9 @@
 #include "Core/DALHAL_HA_Device.h"
 
 #include <DALHAL/Devices/HomeAssistant/Core/DALHAL_HA_Constants.h>
+#include <DALHAL/Devices/HomeAssistant/Core/DALHAL_HA_DiscoveryQueue.h>
+#include <DALHAL/Devices/HomeAssistant/Core/DALHAL_HA_EntityIndex.h>
+#include <DALHAL/Devices/HomeAssistant/Core/DALHAL_HA_TopicMatcher.h>
 
 #define DALHAL_HOME_ASSISTANT_DEFAULT_PORT 1883
 
@@ -60,6 +63,10 @@ namespace DALHAL {
 
         WiFiClient wifiClient;
         PubSubClient mqttClient;
+        HA_DiscoveryQueue discoveryQueue;
+        /** built at begin(), used to route inbound command topics */
+        HA_EntityIndex entityIndex;
+        HA_TopicMatcher topicMatcher;
 
         Device** devices = nullptr;
         int deviceCount = 0;
@@ -41,6 +41,7 @@
 
 #include "DALHAL_HomeAssistant.h"
 #include <DALHAL/Devices/HomeAssistant/Core/DALHAL_HA_DeviceDiscovery.h>
+#include <DALHAL/Core/Manager/DALHAL_DeviceArena.h>
 #if defined(ESP32)
 #include <WiFi.h>
 #elif defined(ESP8266)
@@ -175,12 +176,12 @@ namespace DALHAL {
                     self->deviceCount++;
                 }
                 
-                self->devices = new Device*[self->deviceCount](); // create array and initialize all to nullptr
+                self->devices = DeviceArena::NewDeviceArray(self->deviceCount); // create array and initialize all to nullptr
                 int index = 0;
                 // second pass create devices
                 const JsonVariant& groupObj = JsonSchema::HomeAssistant::globalGroupField.GetValidatedJsonObject(jsonObj);
                 
-                HA_CreateFunctionContext createFuncContext(self->mqttClient);
+                HA_CreateFunctionContext createFuncContext(self->mqttClient, self->discoveryQueue);
                 createFuncContext.groupID_cStr = JsonSchema::HomeAssistant::groupUIDField.ExtractFrom(groupObj);
                 createFuncContext.groupName_cStr = JsonSchema::HomeAssistant::groupNameField.ExtractFrom(groupObj);
 
@@ -214,11 +215,11 @@ namespace DALHAL {
                 }
 
                 // second pass create actual enabled/"non comment" items
-                self->devices = new Device*[self->deviceCount]();
+                self->devices = DeviceArena::NewDeviceArray(self->deviceCount);
 
 
                 int newItemIndex = 0;
-                HA_CreateFunctionContext createFuncContext(self->mqttClient);
+                HA_CreateFunctionContext createFuncContext(self->mqttClient, self->discoveryQueue);
 
                 for (int i=0;i<jsonArrayGroupsCount;i++) {
                     const JsonVariant& jsonObjGrpItem = jsonArrayGroups[i];
@@ -104,6 +104,8 @@ namespace DALHAL {
     void HA_BinarySensor::PrintTo(StringBuilderStreamer& sbs) {
         //String ret = Device::ToString();
         Device::PrintTo(sbs);
+        sbs.write_json_value_separator();
+        publishPolicy.PrintTo(sbs);
         //return ret;
     }
 
@@ -151,23 +153,32 @@ namespace DALHAL {
             {
                 HA_DeviceDiscovery::SetAvailability(mqttClient, hass_uid.c_str(), wasOnline, true);
             }
-            bool state = val.toBool();
-            uint32_t state_cStr_Length = (state ? sizeof(DALHAL_HA_BINARY_SENSOR_PAYLOAD_ON) : sizeof(DALHAL_HA_BINARY_SENSOR_PAYLOAD_OFF)) - 1;
-            const char* state_cStr = state ? DALHAL_HA_BINARY_SENSOR_PAYLOAD_ON : DALHAL_HA_BINARY_SENSOR_PAYLOAD_OFF;
-            bool success = HA_DeviceDiscovery::SendState(mqttClient, hass_uid.c_str(), state_cStr, state_cStr_Length);
-            if (success == false) {
-                GlobalLogger.Error(F("could not send binary sensor state update to HASS"));
-            }
+            publishPolicy.Offer(HALValue(val.toBool())); // published by flushState if needed
         }
         else
         {
             if (wasOnline)
             {
                 HA_DeviceDiscovery::SetAvailability(mqttClient, hass_uid.c_str(), wasOnline, false);
+                publishPolicy.Invalidate(); // make sure the state is sent directly when back online
             }
         }
     }
 
+    void HA_BinarySensor::flushState(uint32_t now) {
+        if (!wasOnline) return;
+        HALValue val;
+        if (publishPolicy.TakeDue(now, val) == false) return;
+        bool state = val.toBool();
+        uint32_t state_cStr_Length = (state ? sizeof(DALHAL_HA_BINARY_SENSOR_PAYLOAD_ON) : sizeof(DALHAL_HA_BINARY_SENSOR_PAYLOAD_OFF)) - 1;
+        const char* state_cStr = state ? DALHAL_HA_BINARY_SENSOR_PAYLOAD_ON : DALHAL_HA_BINARY_SENSOR_PAYLOAD_OFF;
+        if (HA_DeviceDiscovery::SendState(mqttClient, hass_uid.c_str(), state_cStr, state_cStr_Length) == false) {
+            GlobalLogger.Error(F("could not send binary sensor state update to HASS"));
+            return;
+        }
+        publishPolicy.OnPublished(val, now);
+    }
+
     void HA_BinarySensor::begin() {
 
     }
@@ -200,6 +211,7 @@ namespace DALHAL {
         uint32_t state_cStr_Length = (state ? sizeof(DALHAL_HA_BINARY_SENSOR_PAYLOAD_ON) : sizeof(DALHAL_HA_BINARY_SENSOR_PAYLOAD_OFF)) - 1;
         const char* state_cStr = state ? DALHAL_HA_BINARY_SENSOR_PAYLOAD_ON : DALHAL_HA_BINARY_SENSOR_PAYLOAD_OFF;
         bool success = HA_DeviceDiscovery::SendState(self.mqttClient, self.hass_uid.c_str(), state_cStr, state_cStr_Length);
+        if (success) self.publishPolicy.OnPublished(HALValue(state), millis());
 
         return success ? HALOperationResult::Success: HALOperationResult::ExecutionFailed;
     };
@@ -56,6 +56,7 @@ namespace DALHAL {
                 &CommonBase::disabled_type_uidreq_note_group, // DALHAL_CommonSchemas_Base
                 &HomeAssistant::common_fields,
                 &CommonConsumer::consumerFieldsGroup, // includes: refreshTimeGroupFields, sourceField, eventSourceField
+                &HomeAssistant::publish_policy_fields,
                 &discoveryField,
                 nullptr,
             };
@@ -125,10 +126,11 @@ namespace DALHAL {
                 const char* deviceName_cStr = JsonSchema::HomeAssistant::nameField.ExtractFrom(*context.jsonObjItem);
                 const char* hass_uid_cStr = JsonSchema::HomeAssistant::hass_uidField.ExtractFrom(*context.jsonObjItem);
                 out->hass_uid = hass_uid_cStr;
+                JsonSchema::HomeAssistant::ExtractPublishPolicy(*context.jsonObjItem, out->publishPolicy);
                 const char* hass_prev_uid_cStr = JsonSchema::HomeAssistant::hass_prev_uidField.ExtractFrom(*context.jsonObjItem);
                 const JsonObject& jsonObj_discovery = JsonSchema::HA_BinarySensor::discoveryField.GetValidatedJsonObject(*context.jsonObjItem);
                 HA_DD_Context ha_dd_ctx = {hass_uid_cStr, hass_prev_uid_cStr, context.deviceType, deviceName_cStr, context.groupID_cStr, context.groupName_cStr, jsonObj_discovery};  
-                DALHAL::HA_DeviceDiscovery::SendDiscovery(context.mqttClient, ha_dd_ctx, DALHAL::HA_BinarySensor::SendDeviceDiscovery);
+                DALHAL::HA_DeviceDiscovery::QueueDiscovery(context.discoveryQueue, ha_dd_ctx, DALHAL::HA_BinarySensor::SendDeviceDiscovery, &out->publishPolicy);
 
             }
 
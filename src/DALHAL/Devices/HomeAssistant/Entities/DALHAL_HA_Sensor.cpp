@@ -95,6 +95,8 @@ namespace DALHAL {
     void HA_Sensor::PrintTo(StringBuilderStreamer& sbs) {
         //String ret = Device::ToString();
         Device::PrintTo(sbs);
+        sbs.write_json_value_separator();
+        publishPolicy.PrintTo(sbs);
         //return ret;
     }
 
@@ -145,10 +147,7 @@ namespace DALHAL {
                 Serial1.print(hass_uid.c_str()); Serial1.println(F("Sensor::loop() !wasOnline @ operation success"));
                 HA_DeviceDiscovery::SetAvailability(mqttClient, hass_uid.c_str(), wasOnline, true);
             }
-            bool success = HA_DeviceDiscovery::SendState(mqttClient, hass_uid.c_str(), val);
-            if (success == false) {
-                GlobalLogger.Error(F("could not send sensor state update to HASS"));
-            }
+            publishPolicy.Offer(val); // published by flushState if needed
         }
         else
         {
@@ -156,9 +155,21 @@ namespace DALHAL {
             if (wasOnline)
             {
                 HA_DeviceDiscovery::SetAvailability(mqttClient, hass_uid.c_str(), wasOnline, false);
+                publishPolicy.Invalidate(); // make sure the state is sent directly when back online
             }
         }
     }
+
+    void HA_Sensor::flushState(uint32_t now) {
+        if (!wasOnline) return;
+        HALValue val;
+        if (publishPolicy.TakeDue(now, val) == false) return;
+        if (HA_DeviceDiscovery::SendState(mqttClient, hass_uid.c_str(), val) == false) {
+            GlobalLogger.Error(F("could not send sensor state update to HASS"));
+            return;
+        }
+        publishPolicy.OnPublished(val, now);
+    }
     void HA_Sensor::begin() {
 
     }
@@ -180,6 +191,7 @@ namespace DALHAL {
             HA_DeviceDiscovery::SetAvailability(self.mqttClient, self.hass_uid.c_str(), self.wasOnline, true);
         }
         bool success = HA_DeviceDiscovery::SendState(self.mqttClient, self.hass_uid.c_str(), val);
+        if (success) self.publishPolicy.OnPublished(val, millis());
         
         return success ? HALOperationResult::Success: HALOperationResult::ExecutionFailed;
     };
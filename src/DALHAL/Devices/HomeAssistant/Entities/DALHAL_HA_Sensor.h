@@ -42,6 +42,7 @@
 #include <DALHAL/Devices/HomeAssistant/Core/DALHAL_HA_DeviceEntity.h>
 
 #include <DALHAL/Devices/HomeAssistant/Core/DALHAL_HA_DeviceDiscovery.h>
+#include <DALHAL/Devices/HomeAssistant/Core/DALHAL_HA_PublishPolicy.h>
 
 #define DALHAL_HA_SENSOR_DEFAULT_REFRESH_MS 5000
 
@@ -73,6 +74,7 @@ namespace DALHAL {
         uint32_t refreshMs;
         uint32_t lastMs;
         bool wasOnline;
+        HA_PublishPolicy publishPolicy;
 
     private:
         bool IsTimedRefresh_NOT_Due();
@@ -85,6 +87,7 @@ namespace DALHAL {
 
         void begin() override;
         void loop() override;
+        void flushState(uint32_t now) override;
 
         void PrintTo(StringBuilderStreamer& sbs) override;
         
@@ -34,6 +34,7 @@
 #include <DALHAL/API/DALHAL_StringBuilderStreamer.h>
 
 #include "DALHAL_I2C_Master_JSON_Schema.h"
+#include <DALHAL/Core/Manager/DALHAL_DeviceArena.h>
 
 namespace DALHAL {
 
@@ -85,7 +86,7 @@ namespace DALHAL {
                 delete devices[i];
                 devices[i] = nullptr;
             }
-            delete[] devices;
+            DeviceArena::DeleteDeviceArray(devices);
             devices = nullptr;
             deviceCount = 0;
         }
@@ -36,6 +36,7 @@
 #include "_DevicesRegistry/DALHAL_I2C_Master_DevicesRegistry.h"
 
 #include "DALHAL_I2C_Master.h"
+#include <DALHAL/Core/Manager/DALHAL_DeviceArena.h>
 
 namespace DALHAL {
 
@@ -104,7 +105,7 @@ namespace DALHAL {
                     return;
                 }
                 // second pass actually create the devices
-                out->devices = new Device*[out->deviceCount]();
+                out->devices = DeviceArena::NewDeviceArray(out->deviceCount);
                 int index = 0;
                 I2C_Master_CreateFunctionContext createContext(*out->wire);
                 for (int i=0;i<itemCount;i++) {
@@ -27,6 +27,7 @@
 #include <DALHAL/Core/Manager/DALHAL_GPIO_Manager.h>
 #include <DALHAL/Support/DALHAL_Logger.h>
 #include <DALHAL/Core/JsonConfig/DALHAL_ArduinoJSON_ext.h>
+#include <DALHAL/Support/base64.h>
 
 #include "DALHAL_WS2812_JSON_Schema.h"
 
@@ -79,7 +80,8 @@ namespace DALHAL {
 
     __attribute__((used, externally_visible))
     constexpr FunctionEntry<FunctionTypes::WriteString> WS2812::writeStringFunctions[] = {
-        DALHAL_FUNCTION_ENTRY("setpixel", WS2812::writeString_setpixel_Function, "sets a specific pixel the arguments are <xPos>/<yPos>/colorcode")
+        DALHAL_FUNCTION_ENTRY("setpixel", WS2812::writeString_setpixel_Function, "sets a specific pixel the arguments are <xPos>/<yPos>/colorcode"),
+        DALHAL_FUNCTION_ENTRY("frame", WS2812::writeString_frame_Function, "uploads pixels, the arguments are <pixelOffset>/<base64url R,G,B(,W) bytes>[/hold], hold stages the data without showing it")
     };
     HALOperationResult WS2812::writeString_setpixel_Function(Device* device, const ZeroCopyString& zcParams, StringBuilderStreamer& sbs) {
         WS2812& self = *static_cast<WS2812*>(device);
@@ -111,6 +113,70 @@ namespace DALHAL {
         return HALOperationResult::Success;
     }
 
+    HALOperationResult WS2812::writeString_frame_Function(Device* device, const ZeroCopyString& zcParams, StringBuilderStreamer& sbs) {
+        WS2812& self = *static_cast<WS2812*>(device);
+        ZeroCopyString zcParamsCopy = zcParams;
+        ZeroCopyString zcOffset = zcParamsCopy.SplitOffHead('/');
+        ZeroCopyString zcData = zcParamsCopy.SplitOffHead('/');
+        bool hold = zcParamsCopy.EqualsIC("hold");
+        uint32_t offset = 0;
+        if (zcOffset.ConvertTo_uint32(offset) == false || zcData.IsEmpty() || offset >= self.ledCount) {
+            self.framesRejected++;
+            return HALOperationResult::StringRequestParameterError;
+        }
+        const size_t frameBytes = (size_t)self.ledCount * self.bytesPerPixel;
+        if (self.frameBuffer == nullptr) {
+            self.frameBuffer = new uint8_t[frameBytes];
+            if (self.frameBuffer == nullptr) {
+                self.framesRejected++;
+                return HALOperationResult::ExecutionFailed;
+            }
+            memset(self.frameBuffer, 0, frameBytes);
+        }
+        // validated before decoding straight into the back buffer, so a bad chunk never leaves
+        // a partly overwritten staged frame, the strip itself is only touched from loop()
+        const size_t byteOffset = offset * self.bytesPerPixel;
+        int len = b64urlDecodedLength(zcData);
+        if (len <= 0 || (len % self.bytesPerPixel) != 0 || (size_t)len > frameBytes - byteOffset) {
+            self.framesRejected++;
+            return HALOperationResult::InvalidArgument;
+        }
+        b64urlDecodeRaw(self.frameBuffer + byteOffset, frameBytes - byteOffset, zcData);
+        uint16_t first = (uint16_t)offset;
+        uint16_t end = (uint16_t)(offset + len / self.bytesPerPixel);
+        if (self.frameDirtyFirst == self.frameDirtyEnd) {
+            self.frameDirtyFirst = first;
+            self.frameDirtyEnd = end;
+        } else {
+            if (first < self.frameDirtyFirst) self.frameDirtyFirst = first;
+            if (end > self.frameDirtyEnd) self.frameDirtyEnd = end;
+        }
+        if (!hold) {
+            self.framePending = true;
+        }
+        return HALOperationResult::Success;
+    }
+
+    void WS2812::presentFrame() {
+        // fx modes would overwrite the uploaded frame at the next service()
+        ws2812fx->pause();
+        const uint8_t* p = frameBuffer + (size_t)frameDirtyFirst * bytesPerPixel;
+        if (bytesPerPixel == 4) {
+            for (uint16_t i = frameDirtyFirst; i < frameDirtyEnd; ++i, p += 4) {
+                ws2812fx->setPixelColor(i, p[0], p[1], p[2], p[3]);
+            }
+        } else {
+            for (uint16_t i = frameDirtyFirst; i < frameDirtyEnd; ++i, p += 3) {
+                ws2812fx->setPixelColor(i, p[0], p[1], p[2]);
+            }
+        }
+        ws2812fx->execShow();
+        frameDirtyFirst = 0;
+        frameDirtyEnd = 0;
+        framePending = false;
+        framesShown++;
+    }
+
     __attribute__((used, externally_visible))
     constexpr DeviceFunctionTable WS2812::FunctionTable = {
         DALHAL_FUNCTION_TABLE_ENTRY(execFunctions),
@@ -130,7 +196,16 @@ namespace DALHAL {
         JsonSchema::WS2812::Extractors::Apply(context, this);
     }
 
+    WS2812::~WS2812() {
+        delete[] frameBuffer;
+    }
+
     void WS2812::loop() {
+        // an uploaded frame is only copied to the strip here, between service() calls,
+        // so a frame that arrive in several parts is never shown half written
+        if (framePending) {
+            presentFrame();
+        }
         //if (ws2812fx->getMode() != 0) // only service when non static mode
         ws2812fx->service();
     }
@@ -195,6 +270,10 @@ namespace DALHAL {
         sbs.write_jsonNumber(F("curr brightness"), ws2812fx->getBrightness());
         sbs.write_json_value_separator();
         sbs.write_jsonNumber(F("curr speed"), ws2812fx->getSpeed());
+        sbs.write_json_value_separator();
+        sbs.write_jsonNumber(F("frames shown"), framesShown);
+        sbs.write_json_value_separator();
+        sbs.write_jsonNumber(F("frames rejected"), framesRejected);
     }
 
     uint8_t neoCodeFromString(const char* str) {
@@ -65,6 +65,7 @@ namespace DALHAL {
         static HALOperationResult exec_stop_Function(Device* device);
         static HALOperationResult exec_start_Function(Device* device);
         static HALOperationResult writeString_setpixel_Function(Device* device, const ZeroCopyString& zcStrParameters, StringBuilderStreamer& sbs);
+        static HALOperationResult writeString_frame_Function(Device* device, const ZeroCopyString& zcStrParameters, StringBuilderStreamer& sbs);
 
 
     private:
@@ -73,12 +74,31 @@ namespace DALHAL {
         static HALOperationResult writeMode(Device* context, const HALValue& val);
         static HALOperationResult writeFxSpeed(Device* context, const HALValue& val);
 
+        /** 
+         * back buffer for frames uploaded by writeString_frame_Function,
+         * stored as R,G,B(,W) per pixel independent of the strip byte order,
+         * allocated on first upload so that strips only driven by fx modes don't pay for it
+         */
+        uint8_t* frameBuffer = nullptr;
+        /** set when the back buffer hold a complete frame that should be shown at the next loop() */
+        bool framePending = false;
+        /** pixel range [frameDirtyFirst, frameDirtyEnd) that differ from what is currently shown */
+        uint16_t frameDirtyFirst = 0;
+        uint16_t frameDirtyEnd = 0;
+        uint32_t framesShown = 0;
+        uint32_t framesRejected = 0;
+
+        void presentFrame();
+
     public:
         WS2812FX* ws2812fx; // need to be public
+        uint16_t ledCount = 0;
+        /** 3 for RGB and 4 for RGBW strips */
+        uint8_t bytesPerPixel = 3;
 
     public:
         WS2812(DeviceCreateContext& context);
-        ~WS2812() override = default;
+        ~WS2812() override;
 
         const Registry::DefineBase* GetRegistryDefine() override;
 
@@ -194,6 +194,9 @@ namespace DALHAL {
 
                 WS2812FX* ws2812fx = new WS2812FX(numLeds, pin, ws2812cfgData);
                 out->ws2812fx = ws2812fx; // out is the owner
+                out->ledCount = numLeds;
+                // same rule as Adafruit_NeoPixel: the W offset equals the R offset for 3 byte strips
+                out->bytesPerPixel = (((ws2812cfgData >> 6) & 0x03) == ((ws2812cfgData >> 4) & 0x03)) ? 3 : 4;
                 ws2812fx->init();
                 ws2812fx->setBrightness(brightness);
                 ws2812fx->setMode(mode);
@@ -35,6 +35,7 @@
 #include <DALHAL/Core/Manager/DALHAL_GPIO_Manager.h>
 
 #include "DALHAL_REGO600_JSON_Schema.h"
+#include <DALHAL/Core/Manager/DALHAL_DeviceArena.h>
 
 namespace DALHAL {
 
@@ -471,7 +472,7 @@ namespace DALHAL {
             for (int i=0;i<registerItemCount; i++) {
                 delete registerItems[i];
             }
-            delete[] registerItems;
+            DeviceArena::DeleteDeviceArray(registerItems);
         }
         pinMode(rxPin, INPUT); // input
         pinMode(txPin, INPUT); // input
@@ -521,6 +522,14 @@ namespace DALHAL {
             sbs.write_asHex(requestList[i]->def.regIndex);
             sbs.write_doublequote();
 
+            const Drivers::REGO600::PollSchedule& schedule = requestList[i]->schedule;
+            sbs.write_json_value_separator();
+            sbs.write_jsonNumber(F("priority"), schedule.priority);
+            sbs.write_json_value_separator();
+            sbs.write_jsonNumber(F("intervalMs"), schedule.intervalMs);
+            sbs.write_json_value_separator();
+            sbs.write_jsonNumber(F("latencyMs"), schedule.avgLatencyMs);
+
             sbs.write_json_object_end();
         }
         sbs.write_json_object_end();
@@ -39,6 +39,7 @@
 
 #include "DALHAL_REGO600.h"
 #include "DALHAL_REGO600_Register.h"
+#include <DALHAL/Core/Manager/DALHAL_DeviceArena.h>
 
 namespace DALHAL {
 
@@ -102,7 +103,7 @@ namespace DALHAL {
                 }
                 // second pass
                 out->requestList = new Drivers::REGO600::Request*[out->registerItemCount]();
-                out->registerItems = new Device*[out->registerItemCount]();
+                out->registerItems = DeviceArena::NewDeviceArray(out->registerItemCount);
                 int index = 0;
                 DeviceCreateContext createContext;
                 createContext.deviceType = "REGO600reg";
@@ -125,6 +126,9 @@ namespace DALHAL {
                         *entry,
                         itemReg->value
                     );
+                    Drivers::REGO600::PollSchedule& schedule = out->requestList[index]->schedule;
+                    schedule.priority = JsonSchema::REGO600_Register::priorityField.ExtractFrom(item);
+                    schedule.minIntervalMs = JsonSchema::REGO600_Register::minIntervalMsField.ExtractFrom(item);
                     out->registerItems[index] = itemReg;
                     index++;
                 }
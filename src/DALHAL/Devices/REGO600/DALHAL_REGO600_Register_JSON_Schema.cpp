@@ -25,6 +25,7 @@
 
 #include <DALHAL/Core/JsonConfig/Types/Base/DALHAL_JSON_Schema_TypeBase.h>
 #include <DALHAL/Core/JsonConfig/Types/Logical/String/DALHAL_JSON_Schema_StringAnyOfByFuncConstrained.h>
+#include <DALHAL/Core/JsonConfig/Types/Primitives/DALHAL_JSON_Schema_UInt.h>
 #include <DALHAL/Core/JsonConfig/Types/Root/DALHAL_JSON_Schema_JsonObjectSchema.h>
 
 #include <DALHAL/Core/JsonConfig/CommonSchemas/DALHAL_CommonSchemas_Base.h>
@@ -42,10 +43,16 @@ namespace DALHAL {
         namespace REGO600_Register {
         
             constexpr SchemaStringAnyOfByFuncConstrained regnameField = {"regname", FieldPolicy::Required, nullptr, Drivers::REGO600::REGO600Driver::SystemRegisterTable_ItemExists, Drivers::REGO600::REGO600Driver::SystemRegisterTable_GetAllNamesAsJsonStringArray, nullptr};
+            /** higher priority registers are polled first when several are due at the same time */
+            constexpr SchemaUInt priorityField = {"priority", FieldPolicy::Optional, (unsigned int)1, (unsigned int)REGO600_DRIVER_MAX_PRIORITY, (unsigned int)1};
+            /** lower limit of the adaptive poll interval, 0 = a quarter of the REGO600 refresh time */
+            constexpr SchemaUInt minIntervalMsField = {"minIntervalMs", FieldPolicy::Optional, (unsigned int)0, (unsigned int)0, (unsigned int)0};
 
             constexpr const SchemaTypeBase* fields[] = {
                 &CommonBase::disabled_uidreq_note_group, // DALHAL_CommonSchemas_Base
                 &regnameField,
+                &priorityField,
+                &minIntervalMsField,
                 nullptr,
             };
 
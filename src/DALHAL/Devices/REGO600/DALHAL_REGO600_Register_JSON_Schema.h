@@ -34,11 +34,14 @@ namespace DALHAL {
         // forward declarations
         struct JsonObjectSchema; 
         struct SchemaStringAnyOfByFuncConstrained; 
+        struct SchemaUInt;
 
         namespace REGO600_Register {
 
             extern const JsonObjectSchema Root;
             extern const SchemaStringAnyOfByFuncConstrained regnameField;
+            extern const SchemaUInt priorityField;
+            extern const SchemaUInt minIntervalMsField;
 
             struct Extractors final {
                 /** used by the device class */
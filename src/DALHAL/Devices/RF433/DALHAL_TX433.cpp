@@ -32,6 +32,7 @@
 #include "DALHAL_TX433_UnitTypeRegistry.h"
 
 #include "DALHAL_TX433_JSON_Schema.h"
+#include <DALHAL/Core/Manager/DALHAL_DeviceArena.h>
 
 namespace DALHAL {
 
@@ -83,7 +84,7 @@ namespace DALHAL {
                 }
                 units[i] = nullptr;
             }
-            delete[] units;
+            DeviceArena::DeleteDeviceArray(units);
             units = nullptr;
         }
         pinMode(pin, INPUT); // reset to input so other devices can safely use it
@@ -111,6 +112,18 @@ namespace DALHAL {
         sbs.write_json_value_separator();
         sbs.write_jsonNumber(F("pin"), pin);
         sbs.write_json_value_separator();
+        const RF433::TxStats& txStats = RF433::GetTxStats();
+        sbs.write_jsonMemberStart(F("tx"));
+        sbs.write_json_object_begin();
+        sbs.write_jsonNumber(F("queued"), txStats.framesQueued);
+        sbs.write_json_value_separator();
+        sbs.write_jsonNumber(F("coalesced"), txStats.framesCoalesced);
+        sbs.write_json_value_separator();
+        sbs.write_jsonNumber(F("dropped"), txStats.framesDropped);
+        sbs.write_json_value_separator();
+        sbs.write_jsonNumber(F("sent"), txStats.framesSent);
+        sbs.write_json_object_end();
+        sbs.write_json_value_separator();
         sbs.write_jsonMemberStart(F("units"));
         sbs.write_json_array_begin();
 
@@ -32,6 +32,7 @@
 #include "DALHAL_TX433_UnitTypeRegistry.h"
 
 #include "DALHAL_TX433.h"
+#include <DALHAL/Core/Manager/DALHAL_DeviceArena.h>
 
 namespace DALHAL {
 
@@ -85,7 +86,7 @@ namespace DALHAL {
                     return;
                 }
                 // second pass create units(devices)
-                out->units = new Device*[out->unitCount]();
+                out->units = DeviceArena::NewDeviceArray(out->unitCount);
                 uint32_t index = 0;
                 TX433_Unit_CreateFunctionContext createContext(out->pin);
                 for (int i=0;i<jsonItems_count;i++) {
@@ -39,6 +39,71 @@
 
 namespace DALHAL {
 
+    // tight loops over the packed storage, kept free of calls and branches
+    // on the data so that the compiler can auto-vectorize the integer ones
+    namespace ScriptArrayKernels {
+
+        template<typename T, typename Acc>
+        static inline Acc Sum(const T* p, int n) {
+            Acc acc = 0;
+            for (int i = 0; i < n; ++i) acc += p[i];
+            return acc;
+        }
+        /** float adds can't be reordered by the compiler (no -ffast-math), so the lanes are explicit */
+        static inline float SumFloat(const float* p, int n) {
+            float a0 = 0.0f, a1 = 0.0f, a2 = 0.0f, a3 = 0.0f;
+            int i = 0;
+            for (; i + 4 <= n; i += 4) {
+                a0 += p[i];
+                a1 += p[i + 1];
+                a2 += p[i + 2];
+                a3 += p[i + 3];
+            }
+            for (; i < n; ++i) a0 += p[i];
+            return (a0 + a1) + (a2 + a3);
+        }
+        /** a sum that does not fit in int32 is given as float instead of wrapping */
+        static inline void SetSum(HALValue& val, int64_t sum) {
+            if (sum >= INT32_MIN && sum <= INT32_MAX) val = (int32_t)sum;
+            else val = (float)sum;
+        }
+        template<typename T>
+        static inline T Min(const T* p, int n) {
+            T m = p[0];
+            for (int i = 1; i < n; ++i) m = (p[i] < m) ? p[i] : m;
+            return m;
+        }
+        template<typename T>
+        static inline T Max(const T* p, int n) {
+            T m = p[0];
+            for (int i = 1; i < n; ++i) m = (p[i] > m) ? p[i] : m;
+            return m;
+        }
+        static inline int32_t Clamp(int32_t v, int32_t lo, int32_t hi) {
+            return (v < lo) ? lo : ((v > hi) ? hi : v);
+        }
+        /** saturates in the source type, toInt() wraps a UINT above INT32_MAX and a FLOAT outside the int32 range is undefined */
+        static inline int32_t ClampToInt(const HALValue& val, int32_t lo, int32_t hi) {
+            switch (val.getType()) {
+                case HALValue::Type::UINT: {
+                    const uint32_t u = val.asRawUInt();
+                    if (u > static_cast<uint32_t>(hi)) return hi;
+                    return Clamp(static_cast<int32_t>(u), lo, hi);
+                }
+                case HALValue::Type::FLOAT: {
+                    const float f = val.asRawFloat();
+                    if (f != f) return Clamp(0, lo, hi); // NaN
+                    if (f <= static_cast<float>(lo)) return lo;
+                    if (f >= static_cast<float>(hi)) return hi;
+                    return static_cast<int32_t>(f);
+                }
+                default:
+                    return Clamp(val.toInt(), lo, hi);
+            }
+        }
+
+    }
+
     __attribute__((used, externally_visible))
     constexpr Registry::DefineBase ScriptArray::RegistryDefine = {
         Create,
@@ -68,11 +133,25 @@ namespace DALHAL {
         DALHAL_FUNCTION_ENTRY("valuelist", ScriptArray::readString_valuelist_Function, "get the whole list of values")
     };
 
+    __attribute__((used, externally_visible))
+    constexpr FunctionEntry<FunctionTypes::ReadToHALValue> ScriptArray::readValueFunctions[] = {
+        DALHAL_FUNCTION_ENTRY("sum", ScriptArray::read_sum_Function, "sum of all items"),
+        DALHAL_FUNCTION_ENTRY("min", ScriptArray::read_min_Function, "smallest item"),
+        DALHAL_FUNCTION_ENTRY("max", ScriptArray::read_max_Function, "largest item"),
+        DALHAL_FUNCTION_ENTRY("avg", ScriptArray::read_avg_Function, "average of all items (float)"),
+        DALHAL_FUNCTION_ENTRY("count", ScriptArray::read_count_Function, "number of items")
+    };
+
+    __attribute__((used, externally_visible))
+    constexpr FunctionEntry<FunctionTypes::WriteHALValue> ScriptArray::writeValueFunctions[] = {
+        DALHAL_FUNCTION_ENTRY_WITH_VAL_TYPE("shift", ScriptArray::write_shift_Function, "shift in a value at the end, the first item is dropped (ring buffer)", FunctionValueType::_Number_)
+    };
+
     __attribute__((used, externally_visible))
     constexpr DeviceFunctionTable ScriptArray::FunctionTable = {
         EmptyFunctionTable<FunctionTypes::Exec>,
-        EmptyFunctionTable<FunctionTypes::ReadToHALValue>,
-        EmptyFunctionTable<FunctionTypes::WriteHALValue>,
+        DALHAL_FUNCTION_TABLE_ENTRY(readValueFunctions),
+        DALHAL_FUNCTION_TABLE_ENTRY(writeValueFunctions),
         DALHAL_FUNCTION_TABLE_ENTRY(bracketOpReadFunctions),
         DALHAL_FUNCTION_TABLE_ENTRY(bracketOpWriteFunctions),
         DALHAL_FUNCTION_TABLE_ENTRY(readStringFunctions),
@@ -83,7 +162,51 @@ namespace DALHAL {
         JsonSchema::ScriptArray::Extractors::Apply(context, this);
     }
     ScriptArray::~ScriptArray() {
-        delete values;
+        delete[] values;
+        switch (storage) {
+            case Storage::Int16: delete[] static_cast<int16_t*>(packed); break;
+            case Storage::Int32: delete[] static_cast<int32_t*>(packed); break;
+            case Storage::UInt8: delete[] static_cast<uint8_t*>(packed); break;
+            case Storage::Float: delete[] static_cast<float*>(packed); break;
+            default: break;
+        }
+    }
+
+    void ScriptArray::Pack() {
+        if (storage == Storage::Value || values == nullptr) return;
+        switch (storage) {
+            case Storage::Int16: packed = new int16_t[valueCount]; break;
+            case Storage::Int32: packed = new int32_t[valueCount]; break;
+            case Storage::UInt8: packed = new uint8_t[valueCount]; break;
+            case Storage::Float: packed = new float[valueCount]; break;
+            default: break;
+        }
+        for (int i = 0; i < valueCount; ++i) {
+            SetAt(i, values[i]);
+        }
+        delete[] values;
+        values = nullptr;
+    }
+
+    HALValue ScriptArray::GetAt(int physicalIndex) const {
+        switch (storage) {
+            case Storage::Int16: return HALValue((int32_t)static_cast<const int16_t*>(packed)[physicalIndex]);
+            case Storage::Int32: return HALValue(static_cast<const int32_t*>(packed)[physicalIndex]);
+            case Storage::UInt8: return HALValue((uint32_t)static_cast<const uint8_t*>(packed)[physicalIndex]);
+            case Storage::Float: return HALValue(static_cast<const float*>(packed)[physicalIndex]);
+            default: return values[physicalIndex];
+        }
+    }
+
+    void ScriptArray::SetAt(int physicalIndex, const HALValue& val) {
+        // integer storage saturates instead of wrapping around
+        switch (storage) {
+            case Storage::Int16: static_cast<int16_t*>(packed)[physicalIndex] = (int16_t)ScriptArrayKernels::ClampToInt(val, INT16_MIN, INT16_MAX); break;
+            case Storage::Int32: static_cast<int32_t*>(packed)[physicalIndex] = ScriptArrayKernels::ClampToInt(val, INT32_MIN, INT32_MAX); break;
+            case Storage::UInt8: static_cast<uint8_t*>(packed)[physicalIndex] = (uint8_t)ScriptArrayKernels::ClampToInt(val, 0, UINT8_MAX); break;
+            case Storage::Float: static_cast<float*>(packed)[physicalIndex] = val.toFloat(); break;
+            default: values[physicalIndex] = val; break;
+        }
     }
 
     Device* ScriptArray::Create(DeviceCreateContext& context) {
@@ -92,6 +215,10 @@ namespace DALHAL {
 
     void ScriptArray::PrintTo(StringBuilderStreamer& sbs) {
         Device::PrintTo(sbs);
+        sbs.write_json_value_separator();
+        sbs.write_jsonString(F("storage"), JsonSchema::ScriptArray::StorageToString((uint8_t)storage));
+        sbs.write_json_value_separator();
+        sbs.write_jsonNumber(F("count"), (uint32_t)valueCount);
     }
     // init array here
     void ScriptArray::begin() {
@@ -107,7 +234,7 @@ namespace DALHAL {
             if (i>0) {
                 sbs.write_json_value_separator();
             }
-            sbs.write(self.values[i]);
+            sbs.write(self.GetAt(self.PhysicalIndex(i)));
             //self.values[i].toString(sbs);
         }
         sbs.write_json_array_end();
@@ -130,7 +257,7 @@ namespace DALHAL {
             sbs.write_jsonString(F("error"), F("invalid index out of range"));
             return HALOperationResult::BracketOpSubscriptOutOffRange;
         }
-        sbs.write(self.values[index]);
+        sbs.write(self.GetAt(self.PhysicalIndex(index)));
         //self.values[index].toString(sbs);
         //val.out_value = values[index].toString();
         return HALOperationResult::Success;
@@ -143,7 +270,7 @@ namespace DALHAL {
             printf("\nScriptArray::read BracketOpSubscriptOutOffRange:%d\n", index);
             return HALOperationResult::BracketOpSubscriptOutOffRange;
         }
-        val = self.values[index];
+        val = self.GetAt(self.PhysicalIndex(index));
 #if HAS_REACTIVE_BRACKET_READ(SCRIPT_ARRAY)
         self.triggerBracketRead();
 #endif
@@ -159,11 +286,96 @@ namespace DALHAL {
             printf("\nScriptArray::write BracketOpSubscriptOutOffRange:%d\n", index);
             return HALOperationResult::BracketOpSubscriptOutOffRange;
         }
-        self.values[index] = val;
+        self.SetAt(self.PhysicalIndex(index), val);
+#if HAS_REACTIVE_BRACKET_WRITE(SCRIPT_ARRAY)
+        self.triggerBracketWrite();
+#endif
+        return HALOperationResult::Success;
+    }
+
+    /* static */
+    HALOperationResult ScriptArray::read_sum_Function(Device* device, HALValue& val) {
+        ScriptArray& self = static_cast<ScriptArray&>(*device);
+        const int n = self.valueCount;
+        switch (self.storage) {
+            case Storage::Int16: ScriptArrayKernels::SetSum(val, ScriptArrayKernels::Sum<int16_t, int64_t>(static_cast<const int16_t*>(self.packed), n)); break;
+            case Storage::Int32: ScriptArrayKernels::SetSum(val, ScriptArrayKernels::Sum<int32_t, int64_t>(static_cast<const int32_t*>(self.packed), n)); break;
+            case Storage::UInt8: val = ScriptArrayKernels::Sum<uint8_t, uint32_t>(static_cast<const uint8_t*>(self.packed), n); break; // 255 * n can't overflow
+            case Storage::Float: val = ScriptArrayKernels::SumFloat(static_cast<const float*>(self.packed), n); break;
+            default: {
+                float acc = 0.0f;
+                for (int i = 0; i < n; ++i) acc += self.values[i].toFloat();
+                val = acc;
+                break;
+            }
+        }
+        return HALOperationResult::Success;
+    }
+    /* static */
+    HALOperationResult ScriptArray::read_min_Function(Device* device, HALValue& val) {
+        ScriptArray& self = static_cast<ScriptArray&>(*device);
+        const int n = self.valueCount;
+        if (n == 0) return HALOperationResult::ExecutionFailed;
+        switch (self.storage) {
+            case Storage::Int16: val = (int32_t)ScriptArrayKernels::Min(static_cast<const int16_t*>(self.packed), n); break;
+            case Storage::Int32: val = ScriptArrayKernels::Min(static_cast<const int32_t*>(self.packed), n); break;
+            case Storage::UInt8: val = (uint32_t)ScriptArrayKernels::Min(static_cast<const uint8_t*>(self.packed), n); break;
+            case Storage::Float: val = ScriptArrayKernels::Min(static_cast<const float*>(self.packed), n); break;
+            default: {
+                int m = 0;
+                for (int i = 1; i < n; ++i) if (self.values[i].toFloat() < self.values[m].toFloat()) m = i;
+                val = self.values[m];
+                break;
+            }
+        }
+        return HALOperationResult::Success;
+    }
+    /* static */
+    HALOperationResult ScriptArray::read_max_Function(Device* device, HALValue& val) {
+        ScriptArray& self = static_cast<ScriptArray&>(*device);
+        const int n = self.valueCount;
+        if (n == 0) return HALOperationResult::ExecutionFailed;
+        switch (self.storage) {
+            case Storage::Int16: val = (int32_t)ScriptArrayKernels::Max(static_cast<const int16_t*>(self.packed), n); break;
+            case Storage::Int32: val = ScriptArrayKernels::Max(static_cast<const int32_t*>(self.packed), n); break;
+            case Storage::UInt8: val = (uint32_t)ScriptArrayKernels::Max(static_cast<const uint8_t*>(self.packed), n); break;
+            case Storage::Float: val = ScriptArrayKernels::Max(static_cast<const float*>(self.packed), n); break;
+            default: {
+                int m = 0;
+                for (int i = 1; i < n; ++i) if (self.values[i].toFloat() > self.values[m].toFloat()) m = i;
+                val = self.values[m];
+                break;
+            }
+        }
+        return HALOperationResult::Success;
+    }
+    /* static */
+    HALOperationResult ScriptArray::read_avg_Function(Device* device, HALValue& val) {
+        ScriptArray& self = static_cast<ScriptArray&>(*device);
+        if (self.valueCount == 0) return HALOperationResult::ExecutionFailed;
+        HALValue sum;
+        read_sum_Function(device, sum);
+        val = sum.toFloat() / (float)self.valueCount;
+        return HALOperationResult::Success;
+    }
+    /* static */
+    HALOperationResult ScriptArray::read_count_Function(Device* device, HALValue& val) {
+        ScriptArray& self = static_cast<ScriptArray&>(*device);
+        val = (uint32_t)self.valueCount;
+        return HALOperationResult::Success;
+    }
+    /* static */
+    HALOperationResult ScriptArray::write_shift_Function(Device* device, const HALValue& val) {
+        ScriptArray& self = static_cast<ScriptArray&>(*device);
+        if (self.readOnly) return HALOperationResult::UnsupportedOperation;
+        if (self.valueCount == 0) return HALOperationResult::ExecutionFailed;
+        // the slot of the oldest item becomes the newest, no items are moved
+        self.SetAt(self.head, val);
+        self.head = (self.head + 1 == self.valueCount) ? 0 : (self.head + 1);
 #if HAS_REACTIVE_BRACKET_WRITE(SCRIPT_ARRAY)
         self.triggerBracketWrite();
 #endif
         return HALOperationResult::Success;
     }
 
-}
\ No newline at end of file
+}
@@ -49,6 +49,14 @@ namespace DALHAL {
         friend struct JsonSchema::ScriptArray::Extractors; // allow access to private memebers of this class from the schema extractor
 
     public: // public static fields and exposed external structures
+        /** backing storage of the items, selected by the "storage" field in the cfg */
+        enum class Storage : uint8_t {
+            Value, // HALValue per item, can mix types (default)
+            Int16,
+            Int32,
+            UInt8,
+            Float
+        };
         static const Registry::DefineBase RegistryDefine;
         static Device* Create(DeviceCreateContext& context);
 
@@ -57,18 +65,37 @@ namespace DALHAL {
         static const FunctionEntry<FunctionTypes::BracketOpRead> bracketOpReadFunctions[];
         static const FunctionEntry<FunctionTypes::BracketOpWrite> bracketOpWriteFunctions[];
         static const FunctionEntry<FunctionTypes::ReadString> readStringFunctions[];
+        static const FunctionEntry<FunctionTypes::ReadToHALValue> readValueFunctions[];
+        static const FunctionEntry<FunctionTypes::WriteHALValue> writeValueFunctions[];
 
         static HALOperationResult readString_valuelist_Function(Device* device, ZeroCopyString zcStrParameters, StringBuilderStreamer& sbs);
         static HALOperationResult readString_primary_Function(Device* device, ZeroCopyString zcStrParameters, StringBuilderStreamer& sbs);
 
+        static HALOperationResult read_sum_Function(Device* device, HALValue& val);
+        static HALOperationResult read_min_Function(Device* device, HALValue& val);
+        static HALOperationResult read_max_Function(Device* device, HALValue& val);
+        static HALOperationResult read_avg_Function(Device* device, HALValue& val);
+        static HALOperationResult read_count_Function(Device* device, HALValue& val);
+        static HALOperationResult write_shift_Function(Device* device, const HALValue& val);
+
     private:
         static HALOperationResult BracketRead_Func(Device* device, const HALValue& bracketSubscriptVal, HALValue& val);
         static HALOperationResult BracketWrite_Func(Device* device, const HALValue& bracketSubscriptVal, const HALValue& val);
 
-        HALValue* values = nullptr;
+        HALValue* values = nullptr; // used when storage == Storage::Value
+        void* packed = nullptr;     // used by all other storage types
         int valueCount = 0;
+        int head = 0; // physical index of item 0, advanced by shift so the array works as a ring buffer
+        Storage storage = Storage::Value;
         bool readOnly = false;
 
+        /** maps a script index to the physical slot */
+        inline int PhysicalIndex(int index) const { int i = head + index; return (i >= valueCount) ? (i - valueCount) : i; }
+        HALValue GetAt(int physicalIndex) const;
+        void SetAt(int physicalIndex, const HALValue& val);
+        /** converts the extracted HALValue items into the packed storage */
+        void Pack();
+
     public:
         ScriptArray(DeviceCreateContext& context);
         ~ScriptArray() override;
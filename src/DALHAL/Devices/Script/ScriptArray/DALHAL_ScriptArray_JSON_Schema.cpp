@@ -26,6 +26,7 @@
 #include <DALHAL/Core/JsonConfig/Types/Base/DALHAL_JSON_Schema_TypeBase.h>
 #include <DALHAL/Core/JsonConfig/Types/Base/DALHAL_JSON_Schema_PrimitiveTypeFlags.h>
 #include <DALHAL/Core/JsonConfig/Types/Primitives/DALHAL_JSON_Schema_Bool.h>
+#include <DALHAL/Core/JsonConfig/Types/Logical/String/DALHAL_JSON_Schema_StringAnyOfArrayConstrained.h>
 #include <DALHAL/Core/JsonConfig/Types/Structures/DALHAL_JSON_Schema_ArrayOfPrimitives.h>
 #include <DALHAL/Core/JsonConfig/Types/Root/DALHAL_JSON_Schema_JsonObjectSchema.h>
 
@@ -41,11 +42,17 @@ namespace DALHAL {
 
             constexpr SchemaBool readonlyField = {"readonly", FieldPolicy::Optional, false};
 
+            // same order as DALHAL::ScriptArray::Storage
+            constexpr const char* storageTypes[] = {"value", "int16", "int32", "uint8", "float", nullptr};
+            constexpr ByArrayConstraints storageTypesConstraint = {storageTypes, ByArrayConstraints::Policy::IgnoreCase};
+            constexpr SchemaStringAnyOfArrayConstrained storageField = {"storage", FieldPolicy::Optional, "value", &storageTypesConstraint};
+
             constexpr SchemaArrayOfPrimitives scriptArrayItems = {"items", FieldPolicy::Required, PrimitiveTypeFlags::AllowNumbers, EmptyPolicy::Error};
 
             constexpr const SchemaTypeBase* fields[] = {
                 &CommonBase::disabled_type_uidreq_note_group, // DALHAL_CommonSchemas_Base
                 &readonlyField,
+                &storageField,
                 &scriptArrayItems,
                 nullptr,
             };
@@ -59,15 +66,31 @@ namespace DALHAL {
                 UnknownFieldPolicy::Warn,
             };
 
+            const char* StorageToString(uint8_t storage) {
+                constexpr uint8_t count = sizeof(storageTypes)/sizeof(storageTypes[0]) - 1;
+                return (storage < count) ? storageTypes[storage] : "unknown";
+            }
+
+            static DALHAL::ScriptArray::Storage GetStorage(const char* name) {
+                for (uint8_t i = 0; storageTypes[i] != nullptr; ++i) {
+                    if (strcasecmp(storageTypes[i], name) == 0) {
+                        return static_cast<DALHAL::ScriptArray::Storage>(i);
+                    }
+                }
+                return DALHAL::ScriptArray::Storage::Value;
+            }
+
             void Extractors::Apply(DALHAL::DeviceCreateContext& context, DALHAL::ScriptArray* out) {
                 const JsonVariant& jsonObj = *(context.jsonObjItem);
                 out->uid = encodeUID(JsonSchema::CommonBase::uidFieldRequired.ExtractFrom(jsonObj));
                 out->readOnly = JsonSchema::ScriptArray::readonlyField.ExtractFrom(jsonObj);
+                out->storage = GetStorage(JsonSchema::ScriptArray::storageField.ExtractFrom(jsonObj));
                 out->values = nullptr; // allways set it to nullptr
                 if (JsonSchema::ScriptArray::scriptArrayItems.ExtractValues(jsonObj, &out->values, out->valueCount) == false) {
                     // should never happend
                     GlobalLogger.Error(F("Failed to extract script array items"));
                 }
+                out->Pack();
             }
 
         }
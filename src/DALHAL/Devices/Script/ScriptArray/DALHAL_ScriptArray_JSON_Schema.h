@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <stdint.h>
+
 namespace DALHAL {
 
     // forward declarations
@@ -38,6 +40,8 @@ namespace DALHAL {
 
             extern const JsonObjectSchema Root;
 
+            const char* StorageToString(uint8_t storage);
+
             struct Extractors final {
                 /** used by the device class */
                 static void Apply(DALHAL::DeviceCreateContext& context, DALHAL::ScriptArray* out);
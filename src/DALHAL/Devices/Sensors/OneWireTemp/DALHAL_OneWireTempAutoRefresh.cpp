@@ -28,44 +28,50 @@
 
 namespace DALHAL {
 
-    OneWireTempAutoRefresh::OneWireTempAutoRefresh(std::function<void()> _requestTemperatures, std::function<void()> _readAll)
-        : requestTemperatures(_requestTemperatures), readAll(_readAll) {
-            if (!requestTemperatures || !readAll) {
+    OneWireTempAutoRefresh::OneWireTempAutoRefresh(std::function<uint32_t()> _startConversion, std::function<bool()> _readNext)
+        : startConversion(_startConversion), readNext(_readNext) {
+            if (!startConversion || !readNext) {
                 Serial.println(F("ERR@OWTAR")); // short error that can be searched for in code
                 //abort();  // or throw if exceptions are enabled
             }
     }
 
     void OneWireTempAutoRefresh::SetRefreshTimeMs(uint32_t _refreshTimeMs) {
-        if (_refreshTimeMs > DALHAL_ONE_WIRE_TEMP_CONVERSION_TIME_MS)
-            refreshTimeMs = _refreshTimeMs - DALHAL_ONE_WIRE_TEMP_CONVERSION_TIME_MS;
-        else
-            refreshTimeMs = 0; // or some minimum value to avoid underflow
+        // the refresh time is measured from cycle start to cycle start
+        // if a cycle takes longer the next one is started directly
+        refreshTimeMs = _refreshTimeMs;
         // reset states
         state = State::IDLE;
-        lastUpdateMs = millis();
+        lastStart = millis();
+    }
+
+    /*static*/
+    uint32_t OneWireTempAutoRefresh::GetConversionTimeMs(uint8_t resolution) {
+        if (resolution < 9) resolution = 9;
+        else if (resolution > 12) resolution = 12;
+        return DALHAL_ONE_WIRE_TEMP_CONVERSION_TIME_MS >> (12 - resolution);
     }
 
 	void OneWireTempAutoRefresh::loop() {
 		uint32_t now = millis();
         switch (state) {
             case State::IDLE:
-                if ((now - lastUpdateMs) >= refreshTimeMs) {
-                    if (requestTemperatures != nullptr)
-                        requestTemperatures();
-                    //else
-                    //    Serial.println(F("W@OWTAR - rtFP"));
+                if ((now - lastStart) >= refreshTimeMs) {
+                    if (startConversion == nullptr) break;
+                    conversionTimeMs = startConversion();
                     state = State::WAITING_FOR_CONVERSION;
                     lastStart = now;
                 }
                 break;
             case State::WAITING_FOR_CONVERSION:
-                if (now - lastStart >= DALHAL_ONE_WIRE_TEMP_CONVERSION_TIME_MS) {
-                    if (readAll != nullptr)
-                        readAll();
-                    //else
-                    //    Serial.println(F("W@OWTAR - raFP"));
-                    lastUpdateMs = now;
+                if (now - lastStart >= conversionTimeMs) {
+                    state = State::READING;
+                }
+                break;
+            case State::READING:
+                // one scratchpad read per loop tick, so the loop is never held for more than one sensor
+                if (readNext == nullptr || readNext()) {
+                    lastCycleTimeMs = millis() - lastStart;
                     state = State::IDLE;
                 }
                 break;
@@ -73,6 +79,10 @@ namespace DALHAL {
 	}
 
     void OneWireTempAutoRefresh::PrintTo(StringBuilderStreamer& sbs) {
-        sbs.write_jsonNumber(F("refreshtimeMs"), refreshTimeMs + DALHAL_ONE_WIRE_TEMP_CONVERSION_TIME_MS);
+        sbs.write_jsonNumber(F("refreshtimeMs"), refreshTimeMs);
+        sbs.write_json_value_separator();
+        sbs.write_jsonNumber(F("conversionMs"), conversionTimeMs);
+        sbs.write_json_value_separator();
+        sbs.write_jsonNumber(F("cycleTimeMs"), lastCycleTimeMs);
     }
 }
\ No newline at end of file
@@ -30,23 +30,31 @@
 #include <DALHAL/API/DALHAL_StringBuilderStreamer.h>
 
 #define DALHAL_ONE_WIRE_TEMP_DEFAULT_REFRESHRATE_MS 1000
-#define DALHAL_ONE_WIRE_TEMP_CONVERSION_TIME_MS 1000
+/** max conversion time at 12 bit resolution, each lower bit halves it */
+#define DALHAL_ONE_WIRE_TEMP_CONVERSION_TIME_MS 750
+#define DALHAL_ONE_WIRE_TEMP_DEFAULT_RESOLUTION 12
+/** number of extra scratchpad reads done when the crc do not match */
+#define DALHAL_ONE_WIRE_TEMP_CRC_RETRIES 2
 
 namespace DALHAL {
 
+    /**
+     * cooperative conversion/read cycle
+     * startConversion is expected to issue a non blocking convert and return the time to wait,
+     * readNext is then called once every loop tick (reading one sensor) until it returns true
+     */
     class OneWireTempAutoRefresh {
-        typedef void (*Callback)();
 
     private:
-        enum class State { IDLE, WAITING_FOR_CONVERSION };
-        
-        uint32_t lastUpdateMs = 0;
+        enum class State { IDLE, WAITING_FOR_CONVERSION, READING };
 
         State state = State::IDLE;
         uint32_t lastStart = 0;
+        uint32_t conversionTimeMs = 0;
+        uint32_t lastCycleTimeMs = 0;
 
-        std::function<void()> requestTemperatures;
-        std::function<void()> readAll;
+        std::function<uint32_t()> startConversion;
+        std::function<bool()> readNext;
 
     protected:
         uint32_t refreshTimeMs = DALHAL_ONE_WIRE_TEMP_DEFAULT_REFRESHRATE_MS;
@@ -55,8 +63,11 @@ namespace DALHAL {
     public:
         OneWireTempAutoRefresh() = delete;
         OneWireTempAutoRefresh(OneWireTempAutoRefresh&) = delete;
-        OneWireTempAutoRefresh(std::function<void()> _requestTemperatures, std::function<void()> _readAll);
+        OneWireTempAutoRefresh(std::function<uint32_t()> _startConversion, std::function<bool()> _readNext);
         void SetRefreshTimeMs(uint32_t _refreshTimeMs);
+
+        /** max conversion time for the given resolution (9-12 bits) */
+        static uint32_t GetConversionTimeMs(uint8_t resolution);
         
         void loop();
 
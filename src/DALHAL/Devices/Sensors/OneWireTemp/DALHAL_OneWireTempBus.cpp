@@ -32,6 +32,7 @@
 
 #include <DALHAL/Core/JsonConfig/CommonSchemas/DALHAL_CommonSchemas_Time.h>
 #include "DALHAL_OneWireTempBus_JSON_Schema.h"
+#include <DALHAL/Core/Manager/DALHAL_DeviceArena.h>
 
 namespace DALHAL {
 
@@ -97,7 +98,7 @@ namespace DALHAL {
                 delete devices[i];
                 devices[i] = nullptr;
             }
-            delete[] devices;
+            DeviceArena::DeleteDeviceArray(devices);
             devices = nullptr;
         }
         delete dTemp;
@@ -106,20 +107,44 @@ namespace DALHAL {
         pinMode(pin, INPUT); // "free" the pin
     }
 
-    void OneWireTempBus::requestTemperatures()
+    uint32_t OneWireTempBus::startConversion()
     {
-        dTemp->requestTemperatures();
+        dTemp->requestTemperatures(); // skip rom convert, non blocking as setWaitForConversion(false)
+        cycleStartMs = millis();
+        readIndex = 0;
+        readRetries = 0;
+
+        uint8_t maxResolution = 9;
+        for (int i=0;i<deviceCount;i++) {
+            OneWireTempDevice* device = static_cast<OneWireTempDevice*>(devices[i]);
+            if (device->resolution > maxResolution) maxResolution = device->resolution;
+        }
+        return OneWireTempAutoRefresh::GetConversionTimeMs(maxResolution);
     }
 
-    void OneWireTempBus::readAll()
+    bool OneWireTempBus::readNext()
     {
-        for (int i=0;i<deviceCount;i++) {
-            OneWireTempDevice* device = static_cast<OneWireTempDevice*>(devices[i]); // cast for fast exec not using vtable lockup
-            device->read(*dTemp);
+        if (readIndex < 0) return true; // no cycle in progress
+
+        if (readIndex < deviceCount) {
+            OneWireTempDevice* device = static_cast<OneWireTempDevice*>(devices[readIndex]); // cast for fast exec not using vtable lockup
+            if (device->read(*dTemp) == false) {
+                if (readRetries < DALHAL_ONE_WIRE_TEMP_CRC_RETRIES) {
+                    readRetries++;
+                    return false; // retry the same sensor next loop tick
+                }
+                crcErrorCount++;
+            }
+            readRetries = 0;
+            readIndex++;
+            if (readIndex < deviceCount) return false;
         }
+        readIndex = -1;
+        lastCycleTimeMs = millis() - cycleStartMs;
 #if HAS_REACTIVE_CYCLE_COMPLETE(ONE_WIRE_TEMP_BUS)
         triggerCycleComplete();
 #endif
+        return true;
     }
 
     DeviceFindResult OneWireTempBus::findDevice(UIDPath& path, Device*& outDevice) {
@@ -212,6 +237,10 @@ namespace DALHAL {
         sbs.write_json_value_separator();
         sbs.write_jsonNumber(F("pin"), pin);
         sbs.write_json_value_separator();
+        sbs.write_jsonNumber(F("cycleTimeMs"), lastCycleTimeMs);
+        sbs.write_json_value_separator();
+        sbs.write_jsonNumber(F("crcErrors"), crcErrorCount);
+        sbs.write_json_value_separator();
         sbs.write_jsonMemberStart(F("devices"));
         sbs.write_json_array_begin();
 
@@ -227,8 +256,8 @@ namespace DALHAL {
     OneWireTempBusAtRoot::OneWireTempBusAtRoot(DeviceCreateContext& context) 
     : OneWireTempBus(context),
         autoRefresh(
-              [this]() { requestTemperatures(); },
-              [this]() { readAll(); }
+              [this]() { return startConversion(); },
+              [this]() { return readNext(); }
         )
     {
         JsonSchema::OneWireTempBusAtRoot::Extractors::Apply(context, this);
@@ -71,6 +71,13 @@ namespace DALHAL {
         int deviceCount = 0;
         Device **devices;
 
+        /** index of the next sensor to read, -1 when no read cycle is in progress */
+        int readIndex = -1;
+        uint8_t readRetries = 0;
+        uint32_t cycleStartMs = 0;
+        uint32_t lastCycleTimeMs = 0;
+        uint32_t crcErrorCount = 0;
+
     public:    
         OneWireTempBus(DeviceCreateContext& context);
         ~OneWireTempBus() override;
@@ -79,8 +86,10 @@ namespace DALHAL {
 
         /** this function will search the devices to find the device with the uid */
         DeviceFindResult findDevice(UIDPath& path, Device*& outDevice) override;
-        void requestTemperatures();
-        void readAll();
+        /** issues a non blocking skip rom convert on the bus, returns the wait needed by the highest configured resolution */
+        uint32_t startConversion();
+        /** reads one sensor, returns true when all sensors on the bus have been read */
+        bool readNext();
 
         void getAllDevices(bool printTemp, bool onlyNewDevices, StringBuilderStreamer& sbs);
         
@@ -34,6 +34,7 @@
 #include "DALHAL_OneWireTempDevice_JSON_Schema.h"
 
 #include "DALHAL_OneWireTempBus.h"
+#include <DALHAL/Core/Manager/DALHAL_DeviceArena.h>
 
 namespace DALHAL {
 
@@ -78,7 +79,7 @@ namespace DALHAL {
                     if (Device::DisabledOrCommentItem(item)) { continue; }
                     out->deviceCount++;
                 }
-                out->devices = new Device*[static_cast<size_t>(out->deviceCount)]();
+                out->devices = DeviceArena::NewDeviceArray(static_cast<size_t>(out->deviceCount));
                 
                 DeviceCreateContext createContext;
                 createContext.deviceType = "OneWireTempDevice";
@@ -89,7 +90,9 @@ namespace DALHAL {
                     if (Device::DisabledOrCommentItem(item)) { continue; }
 
                     createContext.jsonObjItem = &item;
-                    out->devices[index++] = DALHAL::OneWireTempDevice::RegistryDefine.Create_Function(createContext);
+                    DALHAL::OneWireTempDevice* device = static_cast<DALHAL::OneWireTempDevice*>(DALHAL::OneWireTempDevice::RegistryDefine.Create_Function(createContext));
+                    out->dTemp->setResolution(device->romid.bytes, device->resolution);
+                    out->devices[index++] = device;
                     //out->devices[index++] = new DALHAL::OneWireTempDevice(createContext);
                 }
             }
@@ -108,22 +108,30 @@ namespace DALHAL {
         return HALOperationResult::Success;
     }
 
-    void OneWireTempDevice::read(DallasTemperature& dTemp) {
-        float tempVal = 0;
-        bool updateVal = false;
-        if (format == OneWireTempDeviceTempFormat::Celsius) {
-            tempVal = dTemp.getTempC(romid.bytes);
-            updateVal = (tempVal != DEVICE_DISCONNECTED_C);
+    bool OneWireTempDevice::read(DallasTemperature& dTemp) {
+        ScratchPad scratchPad;
+        // isConnected reads the scratchpad and validates the crc
+        if (dTemp.isConnected(romid.bytes, scratchPad) == false) return false;
+
+        float tempVal = decodeTempC(scratchPad);
+        if (format == OneWireTempDeviceTempFormat::Fahrenheit) {
+            tempVal = tempVal * 1.8f + 32.0f;
         }
-        else if (format == OneWireTempDeviceTempFormat::Fahrenheit) {
-            tempVal = dTemp.getTempF(romid.bytes);
-            updateVal = (tempVal != DEVICE_DISCONNECTED_F);
-        }
-        if (updateVal) {
-            value = tempVal;
-            dataValid = true;
-            //triggerEvent(); // actually a async event trigger
+        value = tempVal;
+        dataValid = true;
+        return true;
+    }
+
+    float OneWireTempDevice::decodeTempC(const uint8_t* scratchPad) {
+        int16_t raw = (int16_t)(((uint16_t)scratchPad[1] << 8) | scratchPad[0]);
+        if (romid.bytes[0] == 0x10) { // DS18S20, 9 bit value extended using COUNT_REMAIN and COUNT_PER_C
+            if (scratchPad[7] == 0) return (float)raw * 0.5f;
+            return (float)(raw >> 1) - 0.25f + ((float)(scratchPad[7] - scratchPad[6]) / (float)scratchPad[7]);
         }
+        // DS18B20/DS1822/DS1825, the low bits are undefined at lower resolutions
+        uint8_t bits = ((scratchPad[4] >> 5) & 0x03) + 9;
+        raw &= (int16_t)~((1 << (12 - bits)) - 1);
+        return (float)raw * 0.0625f;
     }
     
     void OneWireTempDevice::PrintTo(StringBuilderStreamer& sbs) {
@@ -164,8 +172,8 @@ namespace DALHAL {
     OneWireTempDeviceAtRoot::OneWireTempDeviceAtRoot(DeviceCreateContext& context) 
         : OneWireTempDevice(context), 
           autoRefresh(
-            [this](){ requestTemperatures(); },
-            [this](){ readAll(); }
+            [this](){ return startConversion(); },
+            [this](){ return readNext(); }
         )
     {
         JsonSchema::OneWireTempDeviceAtRoot::Extractors::Apply(context, this);
@@ -174,6 +182,7 @@ namespace DALHAL {
         oneWire = new OneWire(pin);
         dTemp = new DallasTemperature(oneWire);
         dTemp->setWaitForConversion(false);
+        dTemp->setResolution(romid.bytes, resolution);
     }
 
     OneWireTempDeviceAtRoot::~OneWireTempDeviceAtRoot() {
@@ -182,12 +191,21 @@ namespace DALHAL {
         pinMode(pin, INPUT); // "free" the pin
     }
 
-    void OneWireTempDeviceAtRoot::requestTemperatures() {
-        dTemp->requestTemperatures();
+    uint32_t OneWireTempDeviceAtRoot::startConversion() {
+        readRetries = 0;
+        dTemp->requestTemperatures(); // skip rom convert, non blocking as setWaitForConversion(false)
+        return OneWireTempAutoRefresh::GetConversionTimeMs(resolution);
     }
 
-    void OneWireTempDeviceAtRoot::readAll() {
-        read(*dTemp);
+    bool OneWireTempDeviceAtRoot::readNext() {
+        if (read(*dTemp) == false && readRetries < DALHAL_ONE_WIRE_TEMP_CRC_RETRIES) {
+            readRetries++;
+            return false; // retry next loop tick
+        }
+#if HAS_REACTIVE_CYCLE_COMPLETE(ONE_WIRE_TEMP_DEVICE)
+        triggerCycleComplete();
+#endif
+        return true;
     }
 
     void OneWireTempDeviceAtRoot::loop() {
@@ -86,9 +86,13 @@ namespace DALHAL {
     private:
         bool dataValid = false;
 
+        float decodeTempC(const uint8_t* scratchPad);
+
     public:
         OneWireAddress romid;
         OneWireTempDeviceTempFormat format = OneWireTempDeviceTempFormat::Celsius;
+        /** configured resolution in bits (9-12), decides the conversion wait time */
+        uint8_t resolution = DALHAL_ONE_WIRE_TEMP_DEFAULT_RESOLUTION;
         OneWireTempDevice_ValueBase value = 0.0f;
     
     public:
@@ -97,7 +101,8 @@ namespace DALHAL {
 
         const Registry::DefineBase* GetRegistryDefine() override;
 
-        void read(DallasTemperature& dTemp);
+        /** reads and crc validates the scratchpad, returns false if the sensor did not answer or the crc failed */
+        bool read(DallasTemperature& dTemp);
 
         
         void PrintTo(StringBuilderStreamer& sbs) override;
@@ -120,9 +125,10 @@ namespace DALHAL {
         uint8_t pin;
         OneWire* oneWire = nullptr;
         DallasTemperature* dTemp = nullptr;
+        uint8_t readRetries = 0;
         
-        void requestTemperatures();
-        void readAll();
+        uint32_t startConversion();
+        bool readNext();
 
     public:
         OneWireTempDeviceAtRoot(DeviceCreateContext& context);
@@ -26,6 +26,7 @@
 #include <DALHAL/Support/ConvertHelper.h>
 
 #include <DALHAL/Core/JsonConfig/Types/Base/DALHAL_JSON_Schema_TypeBase.h>
+#include <DALHAL/Core/JsonConfig/Types/Primitives/DALHAL_JSON_Schema_UInt.h>
 #include <DALHAL/Core/JsonConfig/Types/Logical/String/DALHAL_JSON_Schema_StringAnyOfArrayConstrained.h>
 #include <DALHAL/Core/JsonConfig/Types/Logical/String/DALHAL_JSON_Schema_StringHexBytes.h>
 #include <DALHAL/Core/JsonConfig/Types/Root/DALHAL_JSON_Schema_JsonObjectSchema.h>
@@ -47,10 +48,13 @@ namespace DALHAL {
             constexpr const char* formats[] = {"C", "F", nullptr};
             constexpr ByArrayConstraints formatsConstraint = {formats, ByArrayConstraints::Policy::IgnoreCase};
             constexpr SchemaStringAnyOfArrayConstrained formatField = {"format", FieldPolicy::Optional, "C", &formatsConstraint};
+            /** lower resolution gives shorter conversion time 9:94ms 10:188ms 11:375ms 12:750ms */
+            constexpr SchemaUInt resolutionField = {"resolution", FieldPolicy::Optional, (unsigned int)9, (unsigned int)12, (unsigned int)DALHAL_ONE_WIRE_TEMP_DEFAULT_RESOLUTION};
             
             constexpr const SchemaTypeBase* fields[] = {
                 &CommonBase::disabled_uidreq_note_group, // DALHAL_CommonSchemas_Base
                 &romIdField,
+                &resolutionField,
                 nullptr,
             };
 
@@ -75,6 +79,7 @@ namespace DALHAL {
                     out->format = OneWireTempDeviceTempFormat::Celsius;
                 else if (formatStr[0] == 'f' || formatStr[0] == 'F')
                     out->format = OneWireTempDeviceTempFormat::Fahrenheit;
+                out->resolution = JsonSchema::OneWireTempDevice::resolutionField.ExtractFrom(jsonObj);
 
                 
 
@@ -91,6 +96,7 @@ namespace DALHAL {
                                                 // that then emit a reactive event when the convertion is done
                 &CommonPins::InputOutputPinField,
                 &OneWireTempDevice::romIdField,
+                &OneWireTempDevice::resolutionField,
                 nullptr,
             };
 
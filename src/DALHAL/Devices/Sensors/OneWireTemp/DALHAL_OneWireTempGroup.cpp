@@ -31,6 +31,7 @@
 
 #include <DALHAL/Core/JsonConfig/CommonSchemas/DALHAL_CommonSchemas_Time.h>
 #include "DALHAL_OneWireTempGroup_JSON_Schema.h"
+#include <DALHAL/Core/Manager/DALHAL_DeviceArena.h>
 
 namespace DALHAL {
 
@@ -74,8 +75,8 @@ namespace DALHAL {
 
     OneWireTempGroup::OneWireTempGroup(DeviceCreateContext& context) : OneWireTempGroup_DeviceBase(context.deviceType),
         autoRefresh(
-            [this]() { requestTemperatures(); },
-            [this]() { readAll(); }
+            [this]() { return startConversion(); },
+            [this]() { return readNext(); }
         ), 
         busses(nullptr)
     {
@@ -89,7 +90,7 @@ namespace DALHAL {
                 delete busses[i];
                 busses[i] = nullptr;
             }
-            delete[] busses;
+            DeviceArena::DeleteDeviceArray(busses);
             busses = nullptr;
         }
     }
@@ -147,21 +148,28 @@ namespace DALHAL {
         return HALOperationResult::Success;
     }
 
-    void OneWireTempGroup::requestTemperatures() {
+    uint32_t OneWireTempGroup::startConversion() {
+        // all busses convert in parallel, so the wait is the longest of them instead of the sum
+        uint32_t conversionTimeMs = 0;
         for (int i=0;i<busCount;i++) {
             OneWireTempBus* bus = static_cast<OneWireTempBus*>(busses[i]); // cast because need of non generic function
-            bus->requestTemperatures();
+            uint32_t busTimeMs = bus->startConversion();
+            if (busTimeMs > conversionTimeMs) conversionTimeMs = busTimeMs;
         }
+        readBusIndex = 0;
+        return conversionTimeMs;
     }
 
-    void OneWireTempGroup::readAll() {
-        for (int i=0;i<busCount;i++) {
-            OneWireTempBus* bus = static_cast<OneWireTempBus*>(busses[i]); // cast because need of non generic function
-            bus->readAll();
+    bool OneWireTempGroup::readNext() {
+        if (readBusIndex < busCount) {
+            OneWireTempBus* bus = static_cast<OneWireTempBus*>(busses[readBusIndex]); // cast because need of non generic function
+            if (bus->readNext()) readBusIndex++;
+            if (readBusIndex < busCount) return false;
         }
 #if HAS_REACTIVE_CYCLE_COMPLETE(ONE_WIRE_TEMP_GROUP)
         triggerCycleComplete();
 #endif
+        return true;
     }
 
     void OneWireTempGroup::loop() {
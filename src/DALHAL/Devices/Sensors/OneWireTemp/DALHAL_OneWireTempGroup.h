@@ -68,8 +68,11 @@ namespace DALHAL {
         Device **busses;
         int busCount = 0;
 
-        void requestTemperatures();
-        void readAll();
+        /** bus currently being read, the busses are read one after another */
+        int readBusIndex = 0;
+
+        uint32_t startConversion();
+        bool readNext();
 
     public:
         OneWireTempGroup(DeviceCreateContext& context);
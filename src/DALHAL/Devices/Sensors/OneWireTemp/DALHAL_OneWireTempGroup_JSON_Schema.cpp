@@ -34,6 +34,7 @@
 #include "DALHAL_OneWireTempBus_JSON_Schema.h"
 
 #include "DALHAL_OneWireTempGroup.h"
+#include <DALHAL/Core/Manager/DALHAL_DeviceArena.h>
 
 namespace DALHAL {
 
@@ -75,7 +76,7 @@ namespace DALHAL {
                     if (Device::DisabledOrCommentItem(item)) { continue; }
                     out->busCount++;
                 }
-                out->busses = new Device*[out->busCount]();
+                out->busses = DeviceArena::NewDeviceArray(out->busCount);
                 // second pass create busses
                 
                 DeviceCreateContext createContext;
@@ -0,0 +1,102 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DALHAL_EdgeCapture.h"
+
+namespace DALHAL {
+
+    EdgeCapture::~EdgeCapture() {
+        end();
+    }
+
+    uint8_t EdgeCapture::begin(uint8_t _pin, uint8_t mode) {
+        end();
+        pin = _pin;
+        pinMode(pin, mode);
+        head = 0;
+        tail = 0;
+        overflowCount = 0;
+        pulseCount = 0;
+        edgeCount = 0;
+        lastRisingUs = 0;
+        lastPeriodUs = 0;
+        lastLevel = digitalRead(pin);
+        attachInterruptArg(digitalPinToInterrupt(pin), &EdgeCapture::isr, this, CHANGE);
+        return lastLevel;
+    }
+
+    void EdgeCapture::end() {
+        if (pin == 0xFF) return;
+        detachInterrupt(digitalPinToInterrupt(pin));
+        pin = 0xFF;
+    }
+
+    /*static*/
+    void IRAM_ATTR EdgeCapture::isr(void* arg) {
+        EdgeCapture& self = *static_cast<EdgeCapture*>(arg);
+        uint32_t now = micros();
+        // the level is always taken from the pin so that it can never stay inverted,
+        // the same level twice means two edges were merged into one interrupt (a pulse
+        // shorter than the interrupt latency), which in both directions contains one rising edge
+        uint8_t level = digitalRead(self.pin);
+        const bool rising = (level != self.lastLevel) ? (level != 0) : true;
+        self.lastLevel = level;
+        self.edgeCount = self.edgeCount + 1;
+
+        if (rising) {
+            self.pulseCount = self.pulseCount + 1;
+            if (self.lastRisingUs != 0) self.lastPeriodUs = now - self.lastRisingUs;
+            self.lastRisingUs = now;
+        }
+
+        uint8_t h = self.head;
+        uint8_t next = (h + 1) & RING_MASK;
+        if (next == self.tail) {
+            self.overflowCount = self.overflowCount + 1;
+            return;
+        }
+        self.ring[h].timeUs = now;
+        self.ring[h].level = level;
+        self.head = next; // publish after the slot is written
+    }
+
+    bool EdgeCapture::pop(Edge& out) {
+        uint8_t t = tail;
+        if (t == head) return false;
+        out = ring[t];
+        tail = (t + 1) & RING_MASK;
+        return true;
+    }
+
+    float EdgeCapture::getFrequency() const {
+        noInterrupts();
+        uint32_t period = lastPeriodUs;
+        uint32_t lastRising = lastRisingUs;
+        interrupts();
+        if (period == 0) return 0.0f;
+        uint32_t sinceLast = micros() - lastRising;
+        if (sinceLast > period) period = sinceLast;
+        return 1000000.0f / (float)period;
+    }
+
+}
@@ -0,0 +1,100 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+
+#include <cstdint>
+
+#if !defined(ESP8266) && !defined(ESP32)
+#define IRAM_ATTR
+#endif
+
+namespace DALHAL {
+
+    /**
+     * ISR backed edge capture for a single input pin.
+     *
+     * The pin change interrupt stores every edge (level + micros timestamp)
+     * into a small lock-free ring (single producer = ISR, single consumer = loop),
+     * so short pulses are not lost while the main loop is held by a blocking device.
+     * Rising edges are also counted directly in the ISR so that pulse counting
+     * (S0 energy meters, flow meters) stays exact even if the ring overflows.
+     */
+    class EdgeCapture {
+    public:
+        struct Edge {
+            uint32_t timeUs;
+            uint8_t level;
+        };
+
+        /** must be a power of two */
+        static constexpr uint8_t RING_SIZE = 32;
+        static constexpr uint8_t RING_MASK = RING_SIZE - 1;
+
+    private:
+        Edge ring[RING_SIZE];
+        volatile uint8_t head = 0;  // only written by the ISR
+        volatile uint8_t tail = 0;  // only written by the loop
+        /** level read from the pin by the last interrupt */
+        volatile uint8_t lastLevel = 0;
+        /** number of pin change interrupts, independent of the level */
+        volatile uint32_t edgeCount = 0;
+        volatile uint32_t overflowCount = 0;
+        volatile uint32_t pulseCount = 0;
+        volatile uint32_t lastRisingUs = 0;
+        volatile uint32_t lastPeriodUs = 0;
+
+        uint8_t pin = 0xFF;
+
+        static void IRAM_ATTR isr(void* arg);
+
+    public:
+        EdgeCapture() = default;
+        EdgeCapture(EdgeCapture&) = delete;
+        ~EdgeCapture();
+
+        /** configures the pin as input and attaches the pin change interrupt, returns the current level */
+        uint8_t begin(uint8_t pin, uint8_t mode);
+        void end();
+        bool isActive() const { return pin != 0xFF; }
+
+        /** pops the oldest captured edge, returns false when the ring is empty */
+        bool pop(Edge& out);
+
+        /** number of rising edges seen since begin() or the last resetPulseCount() */
+        uint32_t getPulseCount() const { return pulseCount; }
+        void resetPulseCount() { pulseCount = 0; }
+        /** number of pin change interrupts since begin() */
+        uint32_t getEdgeCount() const { return edgeCount; }
+        /** number of edges dropped because the ring was full */
+        uint32_t getOverflowCount() const { return overflowCount; }
+        /**
+         * frequency in Hz based on the last rising edge period,
+         * decays towards zero when no new rising edge arrives within that period
+         */
+        float getFrequency() const;
+    };
+
+}
@@ -164,13 +164,21 @@ namespace Drivers {
             refreshLoopCount(refreshLoopCount),
             refreshTimeMs(refreshTimeMs)
         {
-
+            // a full round of reads can never be faster than this
             uint32_t minRefreshTimeMs = refreshLoopCount * REGO600_DRIVER_READ_REGISTER_TIME_MS_ON_STATE;
-            // subtract min from wanted to get total refresh time
-            this->refreshTimeMs -= minRefreshTimeMs; 
-            // ensure it's at least minRefreshTimeMs
-            if (this->refreshTimeMs < minRefreshTimeMs) this->refreshTimeMs = minRefreshTimeMs; 
-            
+            if (this->refreshTimeMs < minRefreshTimeMs) this->refreshTimeMs = minRefreshTimeMs;
+
+            for (int i=0;i<refreshLoopCount;i++) {
+                PollSchedule& sch = refreshLoopList[i]->schedule;
+                sch.maxIntervalMs = this->refreshTimeMs;
+                if (sch.minIntervalMs == 0) sch.minIntervalMs = this->refreshTimeMs / 4;
+                if (sch.minIntervalMs < REGO600_DRIVER_READ_REGISTER_TIME_MS_ON_STATE) sch.minIntervalMs = REGO600_DRIVER_READ_REGISTER_TIME_MS_ON_STATE;
+                if (sch.minIntervalMs > sch.maxIntervalMs) sch.minIntervalMs = sch.maxIntervalMs;
+                if (sch.priority == 0) sch.priority = 1;
+                else if (sch.priority > REGO600_DRIVER_MAX_PRIORITY) sch.priority = REGO600_DRIVER_MAX_PRIORITY;
+                sch.intervalMs = sch.maxIntervalMs;
+            }
+
             if (requestDelayMs < 10) { // minimum safe
                 requestDelayMs = 10;
             }
@@ -199,7 +207,8 @@ namespace Drivers {
 
         void REGO600Driver::begin() {
             FlushCleanUARTRxBuffer(REGO600_UART_TO_USE, 260); // failsafe and also a quick way to determine if there are any hardware problems (it gets logged to GlobalLogger)
-            RefreshLoop_Restart();
+            refreshLoopCycleRemaining = 0;
+            RefreshLoop_Continue(); // all registers are due as none have been read yet
         }
 
         void REGO600Driver::ManualRequest_Schedule(RequestMode reqMode) {
@@ -323,20 +332,62 @@ namespace Drivers {
             ScheduleNextRequest();
         }
 
-        void REGO600Driver::RefreshLoop_Restart() {
-            lastUpdateMs = millis();
-            refreshLoopIndex = 0;
-            RefreshLoop_SendCurrent();   
+        int REGO600Driver::RefreshLoop_SelectNext(uint32_t now) {
+            int best = -1;
+            uint32_t bestScore = 0;
+            for (int i=0;i<refreshLoopCount;i++) {
+                const PollSchedule& sch = refreshLoopList[i]->schedule;
+                if (sch.readOnce == false) return i; // never read, take it directly in list order
+                uint32_t age = now - sch.lastReadMs;
+                if (age < sch.intervalMs) continue;
+                // overdue ratio (in 1/256 units) weighted by priority
+                uint32_t score = (uint32_t)(((uint64_t)age * 256 * sch.priority) / (sch.intervalMs ? sch.intervalMs : 1));
+                if (best == -1 || score > bestScore) {
+                    best = i;
+                    bestScore = score;
+                }
+            }
+            return best;
+        }
+
+        void REGO600Driver::RefreshLoop_UpdateSchedule(Request* req, bool valueChanged, uint32_t now) {
+            PollSchedule& sch = req->schedule;
+            if (sch.readOnce) {
+                uint32_t latency = now - sch.lastReadMs;
+                if (sch.avgLatencyMs == 0) sch.avgLatencyMs = latency;
+                else sch.avgLatencyMs = sch.avgLatencyMs - (sch.avgLatencyMs >> 2) + (latency >> 2);
+            }
+            if (valueChanged) {
+                sch.intervalMs >>= 1;
+                if (sch.intervalMs < sch.minIntervalMs) sch.intervalMs = sch.minIntervalMs;
+            } else {
+                sch.intervalMs += (sch.intervalMs >> 2) + 1;
+                if (sch.intervalMs > sch.maxIntervalMs) sch.intervalMs = sch.maxIntervalMs;
+            }
+            sch.lastReadMs = now;
+            sch.readOnce = true;
+
+            if (sch.readInCycle == false) {
+                sch.readInCycle = true;
+                if (--refreshLoopCycleRemaining <= 0) {
+                    // every register have now been read at least once
+                    refreshLoopDoneFlag = true;
+                }
+            }
         }
 
         void REGO600Driver::RefreshLoop_Continue() {
-            if (refreshLoopIndex < (refreshLoopCount-1)) {
-                refreshLoopIndex++;
+            if (refreshLoopCycleRemaining <= 0) {
+                // start a new cycle
+                refreshLoopCycleRemaining = refreshLoopCount;
+                for (int i=0;i<refreshLoopCount;i++) refreshLoopList[i]->schedule.readInCycle = false;
+            }
+            int next = (refreshLoopList != nullptr) ? RefreshLoop_SelectNext(millis()) : -1;
+            if (next != -1) {
+                refreshLoopIndex = next;
                 RefreshLoop_SendCurrent();
             } else {
-                refreshLoopDoneFlag = true;
-                // one loop done
-                // exec some cb here, or set some flags
+                // nothing due right now
                 commState = CommState::Idle;
             }
         }
@@ -349,11 +400,15 @@ namespace Drivers {
         }
 
         void REGO600Driver::RxDone_RefreshLoop() {
-            if (refreshLoopList[refreshLoopIndex]->ValidateAndSetFromBuffer(uartRxBuffer) == Request::ValidateSetResult::Retry) {
+            Request* req = refreshLoopList[refreshLoopIndex];
+            DALHAL::HALValue prevValue = *(req->response.value);
+            if (req->ValidateAndSetFromBuffer(uartRxBuffer) == Request::ValidateSetResult::Retry) {
                 ErrorReport::DebugMessage(String(F("refreshLoopList RX - invalid value ")).c_str());
                 SendRequestFrameAndResetRx(); // retry @ RefreshLoop value error
                 return;
             }
+            RefreshLoop_UpdateSchedule(req, prevValue != *(req->response.value), millis());
+            // manual requests pre-empt the refresh loop between two register reads
             
             if (manualRequest_Pending) {
                 manualRequest_Pending = false;
@@ -596,10 +651,7 @@ namespace Drivers {
                         // nothing to do
                         return;
                     }
-                    unsigned long now = millis();
-                    if (now - lastUpdateMs >= refreshTimeMs) {
-                        RefreshLoop_Restart(); // this will also take care of updating lastUpdateMs
-                    }
+                    RefreshLoop_Continue(); // sends the most urgent due register if any
                     break;
                 }
                 default: break;
@@ -66,6 +66,8 @@
 #define REGO600_DRIVER_READ_REGISTER_TIME_MS_ON_STATE 300
 #define REGO600_DRIVER_READ_REGISTER_TIME_MS_OFF_STATE 30
 
+#define REGO600_DRIVER_MAX_PRIORITY 10
+
 namespace Drivers {
     namespace REGO600 {
 
@@ -73,7 +75,7 @@ namespace Drivers {
         private:
             
             enum class CommState {
-                Idle, //waiting for refreshTimeMs to elapse, or a manual request to arrive
+                Idle, //waiting for a register to be due, or a manual request to arrive
                 PendingSend, // frame queued, waiting out pendingRequestDelayMs (replaces pendingRequest flag)
                 AwaitingResponse, // frame sent, waiting for bytes / timeout (replaces requestInProgress)
             };
@@ -93,6 +95,7 @@ namespace Drivers {
 
             REGO600Driver() = delete;
             REGO600Driver(REGO600Driver&) = delete;
+            /** refreshTimeMs is the longest time any register in refreshLoopList is allowed to wait between reads */
             REGO600Driver(int8_t rxPin, int8_t txPin, Request** refreshLoopList, int refreshLoopCount, uint32_t refreshTimeMs, unsigned long requestDelayMs);
             ~REGO600Driver();
             void begin();
@@ -107,7 +110,8 @@ namespace Drivers {
             bool RequestFrontPanelLeds(RequestCallback cb, void* cb_ctx);
 
             static const OpCodeInfo& getCmdInfo(CommandID cmdId);
-            /** this is a "latching flag"/"one-shot flag", i.e. if read and was true it automatically resets the internal flag to false */
+            /** this is a "latching flag"/"one-shot flag", i.e. if read and was true it automatically resets the internal flag to false
+             * set when every register in the refresh loop have been read at least once since the last time */
             bool RefreshLoopDone();
 
             /** use for one time requests to make sure we do not heap allocate unesssesary data */
@@ -129,15 +133,13 @@ namespace Drivers {
 
             Request* const* refreshLoopList = nullptr; // a const pointer to a list of mutable Request object pointers
             const int refreshLoopCount = 0;
-            uint32_t refreshTimeMs = 5000; // this needs to calculated depending on how many items in refreshLoopList (max items is 17 -> 17*0.2 = 3.4 sec) but also what the json cfg have
+            uint32_t refreshTimeMs = 5000; // upper limit of the adaptive interval of each register
 
-            
-            
             unsigned long requestTimeoutMs = 2000;
-            unsigned long lastUpdateMs = 0;
             uint32_t lastRequestMs = 0;
             
             int refreshLoopIndex = 0;
+            int refreshLoopCycleRemaining = 0;
 
             // flag that is set once a refreshloop is done
             // it's only reset by using RefreshLoopDone function
@@ -179,7 +181,9 @@ namespace Drivers {
             uint16_t GetValueFromUartRxBuff();
 
             void ReturnToRefreshLoop();
-            void RefreshLoop_Restart();
+            /** returns the index of the most urgent due register or -1 if none is due */
+            int RefreshLoop_SelectNext(uint32_t now);
+            void RefreshLoop_UpdateSchedule(Request* req, bool valueChanged, uint32_t now);
             void RefreshLoop_SendCurrent();
             void RefreshLoop_Continue();
 
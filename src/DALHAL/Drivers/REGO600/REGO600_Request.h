@@ -42,6 +42,21 @@ namespace Drivers {
 
         using RequestCallback = void (*)(void* cb_ctx, void* dataCtx, RequestMode);
 
+        /** adaptive poll state of a refresh loop request,
+         * the interval is halved when the value changes and grows slowly while it's stable,
+         * always kept within minIntervalMs and maxIntervalMs */
+        struct PollSchedule {
+            uint32_t minIntervalMs = 0; // 0 = use the driver default
+            uint32_t maxIntervalMs = 0; // set by the driver to the refresh time
+            uint32_t intervalMs = 0;    // current adaptive interval
+            uint32_t lastReadMs = 0;
+            /** running average of the time between two reads, i.e. the effective update latency */
+            uint32_t avgLatencyMs = 0;
+            uint8_t priority = 1;
+            bool readOnce = false;
+            bool readInCycle = false;
+        };
+
 
         struct Request {
 
@@ -58,6 +73,9 @@ namespace Drivers {
 
             bool ownedValue = false;
 
+            /** only used by refresh loop requests */
+            PollSchedule schedule;
+
             Request() = delete;
             Request(const OpCodeInfo& _info, const RegoLookupEntry& _def);
             /** externalValue is a non-owning pointer to external data. 
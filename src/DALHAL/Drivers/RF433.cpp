@@ -26,6 +26,18 @@
 #include <DALHAL/Core/JsonConfig/DALHAL_ArduinoJSON_ext.h>
 #include <DALHAL/Support/DALHAL_Logger.h>
 
+#if defined(ESP32)
+#include <esp_timer.h>
+#include <driver/gpio.h>
+#elif defined(ESP8266)
+#include <core_esp8266_waveform.h>
+#else
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+#endif
+
 namespace RF433
 {
     int pin = -1;
@@ -40,8 +52,227 @@ namespace RF433
     uint32_t RF433_LC_REPEATS = 5;
 
     
-    #define RF433_Set() digitalWrite(pin, HIGH)
-    #define RF433_Clear() digitalWrite(pin, LOW)
+    //  ████████ ██   ██      ██████  ██    ██ ███████ ██    ██ ███████ 
+    //     ██     ██ ██      ██    ██ ██    ██ ██      ██    ██ ██      
+    //     ██      ███       ██    ██ ██    ██ █████   ██    ██ █████   
+    //     ██     ██ ██      ██ ▄▄ ██ ██    ██ ██      ██    ██ ██      
+    //     ██    ██   ██      ██████   ██████  ███████  ██████  ███████ 
+    //                           ▀▀                                     
+
+    // the queue is written by the main loop (Enqueue) and consumed by the timer (TxStep)
+    // all index/flag updates are done inside TX_LOCK/TX_UNLOCK
+    static TxFrame txQueue[TX_QUEUE_SIZE];
+    static volatile uint8_t txHead = 0;
+    static volatile uint8_t txTail = 0;
+    /** true while txQueue[txTail] is being emitted, that frame must not be coalesced into */
+    static volatile bool txActive = false;
+    /** true while the timer backend is scheduled */
+    static volatile bool txRunning = false;
+    static uint16_t txIndex = 0;
+    static uint8_t txRepeat = 0;
+    static TxStats txStats;
+
+#if defined(ESP32)
+    static portMUX_TYPE txMux = portMUX_INITIALIZER_UNLOCKED;
+    #define TX_LOCK() portENTER_CRITICAL_SAFE(&txMux)
+    #define TX_UNLOCK() portEXIT_CRITICAL_SAFE(&txMux)
+#elif defined(ESP8266)
+    #define TX_LOCK() noInterrupts()
+    #define TX_UNLOCK() interrupts()
+#else
+    static std::mutex txMutex;
+    static std::condition_variable txCond;
+    #define TX_LOCK() txMutex.lock()
+    #define TX_UNLOCK() txMutex.unlock()
+#endif
+
+    static void IRAM_ATTR TxWritePin(int8_t txPin, uint8_t level, uint32_t durationUs);
+
+    /** emits the next pulse, returns its duration in us or 0 when the queue is empty
+     *  must be called with TX_LOCK held (or from the timer isr) */
+    static uint32_t IRAM_ATTR TxStep()
+    {
+        while (true) {
+            if (txActive == false) {
+                if (txTail == txHead) return 0;
+                txActive = true;
+                txIndex = 0;
+                txRepeat = 0;
+            }
+            const TxFrame& frame = txQueue[txTail];
+            if (txIndex < frame.count) {
+                uint8_t level = (txIndex & 1) ? LOW : HIGH;
+                uint32_t durationUs = frame.pulses[txIndex++];
+                TxWritePin(frame.pin, level, durationUs);
+                return durationUs;
+            }
+            txIndex = 0;
+            if (++txRepeat < frame.repeats) continue;
+
+            TxWritePin(frame.pin, LOW, 0);
+            txTail = (txTail + 1) & TX_QUEUE_MASK;
+            txActive = false;
+            txStats.framesSent++;
+        }
+    }
+
+#if defined(ESP32)
+    static esp_timer_handle_t txTimer = nullptr;
+    static int64_t txNextAt = 0;
+
+    static void IRAM_ATTR TxWritePin(int8_t txPin, uint8_t level, uint32_t durationUs) {
+        gpio_set_level((gpio_num_t)txPin, level);
+    }
+
+    static void IRAM_ATTR TxTimerCallback(void* arg) {
+        TX_LOCK();
+        uint32_t us = TxStep();
+        if (us == 0) txRunning = false;
+        TX_UNLOCK();
+        if (us == 0) return;
+        // schedule against absolute time so the callback latency does not accumulate
+        txNextAt += us;
+        int64_t wait = txNextAt - esp_timer_get_time();
+        esp_timer_start_once(txTimer, (wait > 0) ? wait : 1);
+    }
+
+    static void TxStart() {
+        if (txTimer == nullptr) {
+            esp_timer_create_args_t args = {};
+            args.callback = &TxTimerCallback;
+            args.name = "rf433tx";
+#if CONFIG_ESP_TIMER_SUPPORTS_ISR_DISPATCH_METHOD
+            args.dispatch_method = ESP_TIMER_ISR;
+#else
+            args.dispatch_method = ESP_TIMER_TASK;
+#endif
+            esp_timer_create(&args, &txTimer);
+        }
+        txNextAt = esp_timer_get_time();
+        esp_timer_start_once(txTimer, 1);
+    }
+#elif defined(ESP8266)
+    static void IRAM_ATTR TxWritePin(int8_t txPin, uint8_t level, uint32_t durationUs) {
+        digitalWrite(txPin, level);
+    }
+
+    /** cycle count at which the next pulse is due */
+    static uint32_t txNextCycle = 0;
+
+    // timer1 is shared with the waveform generator (analogWrite/servo),
+    // so the callback interface of the waveform generator is used instead of owning timer1,
+    // the callback is then run on every timer1 interrupt (also the waveform ones),
+    // so it only steps when its own deadline is reached
+    static uint32_t IRAM_ATTR TxTimerCallback() {
+        int32_t remaining = (int32_t)(txNextCycle - ESP.getCycleCount());
+        if (remaining > (int32_t)microsecondsToClockCycles(1)) return (uint32_t)remaining;
+
+        uint32_t us = TxStep();
+        if (us == 0) {
+            txRunning = false;
+            setTimer1Callback(nullptr); // Enqueue registers it again
+            return microsecondsToClockCycles(1000);
+        }
+        // schedule against the deadline so the interrupt latency does not accumulate
+        txNextCycle += microsecondsToClockCycles(us);
+        remaining = (int32_t)(txNextCycle - ESP.getCycleCount());
+        return (remaining > 0) ? (uint32_t)remaining : 1;
+    }
+
+    static void TxStart() {
+        txNextCycle = ESP.getCycleCount();
+        setTimer1Callback(&TxTimerCallback);
+    }
+#else
+    // virtual pin backend, records the emitted pulse train
+    static std::vector<SimEdge> simRecording;
+
+    static void TxWritePin(int8_t txPin, uint8_t level, uint32_t durationUs) {
+        simRecording.push_back({txPin, level, (uint32_t)micros(), durationUs});
+    }
+
+    static void TxWorker() {
+        auto nextAt = std::chrono::steady_clock::now();
+        while (true) {
+            uint32_t us;
+            {
+                std::unique_lock<std::mutex> lock(txMutex);
+                us = TxStep();
+                if (us == 0) {
+                    txRunning = false;
+                    txCond.wait(lock, []{ return txRunning == true; });
+                    nextAt = std::chrono::steady_clock::now();
+                    continue;
+                }
+            }
+            nextAt += std::chrono::microseconds(us);
+            // spin instead of sleep_for as the os sleep granularity is far too coarse
+            while (std::chrono::steady_clock::now() < nextAt) std::this_thread::yield();
+        }
+    }
+
+    static void TxStart() {
+        static bool workerStarted = false;
+        if (workerStarted == false) {
+            workerStarted = true;
+            std::thread(TxWorker).detach();
+        } else {
+            txCond.notify_one();
+        }
+    }
+
+    void SimTakeRecording(std::vector<SimEdge>& out) {
+        TX_LOCK();
+        out.swap(simRecording);
+        simRecording.clear();
+        TX_UNLOCK();
+    }
+#endif
+
+    bool Enqueue(const TxFrame& frame)
+    {
+        bool start = false;
+        bool queued = true;
+        TX_LOCK();
+        // coalesce with a pending frame to the same unit, the frame currently emitted is left as is
+        uint8_t i = txActive ? ((txTail + 1) & TX_QUEUE_MASK) : txTail;
+        for (; i != txHead; i = (i + 1) & TX_QUEUE_MASK) {
+            TxFrame& pending = txQueue[i];
+            if (pending.key == frame.key && pending.model == frame.model && pending.pin == frame.pin) break;
+        }
+        if (i != txHead) {
+            txQueue[i] = frame;
+            txStats.framesCoalesced++;
+        } else {
+            uint8_t next = (txHead + 1) & TX_QUEUE_MASK;
+            if (next == txTail) {
+                txStats.framesDropped++;
+                queued = false;
+            } else {
+                txQueue[txHead] = frame;
+                txHead = next; // publish after the frame is copied
+                txStats.framesQueued++;
+            }
+        }
+        if (queued && txRunning == false) {
+            txRunning = true;
+            start = true;
+        }
+        TX_UNLOCK();
+        if (start) TxStart();
+        if (queued == false) GlobalLogger.Warn(F("RF433 tx queue full, frame dropped"));
+        return queued;
+    }
+
+    bool IsTxBusy()
+    {
+        return txRunning;
+    }
+
+    const TxStats& GetTxStats()
+    {
+        return txStats;
+    }
 
     void init(arch_word_t _pin)
     {
@@ -127,84 +358,78 @@ namespace RF433
     //  ██      ██  ██ ██  ██      ██   ██     ██      ██    ██ ██   ██ ██      
     //  ██      ██ ██   ██ ███████ ██████       ██████  ██████  ██████  ███████ 
 
-    void Send433FC_One(void)
+    static inline void Encode433_Pulse(TxFrame& frame, uint32_t highUs, uint32_t lowUs)
+    {
+        if (frame.count + 2 > TX_MAX_FRAME_PULSES) return;
+        frame.pulses[frame.count++] = (highUs > 0xFFFF) ? 0xFFFF : highUs;
+        frame.pulses[frame.count++] = (lowUs > 0xFFFF) ? 0xFFFF : lowUs;
+    }
+
+    void Encode433FC_One(TxFrame& frame)
     {
-        RF433_Set();
-        delayMicroseconds(RF433_FC_LONG);
-        RF433_Clear();
-        delayMicroseconds(RF433_FC_SHORT);
-        RF433_Set();
-        delayMicroseconds(RF433_FC_LONG);
-        RF433_Clear();
-        delayMicroseconds(RF433_FC_SHORT);
+        Encode433_Pulse(frame, RF433_FC_LONG, RF433_FC_SHORT);
+        Encode433_Pulse(frame, RF433_FC_LONG, RF433_FC_SHORT);
     }
 
-    void Send433FC_Zero(void)
+    void Encode433FC_Zero(TxFrame& frame)
     {
-        RF433_Set();
-        delayMicroseconds(RF433_FC_SHORT);
-        RF433_Clear();
-        delayMicroseconds(RF433_FC_LONG);
-        RF433_Set();
-        delayMicroseconds(RF433_FC_SHORT);
-        RF433_Clear();
-        delayMicroseconds(RF433_FC_LONG);
+        Encode433_Pulse(frame, RF433_FC_SHORT, RF433_FC_LONG);
+        Encode433_Pulse(frame, RF433_FC_SHORT, RF433_FC_LONG);
     }
 
-    void Send433FC_Float(void)
+    void Encode433FC_Float(TxFrame& frame)
     {
-        RF433_Set();
-        delayMicroseconds(RF433_FC_SHORT);
-        RF433_Clear();
-        delayMicroseconds(RF433_FC_LONG);
-        RF433_Set();
-        delayMicroseconds(RF433_FC_LONG);
-        RF433_Clear();
-        delayMicroseconds(RF433_FC_SHORT);
+        Encode433_Pulse(frame, RF433_FC_SHORT, RF433_FC_LONG);
+        Encode433_Pulse(frame, RF433_FC_LONG, RF433_FC_SHORT);
     }
 
-    void Send433FC_Sync(void)
+    void Encode433FC_Sync(TxFrame& frame)
     {
-        RF433_Set();
-        delayMicroseconds(RF433_FC_SHORT);
-        RF433_Clear();
-        delayMicroseconds(14500);
+        Encode433_Pulse(frame, RF433_FC_SHORT, RF433_FC_SYNC);
     }
     
-    void SendTo433_FC_bits(uint32_t data, uint32_t mask) // start bit can be 0 - 31 and the data is sent from MSB startbit to LSB
+    void Encode433FC_bits(TxFrame& frame, uint32_t data, uint32_t mask) // start bit can be 0 - 31 and the data is sent from MSB startbit to LSB
     {
-        if (pin == -1) return;
         do
         {
-            //LED7_IO = 1;
             if ((data & mask) == mask)
-                Send433FC_Zero(); // fixed code do send zero as ones
+                Encode433FC_Zero(frame); // fixed code do send zero as ones
             else
-                Send433FC_Float(); // fixed code do send ones as floating
+                Encode433FC_Float(frame); // fixed code do send ones as floating
             mask /= 2; // shift mask from left to right
-            //LED7_IO = 0;
-            
         } while (mask);
     }
 
+    void Encode433_FC(TxFrame& frame, uint32_t data)
+    {
+        frame.pin = pin;
+        frame.model = TxModel::FixedCode;
+        frame.repeats = (RF433_FC_REPEATS == 0) ? 1 : RF433_FC_REPEATS;
+        frame.count = 0;
+        // one repeat is sync followed by the data bits
+        Encode433FC_Sync(frame);
+        Encode433FC_bits(frame, data, (1u << 11));
+    }
+
     void SendTo433_FC(uint32_t data) {
         if (pin == -1) return;
-        for (uint32_t i = 0; i < RF433_FC_REPEATS; i++)
-        {
-            // sync
-            Send433FC_Sync();
-            SendTo433_FC_bits(data, (1u << 11));
-
-        }
+        TxFrame frame;
+        Encode433_FC(frame, data);
+        frame.key = data;
+        Enqueue(frame);
     }
 
     void SendTo433_FC(uint32_t staticData, arch_word_t state)
     {
+        if (pin == -1) return;
         if (state == 0)
             staticData |= 0x01;
         else
             staticData &= 0xFFE;
-        SendTo433_FC(staticData);
+        TxFrame frame;
+        Encode433_FC(frame, staticData);
+        frame.key = staticData & 0xFFE; // a newer state to the same unit replaces a pending one
+        Enqueue(frame);
     }
 
     //  ██      ███████  █████  ██████  ███    ██ ██ ███    ██  ██████       ██████  ██████  ██████  ███████ 
@@ -213,78 +438,68 @@ namespace RF433
     //  ██      ██      ██   ██ ██   ██ ██  ██ ██ ██ ██  ██ ██ ██    ██     ██      ██    ██ ██   ██ ██      
     //  ███████ ███████ ██   ██ ██   ██ ██   ████ ██ ██   ████  ██████       ██████  ██████  ██████  ███████
 
-    void Send433LC_One(void)
+    void Encode433LC_One(TxFrame& frame)
     {
-        RF433_Set();
-        delayMicroseconds(RF433_LC_SHORT);
-        RF433_Clear();
-        delayMicroseconds(RF433_LC_LONG);
-        RF433_Set();
-        delayMicroseconds(RF433_LC_SHORT);
-        RF433_Clear();
-        delayMicroseconds(RF433_LC_SHORT);
+        Encode433_Pulse(frame, RF433_LC_SHORT, RF433_LC_LONG);
+        Encode433_Pulse(frame, RF433_LC_SHORT, RF433_LC_SHORT);
     }
 
-    void Send433LC_Zero(void)
+    void Encode433LC_Zero(TxFrame& frame)
     {
-        RF433_Set();
-        delayMicroseconds(RF433_LC_SHORT);
-        RF433_Clear();
-        delayMicroseconds(RF433_LC_SHORT);
-        RF433_Set();
-        delayMicroseconds(RF433_LC_SHORT);
-        RF433_Clear();
-        delayMicroseconds(RF433_LC_LONG);
+        Encode433_Pulse(frame, RF433_LC_SHORT, RF433_LC_SHORT);
+        Encode433_Pulse(frame, RF433_LC_SHORT, RF433_LC_LONG);
     }
 
-    void Send433LC_Start(void)
+    void Encode433LC_Start(TxFrame& frame)
     {
-        RF433_Set();
-        delayMicroseconds(RF433_LC_SHORT);
-        RF433_Clear();
-        delayMicroseconds(RF433_LC_START);
+        Encode433_Pulse(frame, RF433_LC_SHORT, RF433_LC_START);
     }
 
-    void SendTo433_LC_bits(uint32_t data, uint32_t mask) // start bit can be 0 - 31 and the data is sent from MSB startbit to LSB
+    void Encode433LC_bits(TxFrame& frame, uint32_t data, uint32_t mask) // start bit can be 0 - 31 and the data is sent from MSB startbit to LSB
     {
-        if (pin == -1) return;
         do
         {
-            //LED7_IO = 1;
             if ((data & mask) == mask)
-                Send433LC_One();
+                Encode433LC_One(frame);
             else
-                Send433LC_Zero();
+                Encode433LC_Zero(frame);
             mask /= 2; // shift mask from left to right
-            //LED7_IO = 0;
-            
         } while (mask);
     }
 
-    void SendTo433_LC(uint32_t data) // 433MHz "Advanced Learning Code" (NEXA)
+    void Encode433_LC(TxFrame& frame, uint32_t data) // 433MHz "Advanced Learning Code" (NEXA)
+    {
+        frame.pin = pin;
+        frame.model = TxModel::LearningCode;
+        frame.repeats = (RF433_LC_REPEATS == 0) ? 1 : RF433_LC_REPEATS;
+        frame.count = 0;
+        // one repeat is start, data bits, stop pulse and the repeat delay
+        // the repeat delay is also emitted after the last repeat and acts as a inter frame gap
+        Encode433LC_Start(frame);
+        Encode433LC_bits(frame, data, VALUE_2_POW_31);
+        Encode433_Pulse(frame, RF433_LC_SHORT, RF433_LC_REPEAT_DELAY);
+    }
+
+    void SendTo433_LC(uint32_t data)
     {
         if (pin == -1) return;
-        uint32_t i;
-        
-        for (i = 0; i < RF433_LC_REPEATS; i++)
-        {
-            Send433LC_Start();
-            SendTo433_LC_bits(data, VALUE_2_POW_31);
-            RF433_Set();
-            delayMicroseconds(RF433_LC_SHORT);
-            RF433_Clear();
-            if (i<RF433_LC_REPEATS-1) // don't delay after the last is sent
-                delayMicroseconds(RF433_LC_REPEAT_DELAY);
-        }
+        TxFrame frame;
+        Encode433_LC(frame, data);
+        frame.key = data;
+        Enqueue(frame);
     }
 
     void SendTo433_LC(uint32_t staticData, arch_word_t state)
     {
+        if (pin == -1) return;
         if (state == 1)
             staticData |= 0x10;
         else
             staticData &= 0xFFFFFFEF;
-        SendTo433_LC(staticData);
+        TxFrame frame;
+        Encode433_LC(frame, staticData);
+        frame.key = staticData & 0xFFFFFFEF; // a newer state to the same unit replaces a pending one
+        Enqueue(frame);
     }
 
     //  ███████ ███████ ███    ██ ██████      ██████  ██    ██          ██ ███████  ██████  ███    ██ 
@@ -366,6 +581,7 @@ namespace RF433
         RF433_LC_SHORT = DALHAL::GetAsUINT32(jsonObj, "pl_short", RF433_LC_SHORT);//.as<uint32_t>();
         RF433_LC_LONG = DALHAL::GetAsUINT32(jsonObj, "pl_long", RF433_LC_LONG);//.as<uint32_t>();
         RF433_LC_REPEATS = DALHAL::GetAsUINT32(jsonObj, "pl_repeats", RF433_LC_REPEATS);//.as<uint32_t>();
+        if (RF433_LC_REPEATS > 0xFF) RF433_LC_REPEATS = 0xFF; // TxFrame::repeats is 8 bit
     }
     void SerialPrintBits(uint32_t value, uint8_t bitCount = 32)
     {
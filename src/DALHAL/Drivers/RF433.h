@@ -26,6 +26,13 @@
 #include <ArduinoJson.h>
 #include <stdlib.h>
 
+#if !defined(ESP8266) && !defined(ESP32)
+#include <vector>
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+#endif
+
 
 #define DALHAL_KEYNAME_TX433_HEXID "hexid"
 #define DALHAL_KEYNAME_TX433_ALPHA_NUMERIC_ID "anid"
@@ -66,18 +73,75 @@ namespace RF433 {
 
     void init(arch_word_t _pin);
 
+    //  ████████ ██   ██      ██████  ██    ██ ███████ ██    ██ ███████ 
+    //     ██     ██ ██      ██    ██ ██    ██ ██      ██    ██ ██      
+    //     ██      ███       ██    ██ ██    ██ █████   ██    ██ █████   
+    //     ██     ██ ██      ██ ▄▄ ██ ██    ██ ██      ██    ██ ██      
+    //     ██    ██   ██      ██████   ██████  ███████  ██████  ███████ 
+    //                           ▀▀                                     
+
+    /** max pulses (high+low pairs counted separately) of one frame repeat, 
+     *  learning code: start(2) + 32 bits * 4 + stop(2) */
+    constexpr uint16_t TX_MAX_FRAME_PULSES = 132;
+    /** must be a power of two */
+    constexpr uint8_t TX_QUEUE_SIZE = 4;
+    constexpr uint8_t TX_QUEUE_MASK = TX_QUEUE_SIZE - 1;
+
+    enum class TxModel : uint8_t {
+        FixedCode,
+        LearningCode
+    };
+
+    /** one encoded frame, emitted repeats times by the timer backend */
+    struct TxFrame {
+        /** pending frames with the same key/model/pin are replaced instead of queued again */
+        uint32_t key;
+        int8_t pin;
+        TxModel model;
+        uint8_t repeats;
+        uint16_t count;
+        /** alternating high/low durations in us, starting with high */
+        uint16_t pulses[TX_MAX_FRAME_PULSES];
+    };
+
+    struct TxStats {
+        uint32_t framesQueued = 0;
+        uint32_t framesCoalesced = 0;
+        uint32_t framesDropped = 0;
+        uint32_t framesSent = 0;
+    };
+
+    /** queues a encoded frame for non-blocking transmit, returns false if the queue is full */
+    bool Enqueue(const TxFrame& frame);
+    bool IsTxBusy();
+    const TxStats& GetTxStats();
+
+#if !defined(ESP8266) && !defined(ESP32)
+    struct SimEdge {
+        int8_t pin;
+        uint8_t level;
+        uint32_t timeUs;
+        /** the duration this level should be held, 0 at end of frame */
+        uint32_t expectedUs;
+    };
+    /** simulation only: moves the recorded pulse train of the virtual pin backend into out */
+    void SimTakeRecording(std::vector<SimEdge>& out);
+#endif
+
     //  ███████ ██ ██   ██ ███████ ██████       ██████  ██████  ██████  ███████ 
     //  ██      ██  ██ ██  ██      ██   ██     ██      ██    ██ ██   ██ ██      
     //  █████   ██   ███   █████   ██   ██     ██      ██    ██ ██   ██ █████   
     //  ██      ██  ██ ██  ██      ██   ██     ██      ██    ██ ██   ██ ██      
     //  ██      ██ ██   ██ ███████ ██████       ██████  ██████  ██████  ███████ 
 
-    void Send433FC_One(void);
-    void Send433FC_Zero(void);
-    void Send433FC_Float(void);
-    void Send433FC_Sync(void);
+    void Encode433FC_One(TxFrame& frame);
+    void Encode433FC_Zero(TxFrame& frame);
+    void Encode433FC_Float(TxFrame& frame);
+    void Encode433FC_Sync(TxFrame& frame);
 
-    void SendTo433_FC_bits(uint32_t data, uint32_t mask);
+    void Encode433FC_bits(TxFrame& frame, uint32_t data, uint32_t mask);
+    void Encode433_FC(TxFrame& frame, uint32_t data);
+    /** encodes and queues, returns immediately */
     void SendTo433_FC(uint32_t data);
     void SendTo433_FC(uint32_t staticData, arch_word_t state);
 
@@ -87,11 +151,13 @@ namespace RF433 {
     //  ██      ██      ██   ██ ██   ██ ██  ██ ██ ██ ██  ██ ██ ██    ██     ██      ██    ██ ██   ██ ██      
     //  ███████ ███████ ██   ██ ██   ██ ██   ████ ██ ██   ████  ██████       ██████  ██████  ██████  ███████
 
-    void Send433LC_One(void);
-    void Send433LC_Zero(void);
-    void Send433LC_Start(void);
+    void Encode433LC_One(TxFrame& frame);
+    void Encode433LC_Zero(TxFrame& frame);
+    void Encode433LC_Start(TxFrame& frame);
 
-    void SendTo433_LC_bits(uint32_t data, uint32_t mask);
+    void Encode433LC_bits(TxFrame& frame, uint32_t data, uint32_t mask);
+    void Encode433_LC(TxFrame& frame, uint32_t data);
+    /** encodes and queues, returns immediately */
     void SendTo433_LC(uint32_t data);
     void SendTo433_LC(uint32_t staticData, arch_word_t state);
 
@@ -31,6 +31,7 @@
 #include "DALHAL_SCRIPT_ENGINE_Parser.h"
 
 #include "DALHAL_SCRIPT_ENGINE_Tokenizer.h"
+#include "DALHAL_SCRIPT_ENGINE_TokenArena.h"
 #include "../DALHAL_SCRIPT_ENGINE_Reports.h"
 #include "DALHAL_SCRIPT_ENGINE_Parser_Triggers.h"
 #include "DALHAL_SCRIPT_ENGINE_Parser_Conditions.h"
@@ -157,30 +158,27 @@ namespace DALHAL {
             }
 
             bool ReadAndParseScriptFile(const char* filePath, bool (*parsedOKcallback)(ScriptTokens& tokens)) {
-                char* fileContents = nullptr;// = ReadFileToMutableBuffer(filePath, fileSize);
-                MEASURE_TIME(String(F("ReadAndParseScriptFile - load_text_file time: ")).c_str(),
-                LittleFS_ext::FileResult fileResult = LittleFS_ext::load_text_file(filePath, &fileContents);
-                if (fileResult != LittleFS_ext::FileResult::Success) {
+                // owns the token text, so it need to outlive the tokens below
+                TokenArena arena;
+                MEASURE_TIME(String(F("ReadAndParseScriptFile - TokenizeFile time: ")).c_str(),
+                LittleFS_ext::FileResult fileResult = TokenizeFile(filePath, arena);
+                if (fileResult == LittleFS_ext::FileResult::AllocFail) {
+                    ReportInfo(String(F("Error: could not Tokenize, out of memory\n")).c_str());
+                    return false;
+                } else if (fileResult != LittleFS_ext::FileResult::Success) {
                     ReportInfo(String(F("Error: file could not be read/or is empty\n")).c_str());
                     return false;
                 }
                 );
 
-                int tokenCount = 0;
-            //MEASURE_TIME("CountTokens time: ",
-                tokenCount = ParseAndTokenize<ScriptToken>(fileContents, nullptr, -1); // count in the same function
-            //);
+                int tokenCount = arena.Count();
                 ReportInfo(String(F("Token count: ")).c_str() + std::to_string(tokenCount) + "\n");
                 ScriptTokens tokens(tokenCount);
-                
-                //MEASURE_TIME("Tokenize time: ",
-                if (ParseAndTokenize(fileContents, tokens.items, tokenCount) == -1)
-                {
-                    ReportInfo(String(F("Error: could not Tokenize\n")).c_str());
-                    delete[] fileContents;
+                if (tokenCount > 0 && tokens.items == nullptr) {
+                    ReportInfo(String(F("Error: could not Tokenize, out of memory\n")).c_str());
                     return false;
                 }
-                //);
+                arena.MoveTokensTo(tokens.items);
                 bool anyError = false;
                 MEASURE_TIME(String(F("ValidateParseScript time: ")).c_str(),
                 if (ValidateParseScript(tokens, parsedOKcallback==nullptr, filePath)) {
@@ -198,8 +196,6 @@ namespace DALHAL {
                     anyError = true;
                 }
                 );
-                // dont forget to free/delete
-                delete[] fileContents;
                 return anyError == false;
             }
         }
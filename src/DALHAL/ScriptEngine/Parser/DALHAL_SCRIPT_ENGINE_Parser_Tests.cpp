@@ -25,6 +25,7 @@
 
 //#include "DALHAL_SCRIPT_ENGINE_Parser.h"
 #include "DALHAL_SCRIPT_ENGINE_Tokenizer.h"
+#include "DALHAL_SCRIPT_ENGINE_TokenArena.h"
 #include "DALHAL_SCRIPT_ENGINE_Parser_Actions.h"
 #include "DALHAL_SCRIPT_ENGINE_Parser_Expressions.h"
 
@@ -205,6 +206,64 @@ namespace DALHAL {
                     ReportInfo(String(F("\nAll done!!!\n")).c_str());
                     return true;
                 }
+
+                bool TokenizeFileTest(const char* filePath) {
+
+                    char* fileContents = nullptr;
+                    LittleFS_ext::FileResult fileResult = LittleFS_ext::load_text_file(filePath, &fileContents);
+                    if (fileResult != LittleFS_ext::FileResult::Success) {
+                        ReportInfo(String(F("Error: file could not be read/or is empty\n")).c_str());
+                        return false;
+                    }
+                    int tokenCount = ParseAndTokenize<ScriptToken>(fileContents);
+                    ScriptTokens bufferTokens(tokenCount);
+                    ParseAndTokenize(fileContents, bufferTokens.items, tokenCount);
+
+                    TokenArena arena;
+                    fileResult = TokenizeFile(filePath, arena);
+                    if (fileResult != LittleFS_ext::FileResult::Success) {
+                        ReportInfo(String(F("Error: TokenizeFile failed\n")).c_str());
+                        delete[] fileContents;
+                        return false;
+                    }
+                    bool anyError = false;
+                    if (arena.Count() != tokenCount) {
+                        ReportInfo(String(F("Error: token count mismatch, ParseAndTokenize: ")).c_str() + std::to_string(tokenCount) + ", TokenizeFile: " + std::to_string(arena.Count()) + "\n");
+                        anyError = true;
+                    } else {
+                        ScriptTokens fileTokens(tokenCount);
+                        arena.MoveTokensTo(fileTokens.items);
+                        for (int i = 0; i < tokenCount; i++) {
+                            const ScriptToken& b = bufferTokens.items[i];
+                            const ScriptToken& f = fileTokens.items[i];
+                            if (f.Equals(b) == false || f.line != b.line || f.column != b.column) {
+                                ReportInfo(String(F("Error: token mismatch at index ")).c_str() + std::to_string(i) + ": " + b.ToString() + " (" + std::to_string(b.line) + ":" + std::to_string(b.column) + ") != " + f.ToString() + " (" + std::to_string(f.line) + ":" + std::to_string(f.column) + ")\n");
+                                anyError = true;
+                            }
+                        }
+                    }
+                    delete[] fileContents;
+
+                    // an empty file is an error, same as when the whole file was loaded
+                    std::string emptyPath = std::string(filePath) + ".empty";
+                    LittleFS_ext::FileWriter writer;
+                    if (writer.open(emptyPath.c_str()) == LittleFS_ext::FileResult::Success) {
+                        writer.close();
+                        TokenArena emptyArena;
+                        if (TokenizeFile(emptyPath.c_str(), emptyArena) != LittleFS_ext::FileResult::FileEmpty) {
+                            ReportInfo(String(F("Error: TokenizeFile did not report the empty file\n")).c_str());
+                            anyError = true;
+                        }
+                        LittleFS_ext::remove_file(emptyPath.c_str());
+                    }
+
+                    if (anyError) {
+                        ReportInfo(String(F("\nTokenizeFile test FAIL\n")).c_str());
+                    } else {
+                        ReportInfo(String(F("\nTokenizeFile test OK, tokens: ")).c_str() + std::to_string(tokenCount) + "\n");
+                    }
+                    return anyError == false;
+                }
             }
         }
     }
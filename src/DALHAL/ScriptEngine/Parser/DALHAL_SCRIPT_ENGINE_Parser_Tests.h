@@ -32,6 +32,8 @@ namespace DALHAL {
                 bool ParseExpressionTest(const char* filePath);
                 /** for development test only */
                 bool ParseActionExpressionTest(const char* filePath);
+                /** for development test only, checks that TokenizeFile gives the same tokens as ParseAndTokenize */
+                bool TokenizeFileTest(const char* filePath);
             }
         }
     }
@@ -0,0 +1,130 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DALHAL_SCRIPT_ENGINE_TokenArena.h"
+
+#include <cstring>
+
+namespace DALHAL {
+    namespace ScriptEngine {
+
+        TokenArena::TokenArena() : textHead(nullptr), textTail(nullptr), tokenHead(nullptr), tokenTail(nullptr), tokenStart(0), textCapacity(0), count(0), failed(false) { }
+
+        TokenArena::~TokenArena() {
+            FreeTokenChunks();
+            TextChunk* chunk = textHead;
+            while (chunk) {
+                TextChunk* next = chunk->next;
+                delete[] chunk->data;
+                delete chunk;
+                chunk = next;
+            }
+        }
+
+        void TokenArena::FreeTokenChunks() {
+            TokenChunk* chunk = tokenHead;
+            while (chunk) {
+                TokenChunk* next = chunk->next;
+                delete[] chunk->items;
+                delete chunk;
+                chunk = next;
+            }
+            tokenHead = nullptr;
+            tokenTail = nullptr;
+        }
+
+        bool TokenArena::NewTextChunk(size_t minCapacity) {
+            size_t capacity = (minCapacity > DALHAL_SCRIPT_ENGINE_TOKEN_ARENA_TEXT_CHUNK_SIZE) ? minCapacity : DALHAL_SCRIPT_ENGINE_TOKEN_ARENA_TEXT_CHUNK_SIZE;
+            TextChunk* chunk = new TextChunk();
+            if (chunk == nullptr) return false;
+            chunk->data = new char[capacity];
+            if (chunk->data == nullptr) { delete chunk; return false; }
+            chunk->capacity = capacity;
+            chunk->used = 0;
+            chunk->next = nullptr;
+            if (textTail) textTail->next = chunk;
+            else textHead = chunk;
+            textTail = chunk;
+            textCapacity += capacity;
+            return true;
+        }
+
+        void TokenArena::BeginToken() {
+            tokenStart = textTail ? textTail->used : 0;
+        }
+
+        size_t TokenArena::CurrentTokenLength() const {
+            return textTail ? (textTail->used - tokenStart) : 0;
+        }
+
+        void TokenArena::PutChar(char c) {
+            if (failed) return;
+            if (textTail == nullptr || textTail->used == textTail->capacity) {
+                // move the part of the token that is already written, so that each token stays contiguous
+                TextChunk* prev = textTail;
+                size_t partial = prev ? (prev->used - tokenStart) : 0;
+                if (NewTextChunk(partial * 2 + 2) == false) { failed = true; return; }
+                if (partial > 0) {
+                    std::memcpy(textTail->data, prev->data + tokenStart, partial);
+                    prev->used = tokenStart;
+                }
+                textTail->used = partial;
+                tokenStart = 0;
+            }
+            textTail->data[textTail->used++] = c;
+        }
+
+        bool TokenArena::EndToken(int line, int column) {
+            size_t length = CurrentTokenLength();
+            PutChar('\0');
+            if (failed) return false;
+
+            if (tokenTail == nullptr || tokenTail->used == DALHAL_SCRIPT_ENGINE_TOKEN_ARENA_TOKENS_PER_CHUNK) {
+                TokenChunk* chunk = new TokenChunk();
+                if (chunk == nullptr) { failed = true; return false; }
+                chunk->items = new ScriptToken[DALHAL_SCRIPT_ENGINE_TOKEN_ARENA_TOKENS_PER_CHUNK];
+                if (chunk->items == nullptr) { delete chunk; failed = true; return false; }
+                chunk->used = 0;
+                chunk->next = nullptr;
+                if (tokenTail) tokenTail->next = chunk;
+                else tokenHead = chunk;
+                tokenTail = chunk;
+            }
+            const char* start = textTail->data + tokenStart;
+            tokenTail->items[tokenTail->used++].Set(start, start + length, line, column);
+            count++;
+            BeginToken();
+            return true;
+        }
+
+        void TokenArena::MoveTokensTo(ScriptToken* items) {
+            int index = 0;
+            for (TokenChunk* chunk = tokenHead; chunk; chunk = chunk->next) {
+                for (int i = 0; i < chunk->used; i++) {
+                    items[index++] = chunk->items[i];
+                }
+            }
+            FreeTokenChunks();
+        }
+    }
+}
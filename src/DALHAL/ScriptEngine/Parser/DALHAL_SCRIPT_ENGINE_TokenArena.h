@@ -0,0 +1,102 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "DALHAL_SCRIPT_ENGINE_Script_Token.h"
+
+/** tokens per token chunk, a chunk is allocated each time the previous one is full */
+#ifndef DALHAL_SCRIPT_ENGINE_TOKEN_ARENA_TOKENS_PER_CHUNK
+#define DALHAL_SCRIPT_ENGINE_TOKEN_ARENA_TOKENS_PER_CHUNK 64
+#endif
+/** bytes per text chunk, a single token longer than this gets a chunk of its own */
+#ifndef DALHAL_SCRIPT_ENGINE_TOKEN_ARENA_TEXT_CHUNK_SIZE
+#define DALHAL_SCRIPT_ENGINE_TOKEN_ARENA_TEXT_CHUNK_SIZE 512
+#endif
+
+namespace DALHAL {
+    namespace ScriptEngine {
+        /**
+         * Growable storage used by the streaming tokenizer.
+         * Only the token text is kept (whitespace and comments never reach it), each token
+         * is null terminated and stays at a fixed address for the lifetime of the arena,
+         * so the tokens can point into it the same way they pointed into the loaded file before.
+         * The token items are kept in chunks while tokenizing and then moved into the
+         * contiguous ScriptTokens array that the parser works on.
+         */
+        class TokenArena {
+        public:
+            TokenArena();
+            ~TokenArena();
+            TokenArena(const TokenArena&) = delete;
+            TokenArena& operator=(const TokenArena&) = delete;
+
+            /** starts a new token, the chars are then added with PutChar */
+            void BeginToken();
+            void PutChar(char c);
+            /** ends the current token and stores it, returns false on allocation failure */
+            bool EndToken(int line, int column);
+            /** length of the token currently being built */
+            size_t CurrentTokenLength() const;
+
+            int Count() const { return count; }
+            /** total bytes allocated for text, including terminators and chunk slack */
+            size_t TextCapacity() const { return textCapacity; }
+            bool Failed() const { return failed; }
+
+            /** 
+             * copies all tokens to items (which need to have room for Count() tokens)
+             * and frees the token chunks, the text stays owned by this arena
+             */
+            void MoveTokensTo(ScriptToken* items);
+
+        private:
+            struct TextChunk {
+                TextChunk* next;
+                char* data;
+                size_t capacity;
+                size_t used;
+            };
+            struct TokenChunk {
+                TokenChunk* next;
+                ScriptToken* items;
+                int used;
+            };
+            TextChunk* textHead;
+            TextChunk* textTail;
+            TokenChunk* tokenHead;
+            TokenChunk* tokenTail;
+            /** offset of the current token start inside textTail */
+            size_t tokenStart;
+            size_t textCapacity;
+            int count;
+            bool failed;
+
+            bool NewTextChunk(size_t minCapacity);
+            void FreeTokenChunks();
+        };
+    }
+}
@@ -26,60 +26,158 @@
 #include <DALHAL/Core/Types/DALHAL_ZeroCopyString.h>
 #include "DALHAL_SCRIPT_ENGINE_Token.h"
 #include "DALHAL_SCRIPT_ENGINE_Script_Token.h"
+#include "DALHAL_SCRIPT_ENGINE_TokenArena.h"
 
 namespace DALHAL {
     namespace ScriptEngine {
-        inline void advance(char*& p, int& column) {
-            p++;
-            column++;
-        }
 
-        inline void advance(char*& p, int& line, int& column) {
-            if (*p == '\n') { 
-                line++;
-                column = 1;
-            } else {
-                column++;
+        /**
+         * The tokenizer rules are written once in TokenizeSource, against a char source and a token sink.
+         * A source gives the text as chars with one char lookahead (cur/next), -1 marks the end.
+         * A sink gets BeginToken/PutChar/EndToken calls, where EndToken is called after the
+         * source has been advanced past the last char of the token, it returns false to stop tokenizing.
+         */
+
+        /** null terminated in memory buffer, used by ParseAndTokenize */
+        class BufferSource {
+        public:
+            char* p;
+            int cur;
+            int next;
+
+            explicit BufferSource(char* buffer) : p(buffer) { Load(); }
+            inline void Advance() {
+                p++;
+                Load();
             }
-            p++;
-        }
+        private:
+            inline void Load() {
+                cur = (*p != '\0') ? static_cast<unsigned char>(p[0]) : -1;
+                next = (cur != -1 && p[1] != '\0') ? static_cast<unsigned char>(p[1]) : -1;
+            }
+        };
+
+        /** the tokens point into the buffer, so PutChar has nothing to do */
         template <typename T>
-        int ParseAndTokenize(char* buffer, T* tokens, int maxCount) {
-            char* p = buffer;
-            int tokenIndex = 0;
+        class BufferTokenSink {
+        public:
+            int count;
+
+            BufferTokenSink(BufferSource& src, T* tokens, int maxCount) : count(0), src(src), tokens(tokens), maxCount(maxCount), start(nullptr) {}
+
+            inline void BeginToken() { start = src.p; }
+            inline void PutChar(char) {}
+            inline bool EndToken(int line, int column) {
+                if (tokens) {
+                    if (count >= maxCount) return false; // error: mismatch, nearly impossible to happend
+                    tokens[count].Set(start, src.p, line, column);
+                }
+                count++;
+                return true;
+            }
+            inline size_t CurrentTokenLength() const { return static_cast<size_t>(src.p - start); }
+        private:
+            BufferSource& src;
+            T* tokens;
+            int maxCount;
+            char* start;
+        };
+
+        /**
+         * Gives the file as a stream of chars with newlines normalized, used by TokenizeFile.
+         * A null byte in the file also ends it (same as the null terminated buffer does).
+         */
+        class TokenizerSource {
+        public:
+            int cur;
+            int next;
+
+            explicit TokenizerSource(LittleFS_ext::TextFileReader& reader) : reader(reader), pos(0), len(0), ended(false), skipLF(false) {
+                cur = Get();
+                next = Get();
+            }
+            inline void Advance() {
+                cur = next;
+                next = Get();
+            }
+        private:
+            LittleFS_ext::TextFileReader& reader;
+            char block[DALHAL_SCRIPT_ENGINE_TOKENIZER_READ_BLOCK_SIZE];
+            size_t pos;
+            size_t len;
+            bool ended;
+            /** set after a \r so that a directly following \n is dropped */
+            bool skipLF;
+
+            inline int RawGet() {
+                if (pos == len) {
+                    if (ended) return -1;
+                    len = reader.read(block, sizeof(block));
+                    pos = 0;
+                    if (len == 0) { ended = true; return -1; }
+                }
+                return static_cast<unsigned char>(block[pos++]);
+            }
+            inline int Get() {
+                int c = RawGet();
+                if (skipLF) {
+                    skipLF = false;
+                    if (c == '\n') c = RawGet();
+                }
+                if (c == '\r') {
+                    skipLF = true;
+                    return '\n';
+                }
+                if (c == '\0') {
+                    ended = true;
+                    len = pos;
+                    return -1;
+                }
+                return c;
+            }
+        };
+
+        /** returns false if the sink failed */
+        template <typename Source, typename Sink>
+        static bool TokenizeSource(Source& s, Sink& sink) {
             int line = 1;
             int column = 1;
 
-            while (*p) {
+            while (s.cur != -1) {
                 // --- Skip whitespace and comments ---
                 for (;;) {
-                    if (*p == '\0') break;
+                    if (s.cur == -1) break;
 
                     // Whitespace
-                    if (isspace(static_cast<unsigned char>(*p))) {
-                        advance(p, line, column); // advance is newline-aware
+                    if (isspace(s.cur)) {
+                        if (s.cur == '\n') { line++; column = 1; }
+                        else column++;
+                        s.Advance();
                         continue;
                     }
 
                     // // single-line comment
-                    if (p[0] == '/' && p[1] == '/') {
-                        p+=2; // note here we don't touch column 
-                        // Skip all characters until either the end of the string or a newline
-                        while (*p && *p != '\n') { p++; }
+                    if (s.cur == '/' && s.next == '/') {
+                        // note here we don't touch column 
+                        s.Advance(); s.Advance();
+                        // Skip all characters until either the end or a newline
+                        while (s.cur != -1 && s.cur != '\n') { s.Advance(); }
                         continue;
                     }
 
                     // /* block comment */
-                    if (p[0] == '/' && p[1] == '*') {
-                        p += 2;
+                    if (s.cur == '/' && s.next == '*') {
+                        s.Advance(); s.Advance();
                         column += 2; // need to be aware as block comment can escape anywhere
-                        while (*p) {
-                            if (p[0] == '*' && p[1] == '/') {
-                                p += 2;
+                        while (s.cur != -1) {
+                            if (s.cur == '*' && s.next == '/') {
+                                s.Advance(); s.Advance();
                                 column += 2;
                                 break;
                             }
-                            advance(p, line, column); // advance is newline-aware
+                            if (s.cur == '\n') { line++; column = 1; }
+                            else column++;
+                            s.Advance();
                         }
                         continue;
                     }
@@ -87,89 +185,102 @@ namespace DALHAL {
                     break;
                 }
 
-                if (!*p) break;
+                if (s.cur == -1) break;
 
-                // check for string literal start and handle it
-                if (*p == '"') {
-                    char* token_start = p;      // include the starting quote
+                // check for string literal start and handle it, quotes are included in the token
+                if (s.cur == '"') {
                     int token_column = column;
                     int extraNewlines = 0;
+                    sink.BeginToken();
                     // skip opening quote
-                    advance(p, column);
-                    
-                    while (*p && *p != '"') {
-                        if (*p == '\\' && *(p+1)) {
+                    sink.PutChar('"');
+                    column++;
+                    s.Advance();
+
+                    while (s.cur != -1 && s.cur != '"') {
+                        if (s.cur == '\\' && s.next != -1) {
                             // skip '\'
-                            advance(p, column);
+                            sink.PutChar('\\');
+                            column++;
+                            s.Advance();
                         } // skip escaped char or next non "
-                        advance(p, extraNewlines, column); // advance is newline-aware
+                        if (s.cur == '\n') { extraNewlines++; column = 1; }
+                        else column++;
+                        sink.PutChar(static_cast<char>(s.cur));
+                        s.Advance();
                     }
-
-                    if (*p == '"') {
+                    if (s.cur == '"') {
                         // skip closing quote
-                        advance(p, column); 
+                        sink.PutChar('"');
+                        column++;
+                        s.Advance();
                     }
-
                     // store string token
-                    if (tokens) {
-                        if (tokenIndex >= maxCount) return -1;
-                        tokens[tokenIndex].Set(token_start, p, line, token_column);
-                    }
+                    if (sink.EndToken(line, token_column) == false) return false;
                     line += extraNewlines;
-                    tokenIndex++;
                     continue; // move to next token
                 }
 
                 // --- Start of token ---
-                char* token_start = p;
                 int token_column = column;
+                sink.BeginToken();
 
                 // Find end of token
-                while (*p) {
-                    char c = *p;
+                while (s.cur != -1) {
+                    int c = s.cur;
                     // break on whitespace
-                    if (isspace(static_cast<unsigned char>(c))) { break; }
+                    if (isspace(c)) break;
                     // break on comment start inside token
-                    if (c == '/' && (p[1] == '/' || p[1] == '*')) { break; }
+                    if (c == '/' && (s.next == '/' || s.next == '*')) break;
                     // break if the character itself is a token separator (; or \)
                     if (c == ';' || c == '\\') break;
-
-                    advance(p, column);
+                    sink.PutChar(static_cast<char>(c));
+                    column++;
+                    s.Advance();
                 }
                 // --- Handle single-character token separators separately ---
-                if (p[0] == ';' || p[0] == '\\') {
+                if (s.cur == ';' || s.cur == '\\') {
                     // If the token we just scanned has length > 0, store it first
-                    if (token_start < p) {
-                        if (tokens) {
-                            if (tokenIndex >= maxCount) return -1;
-                            tokens[tokenIndex].Set(token_start, p, line, token_column);
-                        }
-                        tokenIndex++;
+                    if (sink.CurrentTokenLength() > 0) {
+                        if (sink.EndToken(line, token_column) == false) return false;
                     }
-
                     // Then store the separator as its own token
-                    if (tokens) {
-                        if (tokenIndex >= maxCount) return -1;
-                        tokens[tokenIndex].Set(p, p + 1, line, column);
-                    }
-                    tokenIndex++;
-
-                    advance(p, column);
+                    int separator_column = column;
+                    sink.BeginToken();
+                    sink.PutChar(static_cast<char>(s.cur));
+                    column++;
+                    s.Advance();
+                    if (sink.EndToken(line, separator_column) == false) return false;
                     continue; // move to next token
                 }
 
                 // If the loop broke naturally (whitespace or comment), store the token
-                if (tokens) {
-                    if (tokenIndex >= maxCount) { return -1; } // error: mismatch, nearly impossible to happend
-                    tokens[tokenIndex].Set(token_start, p, line, token_column);
-                }
-                tokenIndex++;
+                if (sink.EndToken(line, token_column) == false) return false;
             }
-            return tokenIndex; // count of tokens found
+            return true;
+        }
+
+        template <typename T>
+        int ParseAndTokenize(char* buffer, T* tokens, int maxCount) {
+            BufferSource s(buffer);
+            BufferTokenSink<T> sink(s, tokens, maxCount);
+            if (TokenizeSource(s, sink) == false) return -1;
+            return sink.count; // count of tokens found
         }
         // Explicit instantiation for each type need to be after the template definition
         template int ParseAndTokenize<ZeroCopyString>(char* buffer, ZeroCopyString* tokens, int maxCount);
         template int ParseAndTokenize<Token>(char* buffer, Token* tokens, int maxCount);
         template int ParseAndTokenize<ScriptToken>(char* buffer, ScriptToken* tokens, int maxCount);
+
+        LittleFS_ext::FileResult TokenizeFile(const char* filePath, TokenArena& arena) {
+            LittleFS_ext::TextFileReader reader;
+            LittleFS_ext::FileResult res = reader.open(filePath);
+            if (res != LittleFS_ext::FileResult::Success) return res;
+
+            TokenizerSource s(reader);
+            if (s.cur == -1) return LittleFS_ext::FileResult::FileEmpty;
+            if (TokenizeSource(s, arena) == false) return LittleFS_ext::FileResult::AllocFail;
+            return LittleFS_ext::FileResult::Success;
+        }
     }
-}
\ No newline at end of file
+}
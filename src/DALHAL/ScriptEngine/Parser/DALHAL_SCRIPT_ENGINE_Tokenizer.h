@@ -23,6 +23,17 @@
 
 #pragma once
 
+#if defined(ESP32) || defined(ESP8266)
+#include <Support/LittleFS_ext.h>
+#else
+#include <LittleFS_ext.h>
+#endif
+
+/** size of the blocks read from the file by TokenizeFile, it's the only part of the file text that is resident at any time */
+#ifndef DALHAL_SCRIPT_ENGINE_TOKENIZER_READ_BLOCK_SIZE
+#define DALHAL_SCRIPT_ENGINE_TOKENIZER_READ_BLOCK_SIZE 256
+#endif
+
 namespace DALHAL {
     namespace ScriptEngine {
         /**
@@ -45,5 +56,20 @@ namespace DALHAL {
          */
         template <typename T>
         int ParseAndTokenize(char* buffer, T* tokens=nullptr, int maxCount=-1);
+
+        class TokenArena;
+
+        /**
+         * @brief Streaming version of ParseAndTokenize used for script files.
+         *
+         * Reads the file in DALHAL_SCRIPT_ENGINE_TOKENIZER_READ_BLOCK_SIZE blocks and in the same pass
+         * normalizes newlines (\r\n and \r to \n), strips comments and splits into tokens,
+         * using the same tokenizer core as ParseAndTokenize.
+         * The token text is copied into the arena so the file never needs to be resident.
+         *
+         * @return FileResult::Success, the open error, FileResult::FileEmpty for an empty file,
+         *         or FileResult::AllocFail if the arena could not grow.
+         */
+        LittleFS_ext::FileResult TokenizeFile(const char* filePath, TokenArena& arena);
     }
 }
\ No newline at end of file
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <DALHAL/Support/DALHAL_DeleterTemplate.h>
+#include <DALHAL/Support/DALHAL_Arena.h>
 
 #include <DALHAL/Core/Types/DALHAL_OperationResult.h>
 #include <DALHAL/Core/Types/DALHAL_CachedDeviceAccess.h>
@@ -42,6 +43,7 @@ namespace DALHAL {
         struct ActionStatement
         {
             DALHAL_NOCOPY_NOMOVE(ActionStatement);
+            DALHAL_ARENA_ALLOCATED
 
             CachedDeviceAccess* target;
             CalcRPN* calcRpn;
@@ -24,6 +24,7 @@
 #include <string>
 
 #include <DALHAL/Core/Types/DALHAL_OperationResult.h>
+#include <DALHAL/Support/DALHAL_Arena.h>
 
 namespace DALHAL {
     namespace ScriptEngine {
@@ -32,6 +33,7 @@ namespace DALHAL {
         struct CalcRPNToken;
         
         struct CalcRPN {
+            DALHAL_ARENA_ALLOCATED
             std::string calcRPNstr;
             
             CalcRPNToken* items;
@@ -105,7 +105,7 @@ namespace DALHAL {
         void CalcRPNToken::SetAsConstValue(ExpressionToken& expToken)
         {
             NumberResult constNumber = expToken.ConvertStringToNumber();
-            HALValue* value = new HALValue();
+            HALValue* value = ArenaNew<HALValue>(); // HALValue has no class operators as it is used everywhere
             if (constNumber.type == NumberType::FLOAT)
                 value->set(constNumber.f32);
             else if (constNumber.type == NumberType::INT32)
@@ -120,7 +120,7 @@ namespace DALHAL {
 
             context = value;
             handler = &CalcRPNToken::GetAndPushValuePtr_Handler;
-            deleter = DeleteAs<HALValue>;
+            deleter = ArenaDeleteAs<HALValue>;
         }
 
         HALOperationResult CalcRPNToken::DummyHandler(void* context) {
@@ -27,6 +27,7 @@
 #include <DALHAL/Core/Types/DALHAL_Device.h>
 
 #include <DALHAL/Support/DALHAL_DeleterTemplate.h>
+#include <DALHAL/Support/DALHAL_Arena.h>
 #include <DALHAL/ScriptEngine/Runtime/DALHAL_SCRIPT_ENGINE_RPNStack.h>  //contains the instance of halValueStack
 #include <DALHAL/ScriptEngine/Parser/DALHAL_SCRIPT_ENGINE_Script_Token.h>
 #include <DALHAL/ScriptEngine/Parser/DALHAL_SCRIPT_ENGINE_Expression_Token.h>
@@ -37,6 +38,7 @@ namespace DALHAL {
 
         struct ReadToHALValue_Function_Context
         {
+            DALHAL_ARENA_ALLOCATED
             Device* device;
             FunctionTypes::ReadToHALValue handler;
         };
@@ -80,6 +82,7 @@ namespace DALHAL {
 
         struct CalcRPNToken {
             DALHAL_NOCOPY_NOMOVE(CalcRPNToken);
+            DALHAL_ARENA_ALLOCATED
             /** 
              * this will either be:
              * CachedDeviceRead
@@ -25,6 +25,7 @@
 
 #include <DALHAL/Core/Types/DALHAL_OperationResult.h>
 #include <DALHAL/Support/DALHAL_DeleterTemplate.h> // Deleter
+#include <DALHAL/Support/DALHAL_Arena.h>
 #include <DALHAL/ScriptEngine/Parser/DALHAL_SCRIPT_ENGINE_Expression_Token.h> // ExpressionTokens, ExpressionToken
 
 namespace DALHAL {
@@ -51,6 +52,7 @@ namespace DALHAL {
         };
 
         struct LogicExecNode {
+            DALHAL_ARENA_ALLOCATED
             void* childA;   // either LogicExecNode* or CalcRPN Context*
             void* childB;   // either LogicExecNode* or CalcRPN Context*
             LogicExecHandler handler;  // function pointer to EvalAnd/Or variant
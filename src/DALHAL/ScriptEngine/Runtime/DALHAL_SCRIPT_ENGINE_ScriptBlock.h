@@ -27,6 +27,7 @@
 #include <DALHAL/ScriptEngine/Runtime/DALHAL_SCRIPT_ENGINE_TriggerBlock.h>
 
 #include <DALHAL/ScriptEngine/Parser/DALHAL_SCRIPT_ENGINE_Script_Token.h>
+#include <DALHAL/Support/DALHAL_Arena.h>
 
 namespace DALHAL {
     namespace ScriptEngine {
@@ -40,6 +41,7 @@ namespace DALHAL {
         struct ScriptBlock
         {
             DALHAL_NOCOPY_NOMOVE(ScriptBlock);
+            DALHAL_ARENA_ALLOCATED
 
             TriggerBlock* triggerBlocks;
             int triggerBlockCount;
@@ -33,6 +33,11 @@
 #include <DALHAL/ScriptEngine/DALHAL_SCRIPT_ENGINE_Reports.h>
 
 #include <LittleFS.h>
+#if defined(ESP32) || defined(ESP8266)
+#include <Support/LittleFS_ext.h>
+#else
+#include <LittleFS_ext.h>
+#endif
 
 namespace DALHAL {
     namespace ScriptEngine {
@@ -55,6 +60,7 @@ namespace DALHAL {
         ScriptBlock* ScriptBlocks::scriptBlocks = nullptr;
         int ScriptBlocks::scriptBlocksCount = 0;
         int ScriptBlocks::currentScriptIndex = 0;
+        Arena ScriptBlocks::arena;
 
         bool ScriptBlocks::ScriptFileParsed(ScriptTokens& tokens) {
             ReportInfo("\n");
@@ -85,12 +91,24 @@ namespace DALHAL {
 
         bool ScriptBlocks::LoadAllActiveScripts(ScriptsToLoad& scriptsToLoad)
         {
+            // size the arena from the sources, but never smaller than what the previous load did need
+            size_t prevNeeded = arena.Used() + arena.FallbackBytes();
             delete[] scriptBlocks;
             scriptBlocks = nullptr;
             scriptBlocksCount = 0;
+            arena.Release(); // all runtime structures of the previous load are destructed by now
             int count = scriptsToLoad.scriptFileCount;
             ZeroCopyString* files = scriptsToLoad.scriptFileList;
 
+            size_t arenaSize = DALHAL_SCRIPT_ARENA_SLACK;
+            for (int i = 0;i<count;i++) {
+                std::string path = DALHAL_SCRIPT_ENGINE_SCRIPTS_DIRECTORY + files[i].ToString();
+                int fileSize = LittleFS_ext::getFileSize(path.c_str());
+                if (fileSize > 0) { arenaSize += (size_t)fileSize * DALHAL_SCRIPT_ARENA_BYTES_PER_SOURCE_BYTE; }
+            }
+            if (arenaSize < prevNeeded) { arenaSize = prevNeeded; }
+            arena.Begin(arenaSize); // falls back to the heap if the block cannot be allocated
+
             scriptBlocks = new ScriptBlock[count];
             scriptBlocksCount = count;
             bool valid = true; // absolute failsafe
@@ -103,9 +121,10 @@ namespace DALHAL {
                     continue;
                 }
                 valid = ScriptEngine::Parser::ReadAndParseScriptFile(path.c_str(), ScriptFileParsed);
-                if (valid == false) return false;
+                if (valid == false) { arena.End(); return false; }
                 //yield();
             }
+            arena.End();
             return true;
         }
 
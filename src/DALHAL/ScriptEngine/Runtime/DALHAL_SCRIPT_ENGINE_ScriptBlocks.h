@@ -26,6 +26,16 @@
 #include <DALHAL/ScriptEngine/Parser/DALHAL_SCRIPT_ENGINE_Script_Token.h> // ScriptTokens
 #include <DALHAL/ScriptEngine/Runtime/DALHAL_SCRIPT_ENGINE_ScriptBlock.h> // ScriptBlock
 #include <DALHAL/ScriptEngine/Runtime/DALHAL_SCRIPT_ENGINE_ScriptsToLoad.h>
+#include <DALHAL/Support/DALHAL_Arena.h>
+
+/** estimated runtime arena bytes per byte of script source, used to size the script arena before a load */
+#ifndef DALHAL_SCRIPT_ARENA_BYTES_PER_SOURCE_BYTE
+#define DALHAL_SCRIPT_ARENA_BYTES_PER_SOURCE_BYTE   4
+#endif
+/** extra bytes added to every estimate */
+#ifndef DALHAL_SCRIPT_ARENA_SLACK
+#define DALHAL_SCRIPT_ARENA_SLACK                   256
+#endif
 
 namespace DALHAL {
     namespace ScriptEngine {
@@ -45,6 +55,8 @@ namespace DALHAL {
             static ScriptBlock* scriptBlocks;
             static int scriptBlocksCount;
             static int currentScriptIndex;
+            /** all runtime structures of the loaded scripts, released as one block on the next load */
+            static Arena arena;
 
             /** just a callback wrapper to begin initializing the structures */
             static bool ScriptFileParsed(ScriptTokens& tokens);
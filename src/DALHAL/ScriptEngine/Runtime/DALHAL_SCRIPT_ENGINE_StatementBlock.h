@@ -24,6 +24,7 @@
 #pragma once
 
 #include <DALHAL/Support/DALHAL_DeleterTemplate.h> // Deleter
+#include <DALHAL/Support/DALHAL_Arena.h>
 #include <DALHAL/ScriptEngine/Runtime/IfStatement/DALHAL_SCRIPT_ENGINE_IfStatement.h>
 
 namespace DALHAL {
@@ -33,6 +34,7 @@ namespace DALHAL {
         struct StatementBlock
         {
             DALHAL_NOCOPY_NOMOVE(StatementBlock);
+            DALHAL_ARENA_ALLOCATED
 
             void* context;
             HALOperationResult (*handler)(void* context);
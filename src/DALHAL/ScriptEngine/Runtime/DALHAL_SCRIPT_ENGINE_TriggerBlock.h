@@ -24,6 +24,7 @@
 #pragma once
 
 #include <DALHAL/Support/DALHAL_DeleterTemplate.h>
+#include <DALHAL/Support/DALHAL_Arena.h>
 
 namespace DALHAL {
 
@@ -41,6 +42,7 @@ namespace DALHAL {
         struct TriggerBlock
         {
             DALHAL_NOCOPY_NOMOVE(TriggerBlock);
+            DALHAL_ARENA_ALLOCATED
 
             /** the function set to this pointer should return true if the StatementBlock(s) should execute */
             ReactiveEvent* event;
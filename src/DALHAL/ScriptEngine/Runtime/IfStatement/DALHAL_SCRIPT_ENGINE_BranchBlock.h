@@ -24,6 +24,7 @@
 #pragma once
 
 #include <DALHAL/Support/DALHAL_DeleterTemplate.h> // DALHAL_NOCOPY_NOMOVE
+#include <DALHAL/Support/DALHAL_Arena.h>
 #include <DALHAL/Core/Types/DALHAL_OperationResult.h>
 
 namespace DALHAL {
@@ -36,6 +37,7 @@ namespace DALHAL {
         struct BranchBlock
         {
             DALHAL_NOCOPY_NOMOVE(BranchBlock);
+            DALHAL_ARENA_ALLOCATED
 
             StatementBlock* items;
             int itemsCount;
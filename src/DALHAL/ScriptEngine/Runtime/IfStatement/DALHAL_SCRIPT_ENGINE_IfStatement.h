@@ -25,6 +25,7 @@
 
 #include <DALHAL/Core/Types/DALHAL_OperationResult.h>
 #include <DALHAL/Support/DALHAL_DeleterTemplate.h>
+#include <DALHAL/Support/DALHAL_Arena.h>
 
 namespace DALHAL {
     namespace ScriptEngine {
@@ -50,6 +51,7 @@ namespace DALHAL {
         struct IfStatement
         {
             DALHAL_NOCOPY_NOMOVE(IfStatement);
+            DALHAL_ARENA_ALLOCATED
 
             ConditionalBranch* branchItems;
             int branchItemsCount;
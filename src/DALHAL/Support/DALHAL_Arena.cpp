@@ -0,0 +1,103 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DALHAL_Arena.h"
+
+#include <stdlib.h>
+
+namespace DALHAL {
+
+    static constexpr size_t ARENA_ALIGN = alignof(max_align_t);
+
+    Arena* Arena::first = nullptr;
+    Arena* Arena::active = nullptr;
+
+    Arena::Arena() : next(first) {
+        first = this;
+    }
+
+    bool Arena::Begin(size_t size) {
+        if (block != nullptr) { Release(); } // should never happen
+        fallbackCount = 0;
+        fallbackBytes = 0;
+        used = 0;
+        capacity = (size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+        block = static_cast<uint8_t*>(malloc(capacity));
+        if (block == nullptr) {
+            capacity = 0;
+        }
+        active = this; // even without a block so that the fallbacks are counted
+        return block != nullptr;
+    }
+
+    void Arena::End() {
+        if (active == this) { active = nullptr; }
+        if (used > peakUsed) { peakUsed = used; }
+    }
+
+    void Arena::Release() {
+        if (active == this) { active = nullptr; }
+        free(block);
+        block = nullptr;
+        capacity = 0;
+        used = 0;
+    }
+
+    bool Arena::Owns(const void* ptr) const {
+        const uint8_t* p = static_cast<const uint8_t*>(ptr);
+        return (block != nullptr) && (p >= block) && (p < block + capacity);
+    }
+
+    void* Arena::AllocateFromBlock(size_t size) {
+        size_t aligned = (size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+        if (aligned <= capacity - used) {
+            void* ptr = block + used;
+            used += aligned;
+            return ptr;
+        }
+        fallbackCount++;
+        fallbackBytes += size;
+        return malloc(size);
+    }
+
+    void* Arena::Allocate(size_t size) {
+        return (active != nullptr) ? active->AllocateFromBlock(size) : malloc(size);
+    }
+
+    void Arena::Free(void* ptr) {
+        if (ptr == nullptr) return;
+        for (const Arena* arena = first; arena != nullptr; arena = arena->next) {
+            if (arena->Owns(ptr)) return; // released with the whole block
+        }
+        free(ptr);
+    }
+
+    void Arena::PrintTo(StringBuilderStreamer& sbs) const {
+        sbs.write_jsonNumber(F("capacity"), (uint32_t)capacity);
+        sbs.write_json_value_separator(); sbs.write_jsonNumber(F("used"), (uint32_t)used);
+        sbs.write_json_value_separator(); sbs.write_jsonNumber(F("high water"), (uint32_t)((used > peakUsed) ? used : peakUsed));
+        sbs.write_json_value_separator(); sbs.write_jsonNumber(F("heap fallbacks"), fallbackCount);
+        sbs.write_json_value_separator(); sbs.write_jsonNumber(F("heap fallback bytes"), fallbackBytes);
+    }
+
+}
@@ -0,0 +1,101 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <new>
+
+#include <DALHAL/API/DALHAL_StringBuilderStreamer.h>
+
+/**
+ * add inside a class/struct to make new/new[] use the currently open Arena (if any),
+ * that is DeviceArena::arena while devices are loaded and ScriptBlocks::arena while scripts are loaded
+ */
+#define DALHAL_ARENA_ALLOCATED \
+    static void* operator new(size_t size) { return DALHAL::Arena::Allocate(size); } \
+    static void* operator new[](size_t size) { return DALHAL::Arena::Allocate(size); } \
+    static void operator delete(void* ptr) { DALHAL::Arena::Free(ptr); } \
+    static void operator delete[](void* ptr) { DALHAL::Arena::Free(ptr); }
+
+namespace DALHAL {
+
+    /**
+     * A single contiguous block that one load generation is bump allocated from.
+     * While an arena is open (between Begin and End) Arena::Allocate takes memory from it,
+     * otherwise (or when the block is full) from the heap.
+     * Arena::Free is a no-op for memory owned by any arena, the block is released in one shot
+     * with Release, which must only be called when nothing inside it is alive anymore.
+     * Only one arena can be open at the time.
+     */
+    class Arena {
+    private:
+        static Arena* first; // all arenas, used by Free to find the owner
+        static Arena* active;
+        Arena* next;
+
+        uint8_t* block = nullptr;
+        size_t capacity = 0;
+        size_t used = 0;
+        size_t peakUsed = 0; // over all generations
+        uint32_t fallbackCount = 0;
+        uint32_t fallbackBytes = 0;
+
+        void* AllocateFromBlock(size_t size);
+
+    public:
+        Arena();
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        /** allocates the block and makes this the open arena, on failure allocations goes to the heap */
+        bool Begin(size_t size);
+        void End();
+        void Release();
+        bool Owns(const void* ptr) const;
+
+        inline size_t Capacity() const { return capacity; }
+        inline size_t Used() const { return used; }
+        inline uint32_t FallbackBytes() const { return fallbackBytes; }
+
+        /** writes the members of the stats, without the object braces */
+        void PrintTo(StringBuilderStreamer& sbs) const;
+
+        static void* Allocate(size_t size);
+        static void Free(void* ptr);
+    };
+
+    /** for types that cannot have the class operators (i.e. HALValue is also used outside of any load) */
+    template<typename T>
+    T* ArenaNew() {
+        return new (Arena::Allocate(sizeof(T))) T();
+    }
+    template<typename T>
+    void ArenaDeleteAs(void* ptr) {
+        if (ptr == nullptr) return;
+        static_cast<T*>(ptr)->~T();
+        Arena::Free(ptr);
+    }
+
+}
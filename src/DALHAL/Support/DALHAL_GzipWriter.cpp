@@ -0,0 +1,223 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DALHAL_GzipWriter.h"
+
+#include <string.h>
+
+#define DALHAL_GZIP_MIN_MATCH 3
+#define DALHAL_GZIP_MAX_MATCH 258
+#define DALHAL_GZIP_HASH_BITS 10
+#define DALHAL_GZIP_HASH_SIZE (1 << DALHAL_GZIP_HASH_BITS)
+#define DALHAL_GZIP_BUFFER_SIZE (2 * DALHAL_GZIP_WRITER_WINDOW_SIZE)
+
+static_assert(DALHAL_GZIP_WRITER_WINDOW_SIZE > DALHAL_GZIP_MAX_MATCH, "the window must hold the lookahead");
+static_assert(DALHAL_GZIP_BUFFER_SIZE < 65535, "window positions are stored as uint16_t");
+
+namespace DALHAL {
+
+    // RFC 1951 3.2.5
+    static const uint16_t lengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    static const uint8_t lengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    static const uint16_t distanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    static const uint8_t distanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+    // crc32 (0xEDB88320) one nibble at the time, keeps the table at 64 bytes
+    static const uint32_t crcNibble[16] = {
+        0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL, 0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+        0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL, 0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL
+    };
+
+    GzipWriter::~GzipWriter() {
+        release();
+    }
+
+    void GzipWriter::release() {
+        delete[] window;
+        window = nullptr;
+        delete[] head;
+        head = nullptr;
+    }
+
+    bool GzipWriter::begin(OutputCallback outCb) {
+        release();
+        out = outCb;
+        window = new uint8_t[DALHAL_GZIP_BUFFER_SIZE];
+        head = new uint16_t[DALHAL_GZIP_HASH_SIZE];
+        if (window == nullptr || head == nullptr) {
+            release();
+            return false;
+        }
+        memset(head, 0, DALHAL_GZIP_HASH_SIZE * sizeof(uint16_t));
+        fill = 0;
+        pos = 0;
+        crc = 0xFFFFFFFFUL;
+        inTotal = 0;
+        outTotal = 0;
+        bitBuf = 0;
+        bitCount = 0;
+        outLen = 0;
+        ok = true;
+
+        // magic, deflate, no flags, no mtime, no extra flags, unknown os
+        static const uint8_t header[10] = { 0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF };
+        for (uint8_t b : header) putByte(b);
+        // a single final block with the fixed codes, it can be of any length
+        putBits(1, 1); // BFINAL
+        putBits(1, 2); // BTYPE 01
+        return ok;
+    }
+
+    bool GzipWriter::write(const uint8_t* data, size_t len) {
+        if (window == nullptr) return false;
+        while (len > 0 && ok) {
+            if (fill == DALHAL_GZIP_BUFFER_SIZE) {
+                // slide, compress always leaves pos past the first half here
+                memmove(window, window + DALHAL_GZIP_WRITER_WINDOW_SIZE, fill - DALHAL_GZIP_WRITER_WINDOW_SIZE);
+                fill -= DALHAL_GZIP_WRITER_WINDOW_SIZE;
+                pos -= DALHAL_GZIP_WRITER_WINDOW_SIZE;
+                for (size_t i = 0; i < DALHAL_GZIP_HASH_SIZE; i++) {
+                    head[i] = (head[i] > DALHAL_GZIP_WRITER_WINDOW_SIZE) ? (uint16_t)(head[i] - DALHAL_GZIP_WRITER_WINDOW_SIZE) : 0;
+                }
+            }
+            size_t count = DALHAL_GZIP_BUFFER_SIZE - fill;
+            if (count > len) count = len;
+            for (size_t i = 0; i < count; i++) {
+                crc ^= data[i];
+                crc = (crc >> 4) ^ crcNibble[crc & 0x0F];
+                crc = (crc >> 4) ^ crcNibble[crc & 0x0F];
+            }
+            memcpy(window + fill, data, count);
+            fill += count;
+            inTotal += count;
+            data += count;
+            len -= count;
+            compress(false);
+        }
+        return ok;
+    }
+
+    bool GzipWriter::finish() {
+        if (window == nullptr) return false;
+        compress(true);
+        putCode(0, 7); // end of block (256)
+        if (bitCount > 0) putByte((uint8_t)bitBuf);
+        bitBuf = 0;
+        bitCount = 0;
+        const uint32_t crcOut = crc ^ 0xFFFFFFFFUL;
+        for (int i = 0; i < 4; i++) putByte((uint8_t)(crcOut >> (8 * i)));
+        for (int i = 0; i < 4; i++) putByte((uint8_t)(inTotal >> (8 * i)));
+        flushOut();
+        release();
+        return ok;
+    }
+
+    void GzipWriter::insertHash(size_t p) {
+        const uint32_t h = (((uint32_t)window[p] << 10) ^ ((uint32_t)window[p + 1] << 5) ^ window[p + 2]) & (DALHAL_GZIP_HASH_SIZE - 1);
+        head[h] = (uint16_t)(p + 1);
+    }
+
+    void GzipWriter::compress(bool flushAll) {
+        while (pos < fill && (flushAll || fill - pos >= DALHAL_GZIP_MAX_MATCH)) {
+            const size_t available = fill - pos;
+            size_t bestLength = 0;
+            size_t bestDistance = 0;
+            if (available >= DALHAL_GZIP_MIN_MATCH) {
+                const uint32_t h = (((uint32_t)window[pos] << 10) ^ ((uint32_t)window[pos + 1] << 5) ^ window[pos + 2]) & (DALHAL_GZIP_HASH_SIZE - 1);
+                const uint16_t candidate = head[h];
+                head[h] = (uint16_t)(pos + 1);
+                if (candidate != 0) {
+                    const size_t c = candidate - 1;
+                    const size_t maxLength = available < DALHAL_GZIP_MAX_MATCH ? available : DALHAL_GZIP_MAX_MATCH;
+                    size_t length = 0;
+                    while (length < maxLength && window[c + length] == window[pos + length]) length++;
+                    if (length >= DALHAL_GZIP_MIN_MATCH) {
+                        bestLength = length;
+                        bestDistance = pos - c;
+                    }
+                }
+            }
+            if (bestLength == 0) {
+                putLiteral(window[pos]);
+                pos++;
+                continue;
+            }
+            putMatch(bestLength, bestDistance);
+            for (size_t i = 1; i < bestLength && pos + i + DALHAL_GZIP_MIN_MATCH <= fill; i++) {
+                insertHash(pos + i);
+            }
+            pos += bestLength;
+        }
+    }
+
+    void GzipWriter::putLiteral(uint8_t lit) {
+        if (lit < 144) putCode(0x30 + lit, 8);
+        else putCode(0x190 + (lit - 144), 9);
+    }
+
+    void GzipWriter::putMatch(size_t length, size_t distance) {
+        uint8_t code = 28;
+        while (lengthBase[code] > length) code--;
+        const uint16_t symbol = 257 + code;
+        if (symbol < 280) putCode(symbol - 256, 7);
+        else putCode(0xC0 + (symbol - 280), 8);
+        if (lengthExtra[code] > 0) putBits((uint32_t)(length - lengthBase[code]), lengthExtra[code]);
+
+        code = 29;
+        while (distanceBase[code] > distance) code--;
+        putCode(code, 5);
+        if (distanceExtra[code] > 0) putBits((uint32_t)(distance - distanceBase[code]), distanceExtra[code]);
+    }
+
+    void GzipWriter::putCode(uint32_t code, uint8_t count) {
+        uint32_t reversed = 0;
+        for (uint8_t i = 0; i < count; i++) {
+            reversed = (reversed << 1) | (code & 1);
+            code >>= 1;
+        }
+        putBits(reversed, count);
+    }
+
+    void GzipWriter::putBits(uint32_t bits, uint8_t count) {
+        bitBuf |= bits << bitCount;
+        bitCount += count;
+        while (bitCount >= 8) {
+            putByte((uint8_t)bitBuf);
+            bitBuf >>= 8;
+            bitCount -= 8;
+        }
+    }
+
+    void GzipWriter::putByte(uint8_t b) {
+        outBuf[outLen++] = b;
+        if (outLen == sizeof(outBuf)) flushOut();
+    }
+
+    void GzipWriter::flushOut() {
+        if (outLen == 0) return;
+        if (ok) ok = out(outBuf, outLen);
+        outTotal += outLen;
+        outLen = 0;
+    }
+
+}
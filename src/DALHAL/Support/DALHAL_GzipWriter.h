@@ -0,0 +1,97 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <functional>
+
+/**
+ * LZ77 window of the gzip writer, matches are only searched this far back,
+ * the writer allocates twice this (plus a 2 KB hash table) while it is open
+ */
+#ifndef DALHAL_GZIP_WRITER_WINDOW_SIZE
+#if defined(ESP8266)
+#define DALHAL_GZIP_WRITER_WINDOW_SIZE 2048
+#else
+#define DALHAL_GZIP_WRITER_WINDOW_SIZE 4096
+#endif
+#endif
+
+#define DALHAL_GZIP_WRITER_OUT_BUFFER_SIZE 128
+
+namespace DALHAL {
+
+    /**
+     * Minimal streaming gzip encoder, one deflate block with the fixed huffman codes
+     * and a greedy single candidate LZ77 match search.
+     * Made for compressing generated text once on the device (the config schema cache),
+     * it gives roughly what gzip -1 gives on json with a small fixed amount of ram.
+     */
+    class GzipWriter {
+    public:
+        using OutputCallback = std::function<bool(const uint8_t* data, size_t len)>;
+
+        GzipWriter() = default;
+        GzipWriter(const GzipWriter&) = delete;
+        GzipWriter& operator=(const GzipWriter&) = delete;
+        ~GzipWriter();
+
+        /** allocates the buffers and writes the gzip header, returns false when out of memory or out failed */
+        bool begin(OutputCallback out);
+        bool write(const uint8_t* data, size_t len);
+        /** compresses what is left and writes the gzip trailer, the buffers are released */
+        bool finish();
+        /** total compressed bytes given to out so far */
+        size_t compressedSize() const { return outTotal; }
+
+    private:
+        OutputCallback out;
+        uint8_t* window = nullptr; // 2 * DALHAL_GZIP_WRITER_WINDOW_SIZE
+        uint16_t* head = nullptr;  // latest window position + 1 for each hash, 0 = none
+        size_t fill = 0; // bytes in window
+        size_t pos = 0;  // next byte to encode
+        uint32_t crc = 0;
+        uint32_t inTotal = 0;
+        size_t outTotal = 0;
+        uint32_t bitBuf = 0;
+        uint8_t bitCount = 0;
+        uint8_t outBuf[DALHAL_GZIP_WRITER_OUT_BUFFER_SIZE];
+        size_t outLen = 0;
+        bool ok = false;
+
+        void release();
+        /** encodes the window until only lookahead bytes are left, all of it when flushAll */
+        void compress(bool flushAll);
+        void insertHash(size_t p);
+        void putByte(uint8_t b);
+        void putBits(uint32_t bits, uint8_t count);
+        /** huffman codes are stored msb first */
+        void putCode(uint32_t code, uint8_t count);
+        void putLiteral(uint8_t lit);
+        void putMatch(size_t length, size_t distance);
+        void flushOut();
+    };
+
+}
@@ -0,0 +1,309 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DALHAL_NumberCodec.h"
+
+#include <math.h>
+#include <string.h>
+
+namespace DALHAL {
+
+    namespace NumberCodec {
+
+        // two digits at the time halves the number of divisions
+        static const char digitPairs[201] =
+            "00010203040506070809"
+            "10111213141516171819"
+            "20212223242526272829"
+            "30313233343536373839"
+            "40414243444546474849"
+            "50515253545556575859"
+            "60616263646566676869"
+            "70717273747576777879"
+            "80818283848586878889"
+            "90919293949596979899";
+
+        // all powers of ten that are exact in a double
+        static const double pow10Table[] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+
+        static const uint32_t pow10UInt32[] = {
+            1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL
+        };
+
+        static inline bool More(const char* p, const char* end) {
+            return p != end && *p != '\0';
+        }
+
+        static inline uint32_t DigitValue(char c) {
+            return (uint32_t)(uint8_t)c - (uint32_t)'0'; // > 9 when not a digit
+        }
+
+        static double Pow10(int32_t k) {
+            double r = 1.0;
+            while (k > 22) { r *= 1e22; k -= 22; }
+            return r * pow10Table[k];
+        }
+
+        /** dividing by an exact power of ten is more accurate than multiplying with an inexact 1e-k */
+        static double ScaleByPow10(double x, int32_t k) {
+            return (k >= 0) ? x * Pow10(k) : x / Pow10(-k);
+        }
+
+        size_t WriteUInt32(char* out, uint32_t v) {
+            char tmp[10];
+            char* p = tmp + sizeof(tmp);
+            while (v >= 100) {
+                uint32_t r = v % 100;
+                v /= 100;
+                p -= 2;
+                memcpy(p, digitPairs + r * 2, 2);
+            }
+            if (v >= 10) {
+                p -= 2;
+                memcpy(p, digitPairs + v * 2, 2);
+            } else {
+                *--p = (char)('0' + v);
+            }
+            size_t n = (size_t)(tmp + sizeof(tmp) - p);
+            memcpy(out, p, n);
+            out[n] = '\0';
+            return n;
+        }
+
+        size_t WriteInt32(char* out, int32_t v) {
+            if (v < 0) {
+                *out = '-';
+                return 1 + WriteUInt32(out + 1, 0U - (uint32_t)v);
+            }
+            return WriteUInt32(out, (uint32_t)v);
+        }
+
+        size_t WriteFloat(char* out, float v, uint8_t maxDigits) {
+            char* o = out;
+            if (isnan(v)) {
+                memcpy(o, "nan", 4);
+                return 3;
+            }
+            if (signbit(v)) {
+                *o++ = '-';
+                v = -v;
+            }
+            if (isinf(v)) {
+                memcpy(o, "inf", 4);
+                return (size_t)(o - out) + 3;
+            }
+            if (v == 0.0f) {
+                *o++ = '0';
+                *o = '\0';
+                return (size_t)(o - out);
+            }
+            if (maxDigits < 1) maxDigits = 1;
+            else if (maxDigits > 9) maxDigits = 9;
+
+            const double a = v;
+
+            // decimal exponent of the first digit, estimated from the binary exponent
+            int e2;
+            frexp(a, &e2);
+            int32_t e10 = (int32_t)floor((e2 - 1) * 0.30102999566398120);
+            while (a >= ScaleByPow10(1.0, e10 + 1)) e10++;
+            while (a < ScaleByPow10(1.0, e10)) e10--;
+
+            // fewest digits (up to maxDigits) that read back as the same float
+            uint32_t m = 0;
+            int32_t scale = 0;
+            uint8_t n = 1;
+            for (;; n++) {
+                scale = e10 - n + 1;
+                const double s = ScaleByPow10(a, -scale);
+                const double f = floor(s);
+                m = (uint32_t)f;
+                // round half to even, same as printf
+                if (s - f > 0.5 || (s - f == 0.5 && (m & 1))) m++;
+                if (n >= maxDigits) break;
+                if ((float)ScaleByPow10((double)m, scale) == v) break;
+            }
+            if (m >= pow10UInt32[n]) { // rounded up to the next power of ten
+                m /= 10;
+                scale++;
+            }
+            while (n > 1 && (m % 10) == 0) {
+                m /= 10;
+                scale++;
+                n--;
+            }
+
+            char digits[DALHAL_NUMBER_CODEC_UINT32_BUFFER_SIZE];
+            n = (uint8_t)WriteUInt32(digits, m);
+            const int32_t exp = scale + n - 1;
+
+            if (exp < -4 || exp >= maxDigits) {
+                *o++ = digits[0];
+                if (n > 1) {
+                    *o++ = '.';
+                    memcpy(o, digits + 1, n - 1);
+                    o += n - 1;
+                }
+                *o++ = 'e';
+                *o++ = (exp < 0) ? '-' : '+';
+                uint32_t ue = (uint32_t)((exp < 0) ? -exp : exp);
+                memcpy(o, digitPairs + ue * 2, 2); // |exp| <= 45
+                o += 2;
+            } else if (exp >= 0) {
+                if (n <= exp + 1) {
+                    memcpy(o, digits, n);
+                    o += n;
+                    for (int32_t i = n; i <= exp; i++) *o++ = '0';
+                } else {
+                    memcpy(o, digits, exp + 1);
+                    o += exp + 1;
+                    *o++ = '.';
+                    memcpy(o, digits + exp + 1, n - exp - 1);
+                    o += n - exp - 1;
+                }
+            } else {
+                *o++ = '0';
+                *o++ = '.';
+                for (int32_t i = -1; i > exp; i--) *o++ = '0';
+                memcpy(o, digits, n);
+                o += n;
+            }
+            *o = '\0';
+            return (size_t)(o - out);
+        }
+
+        const char* ParseUInt32(const char* p, const char* end, uint32_t& out) {
+            uint64_t value = 0;
+            const char* start = p;
+            uint32_t d;
+            while (More(p, end) && (d = DigitValue(*p)) <= 9) {
+                value = value * 10 + d;
+                if (value > 0xFFFFFFFFULL) return nullptr;
+                p++;
+            }
+            if (p == start) return nullptr;
+            out = (uint32_t)value;
+            return p;
+        }
+
+        const char* ParseInt32(const char* p, const char* end, int32_t& out) {
+            bool negative = false;
+            if (More(p, end) && (*p == '-' || *p == '+')) {
+                negative = (*p == '-');
+                p++;
+            }
+            uint32_t value;
+            p = ParseUInt32(p, end, value);
+            if (p == nullptr) return nullptr;
+            if (value > (negative ? 0x80000000UL : 0x7FFFFFFFUL)) return nullptr;
+            out = negative ? (int32_t)(0U - value) : (int32_t)value;
+            return p;
+        }
+
+        const char* ParseHex32(const char* p, const char* end, uint32_t& out) {
+            uint32_t value = 0;
+            const char* start = p;
+            while (More(p, end)) {
+                uint32_t d = DigitValue(*p);
+                if (d > 9) {
+                    d = (uint32_t)(uint8_t)(*p | 0x20) - (uint32_t)'a' + 10; // lower case, non letters ends up out of range
+                    if (d < 10 || d > 15) break;
+                }
+                if (p - start == 8) return nullptr;
+                value = (value << 4) | d;
+                p++;
+            }
+            if (p == start) return nullptr;
+            out = value;
+            return p;
+        }
+
+        const char* ParseFloat(const char* p, const char* end, float& out) {
+            bool negative = false;
+            if (More(p, end) && (*p == '-' || *p == '+')) {
+                negative = (*p == '-');
+                p++;
+            }
+            uint64_t mantissa = 0;
+            int32_t exp10 = 0;
+            bool digitSeen = false;
+            uint32_t d;
+            // digits beyond what the mantissa holds only affect the exponent
+            while (More(p, end) && (d = DigitValue(*p)) <= 9) {
+                if (mantissa < 100000000000000000ULL) mantissa = mantissa * 10 + d;
+                else exp10++;
+                digitSeen = true;
+                p++;
+            }
+            if (More(p, end) && *p == '.') {
+                p++;
+                while (More(p, end) && (d = DigitValue(*p)) <= 9) {
+                    if (mantissa < 100000000000000000ULL) {
+                        mantissa = mantissa * 10 + d;
+                        exp10--;
+                    }
+                    digitSeen = true;
+                    p++;
+                }
+            }
+            if (digitSeen == false) return nullptr;
+
+            if (More(p, end) && (*p | 0x20) == 'e') {
+                const char* q = p + 1;
+                bool expNegative = false;
+                if (More(q, end) && (*q == '-' || *q == '+')) {
+                    expNegative = (*q == '-');
+                    q++;
+                }
+                if (More(q, end) && DigitValue(*q) <= 9) { // otherwise the e is not part of the number
+                    int32_t e = 0;
+                    while (More(q, end) && (d = DigitValue(*q)) <= 9) {
+                        if (e < 10000) e = e * 10 + (int32_t)d;
+                        q++;
+                    }
+                    exp10 += expNegative ? -e : e;
+                    p = q;
+                }
+            }
+            out = ComposeFloat(mantissa, exp10, negative);
+            return p;
+        }
+
+        float ComposeFloat(uint64_t mantissa, int32_t exp10, bool negative) {
+            float value;
+            if (mantissa == 0 || exp10 < -80) {
+                value = 0.0f; // the mantissa is at most 18 digits, so this is below the smallest float
+            } else if (exp10 > 80) {
+                value = INFINITY;
+            } else {
+                value = (float)ScaleByPow10((double)mantissa, exp10);
+            }
+            return negative ? -value : value;
+        }
+
+    }
+
+}
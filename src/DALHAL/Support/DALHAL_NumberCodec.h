@@ -0,0 +1,75 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * max significant digits written by NumberCodec::WriteFloat, the shortest representation
+ * that reads back to the same float is used when it is shorter.
+ * 6 gives the same output as printf("%g"), 9 makes every float round trip exactly.
+ */
+#ifndef DALHAL_NUMBER_CODEC_FLOAT_MAX_DIGITS
+#define DALHAL_NUMBER_CODEC_FLOAT_MAX_DIGITS 6
+#endif
+
+/** buffer sizes including the null terminator */
+#define DALHAL_NUMBER_CODEC_UINT32_BUFFER_SIZE 11 // 4294967295
+#define DALHAL_NUMBER_CODEC_INT32_BUFFER_SIZE 12  // -2147483648
+#define DALHAL_NUMBER_CODEC_FLOAT_BUFFER_SIZE 24  // -0.0000123456789, -1.23456789e-45
+
+namespace DALHAL {
+
+    /**
+     * printf/strto* free number formatting and parsing used by the json/log/mqtt output
+     * and the value conversions, newlib printf is both slow and stack hungry on the ESP8266.
+     *
+     * The Write functions null terminate the output and return the length (without the terminator).
+     * The Parse functions read from p until end (or until the null terminator when end is nullptr),
+     * stop at the first char that is not part of the number and return the position after it,
+     * nullptr is returned when there are no digits or the value do not fit.
+     */
+    namespace NumberCodec {
+
+        size_t WriteUInt32(char* out, uint32_t v);
+        size_t WriteInt32(char* out, int32_t v);
+        /** same format as %g, nan and inf are written as nan, inf and -inf */
+        size_t WriteFloat(char* out, float v, uint8_t maxDigits = DALHAL_NUMBER_CODEC_FLOAT_MAX_DIGITS);
+
+        /** decimal digits only, no sign */
+        const char* ParseUInt32(const char* p, const char* end, uint32_t& out);
+        /** optional sign followed by decimal digits */
+        const char* ParseInt32(const char* p, const char* end, int32_t& out);
+        /** hex digits only, no 0x prefix, max 8 digits */
+        const char* ParseHex32(const char* p, const char* end, uint32_t& out);
+        /** optional sign, digits with optional '.' fraction and optional e/E exponent */
+        const char* ParseFloat(const char* p, const char* end, float& out);
+
+        /** returns mantissa * 10^exp10, used by parsers that collect the digits themselves */
+        float ComposeFloat(uint64_t mantissa, int32_t exp10, bool negative);
+
+    }
+
+}
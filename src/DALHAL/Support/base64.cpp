@@ -47,14 +47,14 @@ int b64urlDecode(uint8_t *dst, size_t dstSize, const char *src) {
     return o - dst; // number of bytes written
 }
 
-int b64urlDecode(uint8_t *dst, size_t dstSize, const DALHAL::ZeroCopyString& src) {
+int b64urlDecodeRaw(uint8_t *dst, size_t dstSize, const DALHAL::ZeroCopyString& src) {
     uint8_t *o = dst;
     uint8_t *end = dst + dstSize;
 
     int val = 0;
     int valb = -8;
     const char* srcEnd = src.end;
-    for (const char *c = src.start; *c && c < srcEnd; c++) {
+    for (const char *c = src.start; c < srcEnd && *c; c++) {
         if (*c == '\n' || *c == '\r' || *c == ' ')
             continue;
 
@@ -76,10 +76,30 @@ int b64urlDecode(uint8_t *dst, size_t dstSize, const DALHAL::ZeroCopyString& src
             valb -= 8;
         }
     }
-    *o = '\0'; // null terminate
     return o - dst; // number of bytes written
 }
 
+int b64urlDecodedLength(const DALHAL::ZeroCopyString& src) {
+    size_t chars = 0;
+    const char* srcEnd = src.end;
+    for (const char *c = src.start; c < srcEnd && *c; c++) {
+        if (*c == '\n' || *c == '\r' || *c == ' ')
+            continue;
+        if (*c == '=')
+            break;
+        if (b64urlCharToVal((uint8_t)*c) < 0)
+            return -1;
+        chars++;
+    }
+    return (int)(chars * 6 / 8);
+}
+
+int b64urlDecode(uint8_t *dst, size_t dstSize, const DALHAL::ZeroCopyString& src) {
+    int len = b64urlDecodeRaw(dst, dstSize, src);
+    if (len >= 0)
+        dst[len] = '\0'; // null terminate
+    return len;
+}
 
 String b64urlEncode(const uint8_t *data, size_t len) {
     
@@ -6,5 +6,9 @@
 
 int b64urlDecode(uint8_t *dst, size_t dstSize, const char *src);
 int b64urlDecode(uint8_t *dst, size_t dstSize, const DALHAL::ZeroCopyString& src);
+/** same as b64urlDecode but never writes past the decoded bytes (no null terminator), used when decoding into binary buffers */
+int b64urlDecodeRaw(uint8_t *dst, size_t dstSize, const DALHAL::ZeroCopyString& src);
+/** number of bytes b64urlDecodeRaw would write, or -1 on an invalid character, nothing is decoded */
+int b64urlDecodedLength(const DALHAL::ZeroCopyString& src);
 String b64urlEncode(const uint8_t *data, size_t len);
 String b64urlEncode(const char *str);
\ No newline at end of file
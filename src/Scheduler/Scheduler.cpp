@@ -23,7 +23,6 @@
 
 #include <TimeLib.h>
 
-#include <TimeAlarms.h>
 #include <ArduinoJson.h>
 #include <stdlib.h>
 #include <LittleFS.h>
@@ -40,12 +39,18 @@
 
 #include <DALHAL/Core/JsonConfig/DALHAL_ArduinoJSON_ext.h>
 
-AsStringParameter::AsStringParameter(const JsonVariant& json):OnTickExtParameters(0,1)
+AsStringParameter::AsStringParameter(const JsonVariant& json)
 {
-    str = json.as<const char*>();
+    const char* cStr = json.as<const char*>();
+    if (cStr != nullptr) str = cStr;
     //serializeJson(json, jsonStr);  // ArduinoJson overload writes directly into std::string
 }
 
+AsStringParameter::AsStringParameter(const char* cStr)
+{
+    if (cStr != nullptr) str = cStr;
+}
+
 namespace Scheduler
 {
     //WEBSERVER_TYPE *webserver = nullptr;
@@ -53,7 +58,7 @@ namespace Scheduler
     int FuncCount = 0;
     NameToFunction* nameToFuncList = nullptr;
 
-    TimeAlarmsClass *Scheduler = nullptr;
+    TimerWheel Wheel;
 
     // Define a lookup table for day abbreviations to corresponding enum values
     const DayLookupTable dayLookupTable[] = {
@@ -67,9 +72,18 @@ namespace Scheduler
     };
 
     void HandleAlarms() {
-        if (Scheduler != nullptr) Scheduler->delay(0);
-        //else // this happens when there are no file loaded, i.e. when a schedule file is not found
-        //    Serial.println("Scheduler is null");
+        Wheel.Advance(now());
+    }
+
+    time_t NextFire() {
+        return Wheel.NextFire();
+    }
+
+    uint32_t SecondsUntilNextFire() {
+        time_t next = Wheel.NextFire();
+        if (next == 0) return UINT32_MAX;
+        time_t t = now();
+        return (next > t) ? (uint32_t)(next - t) : 0;
     }
 
     bool LoadJson(const char* filePath)
@@ -99,26 +113,8 @@ namespace Scheduler
         size_t itemCount = jsonDoc.size();
         //printf(" items count: %d", itemCount);
         
-        // clear both timers and alarms (ALL)
-        //for (uint8_t id = 0; id < dtNBR_ALARMS; id++) {
-        //    Alarm.free(id);
-        //} this was the old way before dynamic allocated alarms
-
-        uint8_t nrOfActiveAlarms = 0;
-        for (uint8_t i = 0;i<itemCount;i++) {
-            if (jsonDoc[i].containsKey("disabled") == false) nrOfActiveAlarms++; 
-        }
-        if (Scheduler != nullptr) {
-            //if (Scheduler->getCurrentNrOfAlarms() < nrOfActiveAlarms) {
-                delete Scheduler; // delete old instance
-               // Scheduler = new TimeAlarmsClass(nrOfActiveAlarms);
-            //}
-            //else
-            //    Scheduler->clear()
-        }
-        //else // this happens only the very first time LoadJson is called
-
-        Scheduler = new TimeAlarmsClass(nrOfActiveAlarms);
+        // clear both timers and alarms (ALL), the wheel have no fixed size so there is nothing to count first
+        Wheel.Clear();
 
         // sync time with NTP server
         NTP::NTPConnect();
@@ -131,7 +127,7 @@ namespace Scheduler
         Serial.println(F("LoadJson - setTime"));
         setTime(now2.Hour+1, now2.Minute, now2.Second, now2.Day, now2.Month, year);
         Serial.println(F("LoadJson - parse items"));
-        for (uint8_t i = 0; i < itemCount; i++) {
+        for (size_t i = 0; i < itemCount; i++) {
             ParseItem(jsonDoc[i]);
         }
         //printf("TAFJ LJ E"); // TimeAlarmsFromJson LoadJson en
@@ -142,11 +138,6 @@ namespace Scheduler
 
     void ParseItem(const JsonVariant& json)
     {
-        //Alarm.alarmOnce();
-        //Alarm.alarmRepeat(); 
-        //Alarm.timerOnce(); // timer only
-        //Alarm.timerRepeat(); // timer only
-        //Alarm.triggerOnce(); // dtExplicitAlarm only
         if (json.containsKey("disabled") == true) return;
         //if (json["enabled"] == false) return;
 
@@ -156,34 +147,13 @@ namespace Scheduler
         {
             JsonBaseVars vars = GetJsonBaseVars(json);
             if (vars.funcName == nullptr) return;
-            //AlarmID_t id=-1;
-            if(json.containsKey("params")) {
-                AsStringParameter *params = new AsStringParameter(json["params"]);
-                /*id = */Scheduler->timerRepeat(vars.h,vars.m,vars.s, GetFunctionExt(vars.funcName), params);
-            }
-            else {
-                /*id = */Scheduler->timerRepeat(vars.h,vars.m,vars.s, GetFunction(vars.funcName));
-            }
-
-            //DEBUG_UART.printf("added timer repeat %d:%d:%d  now:%s   Scheduler->read(id):%s   Scheduler->getNextTrigger():%s   Scheduler->getNextTrigger(id):%s\r\n", vars.h, vars.m, vars.s, Time_ext::GetTimeAsString(now()).c_str(), Time_ext::GetTimeAsString(Scheduler->read(id)).c_str() , Time_ext::GetTimeAsString(Scheduler->getNextTrigger()).c_str(), Time_ext::GetTimeAsString(Scheduler->getNextTrigger(id)).c_str());
-        
+            AddEntry(json, vars.funcName, RepeatMode::Interval, 0, timeDayOfWeek_t::dowInvalid, vars.h*SECS_PER_HOUR + vars.m*SECS_PER_MIN + vars.s);
         }
         else if (strcasecmp(mode, "daily") == 0)
         {
             JsonBaseVars vars = GetJsonBaseVars(json);
             if (vars.funcName == nullptr) return;
-
-            AlarmID_t id=-1;
-            if(json.containsKey("params")) {
-                AsStringParameter *params = new AsStringParameter(json["params"]);
-                id = Scheduler->alarmRepeat(vars.h,vars.m,vars.s, GetFunctionExt(vars.funcName), params);
-            }
-            else {
-                id = Scheduler->alarmRepeat(vars.h,vars.m,vars.s, GetFunction(vars.funcName));
-            }
-            
-            //DEBUG_UART.printf("added timer daily %d:%d:%d  now:%s   Scheduler->read(id):%s   Scheduler->getNextTrigger():%s   Scheduler->getNextTrigger(id):%s\r\n", vars.h, vars.m, vars.s, Time_ext::GetTimeAsString(now()), Time_ext::GetTimeAsString(Scheduler->read(id)) , Time_ext::GetTimeAsString(Scheduler->getNextTrigger()), Time_ext::GetTimeAsString(Scheduler->getNextTrigger(id)));
-        
+            AddEntry(json, vars.funcName, RepeatMode::Daily, 0, timeDayOfWeek_t::dowInvalid, vars.h*SECS_PER_HOUR + vars.m*SECS_PER_MIN + vars.s);
         }
         else if (strcasecmp(mode, "weekly") == 0)
         {
@@ -192,15 +162,7 @@ namespace Scheduler
 
             if (json.containsKey("D") == false) return; // day of week
             timeDayOfWeek_t dow = GetTimerAlarmsDOW(json["D"]);
-
-            if(json.containsKey("params")) {
-                AsStringParameter *params = new AsStringParameter(json["params"]);
-                Scheduler->alarmRepeat(dow, vars.h,vars.m,vars.s, GetFunctionExt(vars.funcName), params);
-            }
-            else {
-                Scheduler->alarmRepeat(dow, vars.h,vars.m,vars.s, GetFunction(vars.funcName));
-            }
-            //DEBUG_UART.println("added alarm weekly");
+            AddEntry(json, vars.funcName, RepeatMode::Weekly, 0, dow, vars.h*SECS_PER_HOUR + vars.m*SECS_PER_MIN + vars.s);
         }
         else if (strcasecmp(mode, "explicit") == 0)
         {
@@ -214,33 +176,42 @@ namespace Scheduler
             tm.Minute = DALHAL::GetAsUINT32(json,"m", 0);
             tm.Second = DALHAL::GetAsUINT32(json,"s", 0);
             time_t dateTime = makeTime(tm);
-            if(json.containsKey("params")) {
-                //JsonVariant jsonVar = json["params"].as<JsonVariant>();
-                AsStringParameter *params = new AsStringParameter(json["params"]);
-                Scheduler->triggerOnce(dateTime, GetFunctionExt(funcName), params);
-            }
-            else {
-                Scheduler->triggerOnce(dateTime, GetFunction(funcName));
-            }
-            //DEBUG_UART.println("added alarm explicit");
+            AddEntry(json, funcName, RepeatMode::Once, dateTime, timeDayOfWeek_t::dowInvalid, 0);
         }
     }
 
-    OnTick_t GetFunction(const char* name) {
-        for (int i = 0; i < FuncCount; i++) {
-            if (strcasecmp(nameToFuncList[i].name, name) == 0)
-                return nameToFuncList[i].onTick;
+    bool AddEntry(const JsonVariant& json, const char* funcName, RepeatMode mode, time_t onceTime, timeDayOfWeek_t dow, uint32_t seconds) {
+        const NameToFunction* def = GetFunctionDef(funcName);
+        if (def == nullptr) return false;
+
+        if (json.containsKey("params")) {
+            if (def->onTickExt == nullptr) return false;
+            // resolve the params once here instead of every time the entry fires
+            const char* paramsStr = json["params"].as<const char*>();
+            OnTickExtParameters* params = (def->prepare != nullptr) ? def->prepare(paramsStr) : new AsStringParameter(paramsStr);
+            return Wheel.Add(mode, onceTime, dow, seconds, nullptr, def->onTickExt, params);
         }
-        return nullptr;
+        return Wheel.Add(mode, onceTime, dow, seconds, def->onTick, nullptr, nullptr);
     }
-    OnTickExt_t GetFunctionExt(const char* name) {
+
+    const NameToFunction* GetFunctionDef(const char* name) {
+        if (name == nullptr) return nullptr;
         for (int i = 0; i < FuncCount; i++) {
             if (strcasecmp(nameToFuncList[i].name, name) == 0)
-                return nameToFuncList[i].onTickExt;
+                return &nameToFuncList[i];
         }
         return nullptr;
     }
 
+    OnTick_t GetFunction(const char* name) {
+        const NameToFunction* def = GetFunctionDef(name);
+        return (def != nullptr) ? def->onTick : nullptr;
+    }
+    OnTickExt_t GetFunctionExt(const char* name) {
+        const NameToFunction* def = GetFunctionDef(name);
+        return (def != nullptr) ? def->onTickExt : nullptr;
+    }
+
     JsonBaseVars GetJsonBaseVars(const JsonVariant& json)
     {
         if (json.containsKey("func") == false) return {nullptr,0,0,0};
@@ -294,7 +265,8 @@ namespace Scheduler
                 return false;
             }
         } else if (zcCmd.EqualsIC(F(SCHEDULER_URL_GET_MAX_NUMBER_OF_ALARMS))) {
-            res = String(F("\"count\":\"")).c_str() + std::to_string(dtNBR_ALARMS) + '"';
+            // there is no fixed max anymore, report the number of loaded entries
+            res = String(F("\"count\":\"")).c_str() + std::to_string(Wheel.Count()) + '"';
             return true;
         } else if (zcCmd.EqualsIC(F(SCHEDULER_URL_GET_FUNCTION_NAMES))) {
             std::string jsonStr;
@@ -317,7 +289,7 @@ namespace Scheduler
             return true;
         } else if (zcCmd.EqualsIC(F(SCHEDULER_URL_GET_TIME))) {
             std::string nowstr = String(F("{\n\"now\":\"")).c_str() + Time_ext::GetTimeAsString(now());
-            nowstr += String(F("\",\"next trigger\":\"")).c_str() + Time_ext::GetTimeAsString(Scheduler->getNextTrigger());
+            nowstr += String(F("\",\"next trigger\":\"")).c_str() + Time_ext::GetTimeAsString(Wheel.NextFire());
             nowstr += '"'; nowstr += '}';
             res = nowstr;
             return true;
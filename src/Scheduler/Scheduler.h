@@ -25,7 +25,6 @@
 
 #include <TimeLib.h>
 
-#include <TimeAlarms.h>
 #include <ArduinoJson.h>
 #include <stdlib.h>
 #include <LittleFS.h>
@@ -40,10 +39,13 @@
 
 #include <DALHAL/Core/Types/DALHAL_ZeroCopyString.h>
 
+#include "TimerWheel.h"
+
 class AsStringParameter : public OnTickExtParameters
 {
 public:
     AsStringParameter(const JsonVariant& json);
+    AsStringParameter(const char* str);
     AsStringParameter() = delete;
     AsStringParameter(AsStringParameter&) = delete;
     std::string str;
@@ -65,10 +67,14 @@ namespace Scheduler
     };
     
 
+    /** converts the "params" string of a entry into what is given to onTickExt when it fires, called once when the schedule is loaded */
+    typedef OnTickExtParameters* (*OnTickExtPrepare_t)(const char* params);
+
     typedef struct NameToFunction {
         const char* name;
         OnTick_t onTick; // function pointer for simple non parameter callback
         OnTickExt_t onTickExt; // function pointer for ext parameter based callbacks
+        OnTickExtPrepare_t prepare; // optional, when nullptr the params are given as AsStringParameter
     } Name2Func;
 
     typedef struct JsonBaseVars {
@@ -79,19 +85,26 @@ namespace Scheduler
         JsonBaseVars(const char* funcName, int h, int m, int s): funcName(funcName), h(h),m(m),s(s) {}
     } JsonBaseVars;
 
-    extern TimeAlarmsClass *Scheduler;
+    extern TimerWheel Wheel;
 
     extern const DayLookupTable dayLookupTable[];
 
     bool LoadJson(const char* filePath);
     void ParseItem(const JsonVariant& json);
 
+    const NameToFunction* GetFunctionDef(const char* name);
     OnTick_t GetFunction(const char* name);
     OnTickExt_t GetFunctionExt(const char* name);
+    /** adds a entry for the function named by json "func", with the json "params" prepared if given */
+    bool AddEntry(const JsonVariant& json, const char* funcName, RepeatMode mode, time_t onceTime, timeDayOfWeek_t dow, uint32_t seconds);
 
     JsonBaseVars GetJsonBaseVars(const JsonVariant& json);
     timeDayOfWeek_t GetTimerAlarmsDOW(std::string sDOW);
     void HandleAlarms();
+    /** time of the next entry to fire, 0 if nothing is scheduled, can be used to sleep until then */
+    time_t NextFire();
+    /** seconds until NextFire, UINT32_MAX if nothing is scheduled */
+    uint32_t SecondsUntilNextFire();
     std::string GetShortFormDowListAsJson();
 
     bool parseCmd(DALHAL::ZeroCopyString& zcStr, std::string& res);
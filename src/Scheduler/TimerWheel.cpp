@@ -0,0 +1,230 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "TimerWheel.h"
+
+#include <string.h>
+
+namespace Scheduler
+{
+    TimerWheel::TimerWheel() {
+        memset(slots, 0, sizeof(slots));
+    }
+
+    TimerWheel::~TimerWheel() {
+        Clear();
+    }
+
+    void TimerWheel::Clear() {
+        TimerEntry* entry = owned;
+        while (entry != nullptr) {
+            TimerEntry* nextOwned = entry->nextOwned;
+            delete entry->params;
+            delete entry;
+            entry = nextOwned;
+        }
+        owned = nullptr;
+        memset(slots, 0, sizeof(slots));
+        current = 0;
+        count = 0;
+        nextFireValid = false;
+        clearGeneration++;
+    }
+
+    /* static */
+    bool TimerWheel::ComputeNext(TimerEntry& entry, time_t after) {
+        switch (entry.mode) {
+            case RepeatMode::Once:
+                entry.armed = entry.expires > after;
+                break;
+            case RepeatMode::Interval:
+                // keep the phase when possible so that a late tick don't drift the following ones
+                if (entry.expires != 0 && (entry.expires + (time_t)entry.seconds) > after) {
+                    entry.expires += entry.seconds;
+                } else {
+                    entry.expires = after + entry.seconds;
+                }
+                entry.armed = true;
+                break;
+            case RepeatMode::Daily: {
+                time_t t = previousMidnight(after) + entry.seconds;
+                if (t <= after) { t += SECS_PER_DAY; }
+                entry.expires = t;
+                entry.armed = true;
+                break;
+            }
+            case RepeatMode::Weekly: {
+                time_t t = previousSunday(after) + ((int)entry.dow - 1) * SECS_PER_DAY + entry.seconds;
+                if (t <= after) { t += SECS_PER_WEEK; }
+                entry.expires = t;
+                entry.armed = true;
+                break;
+            }
+        }
+        return entry.armed;
+    }
+
+    void TimerWheel::Place(TimerEntry* entry) {
+        time_t expires = entry->expires;
+        if (expires < current) { expires = current; } // already due, fire at the next step
+        uint64_t delta = (uint64_t)(expires - current);
+
+        int level = 0;
+        while (level < SCHEDULER_WHEEL_LEVELS && delta >= ((uint64_t)1 << (SCHEDULER_WHEEL_SLOT_BITS * (level + 1)))) {
+            level++;
+        }
+        if (level == SCHEDULER_WHEEL_LEVELS) {
+            // further away than the wheel covers, the top level slot cascade re-places it every lap until it's in range
+            level = SCHEDULER_WHEEL_LEVELS - 1;
+        }
+        int index = (int)(((uint64_t)expires >> (SCHEDULER_WHEEL_SLOT_BITS * level)) & (SCHEDULER_WHEEL_SLOTS - 1));
+        TimerEntry** list = &slots[level][index];
+        entry->prev = nullptr;
+        entry->next = *list;
+        if (*list != nullptr) { (*list)->prev = entry; }
+        *list = entry;
+    }
+
+    void TimerWheel::Cascade(int level, int index) {
+        TimerEntry* entry = slots[level][index];
+        slots[level][index] = nullptr;
+        while (entry != nullptr) {
+            TimerEntry* next = entry->next;
+            Place(entry);
+            entry = next;
+        }
+    }
+
+    void TimerWheel::Rearm(time_t now) {
+        memset(slots, 0, sizeof(slots));
+        current = now;
+        for (TimerEntry* entry = owned; entry != nullptr; entry = entry->nextOwned) {
+            entry->next = nullptr;
+            entry->prev = nullptr;
+            if (entry->armed == false) { continue; }
+            if (entry->mode == RepeatMode::Interval) { entry->expires = 0; }
+            if (ComputeNext(*entry, now - 1)) {
+                Place(entry);
+            }
+        }
+        nextFireValid = false;
+    }
+
+    bool TimerWheel::Fire(TimerEntry* entry) {
+        uint32_t generation = clearGeneration;
+        while (entry != nullptr) {
+            TimerEntry* next = entry->next;
+            entry->next = nullptr;
+            entry->prev = nullptr;
+
+            if (entry->onTickExt != nullptr) {
+                entry->onTickExt(entry->params);
+            } else if (entry->onTick != nullptr) {
+                entry->onTick();
+            }
+            // a callback may have reloaded the schedule, then every entry is gone
+            if (generation != clearGeneration) { return false; }
+
+            if (ComputeNext(*entry, current)) {
+                Place(entry);
+            }
+            entry = next;
+        }
+        nextFireValid = false;
+        return true;
+    }
+
+    bool TimerWheel::Add(RepeatMode mode, time_t onceTime, timeDayOfWeek_t dow, uint32_t seconds, OnTick_t onTick, OnTickExt_t onTickExt, OnTickExtParameters* params) {
+        bool invalid = (onTick == nullptr && onTickExt == nullptr) ||
+                       (mode == RepeatMode::Interval && seconds == 0) ||
+                       (mode == RepeatMode::Weekly && dow == timeDayOfWeek_t::dowInvalid) ||
+                       ((mode == RepeatMode::Daily || mode == RepeatMode::Weekly) && seconds >= (uint32_t)SECS_PER_DAY);
+        if (invalid) {
+            delete params;
+            return false;
+        }
+        time_t now = ::now();
+        if (count == 0 && current == 0) { current = now; }
+
+        TimerEntry* entry = new TimerEntry();
+        entry->mode = mode;
+        entry->dow = dow;
+        entry->seconds = seconds;
+        entry->expires = (mode == RepeatMode::Once) ? onceTime : 0;
+        entry->onTick = onTick;
+        entry->onTickExt = onTickExt;
+        entry->params = params;
+
+        // a Once entry exactly at 'now' still fires, repeating entries start at the next occurrence
+        if (ComputeNext(*entry, (mode == RepeatMode::Once) ? (now - 1) : now) == false) {
+            delete params;
+            delete entry;
+            return false;
+        }
+        entry->nextOwned = owned;
+        owned = entry;
+        count++;
+        Place(entry);
+        nextFireValid = false;
+        return true;
+    }
+
+    void TimerWheel::Advance(time_t now) {
+        if (count == 0) { return; }
+        if (now < current) {
+            // small backward steps are just waited out, large ones re-arm everything from the new time
+            if ((current - now) > SCHEDULER_WHEEL_MAX_CATCHUP_SECS) { Rearm(now); }
+            return;
+        }
+        if ((now - current) > SCHEDULER_WHEEL_MAX_CATCHUP_SECS) {
+            Rearm(now);
+        }
+        while (current <= now) {
+            const time_t t = current;
+            if ((t & (SCHEDULER_WHEEL_SLOTS - 1)) == 0) {
+                for (int level = 1; level < SCHEDULER_WHEEL_LEVELS; ++level) {
+                    int index = (int)(((uint64_t)t >> (SCHEDULER_WHEEL_SLOT_BITS * level)) & (SCHEDULER_WHEEL_SLOTS - 1));
+                    Cascade(level, index);
+                    if (index != 0) { break; }
+                }
+            }
+            int index = (int)(t & (SCHEDULER_WHEEL_SLOTS - 1));
+            TimerEntry* due = slots[0][index];
+            slots[0][index] = nullptr;
+            if (due != nullptr && Fire(due) == false) { return; }
+            current = t + 1;
+        }
+    }
+
+    time_t TimerWheel::NextFire() {
+        if (nextFireValid) { return nextFire; }
+        nextFire = 0;
+        for (TimerEntry* entry = owned; entry != nullptr; entry = entry->nextOwned) {
+            if (entry->armed && (nextFire == 0 || entry->expires < nextFire)) {
+                nextFire = entry->expires;
+            }
+        }
+        nextFireValid = true;
+        return nextFire;
+    }
+}
@@ -0,0 +1,127 @@
+/*
+  Dalhalla IoT — JSON-configured HAL/DAL + Script Engine
+  HAL = Hardware Abstraction Layer
+  DAL = Device Abstraction Layer
+
+  Provides IoT firmware building blocks for home automation and smart sensors.
+
+  Copyright (C) 2026 Jannik Svensson
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or 
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the 
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License 
+  along with this program. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <TimeLib.h>
+#include <stdint.h>
+
+/** parameters owned by a scheduled entry and given to the OnTickExt_t callback when it fires */
+class OnTickExtParameters
+{
+public:
+    virtual ~OnTickExtParameters() = default;
+};
+
+typedef void (*OnTick_t)();
+typedef void (*OnTickExt_t)(const OnTickExtParameters* param);
+
+/** 
+ * 1s resolution, 6 bits per level, so the 4 levels covers 64^4 s (~194 days), anything further away
+ * is kept in the top level slot of its expire time and re-placed each time that slot comes around
+ */
+#define SCHEDULER_WHEEL_LEVELS    4
+#define SCHEDULER_WHEEL_SLOT_BITS 6
+#define SCHEDULER_WHEEL_SLOTS     (1 << SCHEDULER_WHEEL_SLOT_BITS)
+/** if the clock jump more than this (NTP sync, long blocking operation) the entries are re-armed from the new time instead of stepping the wheel */
+#define SCHEDULER_WHEEL_MAX_CATCHUP_SECS 3600
+
+namespace Scheduler
+{
+    enum class RepeatMode : uint8_t {
+        /** fires once at a explicit date/time */
+        Once,
+        /** fires every seconds */
+        Interval,
+        /** fires every day at second of day */
+        Daily,
+        /** fires every week at dow + second of day */
+        Weekly
+    };
+
+    struct TimerEntry {
+        /** slot list links */
+        TimerEntry* next = nullptr;
+        TimerEntry* prev = nullptr;
+        /** list of every entry owned by the wheel */
+        TimerEntry* nextOwned = nullptr;
+
+        time_t expires = 0;
+        RepeatMode mode = RepeatMode::Once;
+        timeDayOfWeek_t dow = timeDayOfWeek_t::dowInvalid;
+        /** interval length for Interval, second of day for Daily/Weekly */
+        uint32_t seconds = 0;
+        /** false when a Once entry have fired */
+        bool armed = false;
+
+        OnTick_t onTick = nullptr;
+        OnTickExt_t onTickExt = nullptr;
+        /** owned */
+        OnTickExtParameters* params = nullptr;
+    };
+
+    /**
+     * hierarchical timer wheel (linux style cascading) for the schedule entries,
+     * there is no fixed number of entries, they are allocated when the schedule is loaded
+     * advancing one second is O(1) + the entries that fire/cascade at that second
+     */
+    class TimerWheel {
+    private:
+        TimerEntry* slots[SCHEDULER_WHEEL_LEVELS][SCHEDULER_WHEEL_SLOTS];
+        TimerEntry* owned = nullptr;
+        /** wheel time, every entry that expires before this have been handled */
+        time_t current = 0;
+        uint32_t count = 0;
+        /** changed by Clear so that a callback that reloads the schedule is detected while firing */
+        uint32_t clearGeneration = 0;
+
+        bool nextFireValid = false;
+        time_t nextFire = 0;
+
+        static bool ComputeNext(TimerEntry& entry, time_t now);
+        void Place(TimerEntry* entry);
+        void Cascade(int level, int index);
+        void Rearm(time_t now);
+        /** returns false if the wheel was cleared by a callback */
+        bool Fire(TimerEntry* list);
+
+    public:
+        TimerWheel();
+        ~TimerWheel();
+        TimerWheel(const TimerWheel&) = delete;
+        TimerWheel& operator=(const TimerWheel&) = delete;
+
+        void Clear();
+        /** 
+         * takes over params, returns false (and deletes params) if the entry
+         * can never fire (zero interval, invalid dow or a Once time that have passed)
+         */
+        bool Add(RepeatMode mode, time_t onceTime, timeDayOfWeek_t dow, uint32_t seconds, OnTick_t onTick, OnTickExt_t onTickExt, OnTickExtParameters* params);
+
+        void Advance(time_t now);
+
+        /** time of the next entry to fire, 0 if there are no armed entries */
+        time_t NextFire();
+        uint32_t Count() const { return count; }
+    };
+}
@@ -130,6 +130,86 @@ namespace LittleFS_ext
         return size;
     }
 
+    TextFileReader::~TextFileReader() {
+        close();
+    }
+
+    FileResult TextFileReader::open(const char* file_name) {
+        if (file_name == nullptr || strlen(file_name) == 0) {
+            return FileResult::FileNameEmpty;
+        }
+        close();
+        file = LittleFS.open(file_name, "r");
+        if (!file) {
+            return FileResult::FileNotFound;
+        }
+        if (file.size() == 0) {
+            file.close();
+            return FileResult::FileEmpty;
+        }
+        return FileResult::Success;
+    }
+
+    size_t TextFileReader::read(char* buffer, size_t maxCount) {
+        if (!file) return 0;
+        return file.readBytes(buffer, maxCount);
+    }
+
+    void TextFileReader::close() {
+        if (file) file.close();
+    }
+
+    FileWriter::~FileWriter() {
+        close();
+    }
+
+    static uint32_t changeCounter = 0;
+
+    void notify_changed() {
+        changeCounter++;
+    }
+
+    uint32_t change_counter() {
+        return changeCounter;
+    }
+
+    FileResult FileWriter::open(const char* file_name) {
+        if (file_name == nullptr || strlen(file_name) == 0) {
+            return FileResult::FileNameEmpty;
+        }
+        close();
+        file = LittleFS.open(file_name, "w");
+        notify_changed(); // "w" truncates, even if the open itself failed
+        if (!file) {
+            return FileResult::FileWriteError;
+        }
+        return FileResult::Success;
+    }
+
+    bool FileWriter::write(const uint8_t* data, size_t count) {
+        if (!file) return false;
+        return file.write(data, count) == count;
+    }
+
+    void FileWriter::close() {
+        if (!file) return;
+        file.close();
+        notify_changed(); // the content is complete now
+    }
+
+    bool rename_file(const char* from_file_name, const char* to_file_name) {
+        if (LittleFS.exists(to_file_name)) LittleFS.remove(to_file_name);
+        bool ok = LittleFS.rename(from_file_name, to_file_name);
+        notify_changed();
+        return ok;
+    }
+
+    bool remove_file(const char* file_name) {
+        bool ok = LittleFS.remove(file_name);
+        notify_changed();
+        return ok;
+    }
+
     void GetNrSpaces(Stream &printStream, int count, bool isHtml) {
         while (count-- > 0) {
             if (isHtml) printStream.printf_P(PSTR("&nbsp;"));
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <Arduino.h>
+#include <FS.h>
 #include <string>
 
 namespace LittleFS_ext
@@ -37,7 +38,8 @@ namespace LittleFS_ext
         FileEmpty,
         AllocFail,
         FileReadError,
-        BufferOverflowError
+        BufferOverflowError,
+        FileWriteError
     };
     enum class ListMode { PLAIN, HTML, JSON };
     /** --- Text loader (null-terminated, \n normalized) --- */
@@ -46,6 +48,44 @@ namespace LittleFS_ext
     FileResult load_binary_file(const char* file_name, uint8_t** outBuffer, size_t* outSize);
 
     int getFileSize(const char* file_name);
+
+    /** --- Block reader, used to stream a file without having it all resident (raw bytes, no modifications) --- */
+    class TextFileReader {
+    public:
+        TextFileReader() = default;
+        ~TextFileReader();
+        TextFileReader(const TextFileReader&) = delete;
+        TextFileReader& operator=(const TextFileReader&) = delete;
+
+        FileResult open(const char* file_name);
+        /** returns the number of bytes read, 0 at end of file */
+        size_t read(char* buffer, size_t maxCount);
+        void close();
+    private:
+        File file;
+    };
+
+    /** --- Block writer, used to store data as it arrives without having it all resident (truncates existing files) --- */
+    class FileWriter {
+    public:
+        FileWriter() = default;
+        ~FileWriter();
+        FileWriter(const FileWriter&) = delete;
+        FileWriter& operator=(const FileWriter&) = delete;
+
+        FileResult open(const char* file_name);
+        /** returns false if not all bytes could be written */
+        bool write(const uint8_t* data, size_t count);
+        void close();
+    private:
+        File file;
+    };
+    /** replaces to_file_name if it exists */
+    bool rename_file(const char* from_file_name, const char* to_file_name);
+    bool remove_file(const char* file_name);
+    /** --- Change tracking, lets callers cache file lookups (exists etc.) until something is written, renamed or removed, bump it after the change is done --- */
+    void notify_changed();
+    uint32_t change_counter();
     //void listDir(Stream &printStream, const char *dirname, uint8_t level);
     //void listDir(std::string &str, ListMode mode, const char *dirname, uint8_t level = 0);
 }
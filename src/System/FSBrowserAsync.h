@@ -38,6 +38,7 @@
 #endif
 //#include <AsyncTCP.h>
 #include <ESPAsyncWebServer.h>
+#include <Support/LittleFS_ext.h>
 
 
 
@@ -129,6 +130,7 @@ namespace FSBrowser {
         if (index == 0) {
             String filePath = dir + "/" + filename;
             fsUploadFile = LittleFS.open(filePath, "w");
+            LittleFS_ext::notify_changed();
             if (!fsUploadFile) {
                 Serial.println(F("Failed to open file for writing"));
                 request->send(500, FPSTR(TEXT_PLAIN), F("500: couldn't create file"));
@@ -146,6 +148,7 @@ namespace FSBrowser {
         if (final) {
             if (fsUploadFile) {
                 fsUploadFile.close();
+                LittleFS_ext::notify_changed();
                 Serial.printf_P(PSTR("Upload End: %s, total bytes: %u\n"), filename.c_str(), index + len);
 
                 // Redirect client
@@ -283,10 +286,14 @@ namespace FSBrowser {
             if (!filename.startsWith("/")) filename = "/" + filename;
             if (!selectFileSystemAndFixPath(filename)) { replyNotFound(request, F("FS NOT FOUND")); return; }
             uploadFile = fileSystem->open(filename, "w");
+            LittleFS_ext::notify_changed();
             if (!uploadFile) { request->send(500, FPSTR(TEXT_PLAIN), F("CREATE FAILED")); return; }
         }
         if (len && uploadFile) uploadFile.write(data, len);
-        if (final && uploadFile) uploadFile.close();
+        if (final && uploadFile) {
+            uploadFile.close();
+            LittleFS_ext::notify_changed();
+        }
     }
 
     void handleFileCreate(AsyncWebServerRequest *request) {
@@ -307,13 +314,16 @@ namespace FSBrowser {
             if (path.endsWith("/")) {
                 // Create a folder
                 path.remove(path.length() - 1);
-                if (!fileSystem->mkdir(path)) { return replyServerError(request, F("MKDIR FAILED")); }
+                bool ok = fileSystem->mkdir(path);
+                LittleFS_ext::notify_changed();
+                if (!ok) { return replyServerError(request, F("MKDIR FAILED")); }
                 replyOKWithMsg(request, path);
             } else {
             
                 File file = fileSystem->open(path, "w");
                 if (!file) return replyServerError(request, F("CREATE FAILED"));
                 file.close();
+                LittleFS_ext::notify_changed();
                 replyOKWithMsg(request, path.substring(0, path.lastIndexOf('/')));
             }
         } else {
@@ -325,7 +335,9 @@ namespace FSBrowser {
 
             if (path.endsWith("/")) { path.remove(path.length() - 1); }
             if (src.endsWith("/")) { src.remove(src.length() - 1); }
-            if (!fileSystem->rename(src, path)) { return replyServerError(request, F("RENAME FAILED")); }
+            bool ok = fileSystem->rename(src, path);
+            LittleFS_ext::notify_changed();
+            if (!ok) { return replyServerError(request, F("RENAME FAILED")); }
             replyOKWithMsg(request, src.substring(0, src.lastIndexOf('/')));
         }
     }
@@ -341,6 +353,7 @@ namespace FSBrowser {
         if (!fileSystem->exists(path)) return replyNotFound(request, FPSTR(FILE_NOT_FOUND));
         
         fileSystem->remove(path);
+        LittleFS_ext::notify_changed();
         replyOKWithMsg(request, path.substring(0, path.lastIndexOf('/')));
     }
 
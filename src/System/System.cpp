@@ -117,6 +117,10 @@ namespace System {
             DALHAL::CommandExecutor::g_pending.pop();
             CommandExecutor_UNLOCK_QUEUE();
 
+            if (pr.binary) {
+                DALHAL::BinaryCommand::Execute(pr.command, pr.clientId, pr.cb);
+                continue;
+            }
             DALHAL::ZeroCopyString zcCmd(pr.command.c_str());
             DALHAL::CommandExecutor::execute(zcCmd, pr.cb);
         }
@@ -234,6 +238,7 @@ namespace System {
                 ESP.restart();
             }
             failsafeLoop_API_exec_cmd();           
+            DALHAL::WebSocketAPI::loop(); // sends the queued responses
             delay(1);              // Prevent WDT reset
         }
     }
@@ -249,7 +254,9 @@ namespace System {
         });
         webserver.on(MAIN_URLS_FORMAT_LITTLE_FS, [](AsyncWebServerRequest* req) {
             
-            if (LittleFS.format()) {
+            bool formatted = LittleFS.format();
+            LittleFS_ext::notify_changed();
+            if (formatted) {
                 if (!LITTLEFS_BEGIN_FUNC_CALL) {
                     req->send(500, "text/html", "Format OK, but mount failed");
                     return;
@@ -100,24 +100,35 @@ void Timer_SyncTime() {
 }
 
 #if defined(DALHAL_H_)
+/** the halcmd is parsed once when the schedule is loaded, the device/function is resolved at the first fire */
+class HalCmdParameter : public OnTickExtParameters
+{
+public:
+    HalCmdParameter(const char* cmd) : cmd(cmd) {}
+    mutable DALHAL::PreparedCommand cmd;
+};
+
+OnTickExtParameters* Alarm_PrepareHalCmd(const char* params)
+{
+    return new HalCmdParameter(params);
+}
+
 void Alarm_SendToHalCmdExec(const OnTickExtParameters *param)
 {
     DEBUG_UART.println("Alarm_SendToHalCmdExec");
-    const AsStringParameter* casted_param = static_cast<const AsStringParameter*>(param);
+    const HalCmdParameter* casted_param = static_cast<const HalCmdParameter*>(param);
     if (casted_param != nullptr)
     {
-        DALHAL::ZeroCopyString zcCmd(casted_param->str.c_str());
-        //std::string dummy;
-        DALHAL::CommandExecutor::execute(zcCmd,nullptr);
+        casted_param->cmd.Execute();
     }
 }
 #endif
 
 Scheduler::NameToFunction nameToFunctionList[] = {
-//   name         , onTick            , onTickExt
-    {"ntp_sync"   , &Timer_SyncTime   , nullptr           }
+//   name         , onTick            , onTickExt               , prepare
+    {"ntp_sync"   , &Timer_SyncTime   , nullptr                 , nullptr             }
 #if defined(DALHAL_H_)
-    ,{"halcmd"     , nullptr           , &Alarm_SendToHalCmdExec}
+    ,{"halcmd"     , nullptr           , &Alarm_SendToHalCmdExec , &Alarm_PrepareHalCmd}
 #endif
 };
 
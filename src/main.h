@@ -61,7 +61,6 @@
 
 #include <TimeLib.h>
 
-#include <TimeAlarms.h>
 #include <Scheduler/Scheduler.h>
 
 #include <System/Info.h>
@@ -80,6 +79,7 @@
 #ifdef DALHAL_H_
 #include <DALHAL/ScriptEngine/DALHAL_SCRIPT_ENGINE.h>
 #include <DALHAL/API/DALHAL_CommandExecutor.h>
+#include <DALHAL/API/DALHAL_PreparedCommand.h>
 #endif
 
 //